@@ -1,20 +0,0 @@
-/*
-  ==============================================================================
-
-    AdsrData.cpp
-    Created: 7 Feb 2021 2:29:21pm
-    Author:  Joshua Hodge
-
-  ==============================================================================
-*/
-
-#include "AdsrData.h"
-
-void AdsrData::update (const float attack, const float decay, const float sustain, const float release)
-{
-    adsrParams.attack = attack;
-    adsrParams.decay = decay;
-    adsrParams.sustain = sustain;
-    adsrParams.release = release;
-    setParameters (adsrParams);
-}
@@ -38,6 +38,10 @@ public:
     // kill switch for rendering playing notes
     static constexpr bool tuningRendererPlayingNotes {true}; // true = huge cpu hit
 
+    // the audio thread interpolates the Morph tuning from the morph parameter every block, instead of
+    // reading the tuning table, which follows the parameter at the ui rate
+    static constexpr bool morphPerAudioBlock {true};
+
     // kill switch for the simple synth
     static constexpr bool enableSimpleSynth {true}; // false = render 0's in audio callback
 
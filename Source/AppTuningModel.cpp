@@ -10,6 +10,8 @@
 
 #include "AppTuningModel.h"
 #include "DesignsModel.h"
+#include "Morph.h"
+#include "MorphModel.h"
 #include "ok_color.h"
 #include "WilsonicProcessor.h"
 #include "WilsonicProcessorConstants.h"
@@ -145,6 +147,11 @@ void AppTuningModel::attachParameterListeners() {
     for (auto pid : getFavoritesParameterIDs()) {
         _apvts->addParameterListener (pid, this);
     }
+
+    // the audio thread reads the morph position directly, see _updateTuning
+    if(AppExperiments::morphPerAudioBlock) {
+        _scheduledTuning.setMorphPositionSource(_apvts->getRawParameterValue(MorphModel::getMorphInterpolationParameterID().getParamID()));
+    }
 }
 
 void AppTuningModel::detachParameterListeners() {
@@ -184,6 +191,9 @@ void AppTuningModel::updateProperties() {
 #pragma mark - set/get/update tuning
 
 void AppTuningModel::setTuning(shared_ptr<Tuning> inputTuning) {
+    // the message thread, and the audio thread when the host automates a design
+    const ScopedLock sl(_lock);
+
 #if DEBUG
     // NOP for tuning test overrides
     if (_overrideWithTuningTests) {
@@ -199,6 +209,7 @@ void AppTuningModel::setTuning(shared_ptr<Tuning> inputTuning) {
         _targetTuning = _defaultTuning12ET;
     } else { // change global to input tuning
         _targetTuning = inputTuning;
+        const Tuning::ScopedUpdate su(*_targetTuning); // one recompute for all five setters
         _targetTuning->setOctaveMiddleC(static_cast<int>(uiGetOctaveMiddleC()));
         _targetTuning->setNoteNumberMiddleC(static_cast<unsigned long>(uiGetNoteNumberMiddleC()));
         _targetTuning->setFrequencyMiddleC(uiGetFrequencyMiddleC());
@@ -219,50 +230,97 @@ shared_ptr<Tuning> AppTuningModel::getTuning() {
 
 void AppTuningModel::_updateTuning() {
     const ScopedLock sl(_lock);
+
+    // the audio thread reads the tuning from this snapshot
+    TuningSnapshot snapshot;
+    for(unsigned long nn = 0; nn < WilsonicProcessorConstants::numMidiNotes; nn++) {
+        snapshot.frequencies[nn] = _targetTuning->getTuningTableFrequency(nn);
+        snapshot.filterNotes[nn] = _targetTuning->getFilterNoteAtNoteNumber(nn);
+    }
+    snapshot.npo = _targetTuning->getProcessedArrayNPOCount();
+    snapshot.period = _targetTuning->getOctave();
+    if(AppExperiments::morphPerAudioBlock) {
+        // the morph reaches this method at the ui rate, so the audio thread interpolates per block instead
+        if(auto const morph = dynamic_pointer_cast<Morph>(_targetTuning)) {
+            snapshot.morphIsEnabled = true;
+            snapshot.morphInterpolation = morph->getInterpolationType();
+            snapshot.morphPath = morph->getMorphPath();
+        }
+    }
+
+    // the audio thread plays it from the start of the next block it renders, never from within a render
+    _scheduledTuning.schedule(snapshot);
+
     bool const registered_as_mts_esp_source = _processor.getMtsEspStatus() == WilsonicProcessor::MTS_ESP_Status::Registered;
-    auto const tuningName = _targetTuning->getTuningName();
     if(registered_as_mts_esp_source) {
+        _publishTuningToMtsEsp(snapshot);
+    } else {
+        // send everything once we are registered
+        _publishedTuningIsValid = false;
+    }
+
+    // descriptions and colors are rebuilt on the ui timer, or when read
+    _tuningTableUIIsStale = true;
+}
+
+void AppTuningModel::resendTuningToMtsEsp() {
+    const ScopedLock sl(_lock);
+    _publishedTuningIsValid = false;
+    _updateTuning();
+}
+
+/**
+ * @brief Sends the tuning table to MTS-ESP, but only the notes that changed since the last send.
+ *
+ * Every MTS_ call is an IPC write that every connected client reacts to, so continuous automation
+ * (i.e., a morph sweep) that changes only some notes, or only middle C, sends only those notes.
+ */
+void AppTuningModel::_publishTuningToMtsEsp(const TuningSnapshot& snapshot) {
 #if JUCE_IOS || JUCE_ANDROID
-        //NOP
+    // NOP
 #else
-        auto const tuningNameCstr = tuningName.c_str();
-        MTS_SetScaleName(tuningNameCstr);
+    const ScopedLock sl(_lock);
+    auto const wasValid = _publishedTuningIsValid; // i.e., false for a new MTS-ESP session, which has none of our table
+    auto const tuningName = _targetTuning->getTuningName();
+    if(!wasValid || tuningName != _publishedScaleName) {
+        MTS_SetScaleName(tuningName.c_str());
+        _publishedScaleName = tuningName;
+    }
+    if(!wasValid) {
         MTS_ClearNoteFilter();
-#endif
+        _publishedFilterNotes.reset();
     }
 
-    // MTS frequencies
+    // diff against the last table sent
+    _changedNotes.reset();
+    auto const& frequencies = snapshot.frequencies;
+    auto const& filterNotes = snapshot.filterNotes;
     for(unsigned long nn = 0; nn < WilsonicProcessorConstants::numMidiNotes; nn++) {
-        // microtone at this note number
-        auto microtone = _targetTuning->microtoneAtNoteNumber(nn);
-        if(registered_as_mts_esp_source) {
-#if JUCE_IOS || JUCE_ANDROID
-            // NOP
-#else
-            auto const cnn = static_cast<char>(nn);
-            auto const f = _targetTuning->getTuningTableFrequency(nn);
-            MTS_SetNoteTuning(f, cnn); // both synth and midi efx
-            if(microtone->getFilterNote()) {
-                MTS_FilterNote(true, cnn, 0);
-            }
-#endif
+        if(!wasValid || frequencies[nn] != _publishedFrequencies[nn] || filterNotes[nn] != _publishedFilterNotes[nn]) {
+            _changedNotes.set(nn);
         }
+    }
+    _publishedTuningIsValid = true;
+    if(_changedNotes.none()) {
+        return;
+    }
 
-        // descriptions
-        auto shortDescription = microtone->getShortDescriptionText();
-        _setTuningTableShortDescription(shortDescription, nn);
-        auto shortDescription2 = microtone->getShortDescriptionText2();
-        _setTuningTableShortDescription2(shortDescription2, nn);
-        auto centsDescription = microtone->getCentsValueDescription();
-        _setTuningTableCentsDescription(centsDescription, nn);
-        
-        // color
-        auto const p01 = microtone->getPitchValue01();
-        auto color = microtone->getFilterNote() ? Colours::grey : colorForPitch01(p01); // grey for filtered notes
-        _setTuningTableColor(color, nn);
+    // send only the changed notes
+    for(unsigned long nn = 0; nn < WilsonicProcessorConstants::numMidiNotes; nn++) {
+        if(!_changedNotes[nn]) {
+            continue;
+        }
+        auto const cnn = static_cast<char>(nn);
+        if(!wasValid || frequencies[nn] != _publishedFrequencies[nn]) {
+            MTS_SetNoteTuning(frequencies[nn], cnn); // both synth and midi efx
+            _publishedFrequencies[nn] = frequencies[nn];
+        }
+        if(filterNotes[nn] != _publishedFilterNotes[nn]) {
+            MTS_FilterNote(filterNotes[nn], cnn, 0);
+            _publishedFilterNotes[nn] = filterNotes[nn];
+        }
     }
-    
-    
+
 #if 0
     // this worked with jun-6 v, but not with pianoteq
     // temp test for mts channels
@@ -281,9 +339,41 @@ void AppTuningModel::_updateTuning() {
         MTS_SetMultiChannel(false, c);
     }
 #endif
+#endif
+}
+
+/**
+ * @brief Rebuilds the per-note descriptions and colors used by the ui.
+ *
+ * This is string and color work that MTS-ESP and the synth don't need, so it is not done on every
+ * tuning update, only when the (throttled) ui update fires, or when a getter finds it stale.
+ */
+void AppTuningModel::_updateTuningTableUI() {
+    const ScopedLock sl(_lock);
+    if(!_tuningTableUIIsStale) {
+        return;
+    }
+    _tuningTableUIIsStale = false;
+    for(unsigned long nn = 0; nn < WilsonicProcessorConstants::numMidiNotes; nn++) {
+        // microtone at this note number
+        auto microtone = _targetTuning->microtoneAtNoteNumber(nn);
 
+        // descriptions
+        auto shortDescription = microtone->getShortDescriptionText();
+        _setTuningTableShortDescription(shortDescription, nn);
+        auto shortDescription2 = microtone->getShortDescriptionText2();
+        _setTuningTableShortDescription2(shortDescription2, nn);
+        auto centsDescription = microtone->getCentsValueDescription();
+        _setTuningTableCentsDescription(centsDescription, nn);
+        
+        // color
+        auto const p01 = microtone->getPitchValue01();
+        auto color = microtone->getFilterNote() ? Colours::grey : colorForPitch01(p01); // grey for filtered notes
+        _setTuningTableColor(color, nn);
+    }
 }
 
+
 #pragma mark - Frequency
 
 float AppTuningModel::getTuningTableFrequency(unsigned long nn) {
@@ -297,12 +387,19 @@ unsigned long AppTuningModel::getTuningTableNPO() {
     return _targetTuning->getProcessedArrayNPOCount();
 }
 
+// Snapshot
+
+ScheduledTuning& AppTuningModel::getScheduledTuning() {
+    return _scheduledTuning;
+}
+
 #pragma mark - Color
 
 void AppTuningModel::setPitchColorOffset(float offset01) {
     _pitchColorOffset01 = jlimit(0.f, 1.f, offset01);
     _processor.savePitchColorOffset(_pitchColorOffset01);
-    _updateTuning(); // updates color for each midi note
+    const ScopedLock sl(_lock);
+    _tuningTableUIIsStale = true; // updates color for each midi note
 }
 
 float AppTuningModel::getPitchColorOffset() {
@@ -381,6 +478,7 @@ void AppTuningModel::_setTuningTableColor(Colour c, unsigned long nn) {
 }
 
 Colour AppTuningModel::getTuningTableColor(unsigned long nn) {
+    _updateTuningTableUI();
     auto const i = jlimit<unsigned long>(0, 127, nn);
     auto const retVal = _tuningTableColor[i];
     return retVal;
@@ -403,6 +501,7 @@ void AppTuningModel::_setTuningTableShortDescription(string desc, unsigned long
 
 string AppTuningModel::getTuningTableShortDescription(unsigned long nn) {
     jassert(nn < WilsonicProcessorConstants::numMidiNotes);
+    _updateTuningTableUI();
 
     return _tuningTableShortDescription[nn];
 }
@@ -414,6 +513,7 @@ void AppTuningModel::_setTuningTableShortDescription2(string desc, unsigned long
 
 string AppTuningModel::getTuningTableShortDescription2(unsigned long nn) {
     jassert(nn < WilsonicProcessorConstants::numMidiNotes);
+    _updateTuningTableUI();
     return _tuningTableShortDescription2[nn];
 }
 
@@ -424,6 +524,7 @@ void AppTuningModel::_setTuningTableCentsDescription(string desc, unsigned long
 
 string AppTuningModel::getTuningTableCentsDescription(unsigned long nn) {
     jassert(nn < WilsonicProcessorConstants::numMidiNotes);
+    _updateTuningTableUI();
     return _tuningTableCentsDescription[nn];
 }
 
@@ -528,6 +629,7 @@ void AppTuningModel::uiSetOctaveMiddleC(int value) {
 #pragma mark - ActionBroadcaster
 
 void AppTuningModel::_tuningChangedUpdateUI() {
+    _updateTuningTableUI(); // throttled: at most once per ui update
     sendActionMessage(DesignsModel::getAppTuningChangedActionMessage()); // UNUSED
     sendActionMessage(getAppTuningModelChangedMessage()); // very much used
 }
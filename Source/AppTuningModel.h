@@ -14,6 +14,8 @@
 #include "AppVersion.h"
 #include "PresetsModel.h"
 #include "TuningImp.h"
+#include "ScheduledTuning.h"
+#include "TuningSnapshot.h"
 #include "TuningTableImp.h"
 #include "Tuning_Include.h"
 
@@ -55,12 +57,12 @@ private:
 public:
     // ModelBase
     void setApvts(shared_ptr<AudioProcessorValueTreeState>);
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    String getGroupID();
+    String getGroupName();
+    String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // key for this design's Favorites array
     StringArray getFavoritesParameterIDs() override; // used for Favorites
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;    
+    unique_ptr<AudioProcessorParameterGroup> createParams();    
     void attachParameterListeners() override;
     void detachParameterListeners() override;
     void parameterChanged(const String& parameterID, float newValue) override;
@@ -76,6 +78,9 @@ public:
     // NPO
     unsigned long getTuningTableNPO();
 
+    // lock-free copy of the tuning table as the audio thread plays it: changes applied at block boundaries
+    ScheduledTuning& getScheduledTuning();
+
     // Color
 
     // input frequency is in Hz
@@ -117,6 +122,9 @@ public:
     float uiGetOctaveMiddleC();
     void uiSetOctaveMiddleC(int o);
 
+    // MTS-ESP: forget the last table sent, and send every note again, i.e., after (re)registering
+    void resendTuningToMtsEsp();
+
     // for debug builds only
     void setOverrideWithTuningTests();
 
@@ -136,8 +144,21 @@ private:
     static constexpr unsigned long _numInterpolationSteps = 20; // 20 / 80 = 0.25s
     static constexpr int _interpolationTimerHz = 80; // 48000 samples per second / 512 sample per render block
     TuningTableImp _interpolatedTable {};
+    ScheduledTuning _scheduledTuning {};
     void _updateTuning();
 
+    // MTS-ESP: the last table sent, so that only the notes that changed are sent
+    array<float, WilsonicProcessorConstants::numMidiNotes> _publishedFrequencies {};
+    bitset<WilsonicProcessorConstants::numMidiNotes> _publishedFilterNotes {};
+    bitset<WilsonicProcessorConstants::numMidiNotes> _changedNotes {}; // notes that differ from the last table sent
+    string _publishedScaleName {""};
+    bool _publishedTuningIsValid = false; // false => the next publish sends every note
+    void _publishTuningToMtsEsp(const TuningSnapshot& snapshot);
+
+    // descriptions and colors are only needed by the ui, so they are rebuilt on the ui timer, or when read
+    bool _tuningTableUIIsStale = true;
+    void _updateTuningTableUI();
+
     // Colour
     void _setTuningTableColor(Colour c, unsigned long index);
     array<Colour, WilsonicProcessorConstants::numMidiNotes> _tuningTableColor{};
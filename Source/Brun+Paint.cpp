@@ -59,6 +59,7 @@ void Brun::paint(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bound
 // Function to paint the Cartesian representation of the Brun object
 void Brun::_paintCartesian(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bounds) {
     const ScopedLock sl(_lock);
+    _updateAllLevels();
     g.saveState();
     _paintHelper(processor, g, bounds);
     auto const levelCount = getLabelArray().size();
@@ -335,6 +336,11 @@ void Brun::_paintGral(WilsonicProcessor& processor, Graphics& g, Rectangle<int>
     // Get the global transform for all drawing and mouse events
     auto const finalGralPaintTransform = Brun::_gralPaintTransform(); // we're locked in for the rest of this method
 
+#if JucePlugin_IsSynth
+    // One frame of voice states for every note of this paint
+    auto const& vs = processor.getVoiceStates();
+#endif
+
     // Iterate over the sorted scale, draw as hexagons
     for (unsigned long i = 0; i < WilsonicProcessorConstants::numMidiNotes; i++) {
         BrunMicrotone* note_mt = dynamic_cast<BrunMicrotone*>(microtoneAtNoteNumber(i).get());
@@ -348,10 +354,9 @@ void Brun::_paintGral(WilsonicProcessor& processor, Graphics& g, Rectangle<int>
         bool voice_is_playing = false;
         auto voice_rms = 0.f;
 #if JucePlugin_IsSynth
-        // If the plugin is a synth, get the voice states
-        auto vs = processor.getVoiceStates();
+        // If the plugin is a synth, use the voice states
         if(!vs.noVoicesPlaying()) {
-            for (unsigned long vsi = 0; vsi < WilsonicProcessorConstants::numVoices; vsi++) {
+            for (unsigned long vsi = 0; vsi < WilsonicProcessorConstants::maxVoices; vsi++) {
                 auto const v = vs.voiceState[vsi];
                 auto const nnv = v.nn;
                 if (nnv == note_mt->getMidiNoteNumber()) {
@@ -94,9 +94,12 @@ void Brun::_brunUpdate() {
     // Lock
     const ScopedLock sl(_lock);
 
+    // the level structure of the generator, computed once per generator
+    _levels = _levelsForGenerator(_generator);
+
     // Brun Array.  i.e., 0/1,1/2,2/3,3/5,4/7,7/12,...
-    _brunArray = make_shared<MicrotoneArray>(Brun::brunArray(_maxLevel, _generator));
-    
+    _updateBrunArray();
+
     // brun scale at the current level, to clamp murchana
     auto microtoneArray = _microtoneArrayBrun(_level, _generator, _murchana); // clamps _murchana
     
@@ -107,35 +110,12 @@ void Brun::_brunUpdate() {
     // microtoneArrayBrun calculates properly with _murchana via an internal working variable.  updated on range here
     _murchana = _murchana % microtoneArray.count();
     
-    // now calculate brun scale at max level
-    auto microtoneArrayAll = _microtoneArrayBrun(Brun::absoluteMaxLevel, _generator, _murchana); // _murchana mod is <= than at _level
-    
-    // create empty level arrays
-    for (auto l = Brun::absoluteMinLevel; l <= Brun::absoluteMaxLevel; l++) {
-        _microtoneArrayBrunAllLevels[l] = make_shared<MicrotoneArray>();
-    }
-
-    // populate the level arrays from the max level array
-    for (unsigned long i = 0; i < microtoneArrayAll.count(); i++) {
-        auto mt = microtoneArrayAll.microtoneAtIndex(i);
-        auto mtb = static_pointer_cast<BrunMicrotone>(mt);
-        jassert(mtb != nullptr);
-        
-        // populate the level arrays
-        for (auto l = Brun::absoluteMinLevel; l <= Brun::absoluteMaxLevel; l++) {
-            auto const level = mtb->getLevel();
-            if (level <= l) {
-                _microtoneArrayBrunAllLevels[l]->addMicrotone(mtb);
-            }
-        }
-    }
-
-    // Label Array
-    _labelArray.clear();
-    for (unsigned long index = 0; index < _brunArray->count(); index++) {
-        auto const t = _brunArray->microtoneAtIndex(index);
-        _labelArray.push_back(t->getShortDescriptionText());
+    // the brun scale at max level is only drawn, so _updateAllLevels() builds it when it is painted
+    if (_autoSetMurchana) {
+        _murchana = _levels->getNotesPerPeriod(Brun::absoluteMaxLevel) / 2;
     }
+    _allLevelsMurchana = _murchana; // _murchana mod is <= than at _level
+    _allLevelsAreStale = true;
 
     // The microtoneArray is an array of BrunMicrotones. Calculate their gral mapping here.
     // Declare variables for the first, second, and third microtones
@@ -195,6 +175,64 @@ void Brun::_brunUpdate() {
     setTuningDescription(stringStream.str());
 }
 
+// Function to rebuild the Brun Array and its labels when the generator or max level changed
+void Brun::_updateBrunArray() {
+    // Lock
+    const ScopedLock sl(_lock);
+
+    if (_brunArray != nullptr && _brunArray->count() == _maxLevel + 1 && _brunArrayLevels == _levels) {
+        return;
+    }
+    _brunArrayLevels = _levels;
+
+    // as Brun::brunArray(_maxLevel, _generator)
+    _brunArray = make_shared<MicrotoneArray>();
+    for (auto l = Brun::absoluteMinLevel; l <= _maxLevel; l++) {
+        auto const& ratio = _levels->getRatio(l);
+        _brunArray->addMicrotone(make_shared<Microtone>(ratio.num, ratio.den));
+    }
+
+    // Label Array
+    _labelArray.clear();
+    for (unsigned long index = 0; index < _brunArray->count(); index++) {
+        auto const t = _brunArray->microtoneAtIndex(index);
+        _labelArray.push_back(t->getShortDescriptionText());
+    }
+}
+
+// Function to rebuild the level arrays from the brun scale at max level
+void Brun::_updateAllLevels() {
+    // Lock
+    const ScopedLock sl(_lock);
+
+    if (!_allLevelsAreStale) {
+        return;
+    }
+    _allLevelsAreStale = false;
+    auto const npo = _levels->getNotesPerPeriod(Brun::absoluteMaxLevel);
+    auto microtoneArrayAll = _microtoneArrayBrun(*_levels, Brun::absoluteMaxLevel, _allLevelsMurchana % npo);
+
+    // create empty level arrays
+    for (auto l = Brun::absoluteMinLevel; l <= Brun::absoluteMaxLevel; l++) {
+        _microtoneArrayBrunAllLevels[l] = make_shared<MicrotoneArray>();
+    }
+
+    // populate the level arrays from the max level array
+    for (unsigned long i = 0; i < microtoneArrayAll.count(); i++) {
+        auto mt = microtoneArrayAll.microtoneAtIndex(i);
+        auto mtb = static_pointer_cast<BrunMicrotone>(mt);
+        jassert(mtb != nullptr);
+
+        // populate the level arrays
+        for (auto l = Brun::absoluteMinLevel; l <= Brun::absoluteMaxLevel; l++) {
+            auto const level = mtb->getLevel();
+            if (level <= l) {
+                _microtoneArrayBrunAllLevels[l]->addMicrotone(mtb);
+            }
+        }
+    }
+}
+
 #pragma mark - description
 
 // Function to print the Brun object
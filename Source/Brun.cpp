@@ -311,22 +311,33 @@ MicrotoneArray Brun::_microtoneArrayBrun(unsigned long l, float g01, unsigned lo
     // don't need to assert murchana because we'll clamp it below
 
     //
-    MicrotoneArray scaleDegrees;
-    auto brunArray = Brun::brunArray(l, g01);
-    auto brun = Brun::brun(l, g01);
-    auto const numScaleDegrees = brun->getDenominator();
-    auto level = absoluteMinLevel;
-    unsigned long brunIndex = 0;
+    auto const levels = _levelsForGenerator(g01);
+    auto const numScaleDegrees = levels->getNotesPerPeriod(l);
 
     // this is an unusual pattern...auto set and display mode are not automated but murchana is.
     if (_autoSetMurchana) {
         _murchana = numScaleDegrees / 2;
         inMurchana = _murchana;
     }
-    auto const murchana = static_cast<float>(inMurchana % numScaleDegrees);
 
+    return _microtoneArrayBrun(*levels, l, inMurchana % numScaleDegrees);
+}
+
+/**
+ * @brief Returns the scale at a level, sliced from the generator's level structure.
+ * @param levels The level structure of the generator.
+ * @param l The level.
+ * @param murchana The Murchana, less than the number of scale degrees.
+ * @return A MicrotoneArray of BrunMicrotones.
+ */
+MicrotoneArray Brun::_microtoneArrayBrun(const BrunLevels& levels, unsigned long l, unsigned long murchana) {
+    auto const g01 = levels.getGenerator();
+    auto const numScaleDegrees = levels.getNotesPerPeriod(l);
+    jassert(murchana < numScaleDegrees);
+    auto const m = static_cast<float>(murchana);
+    MicrotoneArray scaleDegrees;
     for (unsigned long i = 0; i < numScaleDegrees; i++) {
-        auto degree = static_cast<int>(static_cast<float>(i) - murchana);
+        auto degree = static_cast<int>(static_cast<float>(i) - m);
         auto p = static_cast<float>(degree) * g01;
         jassert(!std::isnan(p) && !std::isinf(p));
         while (p < 0.f) {
@@ -336,26 +347,31 @@ MicrotoneArray Brun::_microtoneArrayBrun(unsigned long l, float g01, unsigned lo
             p -= 1.f;
         }
         jassert(p >= 0.f && p <= 1.f);
-        auto m = make_shared<BrunMicrotone>(p, degree, level);
-        scaleDegrees.addMicrotone(m);
-
-        // don't advance "level" at the end of the scale
-        if (i == numScaleDegrees - 1)
-            break;
-
-        // advance "level" if we have passed the number of notes in the denominator of the current level
-        auto const brunNumber = brunArray.microtoneAtIndex(brunIndex);
-        auto const den = brunNumber->getDenominator();
-        if (i + 1 == den) {
-            level++;
-            brunIndex++;
-            brunIndex = min(brunIndex, brunArray.count() - 1);
-        }
+        scaleDegrees.addMicrotone(make_shared<BrunMicrotone>(p, degree, levels.getDegreeLevel(l, i)));
     }
 
     return scaleDegrees;
 }
 
+/**
+ * @brief Returns the level structure of a generator, from the cache if it was used recently.
+ * @param generator The generator.
+ * @return The level structure, for every level up to absoluteMaxLevel.
+ */
+shared_ptr<const BrunLevels> Brun::_levelsForGenerator(float generator) {
+    const ScopedLock sl(_lock);
+    if (_levels != nullptr && _levels->getGenerator() == generator) {
+        return _levels;
+    }
+    if (auto cached = _levelsCache.find(generator)) {
+        return *cached;
+    }
+    auto levels = make_shared<const BrunLevels>(generator, absoluteMaxLevel);
+    _levelsCache.put(generator, levels);
+
+    return levels;
+}
+
 #pragma mark - instance methods
 
 /**
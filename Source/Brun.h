@@ -10,6 +10,8 @@
 
 #include <JuceHeader.h>
 #include "Tuning_Include.h"
+#include "BrunLevels.h"
+#include "LruCache.h"
 #include "Microtone.h"
 #include "MicrotoneArray.h"
 #include "Tuning.h"
@@ -118,6 +120,7 @@ private:
     static MicrotoneArray __harmonicLimitCartesian; // A MicrotoneArray representing the harmonic limit in Cartesian coordinates.
     static MicrotoneArray __harmonicLimitHorogram; // A MicrotoneArray representing the harmonic limit in a horogram.
     static MicrotoneArray __harmonicLimitHorogramInverse; // A MicrotoneArray representing the harmonic limit in an inverse horogram.
+    static constexpr size_t __levelsCacheSize {16}; // Recent generators, i.e., automation going back and forth.
 
     // Brun implementation parameters
     unsigned long _maxLevel = 6; // The maximum level of the Brun object.
@@ -128,13 +131,22 @@ private:
     bool _autoSetMurchana = false; // Whether the Murchana is set automatically.
     DisplayMode _displayMode = DisplayMode::Cartesian; // The current display mode of the Brun object.
     shared_ptr<MicrotoneArray> _brunArray = nullptr; // A pointer to a MicrotoneArray representing the Brun array.
-    vector<shared_ptr<MicrotoneArray>> _microtoneArrayBrunAllLevels {10, nullptr}; // A vector of pointers to MicrotoneArrays representing all levels of the Brun object.
+    vector<shared_ptr<MicrotoneArray>> _microtoneArrayBrunAllLevels {10, nullptr}; // A vector of pointers to MicrotoneArrays representing all levels of the Brun object.  Built by _updateAllLevels().
+    bool _allLevelsAreStale = true; // Only the Cartesian display draws all levels, so they are built when it paints.
+    unsigned long _allLevelsMurchana = 0; // The murchana of the max level scale, as of the last _brunUpdate().
+    shared_ptr<const BrunLevels> _levels = nullptr; // The level structure of _generator.
+    shared_ptr<const BrunLevels> _brunArrayLevels = nullptr; // The level structure _brunArray was made from.
+    LruCache<float, shared_ptr<const BrunLevels>> _levelsCache {__levelsCacheSize}; // By generator.
     vector<string> _labelArray {}; // An array of labels for the scale degrees.
     shared_ptr<vector<int>> _gral_column_pattern; // A pointer to a vector representing the column pattern of the Gral display.
     
     // private methods
     void _brunUpdate(); // Updates gral after a change in parameters, before TuningImp::update
     MicrotoneArray _microtoneArrayBrun(unsigned long level, float generator, unsigned long murchana); // Returns a MicrotoneArray representing a Brun array for a given level, generator, and Murchana.
+    MicrotoneArray _microtoneArrayBrun(const BrunLevels& levels, unsigned long level, unsigned long murchana); // Slices levels into the scale at level, murchana already reduced.
+    shared_ptr<const BrunLevels> _levelsForGenerator(float generator); // Cached.
+    void _updateBrunArray(); // Rebuilds _brunArray and _labelArray if the generator or max level changed.
+    void _updateAllLevels(); // Rebuilds _microtoneArrayBrunAllLevels if they are stale.
     void _paintCartesian(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bounds); // Paints the Brun object in Cartesian coordinates.
     void _paintHorogram(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bounds); // Paints the Brun object in a horogram.
     void _paintInverseHorogram(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bounds); // Paints the Brun object in an inverse horogram.
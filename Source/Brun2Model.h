@@ -52,10 +52,10 @@ public:
     shared_ptr<Tuning> getTuning() override;
 
     // called only once: on construction of processor
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    static unique_ptr<AudioProcessorParameterGroup> createParams();
+    static String getGroupID();
+    static String getGroupName();
+    static String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // key for this design's Favorites array
     StringArray getFavoritesParameterIDs() override; // used for Favorites
     void attachParameterListeners() override;// called only once: when assigning _avpts
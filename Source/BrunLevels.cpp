@@ -0,0 +1,87 @@
+/**
+ * @file BrunLevels.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the BrunLevels class.
+ */
+
+#include "BrunLevels.h"
+#include <algorithm>
+#include <numeric>
+#include <JuceHeader.h>
+
+#pragma mark - lifecycle
+
+BrunLevels::BrunLevels(float generator, unsigned long maxLevel)
+: _generator(generator)
+, _maxLevel(maxLevel) {
+    jassert(generator >= 0.f && generator <= 1.f);
+
+    // the ratios, as Brun::brunArray()
+    float mosA = 1.f;
+    float mosB = generator;
+    unsigned long mosX1 = 1;
+    unsigned long mosX2 = 0;
+    unsigned long mosY1 = 0;
+    unsigned long mosY2 = 1;
+    unsigned long num = 1;
+    unsigned long den = 1;
+    for(unsigned long i = 0; i < maxLevel + 1; i++) {
+        _ratios.push_back({num, den});
+
+        // reduced, as Fraction does
+        auto const gcf = (num > 0) ? std::gcd(num, den) : 1;
+        _notesPerPeriod.push_back(den / gcf);
+
+        num = 2 * mosY1 + mosY2;
+        den = 2 * mosX1 + mosX2;
+        mosA = mosA - mosB;
+        mosX2 = mosX1 + mosX2;
+        mosY2 = mosY1 + mosY2;
+        if(mosB > mosA) {
+            std::swap(mosA, mosB);
+            std::swap(mosX1, mosX2);
+            std::swap(mosY1, mosY2);
+        }
+    }
+
+    // the degree levels, as Brun::_microtoneArrayBrun(), which only sees the ratios up to its level
+    for(unsigned long level = 0; level <= maxLevel; level++) {
+        _degreeLevelsOffset.push_back(_degreeLevels.size());
+        auto const npo = _notesPerPeriod[level];
+        unsigned long degreeLevel = 0;
+        unsigned long ratioIndex = 0;
+        for(unsigned long i = 0; i < npo; i++) {
+            _degreeLevels.push_back(degreeLevel);
+            if(i == npo - 1) {
+                break;
+            }
+            if(i + 1 == _notesPerPeriod[ratioIndex]) {
+                degreeLevel++;
+                ratioIndex = std::min(ratioIndex + 1, level);
+            }
+        }
+    }
+    _degreeLevelsOffset.push_back(_degreeLevels.size());
+}
+
+#pragma mark - levels
+
+const BrunLevels::Ratio& BrunLevels::getRatio(unsigned long level) const {
+    jassert(level <= _maxLevel);
+
+    return _ratios[level];
+}
+
+unsigned long BrunLevels::getNotesPerPeriod(unsigned long level) const {
+    jassert(level <= _maxLevel);
+
+    return _notesPerPeriod[level];
+}
+
+unsigned long BrunLevels::getDegreeLevel(unsigned long level, unsigned long degree) const {
+    jassert(level <= _maxLevel);
+    jassert(_degreeLevelsOffset[level] + degree < _degreeLevelsOffset[level + 1]);
+
+    return _degreeLevels[_degreeLevelsOffset[level] + degree];
+}
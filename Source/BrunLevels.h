@@ -0,0 +1,53 @@
+/**
+ * @file BrunLevels.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the BrunLevels class.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class BrunLevels
+ * @brief The level structure of one Brun generator, for every level at once.
+ *
+ * For each level: the Brun ratio (the scale tree's convergent, i.e., 7/12), and for each scale degree
+ * of that level's MOS the level at which the degree appears.  Everything but the generator -- level,
+ * murchana, display mode -- only slices these, so Brun computes them once per generator.
+ *
+ * Follows Brun::brunArray() and Brun::_microtoneArrayBrun() step for step, so the scales are unchanged.
+ */
+class BrunLevels final
+{
+public:
+    struct Ratio {
+        unsigned long num = 1;
+        unsigned long den = 1; // as generated, not reduced
+    };
+
+    // lifecycle
+    BrunLevels(float generator, unsigned long maxLevel);
+    ~BrunLevels() = default;
+
+    // levels 0...maxLevel
+    float getGenerator() const { return _generator; }
+    unsigned long getMaxLevel() const { return _maxLevel; }
+    const Ratio& getRatio(unsigned long level) const; ///< Brun::brun(level, generator)
+    unsigned long getNotesPerPeriod(unsigned long level) const; ///< The reduced denominator of getRatio(level)
+
+    // the level at which each degree of a level's scale appears
+    unsigned long getDegreeLevel(unsigned long level, unsigned long degree) const;
+
+private:
+    float _generator = 0.f;
+    unsigned long _maxLevel = 0;
+    std::vector<Ratio> _ratios {};
+    std::vector<unsigned long> _notesPerPeriod {};
+    std::vector<unsigned long> _degreeLevels {}; // every level's degrees, one after another
+    std::vector<size_t> _degreeLevelsOffset {}; // where each level's degrees start
+};
@@ -18,6 +18,7 @@
 
 BrunRootComponent::BrunRootComponent(WilsonicProcessor& processor)
 : WilsonicAppTuningComponent(processor)
+, FrameTimer(this)
 , _frequencyBubble(BubblePlacement::right, "F", "Generator in Frequency Space.\nRange is 1.0 to Period.")
 , _centsBubble(BubblePlacement::left, "C", "Generator in Cents.\nRange is 0 to 1200 when Period=2 (the octave)")
 , _generatorBubble(BubblePlacement::right, "G", "Generator:\nFor this Level, repeat this generating interval against the period until there are only 2 interval sizes: A small and a large.\nUnits are in Log-base period (i.e., log2 when Period=2).\nRange is always 0 to 1.\nHold down Option while dragging for precision.")
@@ -208,7 +209,7 @@ BrunRootComponent::BrunRootComponent(WilsonicProcessor& processor)
 }
 
 BrunRootComponent::~BrunRootComponent() {
-    stopTimer();
+    stopFrameTimer();
     _processor.getAppTuningModel()->removeActionListener(this);
     _processor.getBrun2Model()->removeActionListener(this);
     _frequencyGLabel.removeListener(this);
@@ -431,7 +432,7 @@ void BrunRootComponent::labelTextChanged(Label* labelThatHasChanged) {
 
 #pragma mark - Timer
 
-void BrunRootComponent::timerCallback() {
+void BrunRootComponent::frameCallback() {
     if (isShowing()) {
         _brunGraph->repaint();
     }
@@ -445,7 +446,7 @@ void BrunRootComponent::_timerHelper() {
 
     if (displayMode != Brun::DisplayMode::Gral)
     {
-        stopTimer();
+        stopFrameTimer();
         return;
     }
 */
@@ -455,8 +456,8 @@ void BrunRootComponent::_timerHelper() {
 //    auto const hz = AppExperiments::getFrameRateForNPO(npo);
     auto const hz = 20;
     if (hz > 0) {
-        startTimerHz(hz);
+        startFrameTimerHz(hz);
     } else {
-        stopTimer();
+        stopFrameTimer();
     }
 }
@@ -18,6 +18,7 @@
 #include "BrunLevelComponent.h"
 #include "BrunPitchWheel.h"
 #include "BubbleDrawable.h"
+#include "FrameTimer.h"
 #include "ParameterListeners.h"
 #include "WilsonicAppSkin.h"
 #include "WilsonicAppTuningComponent.h"
@@ -27,7 +28,7 @@ class BrunRootComponent
 : public WilsonicAppTuningComponent
 , private ActionListener
 , private Label::Listener
-, private Timer
+, private FrameTimer
 {
     // lifecycle
 public:
@@ -75,6 +76,6 @@ private:
     // private methods
     void _tuningChangedUpdateUI();
     void labelTextChanged(Label* labelThatHasChanged) override;
-    void timerCallback() override;
+    void frameCallback() override;
     void _timerHelper();
 };
@@ -52,12 +52,12 @@ const vector<CPSModel::Scale> all_scales {
 #pragma mark - lifecycle
 
 CPSModel::CPSModel()
-: _A (CPS::A (1))
-, _B (CPS::B (3))
-, _C (CPS::C (5))
-, _D (CPS::D (7))
-, _E (CPS::E (9))
-, _F (CPS::F (11))
+: _A (CPS::A (defaultA))
+, _B (CPS::B (defaultB))
+, _C (CPS::C (defaultC))
+, _D (CPS::D (defaultD))
+, _E (CPS::E (defaultE))
+, _F (CPS::F (defaultF))
 {
     _currentScale = Scale::CPS_4_2;
     _updateScales(); // clobbered when parameters are hooked up
@@ -91,7 +91,7 @@ unique_ptr<AudioProcessorParameterGroup> CPSModel::createParams() {
      (getCPS_A_ParameterID(),
       getCPS_A_ParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _A->getFrequencyValue(),
+      defaultA,
       getCPS_A_ParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -103,7 +103,7 @@ unique_ptr<AudioProcessorParameterGroup> CPSModel::createParams() {
      (getCPS_B_ParameterID(),
       getCPS_B_ParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _B->getFrequencyValue(),
+      defaultB,
       getCPS_B_ParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -115,7 +115,7 @@ unique_ptr<AudioProcessorParameterGroup> CPSModel::createParams() {
      (getCPS_C_ParameterID(),
       getCPS_C_ParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _C->getFrequencyValue(),
+      defaultC,
       getCPS_C_ParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -127,7 +127,7 @@ unique_ptr<AudioProcessorParameterGroup> CPSModel::createParams() {
      (getCPS_D_ParameterID(),
       getCPS_D_ParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _D->getFrequencyValue(),
+      defaultD,
       getCPS_D_ParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -139,7 +139,7 @@ unique_ptr<AudioProcessorParameterGroup> CPSModel::createParams() {
      (getCPS_E_ParameterID(),
       getCPS_E_ParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _E->getFrequencyValue(),
+      defaultE,
       getCPS_E_ParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -151,7 +151,7 @@ unique_ptr<AudioProcessorParameterGroup> CPSModel::createParams() {
      (getCPS_F_ParameterID(),
       getCPS_F_ParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _F->getFrequencyValue(),
+      defaultF,
       getCPS_F_ParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -68,6 +68,12 @@ public:
     static constexpr float rangeMin = 1.f; // A,B,C,D,E,F
     static constexpr float rangeMax = 16384.f; // A,B,C,D,E,F
     static constexpr float rangeStep = 1.f; // A,B,C,D,E,F
+    static constexpr float defaultA = 1.f; // default A,B,C,D,E,F: the parameter defaults
+    static constexpr float defaultB = 3.f;
+    static constexpr float defaultC = 5.f;
+    static constexpr float defaultD = 7.f;
+    static constexpr float defaultE = 9.f;
+    static constexpr float defaultF = 11.f;
     static const ParameterID getCPSParameterID() { return ParameterID ("CPSCALE", AppVersion::getVersionHint()); }
     static const String getCPSSParameterName() { return "CPS|Scale"; }
     static const ParameterID getCPS_A_ParameterID() { return ParameterID ("CPSA", AppVersion::getVersionHint()); }
@@ -95,15 +101,15 @@ public:
     shared_ptr<Tuning> getTuning() override;
     const shared_ptr<CPSTuningBase> getCPSTuning();
     unsigned long getNumScales();
-    StringArray getScaleNames();
+    static StringArray getScaleNames();
     unsigned long getNumberOfSeeds();
 
     // called only once: on construction of processor
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;
+    static unique_ptr<AudioProcessorParameterGroup> createParams();
 
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    static String getGroupID();
+    static String getGroupName();
+    static String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // key for this design's Favorites array
     StringArray getFavoritesParameterIDs() override; // used for Favorites
     // called only once: when assigning _avpts
@@ -0,0 +1,86 @@
+/**
+ * @file CPSProducts.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the CPSProducts class.
+ */
+
+#include "CPSProducts.h"
+#include <cmath>
+#include <JuceHeader.h>
+
+#pragma mark - building
+
+void CPSProducts::clear() {
+    _log2Terms.fill(0);
+    for(auto& products : _productsWithTerm) {
+        products.clear();
+    }
+    _numerators.clear();
+    _denominators.clear();
+    _frequencies.clear();
+}
+
+size_t CPSProducts::addProduct(Terms numerator, Terms denominator) {
+    auto const index = _frequencies.size();
+    _numerators.push_back(numerator);
+    _denominators.push_back(denominator);
+    _frequencies.push_back(1.f);
+    auto const terms = static_cast<Terms>(numerator | denominator);
+    for(size_t t = 0; t < maxTerms; t++) {
+        if(terms & (1 << t)) {
+            _productsWithTerm[t].push_back(index);
+        }
+    }
+    _computeProduct(index);
+
+    return index;
+}
+
+#pragma mark - terms
+
+void CPSProducts::setTerm(size_t term, float frequency) {
+    jassert(term < maxTerms);
+    jassert(frequency > 0.f);
+    _log2Terms[term] = std::log2(static_cast<double>(frequency));
+    for(auto const index : _productsWithTerm[term]) {
+        _computeProduct(index);
+    }
+}
+
+void CPSProducts::_computeProduct(size_t index) {
+    auto const numerator = _numerators[index];
+    auto const denominator = _denominators[index];
+    auto sum = 0.0;
+    for(size_t t = 0; t < maxTerms; t++) {
+        if(numerator & (1 << t)) {
+            sum += _log2Terms[t];
+        }
+        if(denominator & (1 << t)) {
+            sum -= _log2Terms[t];
+        }
+    }
+    _frequencies[index] = static_cast<float>(std::exp2(sum));
+}
+
+#pragma mark - accessors
+
+float CPSProducts::frequencyAtIndex(size_t index) const {
+    jassert(index < _frequencies.size());
+    return _frequencies[index];
+}
+
+CPSProducts::Terms CPSProducts::numeratorAtIndex(size_t index) const {
+    jassert(index < _numerators.size());
+    return _numerators[index];
+}
+
+CPSProducts::Terms CPSProducts::denominatorAtIndex(size_t index) const {
+    jassert(index < _denominators.size());
+    return _denominators[index];
+}
+
+const std::vector<size_t>& CPSProducts::productsWithTerm(size_t term) const {
+    jassert(term < maxTerms);
+    return _productsWithTerm[term];
+}
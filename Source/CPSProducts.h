@@ -0,0 +1,61 @@
+/**
+ * @file CPSProducts.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the CPSProducts class.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class CPSProducts
+ * @brief A combination index: the products of a CPS or diamond as bitmasks of their terms.
+ *
+ * Each product is a numerator and a denominator set of terms, i.e., ABC = A*B*C, or A/B.
+ * The index keeps, for every term, the products that contain it, and the log2 of every term,
+ * so when one term changes only the products that contain it are recomputed, as log-domain sums.
+ * Each product is summed from the terms again rather than adjusted by a delta, so repeated
+ * automation does not accumulate error.
+ *
+ * CPSTuningBase builds one from the products its update() made, and updates its microtones from it.
+ */
+class CPSProducts final
+{
+public:
+    static constexpr size_t maxTerms = 16;
+    using Terms = uint16_t; // bit i is term i
+
+    // lifecycle
+    CPSProducts() = default;
+    ~CPSProducts() = default;
+
+    // building
+    void clear(); ///< Removes all products and terms
+    size_t addProduct(Terms numerator, Terms denominator = 0); ///< Returns the index of the new product
+
+    // terms
+    void setTerm(size_t term, float frequency); ///< Recomputes the products that contain the term
+
+    // accessors
+    size_t count() const { return _frequencies.size(); }
+    float frequencyAtIndex(size_t index) const;
+    Terms numeratorAtIndex(size_t index) const;
+    Terms denominatorAtIndex(size_t index) const;
+    const std::vector<size_t>& productsWithTerm(size_t term) const; ///< Ascending product indices
+
+private:
+    void _computeProduct(size_t index);
+
+    std::array<double, maxTerms> _log2Terms {}; // log2(frequency) of each term, 0 until set
+    std::array<std::vector<size_t>, maxTerms> _productsWithTerm {};
+    std::vector<Terms> _numerators {};
+    std::vector<Terms> _denominators {};
+    std::vector<float> _frequencies {};
+};
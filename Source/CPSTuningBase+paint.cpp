@@ -207,7 +207,7 @@ void CPSTuningBase::paint(WilsonicProcessor& processor, Graphics& g, Rectangle<i
 
 #if JucePlugin_IsSynth
     // optimization
-    auto vs = processor.getVoiceStates();
+    auto const& vs = processor.getVoiceStates();
     auto const no_notes_playing = vs.noVoicesPlaying();
     if(no_notes_playing) {
         return;
@@ -216,7 +216,7 @@ void CPSTuningBase::paint(WilsonicProcessor& processor, Graphics& g, Rectangle<i
     // stroke playing cps dot
     if(AppExperiments::tuningRendererPlayingNotes) {
         // draw a dynamic line+dot for each microtone based on voice amplitude
-        for(unsigned long i = 0; i < WilsonicProcessorConstants::numVoices; i++) {
+        for(unsigned long i = 0; i < WilsonicProcessorConstants::maxVoices; i++) {
             auto v = vs.voiceState[i];
             auto const nnv = v.nn;
             auto const vmag = v.rms;
@@ -121,7 +121,162 @@ Microtone_p CPSTuningBase::multiplyByCommonTones(vector<Microtone_p> inputTones)
     retVal->setShortDescriptionText2(sd2);
     retVal->setShortDescriptionText3(retVal->getFrequencyValueDescription());
     
-    return retVal;
+    return _recordProduct(retVal, combined);
+}
+
+#pragma mark - incremental update
+
+/**
+ * @brief Records a product made by update(), so setMicrotoneArray() can index it.
+ *
+ * setMicrotoneArray() receives copies of the products, so they are matched to these records by short description.
+ *
+ * @param product The product, i.e., _mABC->mt.
+ * @param numerator The terms multiplied, i.e., {_A, _B, _C} and the common tones.
+ * @param denominator The terms divided by, i.e., {_B} for the diamond's A/B.
+ * @return product
+ */
+Microtone_p CPSTuningBase::_recordProduct(Microtone_p product, vector<Microtone_p> numerator, vector<Microtone_p> denominator) {
+    const ScopedLock sl(_lock);
+    _productRecords[product->getShortDescriptionText()] = ProductRecord {product, std::move(numerator), std::move(denominator)};
+
+    return product;
+}
+
+void CPSTuningBase::setMicrotoneArray(MicrotoneArray ma) {
+    const ScopedLock sl(_lock);
+    _indexProducts(ma);
+    TuningImp::setMicrotoneArray(std::move(ma));
+}
+
+/**
+ * @brief Builds the index of the products in ma from the products update() recorded.
+ *
+ * If any microtone was not recorded, or has changed since, or there are more than CPSProducts::maxTerms terms,
+ * the tuning is not indexed and updateTerm() returns false.
+ */
+void CPSTuningBase::_indexProducts(MicrotoneArray& ma) {
+    const ScopedLock sl(_lock);
+    _products.clear();
+    _productTerms.clear();
+    _productSources.clear();
+    _isIndexed = false;
+    _descriptionsAreStale = false;
+
+    // term -> term index, adding new terms
+    auto termIndex = [this](Microtone_p term) {
+        auto const it = find(_productTerms.begin(), _productTerms.end(), term);
+        if(it != _productTerms.end()) {
+            return static_cast<size_t>(it - _productTerms.begin());
+        }
+        _productTerms.push_back(term);
+        return _productTerms.size() - 1;
+    };
+    auto termsOf = [&](const vector<Microtone_p>& terms, CPSProducts::Terms& bits) {
+        bits = 0;
+        for(auto const& term : terms) {
+            auto const t = termIndex(term);
+            if(t >= CPSProducts::maxTerms || (bits & (1 << t))) {
+                return false; // too many terms, or a term repeated
+            }
+            bits |= static_cast<CPSProducts::Terms>(1 << t);
+        }
+        return true;
+    };
+
+    auto isIndexed = true;
+    for(unsigned long i = 0; i < ma.count() && isIndexed; i++) {
+        auto const mt = ma.microtoneAtIndex(i);
+        auto const it = _productRecords.find(mt->getShortDescriptionText());
+        if(it == _productRecords.end() || it->second.product->getFrequencyValue() != mt->getFrequencyValue() || mt->isRational()) {
+            isIndexed = false;
+            break;
+        }
+        auto const& record = it->second;
+        CPSProducts::Terms numerator;
+        CPSProducts::Terms denominator;
+        isIndexed = termsOf(record.numerator, numerator) && termsOf(record.denominator, denominator);
+        _products.addProduct(numerator, denominator);
+        _productSources.push_back(record.product);
+    }
+    _productRecords.clear();
+    if(!isIndexed) {
+        _products.clear();
+        _productTerms.clear();
+        _productSources.clear();
+        return;
+    }
+    for(size_t t = 0; t < _productTerms.size(); t++) {
+        _products.setTerm(t, _productTerms[t]->getFrequencyValue());
+    }
+    _isIndexed = true;
+}
+
+/**
+ * @brief Recomputes the products that contain term after its frequency changed in place, i.e., from automation.
+ *
+ * Unlike update() no Microtones or descriptions are made: the products are log-domain sums of the terms,
+ * written into the microtone array, then the flat processing chain runs.  Subsets are updated the same way.
+ *
+ * @param term A term of this tuning, i.e., the shared _A.  A term this tuning does not use changes nothing.
+ * @return false if the tuning is not indexed: call update()
+ */
+bool CPSTuningBase::updateTerm(Microtone_p term) {
+    const ScopedLock sl(_lock);
+    _updatedTerm.assign(1, term);
+
+    return _updateTerms(_updatedTerm);
+}
+
+bool CPSTuningBase::_updateTerms(const vector<Microtone_p>& terms) {
+    const ScopedLock sl(_lock);
+    if(!_isIndexed) {
+        return false;
+    }
+
+    // subsets may be built from this tuning's products, i.e., the diamonds, so pass them on too
+    _changedTerms.assign(terms.begin(), terms.end());
+    auto didChange = false;
+    for(auto const& term : terms) {
+        auto const it = find(_productTerms.begin(), _productTerms.end(), term);
+        if(it == _productTerms.end()) {
+            continue;
+        }
+        auto const t = static_cast<size_t>(it - _productTerms.begin());
+        _products.setTerm(t, term->getFrequencyValue());
+        for(auto const p : _products.productsWithTerm(t)) {
+            auto const f = _products.frequencyAtIndex(p);
+            _microtoneArray.microtoneAtIndex(static_cast<unsigned long>(p))->setFrequencyValue(f);
+            _productSources[p]->setFrequencyValue(f);
+            _changedTerms.push_back(_productSources[p]);
+        }
+        didChange = true;
+    }
+    if(didChange) {
+        _descriptionsAreStale = true;
+        _requestUpdate(UpdateStage::Full);
+    }
+
+    // SUBSETS
+    if(getShouldComputeSubsets() && _getDidAllocateSubsets()) {
+        for(auto subsets : {&_subsets0, &_subsets1}) {
+            for(auto& s : *subsets) {
+                if(!s->_updateTerms(_changedTerms)) {
+                    s->update();
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+// the descriptions of the products, i.e., their frequencies as text, are made by update()
+void CPSTuningBase::updateDescriptions() {
+    const ScopedLock sl(_lock);
+    if(_descriptionsAreStale) {
+        update(); // indexes again, which clears _descriptionsAreStale
+    }
 }
 
 const vector<shared_ptr<CPSTuningBase>> CPSTuningBase::getSubsets0() {
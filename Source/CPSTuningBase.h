@@ -11,6 +11,7 @@
 #pragma once
 
 #include "CPS.h"
+#include "CPSProducts.h"
 #include "CPSMicrotone.h"
 #include "TuningImp.h"
 
@@ -48,8 +49,6 @@ public:
     const string getTuningName() override;
     virtual const string getTuningNameAsSymbols() = 0; // codegen
     virtual const string getTuningNameAsUnderscores() = 0; // codegen
-    virtual const string getTuningCreationCodegen(string, vector<string>, vector<string>) = 0; // codegen
-    virtual const string getTuningUpdateCodegen() = 0; // codegen
     const string getDebugDescription() override;
     const string getParameterDescription() override;
     const vector<shared_ptr<CPSTuningBase>> getSubsets0();
@@ -91,6 +90,11 @@ public:
     CPS_Class getTuningType();
     virtual bool isEulerGenusTuningType() = 0;
 
+    // incremental update: the products of update() are indexed by term, see CPSProducts
+    void setMicrotoneArray(MicrotoneArray ma) override; // indexes the products, then calls TuningImp::_update()
+    bool updateTerm(Microtone_p term); ///< Recomputes only the products that contain term, in place.  false: not indexed, call update()
+    void updateDescriptions(); ///< Message thread: after updateTerm() the product descriptions are stale until the next update()
+
 protected:
     CPS_Class _tuningType {CPS_Class::UNDEFINED}; ///< The tuning type.
     vector<Microtone_p> _commonTones {}; ///< The common tones.
@@ -118,6 +122,7 @@ protected:
 
     // protected methods
     virtual void _allocateSubsets() = 0;
+    Microtone_p _recordProduct(Microtone_p product, vector<Microtone_p> numerator, vector<Microtone_p> denominator = {}); // for the index, returns product
     const bool _getDidAllocateSubsets();
     void _setDidAllocateSubsets(bool didAllocate);
     void _clearSelection();
@@ -137,5 +142,24 @@ private:
 
     // default value "assert" is invalid
     DAWKey _dawKey {"assert"}; ///< The DAW key.
+
+    // products recorded by update(), by short description, until setMicrotoneArray() indexes them
+    struct ProductRecord {
+        Microtone_p product;
+        vector<Microtone_p> numerator;
+        vector<Microtone_p> denominator;
+    };
+    unordered_map<string, ProductRecord> _productRecords {};
+
+    // the index: product i is _microtoneArray[i]
+    CPSProducts _products {};
+    vector<Microtone_p> _productTerms {}; // term index -> term
+    vector<Microtone_p> _productSources {}; // product index -> the recorded product, i.e., what is painted
+    bool _isIndexed {false};
+    bool _descriptionsAreStale {false};
+    vector<Microtone_p> _updatedTerm {}; // scratch, reused: updateTerm()'s term
+    vector<Microtone_p> _changedTerms {}; // scratch, reused: the terms and products passed to the subsets
+    void _indexProducts(MicrotoneArray& ma);
+    bool _updateTerms(const vector<Microtone_p>& terms);
 };
 
@@ -262,13 +262,13 @@ void CoPrime::paint(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bo
         
 #if JucePlugin_IsSynth
     // optimization
-    auto vs = processor.getVoiceStates();
+    auto const& vs = processor.getVoiceStates();
     if (vs.noVoicesPlaying()) {
         return;
     }
     
     // call common drawing for x,y of playing non-coprime microtone
-    for (unsigned long i = 0; i < WilsonicProcessorConstants::numVoices; i++) {
+    for (unsigned long i = 0; i < WilsonicProcessorConstants::maxVoices; i++) {
         // keyboard note states
         auto v = vs.voiceState[i];
         auto nnv = v.nn;
@@ -15,6 +15,7 @@
 
 CoPrimeComponent::CoPrimeComponent(WilsonicProcessor& processor)
 : WilsonicAppTuningComponent(processor)
+, FrameTimer(this)
 {
     auto const cm = _processor.getCoPrimeModel();
 
@@ -86,7 +87,7 @@ CoPrimeComponent::CoPrimeComponent(WilsonicProcessor& processor)
 }
 
 CoPrimeComponent::~CoPrimeComponent() {
-    stopTimer();
+    stopFrameTimer();
     _processor.getCoPrimeModel()->removeActionListener(this);
     _processor.getAppTuningModel()->removeActionListener(this);
 }
@@ -236,7 +237,7 @@ void CoPrimeComponent::_tuningChangedUpdateUI() {
 
 #pragma mark - Timer
 
-void CoPrimeComponent::timerCallback() {
+void CoPrimeComponent::frameCallback() {
     if (isShowing()) {
         _coPrimeGrid->repaint();
     }
@@ -250,7 +251,7 @@ void CoPrimeComponent::_timerHelper() {
 
     if (displayMode != Brun::DisplayMode::Gral)
     {
-        stopTimer();
+        stopFrameTimer();
         return;
     }
 */
@@ -260,8 +261,8 @@ void CoPrimeComponent::_timerHelper() {
 //    auto const hz = AppExperiments::getFrameRateForNPO(npo);
     auto const hz = 20;
     if (hz > 0) {
-        startTimerHz(hz);
+        startFrameTimerHz(hz);
     } else {
-        stopTimer();
+        stopFrameTimer();
     }
 }
@@ -15,6 +15,7 @@
 #include "BubbleDrawable.h"
 #include "CoPrimeGridComponent.h"
 #include "DeltaComboBox.h"
+#include "FrameTimer.h"
 #include "SeedSlider.h"
 #include "Tuning_Include.h"
 #include "WilsonicProcessor.h"
@@ -23,7 +24,7 @@
 class CoPrimeComponent
 : public WilsonicAppTuningComponent
 , private ActionListener
-, private Timer
+, private FrameTimer
 {
 public:
     // lifecycle
@@ -63,6 +64,6 @@ private:
     // private methods
     void actionListenerCallback(const String&) override;
     void _tuningChangedUpdateUI();
-    void timerCallback() override;
+    void frameCallback() override;
     void _timerHelper();
 };
@@ -95,10 +95,10 @@ public:
     int nnForMouseInViewBounds(Point<int> xy, Rectangle<int> viewBounds); // starts at middleC
 
     // called only once: on construction of processor
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    static unique_ptr<AudioProcessorParameterGroup> createParams();
+    static String getGroupID();
+    static String getGroupName();
+    static String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // key for this design's Favorites array
     StringArray getFavoritesParameterIDs() override; // used for Favorites
     // called only once: when assigning _avpts
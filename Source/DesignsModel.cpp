@@ -46,20 +46,7 @@
 DesignsModel::DesignsModel(WilsonicProcessor& processor)
 : ActionBroadcaster()
 , _processor(processor)
-, _brun2Model(make_shared<Brun2Model>())
-, _coPrimeModel(make_shared<CoPrimeModel>())
-, _cpsModel(make_shared<CPSModel>())
-, _diamondsModel(make_shared<DiamondsModel>())
-, _equalTemperamentModel(make_shared<EqualTemperamentModel>())
-, _eulerGenusModel(make_shared<EulerGenusModel>())
-, _persian17NorthIndianModel(make_shared<Persian17NorthIndianModel>())
-, _presetsModel(make_shared<PresetsModel>())
-, _recurrenceRelationModel(make_shared<RecurrenceRelationModel>())
-, _scalaModel(make_shared<ScalaModel>())
-, _tritriadicModel(make_shared<TritriadicModel>())
 , _favoritesModelV2(make_shared<FavoritesModelV2>(_processor))
-, _morphModel(make_shared<MorphModel>(_processor))
-, _partchModel(make_shared<PartchModel>(_processor))
 , _appTuningModel(make_shared<AppTuningModel>(_processor))
 {
     // Assert that the size of the design names, function names, tuning changed action message, tuning changed function names, and tuning param IDs for favorites are all zero.
@@ -71,203 +58,163 @@ DesignsModel::DesignsModel(WilsonicProcessor& processor)
     
     // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
     // If you ever change this order you will break all users' presets, AND their Favorites
-    // You must also update MorphABModel, which mimics this
+    // You must also update the design indices in DesignsModel.h, and MorphABModel, which mimics this
     // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
     
-    int designIndex = 0;
-    
     // 0
     // Add "Wilson's Garden" to the design names.
     _designsNames.add("Wilson's Garden");
-    _tuningDesignKeys.push_back(_presetsModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this](){showPresetsTuning();});
     _tuningChangedActionMessage.add(getPresetsTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_presetsModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this](){return _presetsModel->getFavoritesParameterIDs();});
-    _presetsModel->addActionListener(this);
-    _presetsModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getPresetsModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this](){return getPresetsModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getPresetsModel();});
+    jassert(_designsNames.size() == presetsDesignIndex + 1);
     
     // 1
     // Add "Moments of Symmetry" to the design names.
     _designsNames.add("Moments of Symmetry");
-    _tuningDesignKeys.push_back(_brun2Model->getDesignParameterID().getParamID());
     _functionNames.push_back([this](){showBrunTuning();});
     _tuningChangedActionMessage.add(getBrunTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_brun2Model->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this](){return _brun2Model->getFavoritesParameterIDs();});
-    _brun2Model->addActionListener(this);
-    _brun2Model->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getBrun2Model()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this](){return getBrun2Model()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getBrun2Model();});
+    jassert(_designsNames.size() == brun2DesignIndex + 1);
     
     // 2
     // Add "Persian 17 North Indian" to the design names.
     _designsNames.add("Persian 17 North Indian");
-    _tuningDesignKeys.push_back(_persian17NorthIndianModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this](){showPersian17NorthIndianTuning();});
     _tuningChangedActionMessage.add(getPersian17NorthIndianTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_persian17NorthIndianModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _persian17NorthIndianModel->getFavoritesParameterIDs();});
-    _persian17NorthIndianModel->addActionListener(this);
-    _persian17NorthIndianModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getPersian17NorthIndianModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getPersian17NorthIndianModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getPersian17NorthIndianModel();});
+    jassert(_designsNames.size() == persian17NorthIndianDesignIndex + 1);
     
     // 3
     // Add "Combination Product Sets" to the design names.
     _designsNames.add("Combination Product Sets");
-    _tuningDesignKeys.push_back(_cpsModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this](){showCPSTuning();});
     _tuningChangedActionMessage.add(getCPSTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_cpsModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _cpsModel->getFavoritesParameterIDs();});
-    _cpsModel->addActionListener(this);
-    _cpsModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getCPSModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getCPSModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getCPSModel();});
+    jassert(_designsNames.size() == cpsDesignIndex + 1);
     
     // 4
     // Add "Euler Genus 6" to the design names.
     _designsNames.add("Euler Genus 6");
-    _tuningDesignKeys.push_back(_eulerGenusModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this](){showEulerGenusV2Tuning();});
     _tuningChangedActionMessage.add(getEulerGenusTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_eulerGenusModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _eulerGenusModel->getFavoritesParameterIDs();});
-    _eulerGenusModel->addActionListener(this);
-    _eulerGenusModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getEulerGenusModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getEulerGenusModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getEulerGenusModel();});
+    jassert(_designsNames.size() == eulerGenusDesignIndex + 1);
     
     // 5
     // Add "Recurrence Relation" to the design names.
     _designsNames.add("Recurrence Relation");
-    _tuningDesignKeys.push_back(_recurrenceRelationModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this](){showRecurrenceRelationTuning();});
     _tuningChangedActionMessage.add(getRecurrenceRelationTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_recurrenceRelationModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _recurrenceRelationModel->getFavoritesParameterIDs();});
-    _recurrenceRelationModel->addActionListener(this);
-    _recurrenceRelationModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getRecurrenceRelationModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getRecurrenceRelationModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getRecurrenceRelationModel();});
+    jassert(_designsNames.size() == recurrenceRelationDesignIndex + 1);
     
     // 6
     // Add "Equal Temperament" to the design names.
     _designsNames.add("Equal Temperament");
-    _tuningDesignKeys.push_back(_equalTemperamentModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this](){showEqualTemperamentTuning();});
     _tuningChangedActionMessage.add(getEqualTemperamentTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_equalTemperamentModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _equalTemperamentModel->getFavoritesParameterIDs();});
-    _equalTemperamentModel->addActionListener(this);
-    _equalTemperamentModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getEqualTemperamentModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getEqualTemperamentModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getEqualTemperamentModel();});
+    jassert(_designsNames.size() == equalTemperamentDesignIndex + 1);
     
     // 7
     // Add "Tritriadic" to the design names.
     _designsNames.add("Tritriadic");
-    _tuningDesignKeys.push_back(_tritriadicModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this](){showTritriadicTuning();});
     _tuningChangedActionMessage.add(getTritriadicTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_tritriadicModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _tritriadicModel->getFavoritesParameterIDs();});
-    _tritriadicModel->addActionListener(this);
-    _tritriadicModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getTritriadicModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getTritriadicModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getTritriadicModel();});
+    jassert(_designsNames.size() == tritriadicDesignIndex + 1);
     
     //8
     // Add "Scala" to the design names.
     _designsNames.add("Scala");
-    _tuningDesignKeys.push_back(_scalaModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this](){showScalaTuning();});
     _tuningChangedActionMessage.add(getScalaTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_scalaModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _scalaModel->getFavoritesParameterIDs();});
-    _scalaModel->addActionListener(this);
-    _scalaModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getScalaModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getScalaModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getScalaModel();});
+    jassert(_designsNames.size() == scalaDesignIndex + 1);
     
     //9
     // Add "CoPrime Grid" to the design names.
     _designsNames.add("CoPrime Grid");
-    _tuningDesignKeys.push_back(_coPrimeModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this]() {showCoPrimeTuning();});
     _tuningChangedActionMessage.add(getCoPrimeTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_coPrimeModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _coPrimeModel->getFavoritesParameterIDs();});
-    _coPrimeModel->addActionListener(this);
-    _coPrimeModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getCoPrimeModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getCoPrimeModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getCoPrimeModel();});
+    jassert(_designsNames.size() == coPrimeDesignIndex + 1);
     
     //10
     // Add "Diamonds" to the design names.
     _designsNames.add("Diamonds");
-    _tuningDesignKeys.push_back(_diamondsModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this]() {showDiamondsTuning();});
     _tuningChangedActionMessage.add(getDiamondsTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_diamondsModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _diamondsModel->getFavoritesParameterIDs();});
-    _diamondsModel->addActionListener(this);
-    _diamondsModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getDiamondsModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getDiamondsModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getDiamondsModel();});
+    jassert(_designsNames.size() == diamondsDesignIndex + 1);
     
     // 11
     // Morph!
     _designsNames.add("Morph");
-    _tuningDesignKeys.push_back(_morphModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this]() {showMorphTuning();});
     _tuningChangedActionMessage.add(getMorphTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_morphModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _morphModel->getFavoritesParameterIDs();});
-    _morphModel->addActionListener(this);
-    _morphModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getMorphModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getMorphModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getMorphModel();});
+    jassert(_designsNames.size() == morphDesignIndex + 1);
 
     // 12
     // Partch
     _designsNames.add("Partch");
-    _tuningDesignKeys.push_back(_partchModel->getDesignParameterID().getParamID());
     _functionNames.push_back([this]() {showPartchTuning();});
     _tuningChangedActionMessage.add(getPartchTuningChangedActionMessage());
-    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(_partchModel->getTuning());});
-    _tuningParamIDsForFavorites.push_back([this]() {return _partchModel->getFavoritesParameterIDs();});
-    _partchModel->addActionListener(this);
-    _partchModel->setDesignIndex(designIndex);
-    designIndex++;
+    _tuningChangedFunctionNames.push_back([this]() {_appTuningModel->setTuning(getPartchModel()->getTuning());});
+    _tuningParamIDsForFavorites.push_back([this]() {return getPartchModel()->getFavoritesParameterIDs();});
+    _designModels.push_back([this]() -> shared_ptr<ModelBase> {return getPartchModel();});
+    jassert(_designsNames.size() == partchDesignIndex + 1);
 
     // ADD NEW SCALE DESIGN HERE
 
     // favorites is not a menu item, but still need to listen for automation
     _favoritesModelV2->addActionListener(this);
+    _models.push_back(_favoritesModelV2);
+    _models.push_back(_appTuningModel);
     
     // validate
-    // Assert that the size of the designs names, tuning design keys, function names, tuning changed action message, tuning changed function names, and tuning param IDs for favorites are all equal.
-    jassert(static_cast<unsigned long>(_designsNames.size()) == _tuningDesignKeys.size());
+    // Assert that the size of the designs names, function names, tuning changed action message, tuning changed function names, and tuning param IDs for favorites are all equal.
     jassert(static_cast<unsigned long>(_designsNames.size()) == _functionNames.size());
     jassert(_designsNames.size() == _tuningChangedActionMessage.size());
     jassert(static_cast<unsigned long>(_designsNames.size()) == _tuningChangedFunctionNames.size());
     jassert(static_cast<unsigned long>(_designsNames.size()) == _tuningParamIDsForFavorites.size());
-    
-    // when a user scala file is deleted the favoritesmodel needs to validate the favorites/morph entries.
-    _scalaModel->addActionListener(_favoritesModelV2.get());
+    jassert(static_cast<unsigned long>(_designsNames.size()) == _designModels.size());
 }
 
 // ADD NEW SCALE DESIGN HERE
 
 DesignsModel::~DesignsModel() {
-    _brun2Model->removeAllActionListeners();
-    _coPrimeModel->removeAllActionListeners();
-    _cpsModel->removeAllActionListeners();
-    _diamondsModel->removeAllActionListeners();
-    _equalTemperamentModel->removeAllActionListeners();
-    _eulerGenusModel->removeAllActionListeners();
-    _partchModel->removeAllActionListeners();
-    _persian17NorthIndianModel->removeAllActionListeners();
-    _presetsModel->removeAllActionListeners();
-    _recurrenceRelationModel->removeAllActionListeners();
-    _scalaModel->removeAllActionListeners();
-    _tritriadicModel->removeAllActionListeners();
-    _favoritesModelV2->removeAllActionListeners();
-    _morphModel->removeAllActionListeners();
-    _appTuningModel->removeAllActionListeners();
-    _favoritesModelV2->removeAllActionListeners();
+    for(auto const& model : _models) {
+        if(auto broadcaster = dynamic_cast<ActionBroadcaster*>(model.get())) {
+            broadcaster->removeAllActionListeners();
+        }
+    }
     
     removeAllActionListeners();
     detachParameterListeners();
@@ -286,53 +233,38 @@ void DesignsModel::setApvts(shared_ptr<AudioProcessorValueTreeState> apvts) {
     // This also asserts that this method is only called once.
     ModelBase::setApvts(apvts);
     
-    // Set the AudioProcessorValueTreeState for each child model and attach parameter listeners.
-    // order is not important, so done alphabetically
-    _brun2Model->setApvts(_apvts);
-    _brun2Model->attachParameterListeners();
-    
-    _coPrimeModel->setApvts(_apvts);
-    _coPrimeModel->attachParameterListeners();
-    
-    _cpsModel->setApvts(_apvts);
-    _cpsModel->attachParameterListeners();
-    
-    _diamondsModel->setApvts(_apvts);
-    _diamondsModel->attachParameterListeners();
-    
-    _equalTemperamentModel->setApvts(_apvts);
-    _equalTemperamentModel->attachParameterListeners();
-    
-    _eulerGenusModel->setApvts(_apvts);
-    _eulerGenusModel->attachParameterListeners();
-    
-    _morphModel->setApvts(_apvts);
-    _morphModel->attachParameterListeners();
-    
-    _partchModel->setApvts(_apvts);
-    _partchModel->attachParameterListeners();
-    
-    _persian17NorthIndianModel->setApvts(_apvts);
-    _persian17NorthIndianModel->attachParameterListeners();
-    
-    _presetsModel->setApvts(_apvts);
-    _presetsModel->attachParameterListeners();
-    
-    _recurrenceRelationModel->setApvts(_apvts);
-    _recurrenceRelationModel->attachParameterListeners();
-    
-    _tritriadicModel->setApvts(_apvts);
-    _tritriadicModel->attachParameterListeners();
-    
-    _scalaModel->setApvts(_apvts);
-    _scalaModel->attachParameterListeners();
-    
-    _appTuningModel->setApvts(_apvts);
-    _appTuningModel->attachParameterListeners();
+    // Set the AudioProcessorValueTreeState for each model created so far and attach parameter listeners.
+    // order is not important
+    for(auto const& model : _models) {
+        model->setApvts(_apvts);
+        model->attachParameterListeners();
+    }
     
-    // Set the AudioProcessorValueTreeState for the favorites model.
-    _favoritesModelV2->setApvts(_apvts);
-    _favoritesModelV2->attachParameterListeners();
+    // the selected design (the state is not restored yet, so the default) provides the app tuning.
+    // The other designs are created on first use.
+    auto const selected_design = static_cast<unsigned long>(*_apvts->getRawParameterValue(getDesignsParameterID().getParamID()));
+    _checkDesignIndex(selected_design);
+    _designModels[selected_design]();
+}
+
+/**
+ * @brief Hooks up a model created on first use, the way the constructor and setApvts() hooked up every model.
+ * @details If the parameters exist already the model listens to them, and catches up with their values.
+ */
+void DesignsModel::_addModel(shared_ptr<ModelBase> model, int designIndex) {
+    model->setDesignIndex(designIndex);
+    model->setOnTuningChanged([this, designIndex, weakModel = weak_ptr<ModelBase>(model)]() {
+        if(auto const m = weakModel.lock()) {
+            _tuningChanged(designIndex, *m);
+        }
+    });
+    _models.push_back(model);
+    if(_apvts != nullptr) {
+        model->setApvts(_apvts);
+        model->attachParameterListeners();
+        model->updateProperties();
+        model->syncParameters();
+    }
 }
 
 #pragma mark - Designs
@@ -351,7 +283,7 @@ const StringArray DesignsModel::getDesignsNames() {
 
 void DesignsModel::_checkDesignIndex(unsigned long index) {
     jassert(index >= 0);
-    jassert(index < _tuningDesignKeys.size());
+    jassert(index < _designModels.size());
     jassert(index < _functionNames.size());
     jassert(index < _tuningChangedFunctionNames.size());
     jassert(index < static_cast<unsigned long>(_tuningChangedActionMessage.size()));
@@ -392,6 +324,22 @@ void DesignsModel::_updateAppTuning(unsigned long index) {
     }
 }
 
+/**
+ * @brief The selected design's tuning goes to the app tuning as soon as it changes, on the thread that changed it.
+ * @details Host automation changes a design on the audio thread, before the block it arrived with is rendered,
+ * so that block is played with the new tuning.  The tuning changed action message, later on the message thread,
+ * sets the same tuning again.  Lock order: the design model, then AppTuningModel; this lock is not taken.
+ */
+void DesignsModel::_tuningChanged(int designIndex, ModelBase& model) {
+    if(_apvts == nullptr) {
+        return;
+    }
+    auto const selected_design = static_cast<int>(_apvts->getRawParameterValue(getDesignsParameterID().getParamID())->load());
+    if(designIndex == selected_design) {
+        _appTuningModel->setTuning(model.getTuning());
+    }
+}
+
 void DesignsModel::uiStoreFavorite() {
     if (_apvts == nullptr) {
         DBG("RACE: DesignsModel::uiStoreFavorite called before _apvts is set");
@@ -414,8 +362,7 @@ void DesignsModel::uiStoreFavorite() {
     auto selected_design = static_cast<unsigned long>(*designs_val);
     jassert(selected_design < _tuningParamIDsForFavorites.size());
     
-    // Get the design key and the design parameters.
-    auto design_key = _tuningDesignKeys[selected_design];
+    // Get the design parameters.
     auto design_params = _tuningParamIDsForFavorites[selected_design](); // call lambda
     
     // Add the favorite to the favorites model.
@@ -454,7 +401,7 @@ void DesignsModel::uiStoreScala() {
     }
     
     // Add the tuning to the Scala user library.
-    auto const success = _scalaModel->addTuningToScalaUserLibrary(t);
+    auto const success = getScalaModel()->addTuningToScalaUserLibrary(t);
     if (! success) {
         // If adding the tuning to the Scala user library fails, log a message and return.
         DBG("DesignsModel::uiStoreScala: current tuning errored creating Scala: NOP");
@@ -554,6 +501,7 @@ void DesignsModel::detachParameterListeners() {
 void DesignsModel::parameterChanged(const String& parameterID, float newValue) {
     if (parameterID == getDesignsParameterID().getParamID()) {
         _selectDesign(static_cast<unsigned long>(newValue));
+        uiNeedsUpdate(); // creates the selected design's model, on the message thread
     } else {
         // If the changed parameter is not the designs parameter, assert false.
         jassertfalse;
@@ -561,21 +509,10 @@ void DesignsModel::parameterChanged(const String& parameterID, float newValue) {
 }
 
 void DesignsModel::updateProperties() {
-    _brun2Model->updateProperties();
-    _coPrimeModel->updateProperties();
-    _cpsModel->updateProperties();
-    _diamondsModel->updateProperties();
-    _equalTemperamentModel->updateProperties();
-    _eulerGenusModel->updateProperties();
-    _persian17NorthIndianModel->updateProperties();
-    _presetsModel->updateProperties();
-    _recurrenceRelationModel->updateProperties();
-    _scalaModel->updateProperties();
-    _tritriadicModel->updateProperties();
-    _favoritesModelV2->updateProperties();
-    _morphModel->updateProperties();
-    _partchModel->updateProperties();
-    _appTuningModel->updateProperties();
+    const ScopedLock sl(_lock);
+    for(auto const& model : _models) {
+        model->updateProperties();
+    }
 }
 
 shared_ptr<Tuning> DesignsModel::getTuning() {
@@ -591,54 +528,61 @@ shared_ptr<AppTuningModel> DesignsModel::getAppTuningModel() {
 }
 
 shared_ptr<Brun2Model> DesignsModel::getBrun2Model() {
-    return _brun2Model;
+    return _getModel(_brun2Model, brun2DesignIndex);
 }
 
 shared_ptr<CoPrimeModel> DesignsModel::getCoPrimeModel() {
-    return _coPrimeModel;
+    return _getModel(_coPrimeModel, coPrimeDesignIndex);
 }
 
 shared_ptr<CPSModel> DesignsModel::getCPSModel() {
-    return _cpsModel;
+    return _getModel(_cpsModel, cpsDesignIndex);
 }
 
 shared_ptr<DiamondsModel> DesignsModel::getDiamondsModel() {
-    return _diamondsModel;
+    return _getModel(_diamondsModel, diamondsDesignIndex);
 }
 
 shared_ptr<EqualTemperamentModel> DesignsModel::getEqualTemperamentModel() {
-    return _equalTemperamentModel;
+    return _getModel(_equalTemperamentModel, equalTemperamentDesignIndex);
 }
 
 shared_ptr<EulerGenusModel> DesignsModel::getEulerGenusModel() {
-    return _eulerGenusModel;
+    return _getModel(_eulerGenusModel, eulerGenusDesignIndex);
 }
 
 shared_ptr<MorphModel> DesignsModel::getMorphModel() {
-    return _morphModel;
+    return _getModel(_morphModel, morphDesignIndex, _processor);
 }
 
 shared_ptr<PartchModel> DesignsModel::getPartchModel() {
-    return _partchModel;
+    return _getModel(_partchModel, partchDesignIndex, _processor);
 }
 shared_ptr<Persian17NorthIndianModel> DesignsModel::getPersian17NorthIndianModel() {
-    return _persian17NorthIndianModel;
+    return _getModel(_persian17NorthIndianModel, persian17NorthIndianDesignIndex);
 }
 
 shared_ptr<PresetsModel> DesignsModel::getPresetsModel() {
-    return _presetsModel;
+    return _getModel(_presetsModel, presetsDesignIndex);
 }
 
 shared_ptr<RecurrenceRelationModel> DesignsModel::getRecurrenceRelationModel() {
-    return _recurrenceRelationModel;
+    return _getModel(_recurrenceRelationModel, recurrenceRelationDesignIndex);
 }
 
 shared_ptr<ScalaModel> DesignsModel::getScalaModel() {
+    const ScopedLock sl(_lock);
+    if(_scalaModel == nullptr) {
+        _getModel(_scalaModel, scalaDesignIndex);
+        
+        // when a user scala file is deleted the favoritesmodel needs to validate the favorites/morph entries.
+        _scalaModel->addActionListener(_favoritesModelV2.get());
+    }
     return _scalaModel;
 }
 
 shared_ptr<TritriadicModel> DesignsModel::getTritriadicModel() {
-    return _tritriadicModel;
+    return _getModel(_tritriadicModel, tritriadicDesignIndex);
 }
 
 shared_ptr<FavoritesModelV2> DesignsModel::getFavoritesModelV2() {
@@ -704,5 +648,8 @@ void DesignsModel::showTritriadicTuning() {
 #pragma mark - update UI
 
 void DesignsModel::_tuningChangedUpdateUI() {
-    // NOP
+    // the Designs parameter changed, maybe on the audio thread: create the selected design's model here
+    auto const selected_design = static_cast<unsigned long>(*_apvts->getRawParameterValue(getDesignsParameterID().getParamID()));
+    _checkDesignIndex(selected_design);
+    _designModels[selected_design]();
 }
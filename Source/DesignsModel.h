@@ -85,6 +85,24 @@ public:
     static const String getTritriadicTuningChangedActionMessage() { return "TritriadicTuningChangedActionMessage"; }
     static const String getMorphTuningChangedActionMessage() { return "MorphTuningChangedActionMessage";}
     static const String getAppTuningChangedActionMessage() { return "AppTuningChangedActionMessage";} // UNUSED
+
+    // ADD NEW SCALE DESIGN HERE
+
+    // design indices: the values of the Designs parameter.
+    // The models are created on first use, so compare against these instead of getXModel()->getDesignIndex()
+    static constexpr int presetsDesignIndex = 0;
+    static constexpr int brun2DesignIndex = 1;
+    static constexpr int persian17NorthIndianDesignIndex = 2;
+    static constexpr int cpsDesignIndex = 3;
+    static constexpr int eulerGenusDesignIndex = 4;
+    static constexpr int recurrenceRelationDesignIndex = 5;
+    static constexpr int equalTemperamentDesignIndex = 6;
+    static constexpr int tritriadicDesignIndex = 7;
+    static constexpr int scalaDesignIndex = 8;
+    static constexpr int coPrimeDesignIndex = 9;
+    static constexpr int diamondsDesignIndex = 10;
+    static constexpr int morphDesignIndex = 11;
+    static constexpr int partchDesignIndex = 12;
     
     // lifecycle
     DesignsModel(WilsonicProcessor& processor);
@@ -97,11 +115,11 @@ public:
      * @brief Called only once: on construction of processor. Creates the parameters.
      * @return A unique pointer to the AudioProcessorParameterGroup.
      */
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;
+    unique_ptr<AudioProcessorParameterGroup> createParams();
 
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    String getGroupID();
+    String getGroupName();
+    String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // key for this design's Favorites array: for DesignArray it's weird
     StringArray getFavoritesParameterIDs() override; // used for Favorites
     void attachParameterListeners() override;
@@ -112,6 +130,7 @@ public:
     // ADD NEW SCALE DESIGN HERE
 
     // public methods
+    // the design models are created on first use; the app tuning and favorites models are created with this model
     shared_ptr<AppTuningModel> getAppTuningModel();
     shared_ptr<Brun2Model> getBrun2Model();
     shared_ptr<CoPrimeModel> getCoPrimeModel();
@@ -144,6 +163,7 @@ private:
     // ADD NEW SCALE DESIGN HERE
 
 #pragma mark - Tuning Models
+    // nullptr until first use
     shared_ptr<Brun2Model> _brun2Model;
     shared_ptr<CoPrimeModel> _coPrimeModel;
     shared_ptr<CPSModel> _cpsModel;
@@ -155,9 +175,11 @@ private:
     shared_ptr<RecurrenceRelationModel> _recurrenceRelationModel;
     shared_ptr<ScalaModel> _scalaModel;
     shared_ptr<TritriadicModel> _tritriadicModel;
-    shared_ptr<FavoritesModelV2> _favoritesModelV2;
     shared_ptr<MorphModel> _morphModel;
     shared_ptr<PartchModel> _partchModel;
+
+    // always
+    shared_ptr<FavoritesModelV2> _favoritesModelV2;
     shared_ptr<AppTuningModel> _appTuningModel;
 
 #pragma mark - members
@@ -165,14 +187,29 @@ private:
     vector<function<void()>> _functionNames {};
     StringArray _tuningChangedActionMessage {};
     vector<function<void()>> _tuningChangedFunctionNames {};
-    vector<String> _tuningDesignKeys {};
     vector<function<StringArray()>> _tuningParamIDsForFavorites {};
+    vector<function<shared_ptr<ModelBase>()>> _designModels {}; // the getters, by design index
+    vector<shared_ptr<ModelBase>> _models {}; // the models created so far
 
 #pragma mark - methods
     // private methods
     void _checkDesignIndex(unsigned long index);
     void _selectDesign(unsigned long index);
     void _updateAppTuning(unsigned long index);
+    void _addModel(shared_ptr<ModelBase> model, int designIndex);
+    void _tuningChanged(int designIndex, ModelBase& model);
+
+    // creates the design's model on first use
+    template<typename T, typename... Args>
+    shared_ptr<T> _getModel(shared_ptr<T>& model, int designIndex, Args&... args) {
+        const ScopedLock sl(_lock);
+        if(model == nullptr) {
+            model = make_shared<T>(args...);
+            model->addActionListener(this);
+            _addModel(model, designIndex);
+        }
+        return model;
+    }
 
     // ADD NEW SCALE DESIGN HERE
 
@@ -91,14 +91,14 @@ const StringArray DiamondsModel::__DAWKeys {
 #pragma mark - lifecycle
 
 DiamondsModel::DiamondsModel()
-: _A(CPS::A(1))
-, _B(CPS::B(3))
-, _C(CPS::C(5))
-, _D(CPS::D(7))
-, _E(CPS::E(9))
-, _F(CPS::F(11))
-, _G(CPS::G(13))
-, _H(CPS::H(15))
+: _A(CPS::A(defaultA))
+, _B(CPS::B(defaultB))
+, _C(CPS::C(defaultC))
+, _D(CPS::D(defaultD))
+, _E(CPS::E(defaultE))
+, _F(CPS::F(defaultF))
+, _G(CPS::G(defaultG))
+, _H(CPS::H(defaultH))
 {
     _selectedScaleIndex = 0;
     _updateScales(); // sets _numberOfSeeds, and scale
@@ -128,7 +128,7 @@ unique_ptr<AudioProcessorParameterGroup> DiamondsModel::createParams() {
                                                                 (getDiamonds_A_ParameterID(),
                                                                  getDiamonds_A_ParameterName(),
                                                                  NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-                                                                 _A->getFrequencyValue(),
+                                                                 defaultA,
                                                                  getDiamonds_A_ParameterName(),
                                                                  AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String(value).substring(0, maxLength); },
@@ -140,7 +140,7 @@ unique_ptr<AudioProcessorParameterGroup> DiamondsModel::createParams() {
                                                                 (getDiamonds_B_ParameterID(),
                                                                  getDiamonds_B_ParameterName(),
                                                                  NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-                                                                 _B->getFrequencyValue(),
+                                                                 defaultB,
                                                                  getDiamonds_B_ParameterName(),
                                                                  AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String(value).substring(0, maxLength); },
@@ -152,7 +152,7 @@ unique_ptr<AudioProcessorParameterGroup> DiamondsModel::createParams() {
                                                                 (getDiamonds_C_ParameterID(),
                                                                  getDiamonds_C_ParameterName(),
                                                                  NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-                                                                 _C->getFrequencyValue(),
+                                                                 defaultC,
                                                                  getDiamonds_C_ParameterName(),
                                                                  AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String(value).substring(0, maxLength); },
@@ -164,7 +164,7 @@ unique_ptr<AudioProcessorParameterGroup> DiamondsModel::createParams() {
                                                                 (getDiamonds_D_ParameterID(),
                                                                  getDiamonds_D_ParameterName(),
                                                                  NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-                                                                 _D->getFrequencyValue(),
+                                                                 defaultD,
                                                                  getDiamonds_D_ParameterName(),
                                                                  AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String(value).substring(0, maxLength); },
@@ -176,7 +176,7 @@ unique_ptr<AudioProcessorParameterGroup> DiamondsModel::createParams() {
                                                                 (getDiamonds_E_ParameterID(),
                                                                  getDiamonds_E_ParameterName(),
                                                                  NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-                                                                 _E->getFrequencyValue(),
+                                                                 defaultE,
                                                                  getDiamonds_E_ParameterName(),
                                                                  AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String(value).substring(0, maxLength); },
@@ -188,7 +188,7 @@ unique_ptr<AudioProcessorParameterGroup> DiamondsModel::createParams() {
                                                                 (getDiamonds_F_ParameterID(),
                                                                  getDiamonds_F_ParameterName(),
                                                                  NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-                                                                 _F->getFrequencyValue(),
+                                                                 defaultF,
                                                                  getDiamonds_F_ParameterName(),
                                                                  AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String(value).substring(0, maxLength); },
@@ -200,7 +200,7 @@ unique_ptr<AudioProcessorParameterGroup> DiamondsModel::createParams() {
                                                                 (getDiamonds_G_ParameterID(),
                                                                  getDiamonds_G_ParameterName(),
                                                                  NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-                                                                 _G->getFrequencyValue(),
+                                                                 defaultG,
                                                                  getDiamonds_G_ParameterName(),
                                                                  AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String(value).substring(0, maxLength); },
@@ -212,7 +212,7 @@ unique_ptr<AudioProcessorParameterGroup> DiamondsModel::createParams() {
                                                                 (getDiamonds_H_ParameterID(),
                                                                  getDiamonds_H_ParameterName(),
                                                                  NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-                                                                 _H->getFrequencyValue(),
+                                                                 defaultH,
                                                                  getDiamonds_H_ParameterName(),
                                                                  AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String(value).substring(0, maxLength); },
@@ -272,44 +272,59 @@ void DiamondsModel::detachParameterListeners() {
 // DAW callback when apvts changes
 void DiamondsModel::parameterChanged(const String& parameterID, float newValue) {
     const ScopedLock sl(_lock);
+    Microtone_p term = nullptr;
     if(parameterID == getDiamondsParameterID().getParamID()) {
         _selectedScaleIndex = static_cast<unsigned long>(newValue);
     } else if(parameterID == getDiamonds_A_ParameterID().getParamID()) {
         _A->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _A->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
         _A->setFrequencyValue(newValue);
+        term = _A;
     } else if(parameterID == getDiamonds_B_ParameterID().getParamID()) {
         _B->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _B->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
         _B->setFrequencyValue(newValue);
+        term = _B;
     } else if(parameterID == getDiamonds_C_ParameterID().getParamID()) {
         _C->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _C->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
         _C->setFrequencyValue(newValue);
+        term = _C;
     } else if(parameterID == getDiamonds_D_ParameterID().getParamID()) {
         _D->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _D->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
         _D->setFrequencyValue(newValue);
+        term = _D;
     } else if(parameterID == getDiamonds_E_ParameterID().getParamID()) {
         _E->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _E->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
         _E->setFrequencyValue(newValue);
+        term = _E;
     } else if(parameterID == getDiamonds_F_ParameterID().getParamID()) {
         _F->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _F->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
         _F->setFrequencyValue(newValue);
+        term = _F;
     } else if(parameterID == getDiamonds_G_ParameterID().getParamID()) {
         _G->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _G->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
         _G->setFrequencyValue(newValue);
+        term = _G;
     } else if(parameterID == getDiamonds_H_ParameterID().getParamID()) {
         _H->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _H->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
         _H->setFrequencyValue(newValue);
+        term = _H;
     } else {
         jassertfalse;
     }
 
+    // only the products that contain the term are recomputed, unless the diamond is not indexed
+    if(term != nullptr && _parent != nullptr && _parent->updateTerm(term)) {
+        uiNeedsUpdate();
+        return;
+    }
+
     _updateScales(); // update scales, sets _numberOfSeeds, and _diamond
 }
 
@@ -1013,6 +1028,9 @@ unsigned long DiamondsModel::getNumberOfSeeds()
 #pragma mark - update Designs model
 
 void DiamondsModel::_tuningChangedUpdateUI() {
+    if(_parent != nullptr) {
+        _parent->updateDescriptions(); // after automation
+    }
     sendActionMessage(DesignsModel::getDiamondsTuningChangedActionMessage());
 }
 
@@ -35,6 +35,14 @@ public:
     static constexpr float rangeMin = 1.f; ///< Minimum range for A,B,C,D,E,F,G,H
     static constexpr float rangeMax = 16384.f; ///< Maximum range for A,B,C,D,E,F,G,H
     static constexpr float rangeStep = 1.f; ///< Step size for A,B,C,D,E,F,G,H
+    static constexpr float defaultA = 1.f; ///< Default A,B,C,D,E,F,G,H: the parameter defaults
+    static constexpr float defaultB = 3.f;
+    static constexpr float defaultC = 5.f;
+    static constexpr float defaultD = 7.f;
+    static constexpr float defaultE = 9.f;
+    static constexpr float defaultF = 11.f;
+    static constexpr float defaultG = 13.f;
+    static constexpr float defaultH = 15.f;
     static const ParameterID getDiamondsParameterID() { return ParameterID ("DiamondsPRESET", AppVersion::getVersionHint()); } ///< Returns the ParameterID for DiamondsPRESET
     static const String getDiamondsParameterName() { return "Diamonds|Preset"; } ///< Returns the ParameterName for DiamondsPRESET
     static const ParameterID getDiamonds_A_ParameterID() { return ParameterID ("DiamondsA", AppVersion::getVersionHint()); } ///< Returns the ParameterID for DiamondsA
@@ -63,10 +71,10 @@ private:
 
 public:
     // called only once: on construction of processor
-    unique_ptr<AudioProcessorParameterGroup> createParams() override; ///< Creates parameters for the audio processor
-    String getGroupID() override; ///< Returns the group ID
-    String getGroupName() override; ///< Returns the group name
-    String getSubgroupSeparator() override; ///< Returns the subgroup separator
+    static unique_ptr<AudioProcessorParameterGroup> createParams(); ///< Creates parameters for the audio processor
+    static String getGroupID(); ///< Returns the group ID
+    static String getGroupName(); ///< Returns the group name
+    static String getSubgroupSeparator(); ///< Returns the subgroup separator
     ParameterID getDesignParameterID() override; ///< Returns the design parameter ID
     StringArray getFavoritesParameterIDs() override; ///< Returns the parameter IDs
     // called only once: when assigning _avpts
@@ -77,7 +85,7 @@ public:
     shared_ptr<Tuning> getTuning() override; ///< Returns the current tuning
     const shared_ptr<CPSTuningBase> getParentTuning(); ///< Returns the parent tuning
     unsigned long getNumScales(); ///< Returns the number of scales
-    const StringArray getScaleNames(); ///< Returns the names of the scales
+    static const StringArray getScaleNames(); ///< Returns the names of the scales
     unsigned long getNumberOfSeeds(); ///< Returns the number of seeds
     unsigned long uiGetSelectedScaleIndex(); ///< Returns the index of the selected scale
     void uiSelectScale (unsigned long index = 0); ///< Selects a scale by index
@@ -47,10 +47,10 @@ public:
     float uiGetPeriod();
 
     // called only once: on construction of processor
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    static unique_ptr<AudioProcessorParameterGroup> createParams();
+    static String getGroupID();
+    static String getGroupName();
+    static String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // key for this design's Favorites array
     StringArray getFavoritesParameterIDs() override; // used by processor to print apvts, and to store favorites
     void updateProperties() override;
@@ -8,17 +8,31 @@
  ==============================================================================
  */
 
-// creates the following files
+// creates EulerGenusModelCodegen/EulerGenusTables_include.txt and EulerGenusModelCodegen/EulerGenusTables+Data.cpp
 
 #include "EulerGenusModel.h"
+#include <fstream>
 
-unique_ptr<CodegenStream> EulerGenusModel::__stream_daw_keys_cpp {nullptr};
-unique_ptr<CodegenStream> EulerGenusModel::__stream_tuning_constructor_map_cpp {nullptr};
-unique_ptr<CodegenStream> EulerGenusModel::__stream_tuning_selection_map_cpp {nullptr};
-unique_ptr<CodegenStream> EulerGenusModel::__stream_tuning_update_map_cpp {nullptr};
-unique_ptr<CodegenStream> EulerGenusModel::__stream_view_model_constructor_map_cpp {nullptr};
 string EulerGenusModel::__daw_key_null = {"W_EG_CPS_LEAF"};
 
+vector<EulerGenusModel::CodegenDAWKey> EulerGenusModel::__codegenDAWKeys {};
+vector<EulerGenusModel::CodegenTuning> EulerGenusModel::__codegenTunings {};
+
+// A..F as bits; the tables rebuild the terms in A..F order, as the sorted codegen always wrote them
+EulerGenusTables::Terms EulerGenusModel::__codegenTerms (const vector<Microtone_p>& terms)
+{
+    EulerGenusTables::Terms retVal = 0;
+    for (auto t : terms)
+    {
+        auto const bit = t->getShortDescriptionText()[0] - 'A';
+        jassert (bit >= 0 && bit < static_cast<int> (EulerGenusTables::numTerms));
+        jassert (! (retVal & (1 << bit)));
+        retVal |= static_cast<EulerGenusTables::Terms> (1 << bit);
+    }
+
+    return retVal;
+}
+
 // generates static code for euler genus
 void EulerGenusModel::eulerGenusCodeGen()
 {
@@ -30,114 +44,8 @@ void EulerGenusModel::eulerGenusCodeGen()
 #else
     // enable codegen
     DBG ("eulerGenusCodeGen: running codegen");
-
-    // keys
-
-    // EulerGenusModel+_createDAWKeys.cpp
-    // DAWKeys are Strings in a StringArray
-    // they are added one by one
-    string daw_key_basename = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createDAWKeys_";
-    string daw_key_prefix = "#include \"../EulerGenusModel.h\"\n#include \"../EulerGenusViewModel.h\"\nvoid EulerGenusModel::_createDAWKeys_XXXX()\n{\n";
-    string daw_key_suffix = "\n}\n";
-    string daw_key_method_file_name = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createDAWKeys_methods.txt";
-    string daw_key_include_file_name = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createDAWKeys_include.txt";
-    __stream_daw_keys_cpp = make_unique<CodegenStream>(daw_key_basename,
-                                                       __num_entries_limit,
-                                                       daw_key_prefix,
-                                                       daw_key_suffix,
-                                                       "_createDAWKeys",
-                                                       daw_key_method_file_name,
-                                                       daw_key_include_file_name);
-    if (!__stream_daw_keys_cpp)
-    {
-        DBG ("error opening __createDAWKeys_cpp for output");
-        jassertfalse;
-    }
-
-    // tuning construction
-
-    // EulerGenusModel+_createTuningConstructorMap.cpp
-    string tuning_constructor_basename = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createTuningConstructorMap_";
-    string tuning_constructor_prefix = "#include \"../EulerGenusModel.h\"\n#include \"../EulerGenusViewModel.h\"\nvoid EulerGenusModel::_createTuningConstructorMap_XXXX()\n{\n   _tuningConstructorMap->insert ({\n";
-    string tuning_constructor_suffix = "\n });\n}\n";
-    string tuning_constructor_method_file_name = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createTuningConstructorMap_methods.txt";
-    string tuning_constructor_include_file_name = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createTuningConstructorMap_include.txt";
-    __stream_tuning_constructor_map_cpp = make_unique<CodegenStream>(tuning_constructor_basename,
-                                                                     __num_entries_limit,
-                                                                     tuning_constructor_prefix,
-                                                                     tuning_constructor_suffix,
-                                                                     "_createTuningConstructorMap",
-                                                                     tuning_constructor_method_file_name,
-                                                                     tuning_constructor_include_file_name);
-    if (!__stream_tuning_constructor_map_cpp)
-    {
-        DBG ("error opening __createTuningConstructorMap_cpp for output");
-        jassertfalse;
-    }
-
-    // tuning selection
-
-    // EulerGenusModel+_createTuningSelectionMap.cpp
-    string tuning_selection_basename = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createTuningSelectionMap_";
-    string tuning_selection_prefix = "#include \"../EulerGenusModel.h\"\n#include \"../EulerGenusViewModel.h\"\nvoid EulerGenusModel::_createTuningSelectionMap_XXXX()\n{\n   _tuningSelectionMap->insert ({\n";
-    string tuning_selection_suffix = "\n });\n}\n";
-    string tuning_selection_method_file_name = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createTuningSelectionMap_methods.txt";
-    string tuning_selection_include_file_name = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createTuningSelectionMap_include.txt";
-    __stream_tuning_selection_map_cpp = make_unique<CodegenStream>(tuning_selection_basename,
-                                                                   __num_entries_limit,
-                                                                   tuning_selection_prefix,
-                                                                   tuning_selection_suffix,
-                                                                   "_createTuningSelectionMap",
-                                                                   tuning_selection_method_file_name,
-                                                                   tuning_selection_include_file_name);
-    if (!__stream_tuning_selection_map_cpp)
-    {
-        DBG ("error opening __createTuningSelectionMap_cpp for output");
-        jassertfalse;
-    }
-
-
-    // tuning update
-
-    // EulerGenusModel+_createTuningUpdateMap.cpp
-    string tuning_update_basename = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createTuningUpdateMap_";
-    string tuning_update_prefix = "#include \"../EulerGenusModel.h\"\n#include \"../EulerGenusViewModel.h\"\nvoid EulerGenusModel::_createTuningUpdateMap_XXXX()\n{\n   _tuningUpdateMap->insert ({\n";
-    string tuning_update_suffix = "\n });\n}\n";
-    string tuning_update_method_file_name = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createTuningUpdateMap_methods.txt";
-    string tuning_update_include_file_name = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createTuningUpdateMap_include.txt";
-    __stream_tuning_update_map_cpp = make_unique<CodegenStream>(tuning_update_basename,
-                                                                __num_entries_limit,
-                                                                tuning_update_prefix,
-                                                                tuning_update_suffix,
-                                                                "_createTuningUpdateMap",
-                                                                tuning_update_method_file_name,
-                                                                tuning_update_include_file_name);
-    if (!__stream_tuning_update_map_cpp)
-    {
-        DBG ("error opening __createTuningUpdateMap_cpp for output");
-        jassertfalse;
-    }
-
-    // view models
-
-    // EulerGenusModel+_createViewModelConstructorMap.cpp
-    string vm_constructor_basename = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createViewModelConstructorMap_";
-    string vm_constructor_prefix = "#include \"../EulerGenusModel.h\"\n#include \"../EulerGenusViewModel.h\"\nvoid EulerGenusModel::_createViewModelConstructorMap_XXXX()\n{\n   _viewModelConstructorMap->insert ({\n";
-    string vm_constructor_suffix = "\n });\n}\n";
-    string vm_constructor_method_file_name = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createViewModelConstructorMap_methods.txt";
-    string vm_constructor_include_file_name = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/EulerGenusModel+_createViewModelConstructorMap_include.txt";
-    __stream_view_model_constructor_map_cpp = make_unique<CodegenStream>(vm_constructor_basename,
-                                                                         __num_entries_limit,
-                                                                         vm_constructor_prefix,
-                                                                         vm_constructor_suffix,
-                                                                         "_createViewModelConstructorMap",
-                                                                         vm_constructor_method_file_name,
-                                                                         vm_constructor_include_file_name);
-    if (!__stream_view_model_constructor_map_cpp)
-    {
-        DBG ("error opening __createViewModelConstructorMap_cpp for output");
-        jassertfalse;
-    }
+    __codegenDAWKeys.clear();
+    __codegenTunings.clear();
 
     /////////////////////////////////////////////
 #if 0
@@ -190,12 +98,99 @@ void EulerGenusModel::eulerGenusCodeGen()
     jassertfalse;
 #endif
 
-    // close all the files
-    __stream_daw_keys_cpp->close();
-    __stream_tuning_constructor_map_cpp->close();
-    __stream_tuning_selection_map_cpp->close();
-    __stream_tuning_update_map_cpp->close();
-    __stream_view_model_constructor_map_cpp->close();
+    // tunings are sorted by key.  DAW keys stay in walk order: the automation parameter value is the index.
+    sort (__codegenTunings.begin(), __codegenTunings.end(), [] (const CodegenTuning& a, const CodegenTuning& b) { return a.key < b.key; });
+    unordered_map<string, size_t> daw_key_index {};
+    vector<string_view> daw_keys {};
+    for (auto const& row : __codegenDAWKeys)
+    {
+        daw_key_index[row.key] = daw_keys.size();
+        daw_keys.push_back (row.key);
+    }
+    unordered_map<string, size_t> tuning_index {};
+    for (size_t i = 0; i < __codegenTunings.size(); i++)
+    {
+        tuning_index[__codegenTunings[i].key] = i;
+    }
+
+    // perfect hash of the DAW keys
+    auto const num_hash_buckets = daw_keys.size() / 4 + 1;
+    vector<uint16_t> hash_displacements {};
+    vector<uint16_t> hash_slots {};
+    auto const hashed = EulerGenusTables::buildPerfectHash (daw_keys, num_hash_buckets, hash_displacements, hash_slots);
+    jassert (hashed);
+
+    auto binary = [] (EulerGenusTables::Terms terms)
+    {
+        string retVal = "0b";
+        for (int bit = static_cast<int> (EulerGenusTables::numTerms) - 1; bit >= 0; bit--)
+        {
+            retVal += (terms & (1 << bit)) ? "1" : "0";
+        }
+
+        return retVal;
+    };
+    auto numbers = [] (ofstream& out, const vector<uint16_t>& values)
+    {
+        for (size_t i = 0; i < values.size(); i += 16)
+        {
+            out << "    ";
+            for (size_t j = i; j < std::min (i + 16, values.size()); j++)
+            {
+                out << (j > i ? ", " : "") << values[j];
+            }
+            out << ",\n";
+        }
+    };
+
+    // rows
+    const string codegen_directory = "/Users/marcushobbs/IPHONE_PRODUCTION/Wilsonic_2021_juce/Wilsonic/Source/EulerGenusModelCodegen/";
+    const string generated = "// generated by EulerGenusModel::eulerGenusCodeGen()\n";
+    ofstream data (codegen_directory + "EulerGenusTables+Data.cpp");
+    data << generated << "\n#include \"../EulerGenusTables.h\"\n\n";
+    data << "const std::array<EulerGenusTables::DAWKey, EulerGenusTables::numDAWKeys> EulerGenusTables::dawKeys {{\n";
+    for (auto const& row : __codegenDAWKeys)
+    {
+        data << "    {\"" << row.key << "\", " << tuning_index.at (row.tuning_key) << ", Selection::" << row.selection << ", \"" << row.back_key << "\", \"" << row.drill_key << "\"},\n";
+    }
+    data << "}};\n\n";
+    vector<uint16_t> subset_keys {};
+    data << "const std::array<EulerGenusTables::Tuning, EulerGenusTables::numTunings> EulerGenusTables::tunings {{\n";
+    for (auto const& row : __codegenTunings)
+    {
+        auto const s0 = subset_keys.size();
+        for (auto const& k : row.s0_keys)
+        {
+            subset_keys.push_back (static_cast<uint16_t> (daw_key_index.at (k)));
+        }
+        auto const s1 = subset_keys.size();
+        for (auto const& k : row.s1_keys)
+        {
+            subset_keys.push_back (static_cast<uint16_t> (daw_key_index.at (k)));
+        }
+        data << "    {\"" << row.key << "\", TuningClass::" << row.tuning_class << ", " << binary (row.master_set) << ", " << binary (row.common_tones) << ", \"" << row.parent_key << "\", "
+             << s0 << ", " << row.s0_keys.size() << ", " << s1 << ", " << row.s1_keys.size() << "},\n";
+    }
+    data << "}};\n\n";
+    data << "const std::array<uint16_t, EulerGenusTables::numSubsetKeys> EulerGenusTables::subsetKeys {{\n";
+    numbers (data, subset_keys);
+    data << "}};\n\n";
+    data << "const std::array<uint16_t, EulerGenusTables::numHashBuckets> EulerGenusTables::hashDisplacements {{\n";
+    numbers (data, hash_displacements);
+    data << "}};\n\n";
+    data << "const std::array<uint16_t, EulerGenusTables::numDAWKeys> EulerGenusTables::hashSlots {{\n";
+    numbers (data, hash_slots);
+    data << "}};\n";
+    data.close();
+
+    // sizes
+    ofstream include (codegen_directory + "EulerGenusTables_include.txt");
+    include << generated;
+    include << "    static constexpr size_t numDAWKeys = " << daw_keys.size() << ";\n";
+    include << "    static constexpr size_t numTunings = " << __codegenTunings.size() << ";\n";
+    include << "    static constexpr size_t numSubsetKeys = " << subset_keys.size() << ";\n";
+    include << "    static constexpr size_t numHashBuckets = " << num_hash_buckets << ";\n";
+    include.close();
 #endif
 
 }
@@ -211,78 +206,26 @@ void EulerGenusModel::codegenWalkCPSTuningBase (shared_ptr<CPSTuningBase> cpst,
     cpst->setShouldComputeSubsets (true);
     cpst->update();
 
-    // lambdas
+    // rows
 
     // daw keys are selection state
     // "CPS_6_3_A_B_C_D_E_F__CPS_6_3_A_B_C_D_E_F",
-    auto codegen_daw_keys = [](string in_daw_key)
+    auto codegen_daw_key = [](string in_daw_key, string in_tuning_key, string in_selection, string in_back_key, string in_drill_key)
     {
-        __stream_daw_keys_cpp->write (" _dawKeys->add(\"" + in_daw_key + "\");\n");
+        __codegenDAWKeys.push_back ({in_daw_key, in_tuning_key, in_selection, in_back_key, in_drill_key});
     };
 
-    // tuning constructor
-    auto codegen_tuning_constructor_map_cpp = [](string in_tuning_name, string in_tuning_create_lambda)
+    // tunings: constructed, and updated with ABCDEF, from the same row
+    auto codegen_tuning = [](shared_ptr<CPSTuningBase> in_cpst, string in_tuning_key, string in_parent_key, vector<string> in_s0_keys, vector<string> in_s1_keys)
     {
-        __stream_tuning_constructor_map_cpp->write ("{\"" + in_tuning_name + "\", " + in_tuning_create_lambda + "}," + "\n");
-    };
-
-    // tuning update
-    //{"CPS_6_3(A,B,C,D,E,F)", [this](){auto cps = _getTuning (tuning_key); cps->set ({_A,_B,_C,_D,_E}, {_F});}}
-    auto codegen_tuning_update_map_cpp = [](string in_tuning_key, string in_update_str)
-    {
-        __stream_tuning_update_map_cpp->write ("       {\"" + in_tuning_key + "\", [this](){auto cps = _getTuning (\"" + in_tuning_key + "\"); " + in_update_str + "}}," + "\n");
-    };
-
-    // tuning selection
-    auto codegen_tuning_selection_map_cpp = [](string in_select_key, bool in_select_parent, bool in_select_s0, bool in_select_s1, int in_s01_index)
-    {
-        string subset_selection_string = "";
-        if (in_select_parent)
-        {
-            subset_selection_string = "cps->selectParent();";
-        }
-        else if (in_select_s0)
-        {
-            switch (in_s01_index) {
-                case 0: subset_selection_string = "cps->selectS0_0();"; break;
-                case 1: subset_selection_string = "cps->selectS0_1();"; break;
-                case 2: subset_selection_string = "cps->selectS0_2();"; break;
-                case 3: subset_selection_string = "cps->selectS0_3();"; break;
-                case 4: subset_selection_string = "cps->selectS0_4();"; break;
-                case 5: subset_selection_string = "cps->selectS0_5();"; break;
-                default: jassertfalse;
-                    break;
-            }
-        }
-        else if (in_select_s1)
-        {
-            switch (in_s01_index) {
-                case 0: subset_selection_string = "cps->selectS1_0();"; break;
-                case 1: subset_selection_string = "cps->selectS1_1();"; break;
-                case 2: subset_selection_string = "cps->selectS1_2();"; break;
-                case 3: subset_selection_string = "cps->selectS1_3();"; break;
-                case 4: subset_selection_string = "cps->selectS1_4();"; break;
-                case 5: subset_selection_string = "cps->selectS1_5();"; break;
-                default: jassertfalse;
-                    break;
-            }
-        }
-        else
-        {
-            jassertfalse;
-        }
-
-        __stream_tuning_selection_map_cpp->write ("     {\"" + in_select_key + "\", " +
-                                                  "[this]() { auto vm = _getViewModel (\"" + in_select_key + "\"); " +
-                                                  "auto cps = vm->parentTuning; " + subset_selection_string + "}}," +
-                                                  "\n");
-    };
-
-    // view model
-    auto codegen_view_model_constructor_map_cpp = [](string in_daw_key, string in_tuning_key, string in_back_key, string in_select_key)
-    {
-        __stream_view_model_constructor_map_cpp->write ("       {\"" + in_daw_key + "\", [this](){return _create_view_model (\"" + in_daw_key + "\", \"" + in_tuning_key + "\", \"" + in_back_key + "\", \"" + in_select_key + "\");}}," +
-                                                        "\n");
+        jassert (in_s0_keys.size() <= 8 && in_s1_keys.size() <= 8);
+        __codegenTunings.push_back ({in_tuning_key,
+                                      in_cpst->getTuningName(),
+                                      __codegenTerms (in_cpst->getMasterSet()),
+                                      __codegenTerms (in_cpst->getCommonTones()),
+                                      in_parent_key,
+                                      in_s0_keys,
+                                      in_s1_keys});
     };
 
     // many leaf-level subsets are duplicates: keys must be unique for every path in every branch of the tree
@@ -328,19 +271,14 @@ void EulerGenusModel::codegenWalkCPSTuningBase (shared_ptr<CPSTuningBase> cpst,
     // For example, [almost] every "parent tuning" is both a selected parent, and a selected subset; exceptions at the leaves
     // So you have a daw key for a selected subset of a parent, and then a daw key for that subset as the parent tuning one level down
     auto daw_key_parent = create_daw_key (cpst, cpst);
-    auto create_str     = cpst->getTuningCreationCodegen (daw_key_parent, s0_daw_keys, s1_daw_keys);
     auto select_key     = daw_key_parent;
-    auto update_str     = cpst->getTuningUpdateCodegen();
 
     // codegen parent tuning: EulerGenus type has a tuning, but it has no selected parent, only selected subsets
     if (!cpst->isEulerGenusTuningType())
     {
-        codegen_daw_keys (daw_key_parent);
-        codegen_view_model_constructor_map_cpp (daw_key_parent, tuning_key, back_key, select_key);
-        codegen_tuning_selection_map_cpp (select_key, true, false, false, 0);
+        codegen_daw_key (daw_key_parent, tuning_key, "Parent", back_key, select_key);
     }
-    codegen_tuning_constructor_map_cpp (tuning_key, create_str); // only call on parent
-    codegen_tuning_update_map_cpp (tuning_key, update_str); // only call on parent
+    codegen_tuning (cpst, tuning_key, daw_key_parent, s0_daw_keys, s1_daw_keys); // only call on parent
 
     // print subsets and back
     // "back" equals selected subset's parent.  Only the parent has a "back" with a new parent
@@ -350,16 +288,12 @@ void EulerGenusModel::codegenWalkCPSTuningBase (shared_ptr<CPSTuningBase> cpst,
     {
         auto daw_key_s0    = create_daw_key (cpst, cpsts0);
         auto select_key_s0 = create_select_key (cpst, cpsts0);
-        codegen_daw_keys (daw_key_s0);
-        // do not call codegen_daw_keys (select_key_s0); // will be a dup
-        codegen_tuning_selection_map_cpp (daw_key_s0, false, true, false, index);
-
+        // do not add select_key_s0; it will be a dup
         auto big_enough_s0       = cpsts0->getProcessedArray().count() >= __cps_parent_as_leaf_min_size;
         auto select_key_s0_final = big_enough_s0 ? select_key_s0 : __daw_key_null;
-        codegen_view_model_constructor_map_cpp (daw_key_s0, tuning_key, daw_key_parent, select_key_s0_final);
+        codegen_daw_key (daw_key_s0, tuning_key, "S0_" + to_string (index), daw_key_parent, select_key_s0_final);
 
-        // do not call codegen_tuning_constructor_map_cpp
-        // do not call codegen_tuning_update_map_cpp
+        // do not call codegen_tuning
 
         index++;
     }
@@ -369,16 +303,12 @@ void EulerGenusModel::codegenWalkCPSTuningBase (shared_ptr<CPSTuningBase> cpst,
     {
         auto daw_key_s1    = create_daw_key (cpst, cpsts1);
         auto select_key_s1 = create_select_key (cpst, cpsts1);
-        codegen_daw_keys (daw_key_s1);
-        // do not call codegen_daw_keys (select_key_s1); // will be a dup
-        codegen_tuning_selection_map_cpp (daw_key_s1, false, false, true, index);
-
+        // do not add select_key_s1; it will be a dup
         auto big_enough_s1       = cpsts1->getProcessedArray().count() >= __cps_parent_as_leaf_min_size;
         auto select_key_s1_final = big_enough_s1 ? select_key_s1 : __daw_key_null;
-        codegen_view_model_constructor_map_cpp (daw_key_s1, tuning_key, daw_key_parent, select_key_s1_final);
+        codegen_daw_key (daw_key_s1, tuning_key, "S1_" + to_string (index), daw_key_parent, select_key_s1_final);
 
-        // do not call codegen_tuning_constructor_map_cpp
-        // do not call codegen_tuning_update_map_cpp
+        // do not call codegen_tuning
 
         index++;
     }
@@ -17,7 +17,11 @@
 unique_ptr<AudioProcessorParameterGroup> EulerGenusModel::createParams()
 {
     // Tuning Params
-    auto presetNames = *_dawKeys;
+    StringArray presetNames;
+    presetNames.ensureStorageAllocated(getNumDAWKeys());
+    for(int i = 0; i < getNumDAWKeys(); i++) {
+        presetNames.add(dawKeyAtIndex(i));
+    }
     auto presetParamGroup = make_unique<AudioProcessorParameterGroup>
     (getGroupID(), getGroupName(), getSubgroupSeparator(),
 
@@ -35,7 +39,7 @@ unique_ptr<AudioProcessorParameterGroup> EulerGenusModel::createParams()
      (getEulerGenus6AParameterID(),
       getEulerGenus6AParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _A->getFrequencyValue(),
+      defaultA,
       getEulerGenus6AParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -47,7 +51,7 @@ unique_ptr<AudioProcessorParameterGroup> EulerGenusModel::createParams()
      (getEulerGenus6BParameterID(),
       getEulerGenus6BParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _B->getFrequencyValue(),
+      defaultB,
       getEulerGenus6BParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -59,7 +63,7 @@ unique_ptr<AudioProcessorParameterGroup> EulerGenusModel::createParams()
      (getEulerGenus6CParameterID(),
       getEulerGenus6CParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _C->getFrequencyValue(),
+      defaultC,
       getEulerGenus6CParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -71,7 +75,7 @@ unique_ptr<AudioProcessorParameterGroup> EulerGenusModel::createParams()
      (getEulerGenus6DParameterID(),
       getEulerGenus6DParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _D->getFrequencyValue(),
+      defaultD,
       getEulerGenus6DParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -83,7 +87,7 @@ unique_ptr<AudioProcessorParameterGroup> EulerGenusModel::createParams()
      (getEulerGenus6EParameterID(),
       getEulerGenus6EParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _E->getFrequencyValue(),
+      defaultE,
       getEulerGenus6EParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -95,7 +99,7 @@ unique_ptr<AudioProcessorParameterGroup> EulerGenusModel::createParams()
      (getEulerGenus6FParameterID(),
       getEulerGenus6FParameterName(),
       NormalisableRange<float> (rangeMin, rangeMax, rangeStep),
-      _F->getFrequencyValue(),
+      defaultF,
       getEulerGenus6FParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
@@ -15,28 +15,19 @@
 #pragma mark - lifecycle
 
 EulerGenusModel::EulerGenusModel()
-: _A(CPS::A(1))
-, _B(CPS::B(3))
-, _C(CPS::C(5))
-, _D(CPS::D(7))
-, _E(CPS::E(9))
-, _F(CPS::F(11))
+: _A(CPS::A(defaultA))
+, _B(CPS::B(defaultB))
+, _C(CPS::C(defaultC))
+, _D(CPS::D(defaultD))
+, _E(CPS::E(defaultE))
+, _F(CPS::F(defaultF))
 {
-    // caches
-    _viewModelCache = make_unique<ViewModelCache>();
-    _tuningCache = make_unique<TuningCache>();
-
-    // keys
-    _createDAWKeys();
-
-    // lambda maps
-    _createViewModelConstructorMap();
-    _createTuningConstructorMap();
-    _createTuningUpdateMap();
-    _createTuningSelectionMap();
+    // caches: the keys, tunings, and view models are in EulerGenusTables
+    _viewModelCache = make_unique<ViewModelCache>(EulerGenusTables::numDAWKeys);
+    _tuningCache = make_unique<TuningCache>(EulerGenusTables::numTunings);
 
     // initial state
-    _selectDAWKey(dawKeyAtIndex(2)); // EG6 CPS_6_3
+    _selectDAWKey(2); // EG6 CPS_6_3
 }
 
 EulerGenusModel::~EulerGenusModel() {
@@ -64,9 +55,9 @@ void EulerGenusModel::detachParameterListeners() {
 // DAW callback when apvts changes
 void EulerGenusModel::parameterChanged(const String& parameterID, float newValue) {
     const ScopedLock sl(_lock);
+    Microtone_p term = nullptr;
     if(parameterID == getEulerGenus6ParameterID().getParamID()) {
-        auto daw_key =(*_dawKeys)[static_cast<int>(newValue)];
-        _selectDAWKey(daw_key);
+        _selectDAWKey(static_cast<int>(newValue));
 
         // _selectDAWKey() calls _updateCurrentViewModelTuning() and _tuningChangedUpdateUI() so return
         return;
@@ -74,32 +65,41 @@ void EulerGenusModel::parameterChanged(const String& parameterID, float newValue
         _A->setFrequencyValue(newValue);
         _A->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _A->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
+        term = _A;
     } else if(parameterID == getEulerGenus6BParameterID().getParamID()) {
         _B->setFrequencyValue(newValue);
         _B->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _B->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
+        term = _B;
     } else if(parameterID == getEulerGenus6CParameterID().getParamID()) {
         _C->setFrequencyValue(newValue);
         _C->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _C->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
+        term = _C;
     } else if(parameterID == getEulerGenus6DParameterID().getParamID()) {
         _D->setFrequencyValue(newValue);
         _D->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _D->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
+        term = _D;
     } else if(parameterID == getEulerGenus6EParameterID().getParamID()) {
         _E->setFrequencyValue(newValue);
         _E->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _E->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
+        term = _E;
     } else if(parameterID == getEulerGenus6FParameterID().getParamID()) {
         _F->setFrequencyValue(newValue);
         _F->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
         _F->setShortDescriptionText3(Microtone::getFrequencyValueDescription(newValue));
+        term = _F;
     } else {
         jassertfalse;
     }
 
-    // lazily update the right tuning
-    _updateCurrentViewModelTuning();
+    // only the products that contain the term are recomputed, unless the tuning is not indexed
+    if(term == nullptr || !_currentViewModel->parentTuning->updateTerm(term)) {
+        // lazily update the right tuning
+        _updateCurrentViewModelTuning();
+    }
     
     // mark UI needs updating
     uiNeedsUpdate();
@@ -119,33 +119,38 @@ unsigned long EulerGenusModel::getNumberOfSeeds()
 const int EulerGenusModel::getNumDAWKeys()
 {
     // immutable, so no need to lock
-    jassert(_dawKeys != nullptr); // should never happen
-    return _dawKeys->size();
+    return static_cast<int>(EulerGenusTables::numDAWKeys);
 }
 
 const DAWKey EulerGenusModel::dawKeyAtIndex(int index)
 {
-    // "immutable" after construction so no need to lock
-    jassert(_dawKeys != nullptr); // should never happen
+    // immutable, so no need to lock
     jassert(index >= 0);
-    jassert(index < _dawKeys->size());
-    
-    return (*_dawKeys)[index];
+    jassert(index < getNumDAWKeys());
+    auto const key = EulerGenusTables::dawKeys[static_cast<size_t>(index)].key;
+
+    return String(key.data(), key.size());
+}
+
+// perfect hash, no allocation
+int EulerGenusModel::findDAWKey(const DAWKey& daw_key)
+{
+    return EulerGenusTables::findDAWKey(string_view(daw_key.toRawUTF8(), daw_key.getNumBytesAsUTF8()));
 }
 
 // this is the heavy lifter...host calls this, no UI calls this
-void EulerGenusModel::_selectDAWKey(DAWKey daw_key) {
+void EulerGenusModel::_selectDAWKey(int daw_key_index) {
     // Lock
     const ScopedLock sl(_lock);
 
-    // leaf nodes are NOP
-    if(daw_key == String(__daw_key_null)) {
-        
+    // out of range is NOP
+    if(daw_key_index < 0 || daw_key_index >= getNumDAWKeys()) {
+        jassertfalse;
         return;
     }
 
     // lazy-load daw_key's view model
-    auto vm = _getViewModel(daw_key);
+    auto vm = _getViewModel(static_cast<size_t>(daw_key_index));
     _currentViewModel = vm;
     jassert(_currentViewModel != nullptr);
 
@@ -214,7 +219,7 @@ void EulerGenusModel::uiSelectDAWKey(DAWKey daw_key)
     }
 
     // key not found
-    auto index = _dawKeys->indexOf(daw_key);
+    auto index = findDAWKey(daw_key);
     if(index == -1)
     {
         // the only time this happens is for the EulerGenus page when you hit "back".
@@ -591,6 +596,9 @@ const shared_ptr<EulerGenusViewModel> EulerGenusModel::getViewModel() {
 // broadcast that tuning has changed: receivers(Components) will use getViewModel() to update UI state
 
 void EulerGenusModel::_tuningChangedUpdateUI() {
+    if(_currentViewModel != nullptr) {
+        _currentViewModel->parentTuning->updateDescriptions(); // after automation
+    }
     sendActionMessage(DesignsModel::getEulerGenusTuningChangedActionMessage());
 }
 
@@ -601,225 +609,149 @@ void EulerGenusModel::_setTuning(shared_ptr<Tuning> tuning) {
     _currentTuning = tuning;
 }
 
-// CODEGEN
 // updates the current view model's tuning with ABCDEF
 void EulerGenusModel::_updateCurrentViewModelTuning() {
     // update parent tuning, and all subsets
-    auto parentTuningKey = _currentViewModel->parentTuningKey;
-    auto ptkf =(*_tuningUpdateMap)[parentTuningKey];
-    jassert(ptkf != nullptr);
-    ptkf();
+    updateTuning(_currentViewModel->parentTuningIndex, _currentViewModel->parentTuning, _getMasterTerms());
 }
 
-// CODEGEN
 // updates the current view model's tuning's selection state
 void EulerGenusModel::_updateCurrentViewModelTuningSelectionState() {
     // update selection state of current view model's parent tuning
-    auto dawKey = _currentViewModel->dawKey;
-    auto ucvtss =(*_tuningSelectionMap)[dawKey];
-    jassert(ucvtss != nullptr);
-    ucvtss();
+    selectTuning(_currentViewModel->dawKeyIndex, _currentViewModel->parentTuning);
 }
 
-// CODEGEN
 // lazy loading: return value if key exists, else create, store, and return new value
 shared_ptr<EulerGenusViewModel> EulerGenusModel::_getViewModel(DAWKey daw_key) {
     jassert(daw_key.length() > 0);
-    ViewModelCache::const_iterator iter = _viewModelCache->find(daw_key);
+    auto const index = findDAWKey(daw_key);
+    if(index < 0) {
+        // bad
+        jassertfalse;
+        return nullptr;
+    }
 
-    if(iter != _viewModelCache->end()) {
-        // if view model exists return it
-        auto view_model = iter->second;
-        jassert(view_model != nullptr);
-        
-        return view_model;
-    } else {
-        // else create ViewModel and store in cache
-        auto view_model_constructor =(*_viewModelConstructorMap) [daw_key];
-        jassert(view_model_constructor != nullptr);
-        auto view_model = view_model_constructor(); // execute creation lambda
+    return _getViewModel(static_cast<size_t>(index));
+}
+
+shared_ptr<EulerGenusViewModel> EulerGenusModel::_getViewModel(size_t daw_key_index) {
+    auto& view_model = (*_viewModelCache)[daw_key_index];
+    if(view_model == nullptr) {
+        // create ViewModel and store in cache
+        auto const tuning_index = EulerGenusTables::dawKeys[daw_key_index].tuning;
+        view_model = createViewModel(daw_key_index, _getTuning(tuning_index));
         jassert(view_model != nullptr);
-       (*_viewModelCache)[daw_key] = view_model; // store in cache
-        
-        return view_model;
     }
 
-    // bad
-    jassertfalse;
-    return nullptr;
+    return view_model;
 }
 
-// CODEGEN
 // lazy loading: return value if key exists, else create, store, and return new value
-shared_ptr<CPSTuningBase> EulerGenusModel::_getTuning(TuningKey tuning_key) {
-    TuningCache::const_iterator iter = _tuningCache->find(tuning_key);
-    if(iter != _tuningCache->end()) {
-        // if tuning exists return it
-        shared_ptr<CPSTuningBase> tuning = nullptr;
-        tuning = iter->second;
+shared_ptr<CPSTuningBase> EulerGenusModel::_getTuning(size_t tuning_index) {
+    auto& tuning = (*_tuningCache)[tuning_index];
+    if(tuning == nullptr) {
+        // create tuning and store it
+        tuning = createTuning(tuning_index, _getMasterTerms());
         jassert(tuning != nullptr);
-        
-        return tuning;
-    } else {
-        // else create tuning and store it
-        auto tuning_constructor =(*_tuningConstructorMap) [tuning_key];
-        jassert(tuning_constructor != nullptr);
-        auto t = tuning_constructor();
-        jassert(t != nullptr);
-       (*_tuningCache)[tuning_key] = t;
-        
-        return t;
     }
 
-    // bad
-    jassertfalse;
-    return nullptr;
+    return tuning;
 }
 
-// CACHE
-// ONLY _getTuning calls this member function via lambda when there is no entry in _tuningCache
-shared_ptr<CPSTuningBase> EulerGenusModel::_create_tuning(CPS_Class tuning_class_name,
-                                                           vector<Microtone_p> master_set,
-                                                           vector<Microtone_p> common_terms,
-                                                           DAWKey parent_key,
-                                                           vector<DAWKey> s0_daw_keys,
-                                                           vector<DAWKey> s1_daw_keys)
-{
-    shared_ptr<CPSTuningBase> cps = nullptr;
-    switch(tuning_class_name) {
-        case CPS_Class::CPS_1_1:
-            cps = make_shared<CPS_1_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_2_1:
-            cps = make_shared<CPS_2_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_2_2:
-            cps = make_shared<CPS_2_2>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_3_1:
-            cps = make_shared<CPS_3_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_3_2:
-            cps = make_shared<CPS_3_2>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_3_3:
-            cps = make_shared<CPS_3_3>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_4_1:
-            cps = make_shared<CPS_4_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_4_2:
-            cps = make_shared<CPS_4_2>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_4_3:
-            cps = make_shared<CPS_4_3>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_4_4:
-            cps = make_shared<CPS_4_4>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_5_1:
-            cps = make_shared<CPS_5_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_5_2:
-            cps = make_shared<CPS_5_2>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_5_3:
-            cps = make_shared<CPS_5_3>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_5_4:
-            cps = make_shared<CPS_5_4>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_5_5:
-            cps = make_shared<CPS_5_5>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_1:
-            cps = make_shared<CPS_6_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_2:
-            cps = make_shared<CPS_6_2>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_3:
-            cps = make_shared<CPS_6_3>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_4:
-            cps = make_shared<CPS_6_4>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_5:
-            cps = make_shared<CPS_6_5>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_6:
-            cps = make_shared<CPS_6_6>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_1:
-            cps = make_shared<EulerGenus_1>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_2:
-            cps = make_shared<EulerGenus_2>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_3:
-            cps = make_shared<EulerGenus_3>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_4:
-            cps = make_shared<EulerGenus_4>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_5:
-            cps = make_shared<EulerGenus_5>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_6:
-            cps = make_shared<EulerGenus_6>(master_set, common_terms);
-            break;
-        case CPS_Class::UNDEFINED :
-        case CPS_Class::Triad:
-        case CPS_Class::TriadicDiamond:
-        case CPS_Class::Mandala:
-        case CPS_Class::Tetrad:
-        case CPS_Class::TetradicDiamond:
-        case CPS_Class::Pentad:
-        case CPS_Class::PentadicDiamond:
-        case CPS_Class::Hexad:
-        case CPS_Class::HexadicDiamond:
-        case CPS_Class::CPS_7_1:
-        case CPS_Class::Heptad:
-        case CPS_Class::HeptadicDiamond:
-        case CPS_Class::CPS_8_1:
-        case CPS_Class::Ogdoad:
-        case CPS_Class::OgdoadicDiamond:
-        default:
-            jassertfalse;
-            break;
+const MasterTerms EulerGenusModel::_getMasterTerms() {
+    return MasterTerms {_A, _B, _C, _D, _E, _F};
+}
+
+#pragma mark - tables
+
+const array<TuningFactory, static_cast<size_t>(EulerGenusTables::TuningClass::NumTuningClasses)> EulerGenusModel::__tuningFactories {
+    &__makeTuning<CPS_1_1>, &__makeTuning<CPS_2_1>, &__makeTuning<CPS_2_2>,
+    &__makeTuning<CPS_3_1>, &__makeTuning<CPS_3_2>, &__makeTuning<CPS_3_3>,
+    &__makeTuning<CPS_4_1>, &__makeTuning<CPS_4_2>, &__makeTuning<CPS_4_3>, &__makeTuning<CPS_4_4>,
+    &__makeTuning<CPS_5_1>, &__makeTuning<CPS_5_2>, &__makeTuning<CPS_5_3>, &__makeTuning<CPS_5_4>, &__makeTuning<CPS_5_5>,
+    &__makeTuning<CPS_6_1>, &__makeTuning<CPS_6_2>, &__makeTuning<CPS_6_3>, &__makeTuning<CPS_6_4>, &__makeTuning<CPS_6_5>, &__makeTuning<CPS_6_6>,
+    &__makeTuning<EulerGenus_1>, &__makeTuning<EulerGenus_2>, &__makeTuning<EulerGenus_3>,
+    &__makeTuning<EulerGenus_4>, &__makeTuning<EulerGenus_5>, &__makeTuning<EulerGenus_6>
+};
+
+const array<TuningSelector, static_cast<size_t>(EulerGenusTables::Selection::NumSelections)> EulerGenusModel::__tuningSelectors {
+    &CPSTuningBase::selectParent,
+    &CPSTuningBase::selectS0_0, &CPSTuningBase::selectS0_1, &CPSTuningBase::selectS0_2, &CPSTuningBase::selectS0_3,
+    &CPSTuningBase::selectS0_4, &CPSTuningBase::selectS0_5, &CPSTuningBase::selectS0_6, &CPSTuningBase::selectS0_7,
+    &CPSTuningBase::selectS1_0, &CPSTuningBase::selectS1_1, &CPSTuningBase::selectS1_2, &CPSTuningBase::selectS1_3,
+    &CPSTuningBase::selectS1_4, &CPSTuningBase::selectS1_5, &CPSTuningBase::selectS1_6, &CPSTuningBase::selectS1_7
+};
+
+// the terms of a row's set, in A..F order
+vector<Microtone_p> EulerGenusModel::__termsOf(EulerGenusTables::Terms terms, const MasterTerms& master_terms) {
+    vector<Microtone_p> retVal;
+    for(size_t i = 0; i < EulerGenusTables::numTerms; i++) {
+        if(terms & (1 << i)) {
+            retVal.push_back(master_terms[i]);
+        }
     }
 
+    return retVal;
+}
+
+// ONLY _getTuning calls this when there is no entry in _tuningCache
+shared_ptr<CPSTuningBase> EulerGenusModel::createTuning(size_t tuning_index, const MasterTerms& master_terms) {
+    jassert(tuning_index < EulerGenusTables::numTunings);
+    auto const& row = EulerGenusTables::tunings[tuning_index];
+    auto const factory = __tuningFactories[static_cast<size_t>(row.tuningClass)];
+    auto cps = factory(__termsOf(row.masterSet, master_terms), __termsOf(row.commonTones, master_terms));
+
     // subsets sizes and daw keys sizes must match
     jassert(cps != nullptr);
     cps->setShouldComputeSubsets(true); cps->update(); cps->selectParent();
-    jassert(cps->getSubsets0().size() == s0_daw_keys.size());
-    jassert(cps->getSubsets1().size() == s1_daw_keys.size());
+    jassert(cps->getSubsets0().size() == row.numSubsets0);
+    jassert(cps->getSubsets1().size() == row.numSubsets1);
 
     // set the daw keys for the parent and every subset
-    jassert(parent_key.length() > 0);
-    cps->setDAWKey(parent_key);
+    auto daw_key = [](string_view key) { return DAWKey(key.data(), key.size()); };
+    auto subset_key = [&](size_t index) { return daw_key(EulerGenusTables::dawKeys[EulerGenusTables::subsetKeys[index]].key); };
+    jassert(row.parentKey.size() > 0);
+    cps->setDAWKey(daw_key(row.parentKey));
     for(unsigned long index = 0; index < cps->getSubsets0().size(); index++) {
-        auto s0_daw_key = s0_daw_keys[index];
-        cps->getSubsets0()[index]->setDAWKey(s0_daw_key);
+        cps->getSubsets0()[index]->setDAWKey(subset_key(row.subsets0 + index));
     }
-    
+
     for(unsigned long index = 0; index < cps->getSubsets1().size(); index++) {
-        auto s1_daw_key = s1_daw_keys[index];
-        cps->getSubsets1()[index]->setDAWKey(s1_daw_key);
+        cps->getSubsets1()[index]->setDAWKey(subset_key(row.subsets1 + index));
     }
 
     return cps;
 }
 
-// CACHE
-// ONLY _getViewModel calls this member function via lambda when there is no entry in _tuningCache
-shared_ptr<EulerGenusViewModel> EulerGenusModel::_create_view_model(string daw_key, string tuning_key, string back_key, string select_key) {
+// when the host changes ABCDEF
+void EulerGenusModel::updateTuning(size_t tuning_index, shared_ptr<CPSTuningBase> tuning, const MasterTerms& master_terms) {
+    jassert(tuning_index < EulerGenusTables::numTunings);
+    jassert(tuning != nullptr);
+    auto const& row = EulerGenusTables::tunings[tuning_index];
+    tuning->set(__termsOf(row.masterSet, master_terms), __termsOf(row.commonTones, master_terms));
+}
+
+// selects the parent, or the subset, of the daw key
+void EulerGenusModel::selectTuning(size_t daw_key_index, shared_ptr<CPSTuningBase> parent_tuning) {
+    jassert(daw_key_index < EulerGenusTables::numDAWKeys);
+    jassert(parent_tuning != nullptr);
+    auto const selector = __tuningSelectors[static_cast<size_t>(EulerGenusTables::dawKeys[daw_key_index].selection)];
+    (parent_tuning.get()->*selector)();
+}
+
+// ONLY _getViewModel calls this when there is no entry in _viewModelCache
+shared_ptr<EulerGenusViewModel> EulerGenusModel::createViewModel(size_t daw_key_index, shared_ptr<CPSTuningBase> parent_tuning) {
+    jassert(daw_key_index < EulerGenusTables::numDAWKeys);
+    auto const& row = EulerGenusTables::dawKeys[daw_key_index];
+    auto const& tuning_row = EulerGenusTables::tunings[row.tuning];
     auto retVal = make_shared<EulerGenusViewModel>();
-    retVal->dawKey = daw_key;
-    retVal->parentTuningKey = tuning_key;
-    retVal->parentTuning = _getTuning(retVal->parentTuningKey);
-    retVal->dawBackKey = back_key;
-    retVal->dawDrillKey = select_key;
+    retVal->dawKey = DAWKey(row.key.data(), row.key.size());
+    retVal->dawKeyIndex = daw_key_index;
+    retVal->parentTuningKey = TuningKey(tuning_row.key.data(), tuning_row.key.size());
+    retVal->parentTuningIndex = row.tuning;
+    retVal->parentTuning = parent_tuning;
+    retVal->dawBackKey = DAWKey(row.backKey.data(), row.backKey.size());
+    retVal->dawDrillKey = DAWKey(row.drillKey.data(), row.drillKey.size());
     jassert(retVal != nullptr);
     
     return retVal;
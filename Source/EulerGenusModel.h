@@ -11,13 +11,13 @@
 #pragma once
 
 #include <JuceHeader.h>
-#include "CodegenStream.h"
 #include "EulerGenus_1.h"
 #include "EulerGenus_2.h"
 #include "EulerGenus_3.h"
 #include "EulerGenus_4.h"
 #include "EulerGenus_5.h"
 #include "EulerGenus_6.h"
+#include "EulerGenusTables.h"
 #include "ModelBase.h"
 #include "Tuning.h"
 #include "Tuning_Include.h"
@@ -36,6 +36,12 @@ public:
     static constexpr float rangeMin = 1.f; // A,B,C,D,E,F
     static constexpr float rangeMax = 16384.f; // A,B,C,D,E,F
     static constexpr float rangeStep = 1.f; // A,B,C,D,E,F
+    static constexpr float defaultA = 1.f; // default A,B,C,D,E,F: the parameter defaults
+    static constexpr float defaultB = 3.f;
+    static constexpr float defaultC = 5.f;
+    static constexpr float defaultD = 7.f;
+    static constexpr float defaultE = 9.f;
+    static constexpr float defaultF = 11.f;
 
     // static public methods
     static const ParameterID getEulerGenus6ParameterID() { return ParameterID("EULERGENUS6", AppVersion::getVersionHint()); }
@@ -53,19 +59,20 @@ public:
     static const ParameterID getEulerGenus6FParameterID() { return ParameterID("EULERGENUS6F", AppVersion::getVersionHint()); }
     static const String getEulerGenus6FParameterName() { return "Euler Genus 6|F"; }
 
-    // creates static code for 13+ files
+    // creates the EulerGenusTables rows and sizes
     static void eulerGenusCodeGen();
     static void codegenWalkCPSTuningBase(shared_ptr<CPSTuningBase> cpst, const string back, const string prefix);
-    static unique_ptr<CodegenStream> __stream_daw_keys_cpp;
-    static unique_ptr<CodegenStream> __stream_tuning_constructor_map_cpp;
-    static unique_ptr<CodegenStream> __stream_tuning_selection_map_cpp;
-    static unique_ptr<CodegenStream> __stream_tuning_update_map_cpp;
-    static unique_ptr<CodegenStream> __stream_view_model_constructor_map_cpp;
     // 3 ~ 13K strings === too many for DAWs
     // 4 ~ 3.5K strings === balance between perfection and DAW
     static constexpr int __cps_parent_as_leaf_min_size {4}; // parent npo on root component should be greater than equal
     static string __daw_key_null; // DAWKey for do-not-select
-    static constexpr int __num_entries_limit {256};
+
+    // the tunings and view models of the EulerGenusTables rows, with the terms A..F.  Shared with EulerGenusMorphModel.
+    static int findDAWKey(const DAWKey&); // index in EulerGenusTables::dawKeys, or -1
+    static shared_ptr<CPSTuningBase> createTuning(size_t tuning_index, const MasterTerms&);
+    static void updateTuning(size_t tuning_index, shared_ptr<CPSTuningBase>, const MasterTerms&);
+    static void selectTuning(size_t daw_key_index, shared_ptr<CPSTuningBase> parent_tuning);
+    static shared_ptr<EulerGenusViewModel> createViewModel(size_t daw_key_index, shared_ptr<CPSTuningBase> parent_tuning);
 
     // lifecycle
 public:
@@ -80,10 +87,10 @@ public:
     const shared_ptr<EulerGenusViewModel> getViewModel();
 
     // called only once: on construction of processor
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    static unique_ptr<AudioProcessorParameterGroup> createParams();
+    static String getGroupID();
+    static String getGroupName();
+    static String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // key for this design's Favorites array
     StringArray getFavoritesParameterIDs() override; // used for Favorites
     unsigned long getNumberOfSeeds(); // for SeedSlider
@@ -92,8 +99,8 @@ public:
     void updateProperties() override;
 
     // daw keys
-    const int getNumDAWKeys();
-    const DAWKey dawKeyAtIndex(int index); // used for morph
+    static const int getNumDAWKeys();
+    static const DAWKey dawKeyAtIndex(int index); // used for morph
 
     // UI methods:
     // UI notifies host that param has changed, host updates state, host notifies model, model updates tuning, model sends notification to update UI.  This handles the cold start flow too.
@@ -128,38 +135,29 @@ protected:
 
 private:
     // private methods
-    void _createDAWKeys(); // helper called only once on construction
-    void _createViewModelConstructorMap(); // helper called only once on construction
-    void _createTuningConstructorMap(); // helper called only once on construction
-    void _createTuningUpdateMap(); // helper called only once on construction
-    void _createTuningSelectionMap(); // helper called only once on construction
     void _tuningChangedUpdateUI() override; // sends notification to UI Component to query current ViewModel
-    void _selectDAWKey(DAWKey); // heavy lifter...called in host callback
+    void _selectDAWKey(int daw_key_index); // heavy lifter...called in host callback
     void _setTuning(shared_ptr<Tuning>); // helper called by _selectDAWKey
     void _updateCurrentViewModelTuning(); // update current view model's parent tuning when the host changes ABCDEF
     void _updateCurrentViewModelTuningSelectionState(); // update current view model's tuning's selection state
 
 public:
-    // IMPORTANT: if you rename this you need to update and rerun codegen
     shared_ptr<EulerGenusViewModel> _getViewModel(DAWKey); // helper for lazy loading of ViewModels into the cache
 
 private:
-    shared_ptr<CPSTuningBase> _getTuning(TuningKey); // helper for lazy loading of parent tunings into the cache
+    shared_ptr<EulerGenusViewModel> _getViewModel(size_t daw_key_index); // helper for lazy loading of ViewModels into the cache
+    shared_ptr<CPSTuningBase> _getTuning(size_t tuning_index); // helper for lazy loading of parent tunings into the cache
+    const MasterTerms _getMasterTerms(); // A..F
 
-    // keys
-    unique_ptr<DAWKeys> _dawKeys = nullptr; // keys hard coded at compile time: so big we split out in a codegen file
+    // keys are the read-only EulerGenusTables::dawKeys, generated at compile time
 
     // view models
     shared_ptr<EulerGenusViewModel> _currentViewModel = nullptr; // current view model getter, mostly for Components
     unique_ptr<ViewModelCache> _viewModelCache = nullptr; // lazy load ViewModels
-    unique_ptr<ViewModelConstructorMap> _viewModelConstructorMap = nullptr; // key, lambda for creating view model
 
     // tunings
     shared_ptr<Tuning> _currentTuning = nullptr; // current tuning getter, mostly for AppTuningModel
     unique_ptr<TuningCache> _tuningCache = nullptr; // lazy load parent tunings, which own/update subsets
-    unique_ptr<TuningConstructorMap> _tuningConstructorMap = nullptr; // called once on construction
-    unique_ptr<TuningUpdateFunctionMap> _tuningUpdateMap = nullptr; // called once on construction
-    unique_ptr<TuningSelectionFunctionMap> _tuningSelectionMap = nullptr; // called once on construction
 
     // stores of automation state of master set...all tunings are updated based on these
     Microtone_p _A = nullptr;
@@ -170,20 +168,34 @@ private:
     Microtone_p _F = nullptr;
 
     // codegen
-
-    // create tuning
-    shared_ptr<CPSTuningBase> _create_tuning(CPS_Class tuning_class_name, vector<Microtone_p> master_set, vector<Microtone_p> common_terms, DAWKey parent_key, vector<DAWKey> s0_daw_keys, vector<DAWKey> s1_daw_keys);
-
-    // update tuning is handled by inline lambdas
-    // select tuning is handled by inline lambdas
-
-    // create view model
-    shared_ptr<EulerGenusViewModel> _create_view_model(string daw_key, string tuning_key, string back_key, string select_key);
-
-    // codegen declarations
-#include "./EulerGenusModelCodegen/EulerGenusModel+_createDAWKeys_include.txt"
-#include "./EulerGenusModelCodegen/EulerGenusModel+_createTuningConstructorMap_include.txt"
-#include "./EulerGenusModelCodegen/EulerGenusModel+_createTuningSelectionMap_include.txt"
-#include "./EulerGenusModelCodegen/EulerGenusModel+_createTuningUpdateMap_include.txt"
-#include "./EulerGenusModelCodegen/EulerGenusModel+_createViewModelConstructorMap_include.txt"
+    struct CodegenDAWKey
+    {
+        string key;
+        string tuning_key;
+        string selection; // EulerGenusTables::Selection
+        string back_key;
+        string drill_key;
+    };
+    struct CodegenTuning
+    {
+        string key;
+        string tuning_class; // EulerGenusTables::TuningClass
+        EulerGenusTables::Terms master_set;
+        EulerGenusTables::Terms common_tones;
+        string parent_key;
+        vector<string> s0_keys;
+        vector<string> s1_keys;
+    };
+    static vector<CodegenDAWKey> __codegenDAWKeys; // rows collected by codegenWalkCPSTuningBase, in walk order
+    static vector<CodegenTuning> __codegenTunings;
+    static EulerGenusTables::Terms __codegenTerms(const vector<Microtone_p>&);
+
+    // dispatch for the rows
+    template<typename T>
+    static shared_ptr<CPSTuningBase> __makeTuning(vector<Microtone_p> master_set, vector<Microtone_p> common_tones) {
+        return make_shared<T>(master_set, common_tones);
+    }
+    static const array<TuningFactory, static_cast<size_t>(EulerGenusTables::TuningClass::NumTuningClasses)> __tuningFactories;
+    static const array<TuningSelector, static_cast<size_t>(EulerGenusTables::Selection::NumSelections)> __tuningSelectors;
+    static vector<Microtone_p> __termsOf(EulerGenusTables::Terms, const MasterTerms&);
 };
@@ -1,263 +0,0 @@
-#include "../EulerGenusModel.h"
-#include "../EulerGenusViewModel.h"
-void EulerGenusModel::_createDAWKeys_0002()
-{
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_B_C_D_F__X_A__CPS_3_1_C_D_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D__CPS_4_2_A_B_C_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D__CPS_3_1_A_B_C__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D__CPS_3_1_A_B_D__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D__CPS_3_1_A_C_D__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D__CPS_3_1_B_C_D__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D__CPS_3_2_A_B_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D__CPS_3_2_A_B_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D__CPS_3_2_A_C_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D__CPS_3_2_B_C_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F__CPS_4_2_A_B_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F__CPS_3_1_A_B_C__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F__CPS_3_1_A_B_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F__CPS_3_1_A_C_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F__CPS_3_1_B_C_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F__CPS_3_2_A_B_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F__CPS_3_2_A_B_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F__CPS_3_2_A_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F__CPS_3_2_B_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F__CPS_4_2_A_B_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F__CPS_3_1_A_B_D__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F__CPS_3_1_A_B_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F__CPS_3_1_A_D_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F__CPS_3_1_B_D_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F__CPS_3_2_A_B_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F__CPS_3_2_A_B_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F__CPS_3_2_A_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F__CPS_3_2_B_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F__CPS_4_2_A_C_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F__CPS_3_1_A_C_D__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F__CPS_3_1_A_C_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F__CPS_3_1_A_D_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F__CPS_3_1_C_D_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F__CPS_3_2_A_C_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F__CPS_3_2_A_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F__CPS_3_2_A_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F__CPS_3_2_C_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F__CPS_4_2_B_C_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F__CPS_3_1_B_C_D__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F__CPS_3_1_B_C_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F__CPS_3_1_B_D_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F__CPS_3_1_C_D_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F__CPS_3_2_B_C_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F__CPS_3_2_B_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F__CPS_3_2_B_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F__CPS_3_2_C_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_5_2_A_B_C_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_4_1_A_B_C_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_4_1_A_B_C_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_4_1_A_B_E_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_4_1_A_C_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_4_1_B_C_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_4_2_A_B_C_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_4_2_A_B_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_4_2_A_B_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_4_2_A_C_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__CPS_4_2_B_C_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_E__X_F__CPS_4_1_A_B_C_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_E__X_F__CPS_3_1_A_B_C__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_E__X_F__CPS_3_1_A_B_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_E__X_F__CPS_3_1_A_C_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_E__X_F__CPS_3_1_B_C_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_F__X_E__CPS_4_1_A_B_C_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_F__X_E__CPS_3_1_A_B_C__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_F__X_E__CPS_3_1_A_B_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_F__X_E__CPS_3_1_A_C_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_F__X_E__CPS_3_1_B_C_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_E_F__X_C__CPS_4_1_A_B_E_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_E_F__X_C__CPS_3_1_A_B_E__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_E_F__X_C__CPS_3_1_A_B_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_E_F__X_C__CPS_3_1_A_E_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_E_F__X_C__CPS_3_1_B_E_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_C_E_F__X_B__CPS_4_1_A_C_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_C_E_F__X_B__CPS_3_1_A_C_E__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_C_E_F__X_B__CPS_3_1_A_C_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_C_E_F__X_B__CPS_3_1_A_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_C_E_F__X_B__CPS_3_1_C_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_B_C_E_F__X_A__CPS_4_1_B_C_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_B_C_E_F__X_A__CPS_3_1_B_C_E__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_B_C_E_F__X_A__CPS_3_1_B_C_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_B_C_E_F__X_A__CPS_3_1_B_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_B_C_E_F__X_A__CPS_3_1_C_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E__CPS_4_2_A_B_C_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E__CPS_3_1_A_B_C__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E__CPS_3_1_A_B_E__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E__CPS_3_1_A_C_E__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E__CPS_3_1_B_C_E__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E__CPS_3_2_A_B_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E__CPS_3_2_A_B_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E__CPS_3_2_A_C_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E__CPS_3_2_B_C_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F__CPS_4_2_A_B_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F__CPS_3_1_A_B_C__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F__CPS_3_1_A_B_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F__CPS_3_1_A_C_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F__CPS_3_1_B_C_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F__CPS_3_2_A_B_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F__CPS_3_2_A_B_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F__CPS_3_2_A_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F__CPS_3_2_B_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F__CPS_4_2_A_B_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F__CPS_3_1_A_B_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F__CPS_3_1_A_B_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F__CPS_3_1_A_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F__CPS_3_1_B_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F__CPS_3_2_A_B_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F__CPS_3_2_A_B_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F__CPS_3_2_A_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F__CPS_3_2_B_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F__CPS_4_2_A_C_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F__CPS_3_1_A_C_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F__CPS_3_1_A_C_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F__CPS_3_1_A_E_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F__CPS_3_1_C_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F__CPS_3_2_A_C_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F__CPS_3_2_A_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F__CPS_3_2_A_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F__CPS_3_2_C_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F__CPS_4_2_B_C_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F__CPS_3_1_B_C_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F__CPS_3_1_B_C_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F__CPS_3_1_B_E_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F__CPS_3_1_C_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F__CPS_3_2_B_C_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F__CPS_3_2_B_C_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F__CPS_3_2_B_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F__CPS_3_2_C_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_5_2_A_B_D_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_4_1_A_B_D_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_4_1_A_B_D_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_4_1_A_B_E_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_4_1_A_D_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_4_1_B_D_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_4_2_A_B_D_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_4_2_A_B_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_4_2_A_B_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_4_2_A_D_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__CPS_4_2_B_D_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_E__X_F__CPS_4_1_A_B_D_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_E__X_F__CPS_3_1_A_B_D__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_E__X_F__CPS_3_1_A_B_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_E__X_F__CPS_3_1_A_D_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_E__X_F__CPS_3_1_B_D_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_F__X_E__CPS_4_1_A_B_D_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_F__X_E__CPS_3_1_A_B_D__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_F__X_E__CPS_3_1_A_B_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_F__X_E__CPS_3_1_A_D_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_F__X_E__CPS_3_1_B_D_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_E_F__X_D__CPS_4_1_A_B_E_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_E_F__X_D__CPS_3_1_A_B_E__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_E_F__X_D__CPS_3_1_A_B_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_E_F__X_D__CPS_3_1_A_E_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_E_F__X_D__CPS_3_1_B_E_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_D_E_F__X_B__CPS_4_1_A_D_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_D_E_F__X_B__CPS_3_1_A_D_E__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_D_E_F__X_B__CPS_3_1_A_D_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_D_E_F__X_B__CPS_3_1_A_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_D_E_F__X_B__CPS_3_1_D_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_B_D_E_F__X_A__CPS_4_1_B_D_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_B_D_E_F__X_A__CPS_3_1_B_D_E__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_B_D_E_F__X_A__CPS_3_1_B_D_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_B_D_E_F__X_A__CPS_3_1_B_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_B_D_E_F__X_A__CPS_3_1_D_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E__CPS_4_2_A_B_D_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E__CPS_3_1_A_B_D__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E__CPS_3_1_A_B_E__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E__CPS_3_1_A_D_E__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E__CPS_3_1_B_D_E__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E__CPS_3_2_A_B_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E__CPS_3_2_A_B_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E__CPS_3_2_A_D_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E__CPS_3_2_B_D_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F__CPS_4_2_A_B_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F__CPS_3_1_A_B_D__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F__CPS_3_1_A_B_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F__CPS_3_1_A_D_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F__CPS_3_1_B_D_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F__CPS_3_2_A_B_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F__CPS_3_2_A_B_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F__CPS_3_2_A_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F__CPS_3_2_B_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F__CPS_4_2_A_B_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F__CPS_3_1_A_B_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F__CPS_3_1_A_B_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F__CPS_3_1_A_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F__CPS_3_1_B_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F__CPS_3_2_A_B_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F__CPS_3_2_A_B_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F__CPS_3_2_A_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F__CPS_3_2_B_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F__CPS_4_2_A_D_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F__CPS_3_1_A_D_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F__CPS_3_1_A_D_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F__CPS_3_1_A_E_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F__CPS_3_1_D_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F__CPS_3_2_A_D_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F__CPS_3_2_A_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F__CPS_3_2_A_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F__CPS_3_2_D_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F__CPS_4_2_B_D_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F__CPS_3_1_B_D_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F__CPS_3_1_B_D_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F__CPS_3_1_B_E_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F__CPS_3_1_D_E_F__X_B");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F__CPS_3_2_B_D_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F__CPS_3_2_B_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F__CPS_3_2_B_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F__CPS_3_2_D_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_5_2_A_C_D_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_4_1_A_C_D_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_4_1_A_C_D_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_4_1_A_C_E_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_4_1_A_D_E_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_4_1_C_D_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_4_2_A_C_D_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_4_2_A_C_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_4_2_A_C_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_4_2_A_D_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__CPS_4_2_C_D_E_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_E__X_F__CPS_4_1_A_C_D_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_E__X_F__CPS_3_1_A_C_D__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_E__X_F__CPS_3_1_A_C_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_E__X_F__CPS_3_1_A_D_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_E__X_F__CPS_3_1_C_D_E__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_F__X_E__CPS_4_1_A_C_D_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_F__X_E__CPS_3_1_A_C_D__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_F__X_E__CPS_3_1_A_C_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_F__X_E__CPS_3_1_A_D_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_F__X_E__CPS_3_1_C_D_F__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_E_F__X_D__CPS_4_1_A_C_E_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_E_F__X_D__CPS_3_1_A_C_E__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_E_F__X_D__CPS_3_1_A_C_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_E_F__X_D__CPS_3_1_A_E_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_E_F__X_D__CPS_3_1_C_E_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_D_E_F__X_C__CPS_4_1_A_D_E_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_D_E_F__X_C__CPS_3_1_A_D_E__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_D_E_F__X_C__CPS_3_1_A_D_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_D_E_F__X_C__CPS_3_1_A_E_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_D_E_F__X_C__CPS_3_1_D_E_F__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_C_D_E_F__X_A__CPS_4_1_C_D_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_C_D_E_F__X_A__CPS_3_1_C_D_E__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_C_D_E_F__X_A__CPS_3_1_C_D_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_C_D_E_F__X_A__CPS_3_1_C_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_C_D_E_F__X_A__CPS_3_1_D_E_F__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E__CPS_4_2_A_C_D_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E__CPS_3_1_A_C_D__X_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E__CPS_3_1_A_C_E__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E__CPS_3_1_A_D_E__X_C");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E__CPS_3_1_C_D_E__X_A");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E__CPS_3_2_A_C_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E__CPS_3_2_A_C_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E__CPS_3_2_A_D_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E__CPS_3_2_C_D_E");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_F__CPS_4_2_A_C_D_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_F__CPS_3_1_A_C_D__X_F");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_F__CPS_3_1_A_C_F__X_D");
- _dawKeys->add("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_F__CPS_3_1_A_D_F__X_C");
-
-}
@@ -1,165 +0,0 @@
-#include "../EulerGenusModel.h"
-#include "../EulerGenusViewModel.h"
-void EulerGenusModel::_createTuningConstructorMap_0001()
-{
-   _tuningConstructorMap->insert ({
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_C_D_E_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_C,_D,_E,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_C_D_E_F__X_A__CPS_4_2_C_D_E_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_C_D_E_F__X_A__CPS_3_1_C_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_C_D_E_F__X_A__CPS_3_1_C_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_C_D_E_F__X_A__CPS_3_1_C_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_C_D_E_F__X_A__CPS_3_1_D_E_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_C_D_E_F__X_A__CPS_3_2_C_D_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_C_D_E_F__X_A__CPS_3_2_C_D_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_C_D_E_F__X_A__CPS_3_2_C_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_C_D_E_F__X_A__CPS_3_2_D_E_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_E},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_E__CPS_4_3_A_C_D_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_E__CPS_3_2_A_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_E__CPS_3_2_A_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_E__CPS_3_2_A_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_E__CPS_3_2_C_D_E__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_E__CPS_3_3_A_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_E__CPS_3_3_A_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_E__CPS_3_3_A_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_E__CPS_3_3_C_D_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_F__CPS_4_3_A_C_D_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_F__CPS_3_2_A_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_F__CPS_3_2_A_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_F__CPS_3_2_A_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_F__CPS_3_2_C_D_F__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_F__CPS_3_3_A_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_F__CPS_3_3_A_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_F__CPS_3_3_A_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_D_F__CPS_3_3_C_D_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_E_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_E_F__CPS_4_3_A_C_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_E_F__CPS_3_2_A_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_E_F__CPS_3_2_A_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_E_F__CPS_3_2_A_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_E_F__CPS_3_2_C_E_F__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_E_F__CPS_3_3_A_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_E_F__CPS_3_3_A_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_E_F__CPS_3_3_A_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_C_E_F__CPS_3_3_C_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_D_E_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_D,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_D_E_F__CPS_4_3_A_D_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_A_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_A_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_A_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_D_E_F__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_A_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_A_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_A_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_D_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_C_D_E_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_C,_D,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_C_D_E_F__CPS_4_3_C_D_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_2_C_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_2_C_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_2_C_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_2_D_E_F__X_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_3_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_3_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_3_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_3_D_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F", [this](){ return _create_tuning (CPS_Class::CPS_5_3,{_B,_C,_D,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_5_3_B_C_D_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_4_2_B_C_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_4_2_B_C_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_4_2_B_C_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_4_2_B_D_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_4_2_C_D_E_F__X_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_4_3_B_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_4_3_B_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_4_3_B_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_4_3_B_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__CPS_4_3_C_D_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_C,_D,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_E__X_F__CPS_4_2_B_C_D_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_E__X_F__CPS_3_1_B_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_E__X_F__CPS_3_1_B_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_E__X_F__CPS_3_1_B_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_E__X_F__CPS_3_1_C_D_E__X_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_E__X_F__CPS_3_2_B_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_E__X_F__CPS_3_2_B_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_E__X_F__CPS_3_2_B_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_E__X_F__CPS_3_2_C_D_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_C,_D,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_F__X_E__CPS_3_1_B_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_F__X_E__CPS_3_1_B_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_F__X_E__CPS_3_1_B_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_F__X_E__CPS_3_1_C_D_F__X_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_F__X_E__CPS_3_2_B_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_F__X_E__CPS_3_2_B_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_F__X_E__CPS_3_2_B_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_D_F__X_E__CPS_3_2_C_D_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_E_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_C,_E,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_E_F__X_D__CPS_3_1_B_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_E_F__X_D__CPS_3_1_B_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_E_F__X_D__CPS_3_1_B_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_E_F__X_D__CPS_3_1_C_E_F__X_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_E_F__X_D__CPS_3_2_B_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_E_F__X_D__CPS_3_2_B_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_E_F__X_D__CPS_3_2_B_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_C_E_F__X_D__CPS_3_2_C_E_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_D_E_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_D,_E,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_D_E_F__X_C__CPS_3_1_B_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_D_E_F__X_C__CPS_3_1_B_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_D_E_F__X_C__CPS_3_1_B_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_D_E_F__X_C__CPS_3_1_D_E_F__X_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_D_E_F__X_C__CPS_3_2_B_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_D_E_F__X_C__CPS_3_2_B_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_D_E_F__X_C__CPS_3_2_B_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_B_D_E_F__X_C__CPS_3_2_D_E_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_C_D_E_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_C,_D,_E,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_C_D_E_F__X_B__CPS_4_2_C_D_E_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_C_D_E_F__X_B__CPS_3_1_C_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_C_D_E_F__X_B__CPS_3_1_C_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_C_D_E_F__X_B__CPS_3_1_C_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_C_D_E_F__X_B__CPS_3_1_D_E_F__X_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_C_D_E_F__X_B__CPS_3_2_C_D_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_C_D_E_F__X_B__CPS_3_2_C_D_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_C_D_E_F__X_B__CPS_3_2_C_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_2_C_D_E_F__X_B__CPS_3_2_D_E_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_E},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_E__CPS_4_3_B_C_D_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_E__CPS_3_2_B_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_E__CPS_3_2_B_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_E__CPS_3_2_B_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_E__CPS_3_2_C_D_E__X_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_E__CPS_3_3_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_E__CPS_3_3_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_E__CPS_3_3_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_E__CPS_3_3_C_D_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_F__CPS_4_3_B_C_D_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_F__CPS_3_2_B_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_F__CPS_3_2_B_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_F__CPS_3_2_B_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_F__CPS_3_2_C_D_F__X_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_F__CPS_3_3_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_F__CPS_3_3_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_F__CPS_3_3_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_D_F__CPS_3_3_C_D_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_E_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_E_F__CPS_4_3_B_C_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_E_F__CPS_3_2_B_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_E_F__CPS_3_2_B_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_E_F__CPS_3_2_B_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_E_F__CPS_3_2_C_E_F__X_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_E_F__CPS_3_3_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_E_F__CPS_3_3_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_E_F__CPS_3_3_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_C_E_F__CPS_3_3_C_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_D_E_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_D,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_D_E_F__CPS_4_3_B_D_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_B_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_B_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_B_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_D_E_F__X_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_D_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_C_D_E_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_C,_D,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_C_D_E_F__CPS_4_3_C_D_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_2_C_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_2_C_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_2_C_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_2_D_E_F__X_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_3_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_3_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_3_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F||CPS_4_3_C_D_E_F__CPS_3_3_D_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F", [this](){ return _create_tuning (CPS_Class::CPS_6_4, {_A,_B,_C,_D,_E,_F}, {}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_6_4_A_B_C_D_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_3_A_B_C_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_3_A_B_C_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_3_A_B_C_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_3_A_B_D_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_3_A_C_D_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_3_B_C_D_E_F__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_4_A_B_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_4_A_B_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_4_A_B_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_4_A_B_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_4_A_C_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F__CPS_5_4_B_C_D_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_5_3,{_A,_B,_C,_D,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_5_3_A_B_C_D_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_4_2_A_B_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_4_2_A_B_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_4_2_A_B_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_4_2_A_C_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_4_2_B_C_D_E__X_A_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_4_3_A_B_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_4_3_A_B_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_4_3_A_B_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_4_3_A_C_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F__CPS_4_3_B_C_D_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_E_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_C,_D},{_E,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_E_F__CPS_4_2_A_B_C_D__X_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_E_F__CPS_3_1_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_E_F__CPS_3_1_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_E_F__CPS_3_1_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_E_F__CPS_3_1_B_C_D__X_A_E_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_E_F__CPS_3_2_A_B_C__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_E_F__CPS_3_2_A_B_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_E_F__CPS_3_2_A_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_E_F__CPS_3_2_B_C_D__X_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_D_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_C,_E},{_D,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_D_F__CPS_4_2_A_B_C_E__X_D_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_D_F__CPS_3_1_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_D_F__CPS_3_1_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_D_F__CPS_3_1_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_D_F__CPS_3_1_B_C_E__X_A_D_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_D_F__CPS_3_2_A_B_C__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_D_F__CPS_3_2_A_B_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_D_F__CPS_3_2_A_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_D_F__CPS_3_2_B_C_E__X_D_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_C_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_D,_E},{_C,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_C_F__CPS_4_2_A_B_D_E__X_C_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_C_F__CPS_3_1_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_C_F__CPS_3_1_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_C_F__CPS_3_1_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_C_F__CPS_3_1_B_D_E__X_A_C_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_C_F__CPS_3_2_A_B_D__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_C_F__CPS_3_2_A_B_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_C_F__CPS_3_2_A_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_C_F__CPS_3_2_B_D_E__X_C_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_B_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_C,_D,_E},{_B,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_B_F__CPS_4_2_A_C_D_E__X_B_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_B_F__CPS_3_1_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_B_F__CPS_3_1_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_B_F__CPS_3_1_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_B_F__CPS_3_1_C_D_E__X_A_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_B_F__CPS_3_2_A_C_D__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_B_F__CPS_3_2_A_C_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_B_F__CPS_3_2_A_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_B_F__CPS_3_2_C_D_E__X_B_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_A_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_C,_D,_E},{_A,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_A_F__CPS_4_2_B_C_D_E__X_A_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_A_F__CPS_3_1_B_C_D__X_A_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_A_F__CPS_3_1_B_C_E__X_A_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_A_F__CPS_3_1_B_D_E__X_A_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_A_F__CPS_3_1_C_D_E__X_A_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_A_F__CPS_3_2_B_C_D__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_A_F__CPS_3_2_B_C_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_A_F__CPS_3_2_B_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_A_F__CPS_3_2_C_D_E__X_A_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_D},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_F__CPS_4_3_A_B_C_D__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_F__CPS_3_2_A_B_C__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_F__CPS_3_2_A_B_D__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_F__CPS_3_2_A_C_D__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_F__CPS_3_2_B_C_D__X_A_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_F__CPS_3_3_A_B_C__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_F__CPS_3_3_A_B_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_F__CPS_3_3_A_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_F__CPS_3_3_B_C_D__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_F__CPS_4_3_A_B_C_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_F__CPS_3_2_A_B_C__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_F__CPS_3_2_A_B_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_F__CPS_3_2_A_C_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_F__CPS_3_2_B_C_E__X_A_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_F__CPS_3_3_A_B_C__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_F__CPS_3_3_A_B_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_F__CPS_3_3_A_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_F__CPS_3_3_B_C_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_F__CPS_4_3_A_B_D_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_F__CPS_3_2_A_B_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_F__CPS_3_2_A_B_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_F__CPS_3_2_A_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_F__CPS_3_2_B_D_E__X_A_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_F__CPS_3_3_A_B_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_F__CPS_3_3_A_B_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_F__CPS_3_3_A_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_F__CPS_3_3_B_D_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_F__CPS_4_3_A_C_D_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_F__CPS_3_2_A_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_F__CPS_3_2_A_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_F__CPS_3_2_A_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_F__CPS_3_2_C_D_E__X_A_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_F__CPS_3_3_A_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_F__CPS_3_3_A_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_F__CPS_3_3_A_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_F__CPS_3_3_C_D_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_F__CPS_4_3_B_C_D_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_F__CPS_3_2_B_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_F__CPS_3_2_B_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_F__CPS_3_2_B_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_F__CPS_3_2_C_D_E__X_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_F__CPS_3_3_B_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_F__CPS_3_3_B_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_F__CPS_3_3_B_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_F__CPS_3_3_C_D_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_5_3,{_A,_B,_C,_D,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_5_3_A_B_C_D_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_4_2_A_B_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_4_2_A_B_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_4_2_A_B_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_4_2_A_C_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_A_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_4_3_A_B_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_4_3_A_B_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_4_3_A_B_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_4_3_A_C_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E__CPS_4_3_B_C_D_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_C,_D},{_E,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E_F__CPS_4_2_A_B_C_D__X_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E_F__CPS_3_1_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E_F__CPS_3_1_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E_F__CPS_3_1_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E_F__CPS_3_1_B_C_D__X_A_E_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E_F__CPS_3_2_A_B_C__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E_F__CPS_3_2_A_B_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E_F__CPS_3_2_A_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E_F__CPS_3_2_B_C_D__X_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_D_E", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_C,_F},{_D,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_D_E__CPS_4_2_A_B_C_F__X_D_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_D_E__CPS_3_1_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_D_E__CPS_3_1_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_D_E__CPS_3_1_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_D_E__CPS_3_1_B_C_F__X_A_D_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_D_E__CPS_3_2_A_B_C__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_D_E__CPS_3_2_A_B_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_D_E__CPS_3_2_A_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_D_E__CPS_3_2_B_C_F__X_D_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_C_E", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_D,_F},{_C,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_C_E__CPS_4_2_A_B_D_F__X_C_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_C_E__CPS_3_1_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_C_E__CPS_3_1_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_C_E__CPS_3_1_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_C_E__CPS_3_1_B_D_F__X_A_C_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_C_E__CPS_3_2_A_B_D__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_C_E__CPS_3_2_A_B_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_C_E__CPS_3_2_A_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_C_E__CPS_3_2_B_D_F__X_C_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_B_E", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_C,_D,_F},{_B,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_B_E__CPS_4_2_A_C_D_F__X_B_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_B_E__CPS_3_1_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_B_E__CPS_3_1_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_B_E__CPS_3_1_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_B_E__CPS_3_1_C_D_F__X_A_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_B_E__CPS_3_2_A_C_D__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_B_E__CPS_3_2_A_C_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_B_E__CPS_3_2_A_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_B_E__CPS_3_2_C_D_F__X_B_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_A_E", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_C,_D,_F},{_A,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_A_E__CPS_4_2_B_C_D_F__X_A_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_A_E__CPS_3_1_B_C_D__X_A_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_A_E__CPS_3_1_B_C_F__X_A_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_A_E__CPS_3_1_B_D_F__X_A_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_A_E__CPS_3_1_C_D_F__X_A_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_A_E__CPS_3_2_B_C_D__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_A_E__CPS_3_2_B_C_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_A_E__CPS_3_2_B_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_A_E__CPS_3_2_C_D_F__X_A_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_D},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E__CPS_4_3_A_B_C_D__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E__CPS_3_2_A_B_C__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E__CPS_3_2_A_B_D__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E__CPS_3_2_A_C_D__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E__CPS_3_2_B_C_D__X_A_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E__CPS_3_3_A_B_C__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E__CPS_3_3_A_B_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E__CPS_3_3_A_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E__CPS_3_3_B_C_D__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_E__CPS_4_3_A_B_C_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_E__CPS_3_2_A_B_C__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_E__CPS_3_2_A_B_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_E__CPS_3_2_A_C_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_E__CPS_3_2_B_C_F__X_A_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_E__CPS_3_3_A_B_C__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_E__CPS_3_3_A_B_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_E__CPS_3_3_A_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_E__CPS_3_3_B_C_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_E__CPS_4_3_A_B_D_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_E__CPS_3_2_A_B_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_E__CPS_3_2_A_B_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_E__CPS_3_2_A_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_E__CPS_3_2_B_D_F__X_A_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_E__CPS_3_3_A_B_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_E__CPS_3_3_A_B_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_E__CPS_3_3_A_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_E__CPS_3_3_B_D_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_E__CPS_4_3_A_C_D_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_E__CPS_3_2_A_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_E__CPS_3_2_A_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_E__CPS_3_2_A_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_E__CPS_3_2_C_D_F__X_A_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_E__CPS_3_3_A_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_E__CPS_3_3_A_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_E__CPS_3_3_A_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_E__CPS_3_3_C_D_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_E__CPS_4_3_B_C_D_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_E__CPS_3_2_B_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_E__CPS_3_2_B_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_E__CPS_3_2_B_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_E__CPS_3_2_C_D_F__X_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_E__CPS_3_3_B_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_E__CPS_3_3_B_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_E__CPS_3_3_B_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_E__CPS_3_3_C_D_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_5_3,{_A,_B,_C,_E,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_5_3_A_B_C_E_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_4_2_A_B_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_4_2_A_B_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_4_2_A_B_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_4_2_A_C_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_A_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_4_3_A_B_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_4_3_A_B_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_4_3_A_B_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_4_3_A_C_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D__CPS_4_3_B_C_E_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_C,_E},{_D,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D_F__CPS_4_2_A_B_C_E__X_D_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D_F__CPS_3_1_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D_F__CPS_3_1_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D_F__CPS_3_1_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D_F__CPS_3_1_B_C_E__X_A_D_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D_F__CPS_3_2_A_B_C__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D_F__CPS_3_2_A_B_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D_F__CPS_3_2_A_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D_F__CPS_3_2_B_C_E__X_D_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D_E", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_C,_F},{_D,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D_E__CPS_4_2_A_B_C_F__X_D_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D_E__CPS_3_1_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D_E__CPS_3_1_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D_E__CPS_3_1_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D_E__CPS_3_1_B_C_F__X_A_D_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D_E__CPS_3_2_A_B_C__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D_E__CPS_3_2_A_B_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D_E__CPS_3_2_A_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D_E__CPS_3_2_B_C_F__X_D_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_C_D", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_E,_F},{_C,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_C_D__CPS_4_2_A_B_E_F__X_C_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_C_D__CPS_3_1_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_C_D__CPS_3_1_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_C_D__CPS_3_1_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_C_D__CPS_3_1_B_E_F__X_A_C_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_C_D__CPS_3_2_A_B_E__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_C_D__CPS_3_2_A_B_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_C_D__CPS_3_2_A_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_C_D__CPS_3_2_B_E_F__X_C_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_B_D", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_C,_E,_F},{_B,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_B_D__CPS_4_2_A_C_E_F__X_B_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_B_D__CPS_3_1_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_B_D__CPS_3_1_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_B_D__CPS_3_1_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_B_D__CPS_3_1_C_E_F__X_A_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_B_D__CPS_3_2_A_C_E__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_B_D__CPS_3_2_A_C_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_B_D__CPS_3_2_A_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_B_D__CPS_3_2_C_E_F__X_B_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_A_D", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_C,_E,_F},{_A,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_A_D__CPS_4_2_B_C_E_F__X_A_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_A_D__CPS_3_1_B_C_E__X_A_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_A_D__CPS_3_1_B_C_F__X_A_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_A_D__CPS_3_1_B_E_F__X_A_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_A_D__CPS_3_1_C_E_F__X_A_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_A_D__CPS_3_2_B_C_E__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_A_D__CPS_3_2_B_C_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_A_D__CPS_3_2_B_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_A_D__CPS_3_2_C_E_F__X_A_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_E},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D__CPS_4_3_A_B_C_E__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D__CPS_3_2_A_B_C__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D__CPS_3_2_A_B_E__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D__CPS_3_2_A_C_E__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D__CPS_3_2_B_C_E__X_A_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D__CPS_3_3_A_B_C__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D__CPS_3_3_A_B_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D__CPS_3_3_A_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D__CPS_3_3_B_C_E__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D__CPS_4_3_A_B_C_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D__CPS_3_2_A_B_C__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D__CPS_3_2_A_B_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D__CPS_3_2_A_C_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D__CPS_3_2_B_C_F__X_A_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D__CPS_3_3_A_B_C__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D__CPS_3_3_A_B_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D__CPS_3_3_A_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D__CPS_3_3_B_C_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_E,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_D__CPS_4_3_A_B_E_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_D__CPS_3_2_A_B_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_D__CPS_3_2_A_B_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_D__CPS_3_2_A_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_D__CPS_3_2_B_E_F__X_A_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_D__CPS_3_3_A_B_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_D__CPS_3_3_A_B_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_D__CPS_3_3_A_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_D__CPS_3_3_B_E_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_E,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_D__CPS_4_3_A_C_E_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_D__CPS_3_2_A_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_D__CPS_3_2_A_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_D__CPS_3_2_A_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_D__CPS_3_2_C_E_F__X_A_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_D__CPS_3_3_A_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_D__CPS_3_3_A_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_D__CPS_3_3_A_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_D__CPS_3_3_C_E_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_E,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_D__CPS_4_3_B_C_E_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_D__CPS_3_2_B_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_D__CPS_3_2_B_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_D__CPS_3_2_B_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_D__CPS_3_2_C_E_F__X_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_D__CPS_3_3_B_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_D__CPS_3_3_B_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_D__CPS_3_3_B_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_D__CPS_3_3_C_E_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_5_3,{_A,_B,_D,_E,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_5_3_A_B_D_E_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_4_2_A_B_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_4_2_A_B_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_4_2_A_B_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_4_2_A_D_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_4_3_A_B_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_4_3_A_B_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_4_3_A_B_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_4_3_A_D_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C__CPS_4_3_B_D_E_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_D,_E},{_C,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C_F__CPS_4_2_A_B_D_E__X_C_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C_F__CPS_3_1_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C_F__CPS_3_1_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C_F__CPS_3_1_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C_F__CPS_3_1_B_D_E__X_A_C_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C_F__CPS_3_2_A_B_D__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C_F__CPS_3_2_A_B_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C_F__CPS_3_2_A_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C_F__CPS_3_2_B_D_E__X_C_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C_E", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_D,_F},{_C,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C_E__CPS_4_2_A_B_D_F__X_C_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C_E__CPS_3_1_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C_E__CPS_3_1_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C_E__CPS_3_1_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C_E__CPS_3_1_B_D_F__X_A_C_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C_E__CPS_3_2_A_B_D__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C_E__CPS_3_2_A_B_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C_E__CPS_3_2_A_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C_E__CPS_3_2_B_D_F__X_C_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C_D", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_B,_E,_F},{_C,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C_D__CPS_4_2_A_B_E_F__X_C_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C_D__CPS_3_1_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C_D__CPS_3_1_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C_D__CPS_3_1_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C_D__CPS_3_1_B_E_F__X_A_C_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C_D__CPS_3_2_A_B_E__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C_D__CPS_3_2_A_B_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C_D__CPS_3_2_A_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C_D__CPS_3_2_B_E_F__X_C_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_B_C", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_D,_E,_F},{_B,_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_B_C__CPS_4_2_A_D_E_F__X_B_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_B_C__CPS_3_1_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_B_C__CPS_3_1_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_B_C__CPS_3_1_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_B_C__CPS_3_1_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_B_C__CPS_3_2_A_D_E__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_B_C__CPS_3_2_A_D_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_B_C__CPS_3_2_A_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_B_C__CPS_3_2_D_E_F__X_B_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_A_C", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_D,_E,_F},{_A,_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_A_C__CPS_4_2_B_D_E_F__X_A_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_A_C__CPS_3_1_B_D_E__X_A_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_A_C__CPS_3_1_B_D_F__X_A_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_A_C__CPS_3_1_B_E_F__X_A_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_A_C__CPS_3_1_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_A_C__CPS_3_2_B_D_E__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_A_C__CPS_3_2_B_D_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_A_C__CPS_3_2_B_E_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_A_C__CPS_3_2_D_E_F__X_A_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_E},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C__CPS_4_3_A_B_D_E__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C__CPS_3_2_A_B_D__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C__CPS_3_2_A_B_E__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C__CPS_3_2_A_D_E__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C__CPS_3_2_B_D_E__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C__CPS_3_3_A_B_D__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C__CPS_3_3_A_B_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C__CPS_3_3_A_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C__CPS_3_3_B_D_E__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C__CPS_4_3_A_B_D_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C__CPS_3_2_A_B_D__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C__CPS_3_2_A_B_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C__CPS_3_2_A_D_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C__CPS_3_2_B_D_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C__CPS_3_3_A_B_D__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C__CPS_3_3_A_B_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C__CPS_3_3_A_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C__CPS_3_3_B_D_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_E,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C__CPS_4_3_A_B_E_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C__CPS_3_2_A_B_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C__CPS_3_2_A_B_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C__CPS_3_2_A_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C__CPS_3_2_B_E_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C__CPS_3_3_A_B_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C__CPS_3_3_A_B_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C__CPS_3_3_A_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C__CPS_3_3_B_E_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_D,_E,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_C__CPS_4_3_A_D_E_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_C__CPS_3_2_A_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_C__CPS_3_2_A_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_C__CPS_3_2_A_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_C__CPS_3_2_D_E_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_C__CPS_3_3_A_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_C__CPS_3_3_A_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_C__CPS_3_3_A_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_C__CPS_3_3_D_E_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_D,_E,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_C__CPS_4_3_B_D_E_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_C__CPS_3_2_B_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_C__CPS_3_2_B_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_C__CPS_3_2_B_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_C__CPS_3_2_D_E_F__X_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_C__CPS_3_3_B_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_C__CPS_3_3_B_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_C__CPS_3_3_B_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_C__CPS_3_3_D_E_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_5_3,{_A,_C,_D,_E,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_5_3_A_C_D_E_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_4_2_A_C_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_4_2_A_C_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_4_2_A_C_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_4_2_A_D_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_4_2_C_D_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_4_3_A_C_D_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_4_3_A_C_D_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_4_3_A_C_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_4_3_A_D_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B__CPS_4_3_C_D_E_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_C,_D,_E},{_B,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B_F__CPS_4_2_A_C_D_E__X_B_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B_F__CPS_3_1_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B_F__CPS_3_1_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B_F__CPS_3_1_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B_F__CPS_3_1_C_D_E__X_A_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B_F__CPS_3_2_A_C_D__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B_F__CPS_3_2_A_C_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B_F__CPS_3_2_A_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B_F__CPS_3_2_C_D_E__X_B_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B_E", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_C,_D,_F},{_B,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B_E__CPS_4_2_A_C_D_F__X_B_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B_E__CPS_3_1_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B_E__CPS_3_1_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B_E__CPS_3_1_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B_E__CPS_3_1_C_D_F__X_A_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B_E__CPS_3_2_A_C_D__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B_E__CPS_3_2_A_C_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B_E__CPS_3_2_A_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B_E__CPS_3_2_C_D_F__X_B_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B_D", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_C,_E,_F},{_B,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B_D__CPS_4_2_A_C_E_F__X_B_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B_D__CPS_3_1_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B_D__CPS_3_1_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B_D__CPS_3_1_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B_D__CPS_3_1_C_E_F__X_A_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B_D__CPS_3_2_A_C_E__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B_D__CPS_3_2_A_C_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B_D__CPS_3_2_A_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B_D__CPS_3_2_C_E_F__X_B_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B_C", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_A,_D,_E,_F},{_B,_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B_C__CPS_4_2_A_D_E_F__X_B_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B_C__CPS_3_1_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B_C__CPS_3_1_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B_C__CPS_3_1_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B_C__CPS_3_1_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B_C__CPS_3_2_A_D_E__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B_C__CPS_3_2_A_D_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B_C__CPS_3_2_A_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B_C__CPS_3_2_D_E_F__X_B_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_A_B", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_C,_D,_E,_F},{_A,_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_A_B__CPS_4_2_C_D_E_F__X_A_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_A_B__CPS_3_1_C_D_E__X_A_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_A_B__CPS_3_1_C_D_F__X_A_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_A_B__CPS_3_1_C_E_F__X_A_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_A_B__CPS_3_1_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_A_B__CPS_3_2_C_D_E__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_A_B__CPS_3_2_C_D_F__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_A_B__CPS_3_2_C_E_F__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_A_B__CPS_3_2_D_E_F__X_A_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_E},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B__CPS_4_3_A_C_D_E__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B__CPS_3_2_A_C_D__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B__CPS_3_2_A_C_E__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B__CPS_3_2_A_D_E__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B__CPS_3_2_C_D_E__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B__CPS_3_3_A_C_D__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B__CPS_3_3_A_C_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B__CPS_3_3_A_D_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B__CPS_3_3_C_D_E__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B__CPS_4_3_A_C_D_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B__CPS_3_2_A_C_D__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B__CPS_3_2_A_C_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B__CPS_3_2_A_D_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B__CPS_3_2_C_D_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B__CPS_3_3_A_C_D__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B__CPS_3_3_A_C_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B__CPS_3_3_A_D_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B__CPS_3_3_C_D_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_E,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B__CPS_4_3_A_C_E_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B__CPS_3_2_A_C_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B__CPS_3_2_A_C_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B__CPS_3_2_A_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B__CPS_3_2_C_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B__CPS_3_3_A_C_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B__CPS_3_3_A_C_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B__CPS_3_3_A_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B__CPS_3_3_C_E_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_D,_E,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B__CPS_4_3_A_D_E_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B__CPS_3_2_A_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B__CPS_3_2_A_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B__CPS_3_2_A_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B__CPS_3_2_D_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B__CPS_3_3_A_D_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B__CPS_3_3_A_D_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B__CPS_3_3_A_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B__CPS_3_3_D_E_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_C,_D,_E,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_B__CPS_4_3_C_D_E_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_B__CPS_3_2_C_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_B__CPS_3_2_C_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_B__CPS_3_2_C_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_B__CPS_3_2_D_E_F__X_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_B__CPS_3_3_C_D_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_B__CPS_3_3_C_D_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_B__CPS_3_3_C_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_B__CPS_3_3_D_E_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_5_3,{_B,_C,_D,_E,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_5_3_B_C_D_E_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_4_2_B_C_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_4_2_B_C_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_4_2_B_C_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_4_2_B_D_E_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_4_2_C_D_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_4_3_B_C_D_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_4_3_B_C_D_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_4_3_B_C_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_4_3_B_D_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A__CPS_4_3_C_D_E_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A_F", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_C,_D,_E},{_A,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A_F__CPS_4_2_B_C_D_E__X_A_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A_F__CPS_3_1_B_C_D__X_A_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A_F__CPS_3_1_B_C_E__X_A_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A_F__CPS_3_1_B_D_E__X_A_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A_F__CPS_3_1_C_D_E__X_A_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A_F__CPS_3_2_B_C_D__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A_F__CPS_3_2_B_C_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A_F__CPS_3_2_B_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A_F__CPS_3_2_C_D_E__X_A_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A_E", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_C,_D,_F},{_A,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A_E__CPS_4_2_B_C_D_F__X_A_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A_E__CPS_3_1_B_C_D__X_A_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A_E__CPS_3_1_B_C_F__X_A_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A_E__CPS_3_1_B_D_F__X_A_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A_E__CPS_3_1_C_D_F__X_A_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A_E__CPS_3_2_B_C_D__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A_E__CPS_3_2_B_C_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A_E__CPS_3_2_B_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A_E__CPS_3_2_C_D_F__X_A_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A_D", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_C,_E,_F},{_A,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A_D__CPS_4_2_B_C_E_F__X_A_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A_D__CPS_3_1_B_C_E__X_A_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A_D__CPS_3_1_B_C_F__X_A_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A_D__CPS_3_1_B_E_F__X_A_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A_D__CPS_3_1_C_E_F__X_A_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A_D__CPS_3_2_B_C_E__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A_D__CPS_3_2_B_C_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A_D__CPS_3_2_B_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A_D__CPS_3_2_C_E_F__X_A_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A_C", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_B,_D,_E,_F},{_A,_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A_C__CPS_4_2_B_D_E_F__X_A_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A_C__CPS_3_1_B_D_E__X_A_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A_C__CPS_3_1_B_D_F__X_A_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A_C__CPS_3_1_B_E_F__X_A_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A_C__CPS_3_1_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A_C__CPS_3_2_B_D_E__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A_C__CPS_3_2_B_D_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A_C__CPS_3_2_B_E_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A_C__CPS_3_2_D_E_F__X_A_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A_B", [this](){ return _create_tuning (CPS_Class::CPS_4_2, {_C,_D,_E,_F},{_A,_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A_B__CPS_4_2_C_D_E_F__X_A_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A_B__CPS_3_1_C_D_E__X_A_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A_B__CPS_3_1_C_D_F__X_A_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A_B__CPS_3_1_C_E_F__X_A_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A_B__CPS_3_1_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A_B__CPS_3_2_C_D_E__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A_B__CPS_3_2_C_D_F__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A_B__CPS_3_2_C_E_F__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A_B__CPS_3_2_D_E_F__X_A_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_E},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A__CPS_4_3_B_C_D_E__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A__CPS_3_2_B_C_D__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A__CPS_3_2_B_C_E__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A__CPS_3_2_B_D_E__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A__CPS_3_2_C_D_E__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A__CPS_3_3_B_C_D__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A__CPS_3_3_B_C_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A__CPS_3_3_B_D_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A__CPS_3_3_C_D_E__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A__CPS_4_3_B_C_D_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A__CPS_3_2_B_C_D__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A__CPS_3_2_B_C_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A__CPS_3_2_B_D_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A__CPS_3_2_C_D_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A__CPS_3_3_B_C_D__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A__CPS_3_3_B_C_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A__CPS_3_3_B_D_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A__CPS_3_3_C_D_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_E,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A__CPS_4_3_B_C_E_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A__CPS_3_2_B_C_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A__CPS_3_2_B_C_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A__CPS_3_2_B_E_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A__CPS_3_2_C_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A__CPS_3_3_B_C_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A__CPS_3_3_B_C_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A__CPS_3_3_B_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A__CPS_3_3_C_E_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_D,_E,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A__CPS_4_3_B_D_E_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A__CPS_3_2_B_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A__CPS_3_2_B_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A__CPS_3_2_B_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A__CPS_3_2_D_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A__CPS_3_3_B_D_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A__CPS_3_3_B_D_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A__CPS_3_3_B_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A__CPS_3_3_D_E_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_C,_D,_E,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A__CPS_4_3_C_D_E_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A__CPS_3_2_C_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A__CPS_3_2_C_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A__CPS_3_2_C_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A__CPS_3_2_D_E_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A__CPS_3_3_C_D_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A__CPS_3_3_C_D_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A__CPS_3_3_C_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_3_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A__CPS_3_3_D_E_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_A,_B,_C,_D,_E},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_5_4_A_B_C_D_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_4_3_A_B_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_4_3_A_B_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_4_3_A_B_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_4_3_A_C_D_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_4_3_B_C_D_E__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_4_4_A_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_4_4_A_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_4_4_A_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_4_4_A_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__CPS_4_4_B_C_D_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_D__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_D},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_D__X_E__CPS_4_3_A_B_C_D__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_D__X_E__CPS_3_2_A_B_C__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_D__X_E__CPS_3_2_A_B_D__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_D__X_E__CPS_3_2_A_C_D__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_D__X_E__CPS_3_2_B_C_D__X_A_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_D__X_E__CPS_3_3_A_B_C__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_D__X_E__CPS_3_3_A_B_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_D__X_E__CPS_3_3_A_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_D__X_E__CPS_3_3_B_C_D__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_E__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_E},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_E__X_D__CPS_4_3_A_B_C_E__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_E__X_D__CPS_3_2_A_B_C__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_E__X_D__CPS_3_2_A_B_E__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_E__X_D__CPS_3_2_A_C_E__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_E__X_D__CPS_3_2_B_C_E__X_A_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_E__X_D__CPS_3_3_A_B_C__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_E__X_D__CPS_3_3_A_B_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_E__X_D__CPS_3_3_A_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_C_E__X_D__CPS_3_3_B_C_E__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_D_E__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_E},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_D_E__X_C__CPS_4_3_A_B_D_E__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_D_E__X_C__CPS_3_2_A_B_D__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_D_E__X_C__CPS_3_2_A_B_E__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_D_E__X_C__CPS_3_2_A_D_E__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_D_E__X_C__CPS_3_2_B_D_E__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_D_E__X_C__CPS_3_3_A_B_D__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_D_E__X_C__CPS_3_3_A_B_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_D_E__X_C__CPS_3_3_A_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_B_D_E__X_C__CPS_3_3_B_D_E__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_C_D_E__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_E},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_C_D_E__X_B__CPS_4_3_A_C_D_E__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_C_D_E__X_B__CPS_3_2_A_C_D__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_C_D_E__X_B__CPS_3_2_A_C_E__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_C_D_E__X_B__CPS_3_2_A_D_E__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_C_D_E__X_B__CPS_3_2_C_D_E__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_C_D_E__X_B__CPS_3_3_A_C_D__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_C_D_E__X_B__CPS_3_3_A_C_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_C_D_E__X_B__CPS_3_3_A_D_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_A_C_D_E__X_B__CPS_3_3_C_D_E__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_B_C_D_E__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_E},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_B_C_D_E__X_A__CPS_4_3_B_C_D_E__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_B_C_D_E__X_A__CPS_3_2_B_C_D__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_B_C_D_E__X_A__CPS_3_2_B_C_E__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_B_C_D_E__X_A__CPS_3_2_B_D_E__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_B_C_D_E__X_A__CPS_3_2_C_D_E__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_B_C_D_E__X_A__CPS_3_3_B_C_D__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_B_C_D_E__X_A__CPS_3_3_B_C_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_B_C_D_E__X_A__CPS_3_3_B_D_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E||CPS_4_3_B_C_D_E__X_A__CPS_3_3_C_D_E__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_A,_B,_C,_D,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_5_4_A_B_C_D_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_4_3_A_B_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_4_3_A_B_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_4_3_A_B_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_4_3_A_C_D_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_4_3_B_C_D_F__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_4_4_A_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_4_4_A_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_4_4_A_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_4_4_A_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__CPS_4_4_B_C_D_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_D__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_D},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_D__X_F__CPS_4_3_A_B_C_D__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_D__X_F__CPS_3_2_A_B_C__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_D__X_F__CPS_3_2_A_B_D__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_D__X_F__CPS_3_2_A_C_D__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_D__X_F__CPS_3_2_B_C_D__X_A_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_D__X_F__CPS_3_3_A_B_C__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_D__X_F__CPS_3_3_A_B_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_D__X_F__CPS_3_3_A_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_D__X_F__CPS_3_3_B_C_D__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_F__X_D__CPS_4_3_A_B_C_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_F__X_D__CPS_3_2_A_B_C__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_F__X_D__CPS_3_2_A_B_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_F__X_D__CPS_3_2_A_C_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_F__X_D__CPS_3_2_B_C_F__X_A_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_F__X_D__CPS_3_3_A_B_C__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_F__X_D__CPS_3_3_A_B_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_F__X_D__CPS_3_3_A_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_C_F__X_D__CPS_3_3_B_C_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_D_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_D_F__X_C__CPS_4_3_A_B_D_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_D_F__X_C__CPS_3_2_A_B_D__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_D_F__X_C__CPS_3_2_A_B_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_D_F__X_C__CPS_3_2_A_D_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_D_F__X_C__CPS_3_2_B_D_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_D_F__X_C__CPS_3_3_A_B_D__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_D_F__X_C__CPS_3_3_A_B_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_D_F__X_C__CPS_3_3_A_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_B_D_F__X_C__CPS_3_3_B_D_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_C_D_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_C_D_F__X_B__CPS_4_3_A_C_D_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_C_D_F__X_B__CPS_3_2_A_C_D__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_C_D_F__X_B__CPS_3_2_A_C_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_C_D_F__X_B__CPS_3_2_A_D_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_C_D_F__X_B__CPS_3_2_C_D_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_C_D_F__X_B__CPS_3_3_A_C_D__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_C_D_F__X_B__CPS_3_3_A_C_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_C_D_F__X_B__CPS_3_3_A_D_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_A_C_D_F__X_B__CPS_3_3_C_D_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_B_C_D_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_B_C_D_F__X_A__CPS_4_3_B_C_D_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_B_C_D_F__X_A__CPS_3_2_B_C_D__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_B_C_D_F__X_A__CPS_3_2_B_C_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_B_C_D_F__X_A__CPS_3_2_B_D_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_B_C_D_F__X_A__CPS_3_2_C_D_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_B_C_D_F__X_A__CPS_3_3_B_C_D__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_B_C_D_F__X_A__CPS_3_3_B_C_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_B_C_D_F__X_A__CPS_3_3_B_D_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F||CPS_4_3_B_C_D_F__X_A__CPS_3_3_C_D_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_A,_B,_C,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_5_4_A_B_C_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_4_3_A_B_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_4_3_A_B_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_4_3_A_B_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_4_3_A_C_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_4_3_B_C_E_F__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_4_4_A_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_4_4_A_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_4_4_A_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_4_4_A_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__CPS_4_4_B_C_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_E__X_F__CPS_4_3_A_B_C_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_E__X_F__CPS_3_2_A_B_C__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_E__X_F__CPS_3_2_A_B_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_E__X_F__CPS_3_2_A_C_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_E__X_F__CPS_3_2_B_C_E__X_A_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_E__X_F__CPS_3_3_A_B_C__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_E__X_F__CPS_3_3_A_B_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_E__X_F__CPS_3_3_A_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_E__X_F__CPS_3_3_B_C_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_F__X_E__CPS_4_3_A_B_C_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_F__X_E__CPS_3_2_A_B_C__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_F__X_E__CPS_3_2_A_B_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_F__X_E__CPS_3_2_A_C_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_F__X_E__CPS_3_2_B_C_F__X_A_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_F__X_E__CPS_3_3_A_B_C__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_F__X_E__CPS_3_3_A_B_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_F__X_E__CPS_3_3_A_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_C_F__X_E__CPS_3_3_B_C_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_E_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_E,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_E_F__X_C__CPS_4_3_A_B_E_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_E_F__X_C__CPS_3_2_A_B_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_E_F__X_C__CPS_3_2_A_B_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_E_F__X_C__CPS_3_2_A_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_E_F__X_C__CPS_3_2_B_E_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_E_F__X_C__CPS_3_3_A_B_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_E_F__X_C__CPS_3_3_A_B_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_E_F__X_C__CPS_3_3_A_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_B_E_F__X_C__CPS_3_3_B_E_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_C_E_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_E,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_C_E_F__X_B__CPS_4_3_A_C_E_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_C_E_F__X_B__CPS_3_2_A_C_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_C_E_F__X_B__CPS_3_2_A_C_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_C_E_F__X_B__CPS_3_2_A_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_C_E_F__X_B__CPS_3_2_C_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_C_E_F__X_B__CPS_3_3_A_C_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_C_E_F__X_B__CPS_3_3_A_C_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_C_E_F__X_B__CPS_3_3_A_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_A_C_E_F__X_B__CPS_3_3_C_E_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_B_C_E_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_E,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_B_C_E_F__X_A__CPS_4_3_B_C_E_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_B_C_E_F__X_A__CPS_3_2_B_C_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_B_C_E_F__X_A__CPS_3_2_B_C_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_B_C_E_F__X_A__CPS_3_2_B_E_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_B_C_E_F__X_A__CPS_3_2_C_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_B_C_E_F__X_A__CPS_3_3_B_C_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_B_C_E_F__X_A__CPS_3_3_B_C_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_B_C_E_F__X_A__CPS_3_3_B_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F||CPS_4_3_B_C_E_F__X_A__CPS_3_3_C_E_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_A,_B,_D,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_5_4_A_B_D_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_4_3_A_B_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_4_3_A_B_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_4_3_A_B_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_4_3_A_D_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_4_3_B_D_E_F__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_4_4_A_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_4_4_A_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_4_4_A_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_4_4_A_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__CPS_4_4_B_D_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_E__X_F__CPS_4_3_A_B_D_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_E__X_F__CPS_3_2_A_B_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_E__X_F__CPS_3_2_A_B_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_E__X_F__CPS_3_2_A_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_E__X_F__CPS_3_2_B_D_E__X_A_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_E__X_F__CPS_3_3_A_B_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_E__X_F__CPS_3_3_A_B_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_E__X_F__CPS_3_3_A_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_E__X_F__CPS_3_3_B_D_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_F__X_E__CPS_4_3_A_B_D_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_F__X_E__CPS_3_2_A_B_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_F__X_E__CPS_3_2_A_B_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_F__X_E__CPS_3_2_A_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_F__X_E__CPS_3_2_B_D_F__X_A_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_F__X_E__CPS_3_3_A_B_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_F__X_E__CPS_3_3_A_B_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_F__X_E__CPS_3_3_A_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_D_F__X_E__CPS_3_3_B_D_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_E_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_E,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_E_F__X_D__CPS_4_3_A_B_E_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_E_F__X_D__CPS_3_2_A_B_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_E_F__X_D__CPS_3_2_A_B_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_E_F__X_D__CPS_3_2_A_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_E_F__X_D__CPS_3_2_B_E_F__X_A_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_E_F__X_D__CPS_3_3_A_B_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_E_F__X_D__CPS_3_3_A_B_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_E_F__X_D__CPS_3_3_A_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_B_E_F__X_D__CPS_3_3_B_E_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_D_E_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_D,_E,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_D_E_F__X_B__CPS_4_3_A_D_E_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_D_E_F__X_B__CPS_3_2_A_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_D_E_F__X_B__CPS_3_2_A_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_D_E_F__X_B__CPS_3_2_A_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_D_E_F__X_B__CPS_3_2_D_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_D_E_F__X_B__CPS_3_3_A_D_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_D_E_F__X_B__CPS_3_3_A_D_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_D_E_F__X_B__CPS_3_3_A_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_A_D_E_F__X_B__CPS_3_3_D_E_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_B_D_E_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_D,_E,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_B_D_E_F__X_A__CPS_4_3_B_D_E_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_B_D_E_F__X_A__CPS_3_2_B_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_B_D_E_F__X_A__CPS_3_2_B_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_B_D_E_F__X_A__CPS_3_2_B_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_B_D_E_F__X_A__CPS_3_2_D_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_B_D_E_F__X_A__CPS_3_3_B_D_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_B_D_E_F__X_A__CPS_3_3_B_D_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_B_D_E_F__X_A__CPS_3_3_B_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F||CPS_4_3_B_D_E_F__X_A__CPS_3_3_D_E_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_A,_C,_D,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_5_4_A_C_D_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_4_3_A_C_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_4_3_A_C_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_4_3_A_C_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_4_3_A_D_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_4_3_C_D_E_F__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_4_4_A_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_4_4_A_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_4_4_A_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_4_4_A_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__CPS_4_4_C_D_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_E__X_F__CPS_4_3_A_C_D_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_E__X_F__CPS_3_2_A_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_E__X_F__CPS_3_2_A_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_E__X_F__CPS_3_2_A_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_E__X_F__CPS_3_2_C_D_E__X_A_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_E__X_F__CPS_3_3_A_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_E__X_F__CPS_3_3_A_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_E__X_F__CPS_3_3_A_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_E__X_F__CPS_3_3_C_D_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_F__X_E__CPS_4_3_A_C_D_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_F__X_E__CPS_3_2_A_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_F__X_E__CPS_3_2_A_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_F__X_E__CPS_3_2_A_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_F__X_E__CPS_3_2_C_D_F__X_A_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_F__X_E__CPS_3_3_A_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_F__X_E__CPS_3_3_A_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_F__X_E__CPS_3_3_A_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_D_F__X_E__CPS_3_3_C_D_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_E_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_E,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_E_F__X_D__CPS_4_3_A_C_E_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_E_F__X_D__CPS_3_2_A_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_E_F__X_D__CPS_3_2_A_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_E_F__X_D__CPS_3_2_A_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_E_F__X_D__CPS_3_2_C_E_F__X_A_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_E_F__X_D__CPS_3_3_A_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_E_F__X_D__CPS_3_3_A_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_E_F__X_D__CPS_3_3_A_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_C_E_F__X_D__CPS_3_3_C_E_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_D_E_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_D,_E,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_D_E_F__X_C__CPS_4_3_A_D_E_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_D_E_F__X_C__CPS_3_2_A_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_D_E_F__X_C__CPS_3_2_A_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_D_E_F__X_C__CPS_3_2_A_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_D_E_F__X_C__CPS_3_2_D_E_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_D_E_F__X_C__CPS_3_3_A_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_D_E_F__X_C__CPS_3_3_A_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_D_E_F__X_C__CPS_3_3_A_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_A_D_E_F__X_C__CPS_3_3_D_E_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_C_D_E_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_C,_D,_E,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_C_D_E_F__X_A__CPS_4_3_C_D_E_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_C_D_E_F__X_A__CPS_3_2_C_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_C_D_E_F__X_A__CPS_3_2_C_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_C_D_E_F__X_A__CPS_3_2_C_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_C_D_E_F__X_A__CPS_3_2_D_E_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_C_D_E_F__X_A__CPS_3_3_C_D_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_C_D_E_F__X_A__CPS_3_3_C_D_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_C_D_E_F__X_A__CPS_3_3_C_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F||CPS_4_3_C_D_E_F__X_A__CPS_3_3_D_E_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_B,_C,_D,_E,_F},{}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_5_4_B_C_D_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_4_3_B_C_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_4_3_B_C_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_4_3_B_C_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_4_3_B_D_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_4_3_C_D_E_F__X_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_4_4_B_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_4_4_B_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_4_4_B_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_4_4_B_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__CPS_4_4_C_D_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_E__X_F__CPS_4_3_B_C_D_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_E__X_F__CPS_3_2_B_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_E__X_F__CPS_3_2_B_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_E__X_F__CPS_3_2_B_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_E__X_F__CPS_3_2_C_D_E__X_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_E__X_F__CPS_3_3_B_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_E__X_F__CPS_3_3_B_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_E__X_F__CPS_3_3_B_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_E__X_F__CPS_3_3_C_D_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_F__X_E__CPS_4_3_B_C_D_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_F__X_E__CPS_3_2_B_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_F__X_E__CPS_3_2_B_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_F__X_E__CPS_3_2_B_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_F__X_E__CPS_3_2_C_D_F__X_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_F__X_E__CPS_3_3_B_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_F__X_E__CPS_3_3_B_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_F__X_E__CPS_3_3_B_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_D_F__X_E__CPS_3_3_C_D_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_E_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_E,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_E_F__X_D__CPS_4_3_B_C_E_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_E_F__X_D__CPS_3_2_B_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_E_F__X_D__CPS_3_2_B_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_E_F__X_D__CPS_3_2_B_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_E_F__X_D__CPS_3_2_C_E_F__X_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_E_F__X_D__CPS_3_3_B_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_E_F__X_D__CPS_3_3_B_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_E_F__X_D__CPS_3_3_B_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_C_E_F__X_D__CPS_3_3_C_E_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_D_E_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_D,_E,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_D_E_F__X_C__CPS_4_3_B_D_E_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_D_E_F__X_C__CPS_3_2_B_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_D_E_F__X_C__CPS_3_2_B_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_D_E_F__X_C__CPS_3_2_B_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_D_E_F__X_C__CPS_3_2_D_E_F__X_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_D_E_F__X_C__CPS_3_3_B_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_D_E_F__X_C__CPS_3_3_B_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_D_E_F__X_C__CPS_3_3_B_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_B_D_E_F__X_C__CPS_3_3_D_E_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_C_D_E_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_C,_D,_E,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_C_D_E_F__X_B__CPS_4_3_C_D_E_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_C_D_E_F__X_B__CPS_3_2_C_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_C_D_E_F__X_B__CPS_3_2_C_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_C_D_E_F__X_B__CPS_3_2_C_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_C_D_E_F__X_B__CPS_3_2_D_E_F__X_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_C_D_E_F__X_B__CPS_3_3_C_D_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_C_D_E_F__X_B__CPS_3_3_C_D_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_C_D_E_F__X_B__CPS_3_3_C_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_4_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F||CPS_4_3_C_D_E_F__X_B__CPS_3_3_D_E_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F", [this](){ return _create_tuning (CPS_Class::CPS_6_5, {_A,_B,_C,_D,_E,_F}, {}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_6_5_A_B_C_D_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_4_A_B_C_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_4_A_B_C_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_4_A_B_C_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_4_A_B_D_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_4_A_C_D_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_4_B_C_D_E_F__X_A"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_5_A_B_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_5_A_B_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_5_A_B_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_5_A_B_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_5_A_C_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F__CPS_5_5_B_C_D_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_A,_B,_C,_D,_E},{_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_5_4_A_B_C_D_E__X_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_4_3_A_B_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_4_3_A_B_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_4_3_A_B_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_4_3_A_C_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_4_3_B_C_D_E__X_A_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_4_4_A_B_C_D__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_4_4_A_B_C_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_4_4_A_B_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_4_4_A_C_D_E__X_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F__CPS_4_4_B_C_D_E__X_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_E_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_D},{_E,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_E_F__CPS_4_3_A_B_C_D__X_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_E_F__CPS_3_2_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_E_F__CPS_3_2_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_E_F__CPS_3_2_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_E_F__CPS_3_2_B_C_D__X_A_E_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_E_F__CPS_3_3_A_B_C__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_E_F__CPS_3_3_A_B_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_E_F__CPS_3_3_A_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_D__X_E_F__CPS_3_3_B_C_D__X_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_D_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_E},{_D,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_D_F__CPS_4_3_A_B_C_E__X_D_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_D_F__CPS_3_2_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_D_F__CPS_3_2_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_D_F__CPS_3_2_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_D_F__CPS_3_2_B_C_E__X_A_D_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_D_F__CPS_3_3_A_B_C__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_D_F__CPS_3_3_A_B_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_D_F__CPS_3_3_A_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_C_E__X_D_F__CPS_3_3_B_C_E__X_D_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_C_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_E},{_C,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_C_F__CPS_4_3_A_B_D_E__X_C_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_C_F__CPS_3_2_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_C_F__CPS_3_2_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_C_F__CPS_3_2_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_C_F__CPS_3_2_B_D_E__X_A_C_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_C_F__CPS_3_3_A_B_D__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_C_F__CPS_3_3_A_B_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_C_F__CPS_3_3_A_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_B_D_E__X_C_F__CPS_3_3_B_D_E__X_C_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_B_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_E},{_B,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_B_F__CPS_4_3_A_C_D_E__X_B_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_B_F__CPS_3_2_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_B_F__CPS_3_2_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_B_F__CPS_3_2_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_B_F__CPS_3_2_C_D_E__X_A_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_B_F__CPS_3_3_A_C_D__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_B_F__CPS_3_3_A_C_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_B_F__CPS_3_3_A_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_A_C_D_E__X_B_F__CPS_3_3_C_D_E__X_B_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_A_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_E},{_A,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_A_F__CPS_4_3_B_C_D_E__X_A_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_A_F__CPS_3_2_B_C_D__X_A_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_A_F__CPS_3_2_B_C_E__X_A_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_A_F__CPS_3_2_B_D_E__X_A_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_A_F__CPS_3_2_C_D_E__X_A_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_A_F__CPS_3_3_B_C_D__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_A_F__CPS_3_3_B_C_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_A_F__CPS_3_3_B_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_E__X_F||CPS_4_3_B_C_D_E__X_A_F__CPS_3_3_C_D_E__X_A_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_A,_B,_C,_D,_F},{_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_5_4_A_B_C_D_F__X_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_4_3_A_B_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_4_3_A_B_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_4_3_A_B_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_4_3_A_C_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_4_3_B_C_D_F__X_A_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_4_4_A_B_C_D__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_4_4_A_B_C_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_4_4_A_B_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_4_4_A_C_D_F__X_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E__CPS_4_4_B_C_D_F__X_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_D},{_E,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E_F__CPS_4_3_A_B_C_D__X_E_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E_F__CPS_3_2_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E_F__CPS_3_2_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E_F__CPS_3_2_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E_F__CPS_3_2_B_C_D__X_A_E_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E_F__CPS_3_3_A_B_C__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E_F__CPS_3_3_A_B_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E_F__CPS_3_3_A_C_D__X_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_D__X_E_F__CPS_3_3_B_C_D__X_E_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_D_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_F},{_D,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_D_E__CPS_4_3_A_B_C_F__X_D_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_D_E__CPS_3_2_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_D_E__CPS_3_2_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_D_E__CPS_3_2_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_D_E__CPS_3_2_B_C_F__X_A_D_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_D_E__CPS_3_3_A_B_C__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_D_E__CPS_3_3_A_B_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_D_E__CPS_3_3_A_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_C_F__X_D_E__CPS_3_3_B_C_F__X_D_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_C_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_F},{_C,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_C_E__CPS_4_3_A_B_D_F__X_C_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_C_E__CPS_3_2_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_C_E__CPS_3_2_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_C_E__CPS_3_2_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_C_E__CPS_3_2_B_D_F__X_A_C_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_C_E__CPS_3_3_A_B_D__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_C_E__CPS_3_3_A_B_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_C_E__CPS_3_3_A_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_B_D_F__X_C_E__CPS_3_3_B_D_F__X_C_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_B_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_F},{_B,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_B_E__CPS_4_3_A_C_D_F__X_B_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_B_E__CPS_3_2_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_B_E__CPS_3_2_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_B_E__CPS_3_2_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_B_E__CPS_3_2_C_D_F__X_A_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_B_E__CPS_3_3_A_C_D__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_B_E__CPS_3_3_A_C_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_B_E__CPS_3_3_A_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_A_C_D_F__X_B_E__CPS_3_3_C_D_F__X_B_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_A_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_F},{_A,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_A_E__CPS_4_3_B_C_D_F__X_A_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_A_E__CPS_3_2_B_C_D__X_A_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_A_E__CPS_3_2_B_C_F__X_A_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_A_E__CPS_3_2_B_D_F__X_A_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_A_E__CPS_3_2_C_D_F__X_A_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_A_E__CPS_3_3_B_C_D__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_A_E__CPS_3_3_B_C_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_A_E__CPS_3_3_B_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_D_F__X_E||CPS_4_3_B_C_D_F__X_A_E__CPS_3_3_C_D_F__X_A_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_A,_B,_C,_E,_F},{_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_5_4_A_B_C_E_F__X_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_4_3_A_B_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_4_3_A_B_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_4_3_A_B_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_4_3_A_C_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_4_3_B_C_E_F__X_A_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_4_4_A_B_C_E__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_4_4_A_B_C_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_4_4_A_B_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_4_4_A_C_E_F__X_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D__CPS_4_4_B_C_E_F__X_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_E},{_D,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D_F__CPS_4_3_A_B_C_E__X_D_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D_F__CPS_3_2_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D_F__CPS_3_2_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D_F__CPS_3_2_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D_F__CPS_3_2_B_C_E__X_A_D_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D_F__CPS_3_3_A_B_C__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D_F__CPS_3_3_A_B_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D_F__CPS_3_3_A_C_E__X_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_E__X_D_F__CPS_3_3_B_C_E__X_D_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_C,_F},{_D,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D_E__CPS_4_3_A_B_C_F__X_D_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D_E__CPS_3_2_A_B_C__X_D_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D_E__CPS_3_2_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D_E__CPS_3_2_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D_E__CPS_3_2_B_C_F__X_A_D_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D_E__CPS_3_3_A_B_C__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D_E__CPS_3_3_A_B_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D_E__CPS_3_3_A_C_F__X_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_C_F__X_D_E__CPS_3_3_B_C_F__X_D_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_C_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_E,_F},{_C,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_C_D__CPS_4_3_A_B_E_F__X_C_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_C_D__CPS_3_2_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_C_D__CPS_3_2_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_C_D__CPS_3_2_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_C_D__CPS_3_2_B_E_F__X_A_C_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_C_D__CPS_3_3_A_B_E__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_C_D__CPS_3_3_A_B_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_C_D__CPS_3_3_A_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_B_E_F__X_C_D__CPS_3_3_B_E_F__X_C_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_B_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_E,_F},{_B,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_B_D__CPS_4_3_A_C_E_F__X_B_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_B_D__CPS_3_2_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_B_D__CPS_3_2_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_B_D__CPS_3_2_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_B_D__CPS_3_2_C_E_F__X_A_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_B_D__CPS_3_3_A_C_E__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_B_D__CPS_3_3_A_C_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_B_D__CPS_3_3_A_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_A_C_E_F__X_B_D__CPS_3_3_C_E_F__X_B_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_A_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_E,_F},{_A,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_A_D__CPS_4_3_B_C_E_F__X_A_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_A_D__CPS_3_2_B_C_E__X_A_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_A_D__CPS_3_2_B_C_F__X_A_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_A_D__CPS_3_2_B_E_F__X_A_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_A_D__CPS_3_2_C_E_F__X_A_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_A_D__CPS_3_3_B_C_E__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_A_D__CPS_3_3_B_C_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_A_D__CPS_3_3_B_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_C_E_F__X_D||CPS_4_3_B_C_E_F__X_A_D__CPS_3_3_C_E_F__X_A_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_A,_B,_D,_E,_F},{_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_5_4_A_B_D_E_F__X_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_4_3_A_B_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_4_3_A_B_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_4_3_A_B_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_4_3_A_D_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_4_3_B_D_E_F__X_A_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_4_4_A_B_D_E__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_4_4_A_B_D_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_4_4_A_B_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_4_4_A_D_E_F__X_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C__CPS_4_4_B_D_E_F__X_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_E},{_C,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C_F__CPS_4_3_A_B_D_E__X_C_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C_F__CPS_3_2_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C_F__CPS_3_2_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C_F__CPS_3_2_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C_F__CPS_3_2_B_D_E__X_A_C_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C_F__CPS_3_3_A_B_D__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C_F__CPS_3_3_A_B_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C_F__CPS_3_3_A_D_E__X_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_E__X_C_F__CPS_3_3_B_D_E__X_C_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_D,_F},{_C,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C_E__CPS_4_3_A_B_D_F__X_C_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C_E__CPS_3_2_A_B_D__X_C_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C_E__CPS_3_2_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C_E__CPS_3_2_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C_E__CPS_3_2_B_D_F__X_A_C_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C_E__CPS_3_3_A_B_D__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C_E__CPS_3_3_A_B_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C_E__CPS_3_3_A_D_F__X_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_D_F__X_C_E__CPS_3_3_B_D_F__X_C_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_B,_E,_F},{_C,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C_D__CPS_4_3_A_B_E_F__X_C_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C_D__CPS_3_2_A_B_E__X_C_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C_D__CPS_3_2_A_B_F__X_C_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C_D__CPS_3_2_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C_D__CPS_3_2_B_E_F__X_A_C_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C_D__CPS_3_3_A_B_E__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C_D__CPS_3_3_A_B_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C_D__CPS_3_3_A_E_F__X_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_B_E_F__X_C_D__CPS_3_3_B_E_F__X_C_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_B_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_D,_E,_F},{_B,_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_B_C__CPS_4_3_A_D_E_F__X_B_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_B_C__CPS_3_2_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_B_C__CPS_3_2_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_B_C__CPS_3_2_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_B_C__CPS_3_2_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_B_C__CPS_3_3_A_D_E__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_B_C__CPS_3_3_A_D_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_B_C__CPS_3_3_A_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_A_D_E_F__X_B_C__CPS_3_3_D_E_F__X_B_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_A_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_D,_E,_F},{_A,_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_A_C__CPS_4_3_B_D_E_F__X_A_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_A_C__CPS_3_2_B_D_E__X_A_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_A_C__CPS_3_2_B_D_F__X_A_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_A_C__CPS_3_2_B_E_F__X_A_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_A_C__CPS_3_2_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_A_C__CPS_3_3_B_D_E__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_A_C__CPS_3_3_B_D_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_A_C__CPS_3_3_B_E_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_B_D_E_F__X_C||CPS_4_3_B_D_E_F__X_A_C__CPS_3_3_D_E_F__X_A_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_A,_C,_D,_E,_F},{_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_5_4_A_C_D_E_F__X_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_4_3_A_C_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_4_3_A_C_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_4_3_A_C_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_4_3_A_D_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_4_3_C_D_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_4_4_A_C_D_E__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_4_4_A_C_D_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_4_4_A_C_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_4_4_A_D_E_F__X_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B__CPS_4_4_C_D_E_F__X_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_E},{_B,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B_F__CPS_4_3_A_C_D_E__X_B_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B_F__CPS_3_2_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B_F__CPS_3_2_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B_F__CPS_3_2_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B_F__CPS_3_2_C_D_E__X_A_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B_F__CPS_3_3_A_C_D__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B_F__CPS_3_3_A_C_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B_F__CPS_3_3_A_D_E__X_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_E__X_B_F__CPS_3_3_C_D_E__X_B_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_D,_F},{_B,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B_E__CPS_4_3_A_C_D_F__X_B_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B_E__CPS_3_2_A_C_D__X_B_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B_E__CPS_3_2_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B_E__CPS_3_2_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B_E__CPS_3_2_C_D_F__X_A_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B_E__CPS_3_3_A_C_D__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B_E__CPS_3_3_A_C_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B_E__CPS_3_3_A_D_F__X_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_D_F__X_B_E__CPS_3_3_C_D_F__X_B_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_C,_E,_F},{_B,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B_D__CPS_4_3_A_C_E_F__X_B_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B_D__CPS_3_2_A_C_E__X_B_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B_D__CPS_3_2_A_C_F__X_B_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B_D__CPS_3_2_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B_D__CPS_3_2_C_E_F__X_A_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B_D__CPS_3_3_A_C_E__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B_D__CPS_3_3_A_C_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B_D__CPS_3_3_A_E_F__X_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_C_E_F__X_B_D__CPS_3_3_C_E_F__X_B_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_A,_D,_E,_F},{_B,_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B_C__CPS_4_3_A_D_E_F__X_B_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B_C__CPS_3_2_A_D_E__X_B_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B_C__CPS_3_2_A_D_F__X_B_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B_C__CPS_3_2_A_E_F__X_B_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B_C__CPS_3_2_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B_C__CPS_3_3_A_D_E__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B_C__CPS_3_3_A_D_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B_C__CPS_3_3_A_E_F__X_B_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_A_D_E_F__X_B_C__CPS_3_3_D_E_F__X_B_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_A_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_C,_D,_E,_F},{_A,_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_A_B__CPS_4_3_C_D_E_F__X_A_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_A_B__CPS_3_2_C_D_E__X_A_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_A_B__CPS_3_2_C_D_F__X_A_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_A_B__CPS_3_2_C_E_F__X_A_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_A_B__CPS_3_2_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_A_B__CPS_3_3_C_D_E__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_A_B__CPS_3_3_C_D_F__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_A_B__CPS_3_3_C_E_F__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_A_C_D_E_F__X_B||CPS_4_3_C_D_E_F__X_A_B__CPS_3_3_D_E_F__X_A_B"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A", [this](){ return _create_tuning (CPS_Class::CPS_5_4,{_B,_C,_D,_E,_F},{_A}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_5_4_B_C_D_E_F__X_A", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_4_3_B_C_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_4_3_B_C_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_4_3_B_C_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_4_3_B_D_E_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_4_3_C_D_E_F__X_A_B"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_4_4_B_C_D_E__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_4_4_B_C_D_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_4_4_B_C_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_4_4_B_D_E_F__X_A","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A__CPS_4_4_C_D_E_F__X_A"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A_F", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_E},{_A,_F}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A_F__CPS_4_3_B_C_D_E__X_A_F", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A_F__CPS_3_2_B_C_D__X_A_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A_F__CPS_3_2_B_C_E__X_A_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A_F__CPS_3_2_B_D_E__X_A_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A_F__CPS_3_2_C_D_E__X_A_B_F"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A_F__CPS_3_3_B_C_D__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A_F__CPS_3_3_B_C_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A_F__CPS_3_3_B_D_E__X_A_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_E__X_A_F__CPS_3_3_C_D_E__X_A_F"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A_E", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_D,_F},{_A,_E}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A_E__CPS_4_3_B_C_D_F__X_A_E", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A_E__CPS_3_2_B_C_D__X_A_E_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A_E__CPS_3_2_B_C_F__X_A_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A_E__CPS_3_2_B_D_F__X_A_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A_E__CPS_3_2_C_D_F__X_A_B_E"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A_E__CPS_3_3_B_C_D__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A_E__CPS_3_3_B_C_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A_E__CPS_3_3_B_D_F__X_A_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_D_F__X_A_E__CPS_3_3_C_D_F__X_A_E"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A_D", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_C,_E,_F},{_A,_D}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A_D__CPS_4_3_B_C_E_F__X_A_D", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A_D__CPS_3_2_B_C_E__X_A_D_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A_D__CPS_3_2_B_C_F__X_A_D_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A_D__CPS_3_2_B_E_F__X_A_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A_D__CPS_3_2_C_E_F__X_A_B_D"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A_D__CPS_3_3_B_C_E__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A_D__CPS_3_3_B_C_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A_D__CPS_3_3_B_E_F__X_A_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_C_E_F__X_A_D__CPS_3_3_C_E_F__X_A_D"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A_C", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_B,_D,_E,_F},{_A,_C}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A_C__CPS_4_3_B_D_E_F__X_A_C", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A_C__CPS_3_2_B_D_E__X_A_C_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A_C__CPS_3_2_B_D_F__X_A_C_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A_C__CPS_3_2_B_E_F__X_A_C_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A_C__CPS_3_2_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A_C__CPS_3_3_B_D_E__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A_C__CPS_3_3_B_D_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A_C__CPS_3_3_B_E_F__X_A_C","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_B_D_E_F__X_A_C__CPS_3_3_D_E_F__X_A_C"});}},
-{"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A_B", [this](){ return _create_tuning (CPS_Class::CPS_4_3, {_C,_D,_E,_F},{_A,_B}, "||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A_B__CPS_4_3_C_D_E_F__X_A_B", {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A_B__CPS_3_2_C_D_E__X_A_B_F","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A_B__CPS_3_2_C_D_F__X_A_B_E","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A_B__CPS_3_2_C_E_F__X_A_B_D","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A_B__CPS_3_2_D_E_F__X_A_B_C"}, {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A_B__CPS_3_3_C_D_E__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A_B__CPS_3_3_C_D_F__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A_B__CPS_3_3_C_E_F__X_A_B","||EulerGenus_6_A_B_C_D_E_F||CPS_6_5_A_B_C_D_E_F||CPS_5_4_B_C_D_E_F__X_A||CPS_4_3_C_D_E_F__X_A_B__CPS_3_3_D_E_F__X_A_B"});}},
-
- });
-}
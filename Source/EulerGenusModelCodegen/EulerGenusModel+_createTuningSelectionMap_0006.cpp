@@ -1,266 +0,0 @@
-#include "../EulerGenusModel.h"
-#include "../EulerGenusViewModel.h"
-
-void EulerGenusModel::_createTuningSelectionMap_0006()
-{
-   _tuningSelectionMap->insert ({
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_2_A_B_D__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_2_A_B_D__X_C"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_2_A_C_D__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_2_A_C_D__X_B"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_2_B_C_D__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_2_B_C_D__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_3_A_B_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_3_A_B_C"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_3_A_B_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_3_A_B_D"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_3_A_C_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_3_A_C_D"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_3_B_C_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D__CPS_3_3_B_C_D"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_4_3_A_B_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_4_3_A_B_C_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_2_A_B_C__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_2_A_B_C__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_2_A_B_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_2_A_B_F__X_C"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_2_A_C_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_2_A_C_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_2_B_C_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_2_B_C_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_3_A_B_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_3_A_B_C"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_3_A_B_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_3_A_B_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_3_A_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_3_A_C_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_3_B_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F__CPS_3_3_B_C_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_4_3_A_B_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_4_3_A_B_D_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_2_A_B_D__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_2_A_B_D__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_2_A_B_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_2_A_B_F__X_D"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_2_A_D_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_2_A_D_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_2_B_D_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_2_B_D_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_3_A_B_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_3_A_B_D"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_3_A_B_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_3_A_B_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_3_A_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_3_A_D_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_3_B_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F__CPS_3_3_B_D_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_4_3_A_C_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_4_3_A_C_D_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_2_A_C_D__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_2_A_C_D__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_2_A_C_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_2_A_C_F__X_D"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_2_A_D_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_2_A_D_F__X_C"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_2_C_D_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_2_C_D_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_3_A_C_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_3_A_C_D"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_3_A_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_3_A_C_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_3_A_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_3_A_D_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_3_C_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F__CPS_3_3_C_D_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_4_3_B_C_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_4_3_B_C_D_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_2_B_C_D__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_2_B_C_D__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_2_B_C_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_2_B_C_F__X_D"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_2_B_D_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_2_B_D_F__X_C"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_2_C_D_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_2_C_D_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_3_B_C_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_3_B_C_D"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_3_B_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_3_B_C_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_3_B_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_3_B_D_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_3_C_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F__CPS_3_3_C_D_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_5_3_A_B_C_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_5_3_A_B_C_E_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_2_A_B_C_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_2_A_B_C_E__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_2_A_B_C_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_2_A_B_C_F__X_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_2_A_B_E_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_2_A_B_E_F__X_C"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_2_A_C_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_2_A_C_E_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_2_B_C_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_2_B_C_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_4();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_3_A_B_C_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_3_A_B_C_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_3_A_B_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_3_A_B_C_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_3_A_B_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_3_A_B_E_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_3_A_C_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_3_A_C_E_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_3_B_C_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F__CPS_4_3_B_C_E_F"); auto cps = vm->parentTuning; cps->selectS1_4();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_4_2_A_B_C_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_4_2_A_B_C_E__X_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_1_A_B_C__X_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_1_A_B_C__X_E_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_1_A_B_E__X_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_1_A_B_E__X_C_F"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_1_A_C_E__X_B_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_1_A_C_E__X_B_F"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_1_B_C_E__X_A_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_1_B_C_E__X_A_F"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_2_A_B_C__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_2_A_B_C__X_F"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_2_A_B_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_2_A_B_E__X_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_2_A_C_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_2_A_C_E__X_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_2_B_C_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F__CPS_3_2_B_C_E__X_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_4_2_A_B_C_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_4_2_A_B_C_F__X_E"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_1_A_B_C__X_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_1_A_B_C__X_E_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_1_A_B_F__X_C_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_1_A_B_F__X_C_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_1_A_C_F__X_B_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_1_A_C_F__X_B_E"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_1_B_C_F__X_A_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_1_B_C_F__X_A_E"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_B_C__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_B_C__X_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_B_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_B_F__X_E"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_C_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_C_F__X_E"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_2_B_C_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E__CPS_3_2_B_C_F__X_E"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_B_E__X_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_B_E__X_C_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_B_F__X_C_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_B_F__X_C_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_E_F__X_B_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_E_F__X_B_C"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_1_B_E_F__X_A_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_1_B_E_F__X_A_C"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_B_E__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_B_E__X_C"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_B_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_B_F__X_C"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_E_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_E_F__X_C"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_2_B_E_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C__CPS_3_2_B_E_F__X_C"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_C_E__X_B_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_C_E__X_B_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_C_F__X_B_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_C_F__X_B_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_E_F__X_B_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_E_F__X_B_C"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_1_C_E_F__X_A_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_1_C_E_F__X_A_B"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_C_E__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_C_E__X_B"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_C_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_C_F__X_B"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_E_F__X_B"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_2_C_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B__CPS_3_2_C_E_F__X_B"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_4_2_B_C_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_4_2_B_C_E_F__X_A"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_1_B_C_E__X_A_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_1_B_C_E__X_A_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_1_B_C_F__X_A_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_1_B_C_F__X_A_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_1_B_E_F__X_A_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_1_B_E_F__X_A_C"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_1_C_E_F__X_A_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_1_C_E_F__X_A_B"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_2_B_C_E__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_2_B_C_E__X_A"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_2_B_C_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_2_B_C_F__X_A"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_2_B_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_2_B_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_2_C_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A__CPS_3_2_C_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_4_3_A_B_C_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_4_3_A_B_C_E"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_2_A_B_C__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_2_A_B_C__X_E"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_2_A_B_E__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_2_A_B_E__X_C"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_2_A_C_E__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_2_A_C_E__X_B"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_2_B_C_E__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_2_B_C_E__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_3_A_B_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_3_A_B_C"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_3_A_B_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_3_A_B_E"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_3_A_C_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_3_A_C_E"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_3_B_C_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E__CPS_3_3_B_C_E"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_4_3_A_B_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_4_3_A_B_C_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_2_A_B_C__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_2_A_B_C__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_2_A_B_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_2_A_B_F__X_C"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_2_A_C_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_2_A_C_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_2_B_C_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_2_B_C_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_3_A_B_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_3_A_B_C"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_3_A_B_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_3_A_B_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_3_A_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_3_A_C_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_3_B_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F__CPS_3_3_B_C_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_4_3_A_B_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_4_3_A_B_E_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_B_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_B_E__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_B_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_B_F__X_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_E_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_2_B_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_2_B_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_B_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_B_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_B_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_B_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_E_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_3_B_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F__CPS_3_3_B_E_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_4_3_A_C_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_4_3_A_C_E_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_2_A_C_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_2_A_C_E__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_2_A_C_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_2_A_C_F__X_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_2_A_E_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_2_A_E_F__X_C"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_2_C_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_2_C_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_3_A_C_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_3_A_C_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_3_A_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_3_A_C_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_3_A_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_3_A_E_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_3_C_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F__CPS_3_3_C_E_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_4_3_B_C_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_4_3_B_C_E_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_2_B_C_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_2_B_C_E__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_2_B_C_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_2_B_C_F__X_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_2_B_E_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_2_B_E_F__X_C"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_2_C_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_2_C_E_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_3_B_C_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_3_B_C_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_3_B_C_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_3_B_C_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_3_B_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_3_B_E_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_3_C_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F__CPS_3_3_C_E_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_5_3_A_B_D_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_5_3_A_B_D_E_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_2_A_B_D_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_2_A_B_D_E__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_2_A_B_D_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_2_A_B_D_F__X_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_2_A_B_E_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_2_A_B_E_F__X_D"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_2_A_D_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_2_A_D_E_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_2_B_D_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_2_B_D_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_4();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_3_A_B_D_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_3_A_B_D_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_3_A_B_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_3_A_B_D_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_3_A_B_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_3_A_B_E_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_3_A_D_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_3_A_D_E_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_3_B_D_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F__CPS_4_3_B_D_E_F"); auto cps = vm->parentTuning; cps->selectS1_4();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_4_2_A_B_D_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_4_2_A_B_D_E__X_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_1_A_B_D__X_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_1_A_B_D__X_E_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_1_A_B_E__X_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_1_A_B_E__X_D_F"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_1_A_D_E__X_B_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_1_A_D_E__X_B_F"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_1_B_D_E__X_A_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_1_B_D_E__X_A_F"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_2_A_B_D__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_2_A_B_D__X_F"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_2_A_B_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_2_A_B_E__X_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_2_A_D_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_2_A_D_E__X_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_2_B_D_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F__CPS_3_2_B_D_E__X_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_B_D__X_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_B_D__X_E_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_B_F__X_D_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_B_F__X_D_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_D_F__X_B_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_D_F__X_B_E"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_1_B_D_F__X_A_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_1_B_D_F__X_A_E"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_B_D__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_B_D__X_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_B_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_B_F__X_E"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_D_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_D_F__X_E"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_2_B_D_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E__CPS_3_2_B_D_F__X_E"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_B_E__X_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_B_E__X_D_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_B_F__X_D_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_B_F__X_D_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_E_F__X_B_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_E_F__X_B_D"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_1_B_E_F__X_A_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_1_B_E_F__X_A_D"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_B_E__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_B_E__X_D"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_B_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_B_F__X_D"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_E_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_E_F__X_D"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_2_B_E_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D__CPS_3_2_B_E_F__X_D"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_4_2_A_D_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_4_2_A_D_E_F__X_B"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_1_A_D_E__X_B_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_1_A_D_E__X_B_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_1_A_D_F__X_B_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_1_A_D_F__X_B_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_1_A_E_F__X_B_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_1_A_E_F__X_B_D"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_1_D_E_F__X_A_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_1_D_E_F__X_A_B"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_2_A_D_E__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_2_A_D_E__X_B"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_2_A_D_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_2_A_D_F__X_B"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_2_A_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_2_A_E_F__X_B"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_2_D_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B__CPS_3_2_D_E_F__X_B"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_4_2_B_D_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_4_2_B_D_E_F__X_A"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_1_B_D_E__X_A_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_1_B_D_E__X_A_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_1_B_D_F__X_A_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_1_B_D_F__X_A_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_1_B_E_F__X_A_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_1_B_E_F__X_A_D"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_1_D_E_F__X_A_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_1_D_E_F__X_A_B"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_2_B_D_E__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_2_B_D_E__X_A"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_2_B_D_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_2_B_D_F__X_A"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_2_B_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_2_B_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_2_D_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A__CPS_3_2_D_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_4_3_A_B_D_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_4_3_A_B_D_E"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_2_A_B_D__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_2_A_B_D__X_E"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_2_A_B_E__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_2_A_B_E__X_D"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_2_A_D_E__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_2_A_D_E__X_B"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_2_B_D_E__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_2_B_D_E__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_3_A_B_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_3_A_B_D"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_3_A_B_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_3_A_B_E"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_3_A_D_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_3_A_D_E"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_3_B_D_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E__CPS_3_3_B_D_E"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_4_3_A_B_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_4_3_A_B_D_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_2_A_B_D__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_2_A_B_D__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_2_A_B_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_2_A_B_F__X_D"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_2_A_D_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_2_A_D_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_2_B_D_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_2_B_D_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_3_A_B_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_3_A_B_D"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_3_A_B_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_3_A_B_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_3_A_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_3_A_D_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_3_B_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F__CPS_3_3_B_D_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_4_3_A_B_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_4_3_A_B_E_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_B_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_B_E__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_B_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_B_F__X_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_2_A_E_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_2_B_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_2_B_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_B_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_B_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_B_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_B_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_3_A_E_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_3_B_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F__CPS_3_3_B_E_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_4_3_A_D_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_4_3_A_D_E_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_A_D_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_A_D_E__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_A_D_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_A_D_F__X_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_A_E_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_A_E_F__X_D"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_D_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_2_D_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_A_D_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_A_D_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_A_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_A_D_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_A_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_A_E_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_D_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F__CPS_3_3_D_E_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_4_3_B_D_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_4_3_B_D_E_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_B_D_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_B_D_E__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_B_D_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_B_D_F__X_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_B_E_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_B_E_F__X_D"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_D_E_F__X_B", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_2_D_E_F__X_B"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_B_D_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_B_D_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_B_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_B_D_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_B_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_B_E_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_D_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F__CPS_3_3_D_E_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_5_3_A_C_D_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_5_3_A_C_D_E_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_2_A_C_D_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_2_A_C_D_E__X_F"); auto cps = vm->parentTuning; cps->selectS0_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_2_A_C_D_F__X_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_2_A_C_D_F__X_E"); auto cps = vm->parentTuning; cps->selectS0_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_2_A_C_E_F__X_D", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_2_A_C_E_F__X_D"); auto cps = vm->parentTuning; cps->selectS0_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_2_A_D_E_F__X_C", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_2_A_D_E_F__X_C"); auto cps = vm->parentTuning; cps->selectS0_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_2_C_D_E_F__X_A", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_2_C_D_E_F__X_A"); auto cps = vm->parentTuning; cps->selectS0_4();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_3_A_C_D_E", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_3_A_C_D_E"); auto cps = vm->parentTuning; cps->selectS1_0();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_3_A_C_D_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_3_A_C_D_F"); auto cps = vm->parentTuning; cps->selectS1_1();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_3_A_C_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_3_A_C_E_F"); auto cps = vm->parentTuning; cps->selectS1_2();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_3_A_D_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_3_A_D_E_F"); auto cps = vm->parentTuning; cps->selectS1_3();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_3_C_D_E_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F__CPS_4_3_C_D_E_F"); auto cps = vm->parentTuning; cps->selectS1_4();}},
-     {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_A_C_D_E__X_F__CPS_4_2_A_C_D_E__X_F", [this]() { auto vm = _getViewModel ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_A_C_D_E__X_F__CPS_4_2_A_C_D_E__X_F"); auto cps = vm->parentTuning; cps->selectParent();}},
-
- });
-}
@@ -1,265 +0,0 @@
-#include "../EulerGenusModel.h"
-#include "../EulerGenusViewModel.h"
-void EulerGenusModel::_createTuningUpdateMap_0000()
-{
-   _tuningUpdateMap->insert ({
-       {"||EulerGenus_6_A_B_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F"); cps->set ({_A,_B,_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F"); cps->set ({_A,_B,_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E"); cps->set ({_A,_B,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E||CPS_4_1_A_B_C_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E||CPS_4_1_A_B_C_D"); cps->set ({_A,_B,_C,_D},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E||CPS_4_1_A_B_C_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E||CPS_4_1_A_B_C_E"); cps->set ({_A,_B,_C,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E||CPS_4_1_A_B_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E||CPS_4_1_A_B_D_E"); cps->set ({_A,_B,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E||CPS_4_1_A_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E||CPS_4_1_A_C_D_E"); cps->set ({_A,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E||CPS_4_1_B_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E||CPS_4_1_B_C_D_E"); cps->set ({_B,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F"); cps->set ({_A,_B,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F||CPS_4_1_A_B_C_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F||CPS_4_1_A_B_C_D"); cps->set ({_A,_B,_C,_D},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F||CPS_4_1_A_B_C_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F||CPS_4_1_A_B_C_F"); cps->set ({_A,_B,_C,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F||CPS_4_1_A_B_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F||CPS_4_1_A_B_D_F"); cps->set ({_A,_B,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F||CPS_4_1_A_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F||CPS_4_1_A_C_D_F"); cps->set ({_A,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F||CPS_4_1_B_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F||CPS_4_1_B_C_D_F"); cps->set ({_B,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F"); cps->set ({_A,_B,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F||CPS_4_1_A_B_C_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F||CPS_4_1_A_B_C_E"); cps->set ({_A,_B,_C,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F||CPS_4_1_A_B_C_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F||CPS_4_1_A_B_C_F"); cps->set ({_A,_B,_C,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F||CPS_4_1_A_B_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F||CPS_4_1_A_B_E_F"); cps->set ({_A,_B,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F||CPS_4_1_A_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F||CPS_4_1_A_C_E_F"); cps->set ({_A,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F||CPS_4_1_B_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F||CPS_4_1_B_C_E_F"); cps->set ({_B,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F"); cps->set ({_A,_B,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F||CPS_4_1_A_B_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F||CPS_4_1_A_B_D_E"); cps->set ({_A,_B,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F||CPS_4_1_A_B_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F||CPS_4_1_A_B_D_F"); cps->set ({_A,_B,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F||CPS_4_1_A_B_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F||CPS_4_1_A_B_E_F"); cps->set ({_A,_B,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F||CPS_4_1_A_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F||CPS_4_1_A_D_E_F"); cps->set ({_A,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F||CPS_4_1_B_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F||CPS_4_1_B_D_E_F"); cps->set ({_B,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F"); cps->set ({_A,_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F||CPS_4_1_A_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F||CPS_4_1_A_C_D_E"); cps->set ({_A,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F||CPS_4_1_A_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F||CPS_4_1_A_C_D_F"); cps->set ({_A,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F||CPS_4_1_A_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F||CPS_4_1_A_C_E_F"); cps->set ({_A,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F||CPS_4_1_A_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F||CPS_4_1_A_D_E_F"); cps->set ({_A,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F||CPS_4_1_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F||CPS_4_1_C_D_E_F"); cps->set ({_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F"); cps->set ({_B,_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F||CPS_4_1_B_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F||CPS_4_1_B_C_D_E"); cps->set ({_B,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F||CPS_4_1_B_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F||CPS_4_1_B_C_D_F"); cps->set ({_B,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F||CPS_4_1_B_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F||CPS_4_1_B_C_E_F"); cps->set ({_B,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F||CPS_4_1_B_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F||CPS_4_1_B_D_E_F"); cps->set ({_B,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F||CPS_4_1_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_1_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F||CPS_4_1_C_D_E_F"); cps->set ({_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F"); cps->set ({_A,_B,_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F"); cps->set ({_A,_B,_C,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F||CPS_4_1_A_B_C_D__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F||CPS_4_1_A_B_C_D__X_F"); cps->set ({_A,_B,_C,_D},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F||CPS_4_1_A_B_C_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F||CPS_4_1_A_B_C_E__X_F"); cps->set ({_A,_B,_C,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F||CPS_4_1_A_B_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F||CPS_4_1_A_B_D_E__X_F"); cps->set ({_A,_B,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F||CPS_4_1_A_C_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F||CPS_4_1_A_C_D_E__X_F"); cps->set ({_A,_C,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F||CPS_4_1_B_C_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_E__X_F||CPS_4_1_B_C_D_E__X_F"); cps->set ({_B,_C,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E"); cps->set ({_A,_B,_C,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E||CPS_4_1_A_B_C_D__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E||CPS_4_1_A_B_C_D__X_E"); cps->set ({_A,_B,_C,_D},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E||CPS_4_1_A_B_C_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E||CPS_4_1_A_B_C_F__X_E"); cps->set ({_A,_B,_C,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E||CPS_4_1_A_B_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E||CPS_4_1_A_B_D_F__X_E"); cps->set ({_A,_B,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E||CPS_4_1_A_C_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E||CPS_4_1_A_C_D_F__X_E"); cps->set ({_A,_C,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E||CPS_4_1_B_C_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_D_F__X_E||CPS_4_1_B_C_D_F__X_E"); cps->set ({_B,_C,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D"); cps->set ({_A,_B,_C,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D"); cps->set ({_A,_B,_C,_E},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D"); cps->set ({_A,_B,_C,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_D"); cps->set ({_A,_B,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_D"); cps->set ({_A,_C,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_D"); cps->set ({_B,_C,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C"); cps->set ({_A,_B,_D,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C"); cps->set ({_A,_B,_D,_E},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C"); cps->set ({_A,_B,_D,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C"); cps->set ({_A,_B,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_C"); cps->set ({_A,_D,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_C"); cps->set ({_B,_D,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B"); cps->set ({_A,_C,_D,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B"); cps->set ({_A,_C,_D,_E},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B"); cps->set ({_A,_C,_D,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B"); cps->set ({_A,_C,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B"); cps->set ({_A,_D,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_B"); cps->set ({_C,_D,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A"); cps->set ({_B,_C,_D,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A||CPS_4_1_B_C_D_E__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A||CPS_4_1_B_C_D_E__X_A"); cps->set ({_B,_C,_D,_E},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A||CPS_4_1_B_C_D_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A||CPS_4_1_B_C_D_F__X_A"); cps->set ({_B,_C,_D,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A||CPS_4_1_B_C_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A||CPS_4_1_B_C_E_F__X_A"); cps->set ({_B,_C,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A||CPS_4_1_B_D_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A||CPS_4_1_B_D_E_F__X_A"); cps->set ({_B,_D,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A||CPS_4_1_C_D_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_1_B_C_D_E_F__X_A||CPS_4_1_C_D_E_F__X_A"); cps->set ({_C,_D,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E"); cps->set ({_A,_B,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_1_A_B_C_D__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_1_A_B_C_D__X_E"); cps->set ({_A,_B,_C,_D},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_1_A_B_C_E__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_1_A_B_C_E__X_D"); cps->set ({_A,_B,_C,_E},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_1_A_B_D_E__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_1_A_B_D_E__X_C"); cps->set ({_A,_B,_D,_E},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_1_A_C_D_E__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_1_A_C_D_E__X_B"); cps->set ({_A,_C,_D,_E},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_1_B_C_D_E__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_1_B_C_D_E__X_A"); cps->set ({_B,_C,_D,_E},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_2_A_B_C_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_2_A_B_C_D"); cps->set ({_A,_B,_C,_D},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_2_A_B_C_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_2_A_B_C_E"); cps->set ({_A,_B,_C,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_2_A_B_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_2_A_B_D_E"); cps->set ({_A,_B,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_2_A_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_2_A_C_D_E"); cps->set ({_A,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_2_B_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E||CPS_4_2_B_C_D_E"); cps->set ({_B,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F"); cps->set ({_A,_B,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_A_B_C_D__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_A_B_C_D__X_F"); cps->set ({_A,_B,_C,_D},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_A_B_C_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_A_B_C_F__X_D"); cps->set ({_A,_B,_C,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_A_B_D_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_A_B_D_F__X_C"); cps->set ({_A,_B,_D,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_A_C_D_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_A_C_D_F__X_B"); cps->set ({_A,_C,_D,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_B_C_D_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_1_B_C_D_F__X_A"); cps->set ({_B,_C,_D,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_D"); cps->set ({_A,_B,_C,_D},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_C_F"); cps->set ({_A,_B,_C,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_B_D_F"); cps->set ({_A,_B,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_A_C_D_F"); cps->set ({_A,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F||CPS_4_2_B_C_D_F"); cps->set ({_B,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F"); cps->set ({_A,_B,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_E__X_F"); cps->set ({_A,_B,_C,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_C_F__X_E"); cps->set ({_A,_B,_C,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_B_E_F__X_C"); cps->set ({_A,_B,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_C_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_A_C_E_F__X_B"); cps->set ({_A,_C,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_B_C_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_1_B_C_E_F__X_A"); cps->set ({_B,_C,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_E"); cps->set ({_A,_B,_C,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_C_F"); cps->set ({_A,_B,_C,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_B_E_F"); cps->set ({_A,_B,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_A_C_E_F"); cps->set ({_A,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F||CPS_4_2_B_C_E_F"); cps->set ({_B,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F"); cps->set ({_A,_B,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_E__X_F"); cps->set ({_A,_B,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_D_F__X_E"); cps->set ({_A,_B,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_B_E_F__X_D"); cps->set ({_A,_B,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_D_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_A_D_E_F__X_B"); cps->set ({_A,_D,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_B_D_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_1_B_D_E_F__X_A"); cps->set ({_B,_D,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_E"); cps->set ({_A,_B,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_D_F"); cps->set ({_A,_B,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_B_E_F"); cps->set ({_A,_B,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_A_D_E_F"); cps->set ({_A,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F||CPS_4_2_B_D_E_F"); cps->set ({_B,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F"); cps->set ({_A,_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_E__X_F"); cps->set ({_A,_C,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_D_F__X_E"); cps->set ({_A,_C,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_C_E_F__X_D"); cps->set ({_A,_C,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_D_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_A_D_E_F__X_C"); cps->set ({_A,_D,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_C_D_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_1_C_D_E_F__X_A"); cps->set ({_C,_D,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_E"); cps->set ({_A,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_D_F"); cps->set ({_A,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_C_E_F"); cps->set ({_A,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_A_D_E_F"); cps->set ({_A,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F||CPS_4_2_C_D_E_F"); cps->set ({_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F"); cps->set ({_B,_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_1_B_C_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_1_B_C_D_E__X_F"); cps->set ({_B,_C,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_1_B_C_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_1_B_C_D_F__X_E"); cps->set ({_B,_C,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_1_B_C_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_1_B_C_E_F__X_D"); cps->set ({_B,_C,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_1_B_D_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_1_B_D_E_F__X_C"); cps->set ({_B,_D,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_1_C_D_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_1_C_D_E_F__X_B"); cps->set ({_C,_D,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_2_B_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_2_B_C_D_E"); cps->set ({_B,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_2_B_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_2_B_C_D_F"); cps->set ({_B,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_2_B_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_2_B_C_E_F"); cps->set ({_B,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_2_B_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_2_B_D_E_F"); cps->set ({_B,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_2_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_2_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F||CPS_4_2_C_D_E_F"); cps->set ({_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F"); cps->set ({_A,_B,_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F"); cps->set ({_A,_B,_C,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_1_A_B_C_D__X_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_1_A_B_C_D__X_E_F"); cps->set ({_A,_B,_C,_D},{_E,_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_1_A_B_C_E__X_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_1_A_B_C_E__X_D_F"); cps->set ({_A,_B,_C,_E},{_D,_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_1_A_B_D_E__X_C_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_1_A_B_D_E__X_C_F"); cps->set ({_A,_B,_D,_E},{_C,_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_1_A_C_D_E__X_B_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_1_A_C_D_E__X_B_F"); cps->set ({_A,_C,_D,_E},{_B,_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_1_B_C_D_E__X_A_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_1_B_C_D_E__X_A_F"); cps->set ({_B,_C,_D,_E},{_A,_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_2_A_B_C_D__X_F"); cps->set ({_A,_B,_C,_D},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_2_A_B_C_E__X_F"); cps->set ({_A,_B,_C,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_2_A_B_D_E__X_F"); cps->set ({_A,_B,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_2_A_C_D_E__X_F"); cps->set ({_A,_C,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_E__X_F||CPS_4_2_B_C_D_E__X_F"); cps->set ({_B,_C,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E"); cps->set ({_A,_B,_C,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_1_A_B_C_D__X_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_1_A_B_C_D__X_E_F"); cps->set ({_A,_B,_C,_D},{_E,_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_1_A_B_C_F__X_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_1_A_B_C_F__X_D_E"); cps->set ({_A,_B,_C,_F},{_D,_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_1_A_B_D_F__X_C_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_1_A_B_D_F__X_C_E"); cps->set ({_A,_B,_D,_F},{_C,_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_1_A_C_D_F__X_B_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_1_A_C_D_F__X_B_E"); cps->set ({_A,_C,_D,_F},{_B,_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_1_B_C_D_F__X_A_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_1_B_C_D_F__X_A_E"); cps->set ({_B,_C,_D,_F},{_A,_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_D__X_E"); cps->set ({_A,_B,_C,_D},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E"); cps->set ({_A,_B,_C,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E"); cps->set ({_A,_B,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E"); cps->set ({_A,_C,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E"); cps->set ({_B,_C,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D"); cps->set ({_A,_B,_C,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F"); cps->set ({_A,_B,_C,_E},{_D,_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E"); cps->set ({_A,_B,_C,_F},{_D,_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D"); cps->set ({_A,_B,_E,_F},{_C,_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D"); cps->set ({_A,_C,_E,_F},{_B,_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D"); cps->set ({_B,_C,_E,_F},{_A,_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D"); cps->set ({_A,_B,_C,_E},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D"); cps->set ({_A,_B,_C,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D"); cps->set ({_A,_B,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D"); cps->set ({_A,_C,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D"); cps->set ({_B,_C,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C"); cps->set ({_A,_B,_D,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F"); cps->set ({_A,_B,_D,_E},{_C,_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E"); cps->set ({_A,_B,_D,_F},{_C,_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D"); cps->set ({_A,_B,_E,_F},{_C,_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C"); cps->set ({_A,_D,_E,_F},{_B,_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C"); cps->set ({_B,_D,_E,_F},{_A,_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C"); cps->set ({_A,_B,_D,_E},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C"); cps->set ({_A,_B,_D,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C"); cps->set ({_A,_B,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C"); cps->set ({_A,_D,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C"); cps->set ({_B,_D,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B"); cps->set ({_A,_C,_D,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F"); cps->set ({_A,_C,_D,_E},{_B,_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E"); cps->set ({_A,_C,_D,_F},{_B,_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D"); cps->set ({_A,_C,_E,_F},{_B,_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C"); cps->set ({_A,_D,_E,_F},{_B,_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B"); cps->set ({_C,_D,_E,_F},{_A,_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B"); cps->set ({_A,_C,_D,_E},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B"); cps->set ({_A,_C,_D,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B"); cps->set ({_A,_C,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B"); cps->set ({_A,_D,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_B"); cps->set ({_C,_D,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A"); cps->set ({_B,_C,_D,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_1_B_C_D_E__X_A_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_1_B_C_D_E__X_A_F"); cps->set ({_B,_C,_D,_E},{_A,_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_1_B_C_D_F__X_A_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_1_B_C_D_F__X_A_E"); cps->set ({_B,_C,_D,_F},{_A,_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_1_B_C_E_F__X_A_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_1_B_C_E_F__X_A_D"); cps->set ({_B,_C,_E,_F},{_A,_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_1_B_D_E_F__X_A_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_1_B_D_E_F__X_A_C"); cps->set ({_B,_D,_E,_F},{_A,_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_1_C_D_E_F__X_A_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_1_C_D_E_F__X_A_B"); cps->set ({_C,_D,_E,_F},{_A,_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_2_B_C_D_E__X_A"); cps->set ({_B,_C,_D,_E},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_2_B_C_D_F__X_A"); cps->set ({_B,_C,_D,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_2_B_C_E_F__X_A"); cps->set ({_B,_C,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_2_B_D_E_F__X_A"); cps->set ({_B,_D,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_B_C_D_E_F__X_A||CPS_4_2_C_D_E_F__X_A"); cps->set ({_C,_D,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E"); cps->set ({_A,_B,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_2_A_B_C_D__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_2_A_B_C_D__X_E"); cps->set ({_A,_B,_C,_D},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_2_A_B_C_E__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_2_A_B_C_E__X_D"); cps->set ({_A,_B,_C,_E},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_2_A_B_D_E__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_2_A_B_D_E__X_C"); cps->set ({_A,_B,_D,_E},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_2_A_C_D_E__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_2_A_C_D_E__X_B"); cps->set ({_A,_C,_D,_E},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_2_B_C_D_E__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_2_B_C_D_E__X_A"); cps->set ({_B,_C,_D,_E},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_3_A_B_C_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_3_A_B_C_D"); cps->set ({_A,_B,_C,_D},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_3_A_B_C_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_3_A_B_C_E"); cps->set ({_A,_B,_C,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_3_A_B_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_3_A_B_D_E"); cps->set ({_A,_B,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_3_A_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_3_A_C_D_E"); cps->set ({_A,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_3_B_C_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_E||CPS_4_3_B_C_D_E"); cps->set ({_B,_C,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F"); cps->set ({_A,_B,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_2_A_B_C_D__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_2_A_B_C_D__X_F"); cps->set ({_A,_B,_C,_D},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_2_A_B_C_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_2_A_B_C_F__X_D"); cps->set ({_A,_B,_C,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_2_A_B_D_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_2_A_B_D_F__X_C"); cps->set ({_A,_B,_D,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_2_A_C_D_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_2_A_C_D_F__X_B"); cps->set ({_A,_C,_D,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_2_B_C_D_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_2_B_C_D_F__X_A"); cps->set ({_B,_C,_D,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_D"); cps->set ({_A,_B,_C,_D},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_C_F"); cps->set ({_A,_B,_C,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_B_D_F"); cps->set ({_A,_B,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_A_C_D_F"); cps->set ({_A,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_D_F||CPS_4_3_B_C_D_F"); cps->set ({_B,_C,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F"); cps->set ({_A,_B,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_E__X_F"); cps->set ({_A,_B,_C,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_C_F__X_E"); cps->set ({_A,_B,_C,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_B_E_F__X_C"); cps->set ({_A,_B,_E,_F},{_C});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_A_C_E_F__X_B"); cps->set ({_A,_C,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_2_B_C_E_F__X_A"); cps->set ({_B,_C,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_E"); cps->set ({_A,_B,_C,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_C_F"); cps->set ({_A,_B,_C,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_B_E_F"); cps->set ({_A,_B,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_A_C_E_F"); cps->set ({_A,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_C_E_F||CPS_4_3_B_C_E_F"); cps->set ({_B,_C,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F"); cps->set ({_A,_B,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_E__X_F"); cps->set ({_A,_B,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_D_F__X_E"); cps->set ({_A,_B,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_B_E_F__X_D"); cps->set ({_A,_B,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_A_D_E_F__X_B"); cps->set ({_A,_D,_E,_F},{_B});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_2_B_D_E_F__X_A"); cps->set ({_B,_D,_E,_F},{_A});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_E"); cps->set ({_A,_B,_D,_E},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_D_F"); cps->set ({_A,_B,_D,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_B_E_F"); cps->set ({_A,_B,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_A_D_E_F"); cps->set ({_A,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_B_D_E_F||CPS_4_3_B_D_E_F"); cps->set ({_B,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F"); cps->set ({_A,_C,_D,_E,_F},{});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_A_C_D_E__X_F", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_A_C_D_E__X_F"); cps->set ({_A,_C,_D,_E},{_F});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_A_C_D_F__X_E", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_A_C_D_F__X_E"); cps->set ({_A,_C,_D,_F},{_E});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_A_C_E_F__X_D", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_A_C_E_F__X_D"); cps->set ({_A,_C,_E,_F},{_D});}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_A_D_E_F__X_C", [this](){auto cps = _getTuning ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_3_A_C_D_E_F||CPS_4_2_A_D_E_F__X_C"); cps->set ({_A,_D,_E,_F},{_C});}},
-
- });
-}
@@ -1,265 +0,0 @@
-#include "../EulerGenusModel.h"
-#include "../EulerGenusViewModel.h"
-void EulerGenusModel::_createViewModelConstructorMap_0004()
-{
-   _viewModelConstructorMap->insert ({
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_B_C__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_B_C__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_4_2_A_B_C_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_B_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_B_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_4_2_A_B_C_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_C_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_3_2_A_C_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_4_2_A_B_C_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_3_2_B_C_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_3_2_B_C_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_C_F__X_E__CPS_4_2_A_B_C_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E__CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_B_D__X_E_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_B_D__X_E_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_B_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_B_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_D_F__X_B_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_1_A_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_1_B_D_F__X_A_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_1_B_D_F__X_A_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_B_D__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_B_D__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_B_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_B_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_D_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_2_A_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_2_B_D_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_3_2_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_B_D_F__X_E__CPS_4_2_A_B_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_1_A_C_D__X_E_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_1_A_C_D__X_E_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_1_A_C_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_1_A_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_1_A_D_F__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_1_A_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_1_C_D_F__X_A_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_1_C_D_F__X_A_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_2_A_C_D__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_2_A_C_D__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_2_A_C_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_2_A_C_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_2_A_D_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_2_A_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_2_C_D_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_3_2_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_A_C_D_F__X_E__CPS_4_2_A_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_1_B_C_D__X_E_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_1_B_C_D__X_E_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_1_B_C_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_1_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_1_B_D_F__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_1_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_1_C_D_F__X_B_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_1_C_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_2_B_C_D__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_2_B_C_D__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_2_B_C_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_2_B_C_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_2_B_D_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_2_B_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_2_C_D_F__X_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_3_2_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_D_F__X_E||CPS_4_2_B_C_D_F__X_E__CPS_4_2_B_C_D_F__X_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_B_C_E__X_D_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_B_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_4_1_A_B_C_E__X_D_F");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_B_C_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_4_1_A_B_C_F__X_D_E");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_B_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_C_E_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_B_C_E_F__X_A_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_B_C_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_4_1_B_C_E_F__X_A_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_B_C_E__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_B_C_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_B_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_5_2_A_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_4_1_A_B_C_E__X_D_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_4_1_A_B_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_B_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_4_1_A_B_C_E__X_D_F");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_3_1_A_B_C__X_D_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_3_1_A_B_C__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_4_1_A_B_C_E__X_D_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_3_1_A_B_E__X_D_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_3_1_A_B_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_4_1_A_B_C_E__X_D_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_3_1_A_C_E__X_D_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_3_1_A_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_4_1_A_B_C_E__X_D_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_3_1_B_C_E__X_D_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_3_1_B_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_E__X_D_F__CPS_4_1_A_B_C_E__X_D_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_4_1_A_B_C_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_4_1_A_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_4_1_A_B_C_F__X_D_E");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_3_1_A_B_C__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_3_1_A_B_C__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_4_1_A_B_C_F__X_D_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_3_1_A_B_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_3_1_A_B_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_4_1_A_B_C_F__X_D_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_3_1_A_C_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_3_1_A_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_4_1_A_B_C_F__X_D_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_3_1_B_C_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_3_1_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_C_F__X_D_E__CPS_4_1_A_B_C_F__X_D_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_B_E__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_B_E__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_B_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_B_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_B_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_C_E__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_C_E__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_C_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_C_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_E_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_C_E_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_4_1_B_C_E_F__X_A_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_4_1_B_C_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_1_B_C_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_4_1_B_C_E_F__X_A_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_3_1_B_C_E__X_A_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_3_1_B_C_E__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_4_1_B_C_E_F__X_A_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_3_1_B_C_F__X_A_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_3_1_B_C_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_4_1_B_C_E_F__X_A_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_3_1_B_E_F__X_A_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_3_1_B_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_4_1_B_C_E_F__X_A_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_3_1_C_E_F__X_A_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_3_1_C_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_1_B_C_E_F__X_A_D__CPS_4_1_B_C_E_F__X_A_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_1_A_B_C__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_1_A_B_C__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_1_A_B_E__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_1_A_B_E__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_1_A_C_E__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_1_A_C_E__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_1_B_C_E__X_A_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_1_B_C_E__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_2_A_B_C__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_2_A_B_C__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_2_A_B_E__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_2_A_B_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_2_A_C_E__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_2_A_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_2_B_C_E__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_3_2_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_E__X_D__CPS_4_2_A_B_C_E__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_1_A_B_C__X_D_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_1_A_B_C__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_1_A_B_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_1_A_B_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_1_A_C_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_1_A_C_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_1_B_C_F__X_A_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_1_B_C_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_2_A_B_C__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_2_A_B_C__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_2_A_B_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_2_A_B_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_2_A_C_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_2_A_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_2_B_C_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_3_2_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_C_F__X_D__CPS_4_2_A_B_C_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_B_E__X_D_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_B_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_B_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_B_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_E_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_1_A_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_1_B_E_F__X_A_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_1_B_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_B_E__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_B_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_B_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_B_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_2_A_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_2_B_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_3_2_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_B_E_F__X_D__CPS_4_2_A_B_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_1_A_C_E__X_D_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_1_A_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_1_A_C_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_1_A_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_1_A_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_1_A_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_1_C_E_F__X_A_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_1_C_E_F__X_A_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_2_A_C_E__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_2_A_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_2_A_C_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_2_A_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_2_A_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_2_A_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_2_C_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_3_2_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_A_C_E_F__X_D__CPS_4_2_A_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_1_B_C_E__X_D_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_1_B_C_E__X_D_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_1_B_C_F__X_D_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_1_B_C_F__X_D_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_1_B_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_1_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_1_C_E_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_1_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_2_B_C_E__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_2_B_C_E__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_2_B_C_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_2_B_C_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_2_B_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_2_B_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_2_C_E_F__X_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_3_2_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_C_E_F__X_D||CPS_4_2_B_C_E_F__X_D__CPS_4_2_B_C_E_F__X_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_B_D_E__X_C_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_B_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_4_1_A_B_D_E__X_C_F");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_B_D_F__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_4_1_A_B_D_F__X_C_E");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_B_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_D_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_B_D_E_F__X_A_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_B_D_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_4_1_B_D_E_F__X_A_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_B_D_E__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_B_D_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_B_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_5_2_A_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_4_1_A_B_D_E__X_C_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_4_1_A_B_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_B_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_4_1_A_B_D_E__X_C_F");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_3_1_A_B_D__X_C_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_3_1_A_B_D__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_4_1_A_B_D_E__X_C_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_3_1_A_B_E__X_C_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_3_1_A_B_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_4_1_A_B_D_E__X_C_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_3_1_A_D_E__X_C_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_3_1_A_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_4_1_A_B_D_E__X_C_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_3_1_B_D_E__X_C_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_3_1_B_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_E__X_C_F__CPS_4_1_A_B_D_E__X_C_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_4_1_A_B_D_F__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_4_1_A_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_4_1_A_B_D_F__X_C_E");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_3_1_A_B_D__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_3_1_A_B_D__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_4_1_A_B_D_F__X_C_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_3_1_A_B_F__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_3_1_A_B_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_4_1_A_B_D_F__X_C_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_3_1_A_D_F__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_3_1_A_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_4_1_A_B_D_F__X_C_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_3_1_B_D_F__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_3_1_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_D_F__X_C_E__CPS_4_1_A_B_D_F__X_C_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_B_E__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_B_E__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_B_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_B_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_A_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_B_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_3_1_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_B_E_F__X_C_D__CPS_4_1_A_B_E_F__X_C_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_D_E__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_D_E__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_D_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_D_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_D_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_4_1_B_D_E_F__X_A_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_4_1_B_D_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_1_B_D_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_4_1_B_D_E_F__X_A_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_3_1_B_D_E__X_A_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_3_1_B_D_E__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_4_1_B_D_E_F__X_A_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_3_1_B_D_F__X_A_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_3_1_B_D_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_4_1_B_D_E_F__X_A_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_3_1_B_E_F__X_A_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_3_1_B_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_4_1_B_D_E_F__X_A_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_3_1_D_E_F__X_A_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_3_1_D_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_1_B_D_E_F__X_A_C__CPS_4_1_B_D_E_F__X_A_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_1_A_B_D__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_1_A_B_D__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_1_A_B_E__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_1_A_B_E__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_1_A_D_E__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_1_A_D_E__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_1_B_D_E__X_A_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_1_B_D_E__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_2_A_B_D__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_2_A_B_D__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_2_A_B_E__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_2_A_B_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_2_A_D_E__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_2_A_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_2_B_D_E__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_3_2_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_E__X_C__CPS_4_2_A_B_D_E__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_1_A_B_D__X_C_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_1_A_B_D__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_1_A_B_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_1_A_B_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_1_A_D_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_1_A_D_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_1_B_D_F__X_A_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_1_B_D_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_2_A_B_D__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_2_A_B_D__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_2_A_B_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_2_A_B_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_2_A_D_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_2_A_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_2_B_D_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_3_2_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_D_F__X_C__CPS_4_2_A_B_D_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_B_E__X_C_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_B_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_B_F__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_B_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_1_A_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_1_B_E_F__X_A_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_1_B_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_B_E__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_B_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_B_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_B_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_2_A_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_2_B_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_3_2_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_B_E_F__X_C__CPS_4_2_A_B_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_1_A_D_E__X_C_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_1_A_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_1_A_D_F__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_1_A_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_1_A_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_1_A_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_1_D_E_F__X_A_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_1_D_E_F__X_A_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_2_A_D_E__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_2_A_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_2_A_D_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_2_A_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_2_A_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_2_A_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_2_D_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_3_2_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_A_D_E_F__X_C__CPS_4_2_A_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_1_B_D_E__X_C_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_1_B_D_E__X_C_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_1_B_D_F__X_C_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_1_B_D_F__X_C_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_1_B_E_F__X_C_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_1_B_E_F__X_C_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_1_D_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_1_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_2_B_D_E__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_2_B_D_E__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_2_B_D_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_2_B_D_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_2_B_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_2_B_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_2_D_E_F__X_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_3_2_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_B_D_E_F__X_C||CPS_4_2_B_D_E_F__X_C__CPS_4_2_B_D_E_F__X_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_C_D_E__X_B_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_C_D_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_4_1_A_C_D_E__X_B_F");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_C_D_F__X_B_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_C_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_4_1_A_C_D_F__X_B_E");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_C_E_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_D_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_C_D_E_F__X_A_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_C_D_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_4_1_C_D_E_F__X_A_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_C_D_E__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_C_D_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_C_E_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_D_E_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B__CPS_4_2_A_D_E_F__X_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_C_D_E_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_5_2_A_C_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_C_D_E_F__X_B__CPS_4_2_C_D_E_F__X_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_4_1_A_C_D_E__X_B_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_4_1_A_C_D_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_C_D_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_4_1_A_C_D_E__X_B_F");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_3_1_A_C_D__X_B_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_3_1_A_C_D__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_4_1_A_C_D_E__X_B_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_3_1_A_C_E__X_B_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_3_1_A_C_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_4_1_A_C_D_E__X_B_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_3_1_A_D_E__X_B_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_3_1_A_D_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_4_1_A_C_D_E__X_B_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_3_1_C_D_E__X_B_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_3_1_C_D_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_E__X_B_F__CPS_4_1_A_C_D_E__X_B_F", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_4_1_A_C_D_F__X_B_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_4_1_A_C_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_C_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_4_1_A_C_D_F__X_B_E");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_3_1_A_C_D__X_B_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_3_1_A_C_D__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_4_1_A_C_D_F__X_B_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_3_1_A_C_F__X_B_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_3_1_A_C_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_4_1_A_C_D_F__X_B_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_3_1_A_D_F__X_B_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_3_1_A_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_4_1_A_C_D_F__X_B_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_3_1_C_D_F__X_B_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_3_1_C_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_D_F__X_B_E__CPS_4_1_A_C_D_F__X_B_E", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_C_E__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_C_E__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_C_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_C_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_E_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_A_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_C_E_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_3_1_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_C_E_F__X_B_D__CPS_4_1_A_C_E_F__X_B_D", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_D_E__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_D_E__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_D_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_D_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_A_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_D_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_3_1_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_A_D_E_F__X_B_C__CPS_4_1_A_D_E_F__X_B_C", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_4_1_C_D_E_F__X_A_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_4_1_C_D_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_1_C_D_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_4_1_C_D_E_F__X_A_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_3_1_C_D_E__X_A_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_3_1_C_D_E__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_4_1_C_D_E_F__X_A_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_3_1_C_D_F__X_A_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_3_1_C_D_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_4_1_C_D_E_F__X_A_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_3_1_C_E_F__X_A_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_3_1_C_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_4_1_C_D_E_F__X_A_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_3_1_D_E_F__X_A_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_3_1_D_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_1_C_D_E_F__X_A_B__CPS_4_1_C_D_E_F__X_A_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_1_A_C_D__X_B_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_1_A_C_D__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_1_A_C_E__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_1_A_C_E__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_1_A_D_E__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_1_A_D_E__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_1_C_D_E__X_A_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_1_C_D_E__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_2_A_C_D__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_2_A_C_D__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_2_A_C_E__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_2_A_C_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_2_A_D_E__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_2_A_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_2_C_D_E__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_3_2_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_E__X_B__CPS_4_2_A_C_D_E__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_1_A_C_D__X_B_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_1_A_C_D__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_1_A_C_F__X_B_D", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_1_A_C_F__X_B_D", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_1_A_D_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_1_A_D_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_1_C_D_F__X_A_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_1_C_D_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_2_A_C_D__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_2_A_C_D__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_2_A_C_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_2_A_C_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_2_A_D_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_2_A_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_2_C_D_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_3_2_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_D_F__X_B__CPS_4_2_A_C_D_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_C_E__X_B_F", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_C_E__X_B_F", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_C_F__X_B_E", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_C_F__X_B_E", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_E_F__X_B_C", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_1_A_E_F__X_B_C", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_1_C_E_F__X_A_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_1_C_E_F__X_A_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_C_E__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_C_E__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_C_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_C_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_E_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_2_A_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_2_C_E_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_3_2_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_C_E_F__X_B__CPS_4_2_A_C_E_F__X_B", "W_EG_CPS_LEAF");}},
-       {"||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B__CPS_4_2_A_D_E_F__X_B", [this](){return _create_view_model ("||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B__CPS_4_2_A_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B__CPS_4_2_A_D_E_F__X_B", "||EulerGenus_6_A_B_C_D_E_F||CPS_6_3_A_B_C_D_E_F||CPS_5_2_A_C_D_E_F__X_B||CPS_4_2_A_D_E_F__X_B__CPS_4_2_A_D_E_F__X_B");}},
-
- });
-}
@@ -13,15 +13,9 @@
 // types
 struct EulerGenusViewModel;
 using DAWKey = String;
-using DAWKeys = StringArray;
-using ViewModelCache = unordered_map<DAWKey, shared_ptr<EulerGenusViewModel>>;
-using ViewModelConstructor = function<shared_ptr<EulerGenusViewModel>(void)>;
-using ViewModelConstructorMap = unordered_map<DAWKey, ViewModelConstructor>;
+using ViewModelCache = vector<shared_ptr<EulerGenusViewModel>>; // by index in EulerGenusTables::dawKeys
 using TuningKey = String;
-using TuningCache = unordered_map<TuningKey, shared_ptr<CPSTuningBase>>;
-using TuningConstructor = function<shared_ptr<CPSTuningBase>(void)>;
-using TuningConstructorMap = unordered_map<TuningKey, TuningConstructor>;
-using TuningUpdateFunction = function<void()>;
-using TuningUpdateFunctionMap = unordered_map<TuningKey, TuningUpdateFunction>;
-using TuningSelectionFunction = function<void()>;
-using TuningSelectionFunctionMap = unordered_map<DAWKey, TuningSelectionFunction>;
+using TuningCache = vector<shared_ptr<CPSTuningBase>>; // by index in EulerGenusTables::tunings
+using TuningFactory = shared_ptr<CPSTuningBase> (*)(vector<Microtone_p> master_set, vector<Microtone_p> common_tones); // by EulerGenusTables::TuningClass
+using TuningSelector = void (CPSTuningBase::*)(); // by EulerGenusTables::Selection
+using MasterTerms = array<Microtone_p, 6>; // A..F
@@ -21,24 +21,12 @@ EulerGenusMorphModel::EulerGenusMorphModel(WilsonicProcessor& processor)
 , _E(CPS::E(9))
 , _F(CPS::F(11))
 {
-    // caches
-    _viewModelCache = make_unique<ViewModelCache>();
-    _tuningCache = make_unique<TuningCache>();
+    // caches: the keys, tunings, and view models are in EulerGenusTables, shared with EulerGenusModel
+    _viewModelCache = make_unique<ViewModelCache>(EulerGenusTables::numDAWKeys);
+    _tuningCache = make_unique<TuningCache>(EulerGenusTables::numTunings);
 
-    // we will use EulerGenusModel DAW keys
-    
-    // lambda maps
-    _createViewModelConstructorMap();
-    _createTuningConstructorMap();
-    _createTuningUpdateMap();
-    _createTuningSelectionMap();
-
-    //TODO: RACE CONDITION
-/*
-    // initial state
-    auto egm = _processor.getEulerGenusModel();
-    _selectDAWKey(egm->dawKeyAtIndex(2)); // EG6 CPS_6_3
- */
+    // initial state: the tables don't depend on EulerGenusModel, so there is no race with its construction
+    _selectDAWKey(2); // EG6 CPS_6_3
 }
 
 EulerGenusMorphModel::~EulerGenusMorphModel() {
@@ -49,9 +37,7 @@ EulerGenusMorphModel::~EulerGenusMorphModel() {
 void EulerGenusMorphModel::parameterChanged(const String& parameterID, float newValue) {
     const ScopedLock sl(_lock);
     if(parameterID == EulerGenusModel::getEulerGenus6ParameterID().getParamID()) {
-        auto egm = _processor.getEulerGenusModel();
-        auto daw_key = egm->dawKeyAtIndex(static_cast<int>(newValue));
-        _selectDAWKey(daw_key);
+        _selectDAWKey(static_cast<int>(newValue));
     } else if(parameterID == EulerGenusModel::getEulerGenus6AParameterID().getParamID()) {
         _A->setFrequencyValue(newValue);
         _A->setShortDescriptionText2(Microtone::getFrequencyValueDescription(newValue));
@@ -99,17 +85,18 @@ shared_ptr<Tuning> EulerGenusMorphModel::getTuning() {
 }
 
 // this is the heavy lifter...host calls this, no UI calls this
-void EulerGenusMorphModel::_selectDAWKey(DAWKey daw_key) {
+void EulerGenusMorphModel::_selectDAWKey(int daw_key_index) {
     // Lock
     const ScopedLock sl(_lock);
 
-    // leaf nodes are NOP
-    if(daw_key == String(EulerGenusModel::__daw_key_null)) {
+    // out of range is NOP
+    if(daw_key_index < 0 || daw_key_index >= static_cast<int>(EulerGenusTables::numDAWKeys)) {
+        jassertfalse;
         return;
     }
 
     // lazy-load daw_key's view model
-    auto vm = _getViewModel(daw_key);
+    auto vm = _getViewModel(static_cast<size_t>(daw_key_index));
     _currentViewModel = vm;
     jassert(_currentViewModel != nullptr);
 
@@ -139,14 +126,11 @@ void EulerGenusMorphModel::_selectDAWKey(DAWKey daw_key) {
     }
 }
 
-// CODEGEN
 // updates the current view model's tuning with ABCDEF
 void EulerGenusMorphModel::_updateCurrentViewModelTuning() {
     // update parent tuning, and all subsets
-    auto parentTuningKey = _currentViewModel->parentTuningKey;
-    auto ptkf =(*_tuningUpdateMap)[parentTuningKey];
-    jassert(ptkf != nullptr);
-    ptkf();
+    auto const tuning_index = _currentViewModel->parentTuningIndex;
+    EulerGenusModel::updateTuning(tuning_index, _getTuning(tuning_index), _getMasterTerms());
 }
 
 // trivial helper
@@ -156,227 +140,53 @@ void EulerGenusMorphModel::_setTuning(shared_ptr<Tuning> tuning) {
 
 shared_ptr<EulerGenusViewModel> EulerGenusMorphModel::_getViewModel(DAWKey daw_key) {
     jassert(daw_key.length() > 0);
-    ViewModelCache::const_iterator iter = _viewModelCache->find(daw_key);
-    if(iter != _viewModelCache->end()) {
-        // if view model exists return it
-        auto view_model = iter->second;
-        jassert(view_model != nullptr);
-        
-        return view_model;
-    } else {
-        // else create ViewModel and store in cache
-        auto view_model_constructor =(*_viewModelConstructorMap) [daw_key];
-        jassert(view_model_constructor != nullptr);
-        auto view_model = view_model_constructor(); // execute creation lambda
-        jassert(view_model != nullptr);
-        (*_viewModelCache)[daw_key] = view_model; // store in cache
-        
-        return view_model;
+    auto const index = EulerGenusModel::findDAWKey(daw_key);
+    if(index < 0) {
+        // bad
+        jassertfalse;
+        return nullptr;
     }
 
-    // bad
-    jassertfalse;
-    return nullptr;
+    return _getViewModel(static_cast<size_t>(index));
 }
 
-// CODEGEN
-// updates the current view model's tuning's selection state
-void EulerGenusMorphModel::_updateCurrentViewModelTuningSelectionState() {
-    // update selection state of current view model's parent tuning
-    auto dawKey = _currentViewModel->dawKey;
-    auto ucvtss =(*_tuningSelectionMap)[dawKey];
-    jassert(ucvtss != nullptr);
-    ucvtss();
-}
-
-
-// CACHE
-// ONLY _getTuning calls this member function via lambda when there is no entry in _tuningCache
-shared_ptr<CPSTuningBase> EulerGenusMorphModel::_create_tuning(CPS_Class tuning_class_name,
-                                                           vector<Microtone_p> master_set,
-                                                           vector<Microtone_p> common_terms,
-                                                           DAWKey parent_key,
-                                                           vector<DAWKey> s0_daw_keys,
-                                                           vector<DAWKey> s1_daw_keys)
-{
-    shared_ptr<CPSTuningBase> cps = nullptr;
-    switch(tuning_class_name)
-    {
-        case CPS_Class::CPS_1_1:
-            cps = make_shared<CPS_1_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_2_1:
-            cps = make_shared<CPS_2_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_2_2:
-            cps = make_shared<CPS_2_2>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_3_1:
-            cps = make_shared<CPS_3_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_3_2:
-            cps = make_shared<CPS_3_2>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_3_3:
-            cps = make_shared<CPS_3_3>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_4_1:
-            cps = make_shared<CPS_4_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_4_2:
-            cps = make_shared<CPS_4_2>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_4_3:
-            cps = make_shared<CPS_4_3>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_4_4:
-            cps = make_shared<CPS_4_4>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_5_1:
-            cps = make_shared<CPS_5_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_5_2:
-            cps = make_shared<CPS_5_2>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_5_3:
-            cps = make_shared<CPS_5_3>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_5_4:
-            cps = make_shared<CPS_5_4>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_5_5:
-            cps = make_shared<CPS_5_5>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_1:
-            cps = make_shared<CPS_6_1>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_2:
-            cps = make_shared<CPS_6_2>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_3:
-            cps = make_shared<CPS_6_3>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_4:
-            cps = make_shared<CPS_6_4>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_5:
-            cps = make_shared<CPS_6_5>(master_set, common_terms);
-            break;
-        case CPS_Class::CPS_6_6:
-            cps = make_shared<CPS_6_6>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_1:
-            cps = make_shared<EulerGenus_1>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_2:
-            cps = make_shared<EulerGenus_2>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_3:
-            cps = make_shared<EulerGenus_3>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_4:
-            cps = make_shared<EulerGenus_4>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_5:
-            cps = make_shared<EulerGenus_5>(master_set, common_terms);
-            break;
-        case CPS_Class::EulerGenus_6:
-            cps = make_shared<EulerGenus_6>(master_set, common_terms);
-            break;
-        case CPS_Class::UNDEFINED :
-        case CPS_Class::Triad:
-        case CPS_Class::TriadicDiamond:
-        case CPS_Class::Mandala:
-        case CPS_Class::Tetrad:
-        case CPS_Class::TetradicDiamond:
-        case CPS_Class::Pentad:
-        case CPS_Class::PentadicDiamond:
-        case CPS_Class::Hexad:
-        case CPS_Class::HexadicDiamond:
-        case CPS_Class::CPS_7_1:
-        case CPS_Class::Heptad:
-        case CPS_Class::HeptadicDiamond:
-        case CPS_Class::CPS_8_1:
-        case CPS_Class::Ogdoad:
-        case CPS_Class::OgdoadicDiamond:
-        default:
-            jassertfalse;
-            break;
-    }
-
-    // subsets sizes and daw keys sizes must match
-    jassert(cps != nullptr);
-    cps->setShouldComputeSubsets(true); cps->update(); cps->selectParent();
-    jassert(cps->getSubsets0().size() == s0_daw_keys.size());
-    jassert(cps->getSubsets1().size() == s1_daw_keys.size());
-
-    // set the daw keys for the parent and every subset
-    jassert(parent_key.length() > 0);
-    cps->setDAWKey(parent_key);
-    for(unsigned long index = 0; index < cps->getSubsets0().size(); index++) {
-        auto s0_daw_key = s0_daw_keys[index];
-        cps->getSubsets0()[index]->setDAWKey(s0_daw_key);
-    }
-    
-    for(unsigned long index = 0; index < cps->getSubsets1().size(); index++) {
-        auto s1_daw_key = s1_daw_keys[index];
-        cps->getSubsets1()[index]->setDAWKey(s1_daw_key);
+shared_ptr<EulerGenusViewModel> EulerGenusMorphModel::_getViewModel(size_t daw_key_index) {
+    auto& view_model = (*_viewModelCache)[daw_key_index];
+    if(view_model == nullptr) {
+        // create ViewModel and store in cache
+        auto const tuning_index = EulerGenusTables::dawKeys[daw_key_index].tuning;
+        view_model = EulerGenusModel::createViewModel(daw_key_index, _getTuning(tuning_index));
+        jassert(view_model != nullptr);
     }
 
-    return cps;
+    return view_model;
 }
 
-// CACHE
-// ONLY _getViewModel calls this member function via lambda when there is no entry in _tuningCache
-shared_ptr<EulerGenusViewModel> EulerGenusMorphModel::_create_view_model(string daw_key, string tuning_key, string back_key, string select_key) {
-    auto retVal = make_shared<EulerGenusViewModel>();
-    retVal->dawKey = daw_key;
-    retVal->parentTuningKey = tuning_key;
-    retVal->parentTuning = _getTuning(retVal->parentTuningKey);
-    retVal->dawBackKey = back_key;
-    retVal->dawDrillKey = select_key;
-    jassert(retVal != nullptr);
-    
-    return retVal;
+// updates the current view model's tuning's selection state
+void EulerGenusMorphModel::_updateCurrentViewModelTuningSelectionState() {
+    // update selection state of current view model's parent tuning
+    EulerGenusModel::selectTuning(_currentViewModel->dawKeyIndex, _currentViewModel->parentTuning);
 }
 
-// CODEGEN
 // lazy loading: return value if key exists, else create, store, and return new value
-shared_ptr<CPSTuningBase> EulerGenusMorphModel::_getTuning(TuningKey tuning_key)
-{
-    TuningCache::const_iterator iter = _tuningCache->find(tuning_key);
-
-    if(iter != _tuningCache->end()) {
-        // if tuning exists return it
-        shared_ptr<CPSTuningBase> tuning = nullptr;
-        tuning = iter->second;
+shared_ptr<CPSTuningBase> EulerGenusMorphModel::_getTuning(size_t tuning_index) {
+    auto& tuning = (*_tuningCache)[tuning_index];
+    if(tuning == nullptr) {
+        // create tuning and store it
+        tuning = EulerGenusModel::createTuning(tuning_index, _getMasterTerms());
         jassert(tuning != nullptr);
-        // update app tuning model params
-        tuning->setNoteNumberMiddleC(_noteNumberMiddleC);
-        tuning->setOctaveMiddleC(_octaveMiddleC);
-        tuning->setFrequencyMiddleC(_frequencyMiddleC);
-        tuning->setNPOOverride(_npoOverride);
-        tuning->setNPOOverrideEnable(_npoOverrideEnable);
+    }
 
-        return tuning;
-    } else {
-        // else create tuning and store it
-        auto tuning_constructor =(*_tuningConstructorMap)[tuning_key];
-        jassert(tuning_constructor != nullptr);
-        auto t = tuning_constructor();
-        jassert(t != nullptr);
-        (*_tuningCache)[tuning_key] = t;
-        // update app tuning model params
-        t->setNoteNumberMiddleC(_noteNumberMiddleC);
-        t->setOctaveMiddleC(_octaveMiddleC);
-        t->setFrequencyMiddleC(_frequencyMiddleC);
-        t->setNPOOverride(_npoOverride);
-        t->setNPOOverrideEnable(_npoOverrideEnable);
+    // update app tuning model params
+    tuning->setNoteNumberMiddleC(_noteNumberMiddleC);
+    tuning->setOctaveMiddleC(_octaveMiddleC);
+    tuning->setFrequencyMiddleC(_frequencyMiddleC);
+    tuning->setNPOOverride(_npoOverride);
+    tuning->setNPOOverrideEnable(_npoOverrideEnable);
 
-        return t;
-    }
+    return tuning;
+}
 
-    // bad
-    jassertfalse;
-    return nullptr;
+const MasterTerms EulerGenusMorphModel::_getMasterTerms() {
+    return MasterTerms {_A, _B, _C, _D, _E, _F};
 }
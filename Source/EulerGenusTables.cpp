@@ -0,0 +1,80 @@
+/**
+ * @file EulerGenusTables.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the EulerGenusTables class.
+ *
+ * The tables themselves are in EulerGenusModelCodegen/EulerGenusTables+Data.cpp.
+ */
+
+#include "EulerGenusTables.h"
+#include <algorithm>
+#include <numeric>
+
+#pragma mark - lookup
+
+int EulerGenusTables::findDAWKey(std::string_view key) {
+    auto const bucket = hash(key, 0) % numHashBuckets;
+    auto const slot = hash(key, hashDisplacements[bucket]) % numDAWKeys;
+    auto const index = hashSlots[slot];
+
+    return dawKeys[index].key == key ? static_cast<int>(index) : -1;
+}
+
+#pragma mark - codegen
+
+// hash and displace: place the biggest buckets first, each with the first seed that maps all of its keys to free slots
+bool EulerGenusTables::buildPerfectHash(const std::vector<std::string_view>& keys,
+                                        size_t num_buckets,
+                                        std::vector<uint16_t>& displacements,
+                                        std::vector<uint16_t>& slots) {
+    auto const n = keys.size();
+    if(n == 0 || n > 0xffff || num_buckets == 0) {
+        return false;
+    }
+
+    std::vector<std::vector<uint16_t>> buckets(num_buckets);
+    for(size_t i = 0; i < n; i++) {
+        buckets[hash(keys[i], 0) % num_buckets].push_back(static_cast<uint16_t>(i));
+    }
+    std::vector<size_t> order(num_buckets);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    displacements.assign(num_buckets, 0);
+    slots.assign(n, 0);
+    std::vector<bool> used(n, false);
+    std::vector<size_t> candidate;
+    for(auto b : order) {
+        auto const& bucket = buckets[b];
+        if(bucket.empty()) {
+            break;
+        }
+        bool placed = false;
+        for(uint32_t d = 1; d <= 0xffff && !placed; d++) {
+            candidate.clear();
+            for(auto i : bucket) {
+                auto const s = hash(keys[i], d) % n;
+                if(used[s] || std::find(candidate.begin(), candidate.end(), s) != candidate.end()) {
+                    break;
+                }
+                candidate.push_back(s);
+            }
+            if(candidate.size() == bucket.size()) {
+                for(size_t k = 0; k < bucket.size(); k++) {
+                    used[candidate[k]] = true;
+                    slots[candidate[k]] = bucket[k];
+                }
+                displacements[b] = static_cast<uint16_t>(d);
+                placed = true;
+            }
+        }
+        if(!placed) {
+            return false;
+        }
+    }
+
+    return true;
+}
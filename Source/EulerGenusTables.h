@@ -0,0 +1,109 @@
+/**
+ * @file EulerGenusTables.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the EulerGenusTables class.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class EulerGenusTables
+ * @brief The Euler Genus 6 tree: every DAW key and every tuning, as read-only tables.
+ *
+ * The tables are generated by EulerGenusModel::eulerGenusCodeGen() into EulerGenusModelCodegen/:
+ * the sizes into EulerGenusTables_include.txt, the rows into EulerGenusTables+Data.cpp.
+ * They are constant-initialized, so they cost nothing at startup and are shared by every
+ * EulerGenusModel and EulerGenusMorphModel.
+ *
+ * DAW keys are in automation parameter order (the parameter value is the index), and are found
+ * by key with a minimal perfect hash.  Tunings are sorted by key, and are referenced by index.
+ */
+class EulerGenusTables final
+{
+public:
+    // the classes EulerGenusModel can construct; the names match CPS_Class
+    enum class TuningClass : uint8_t {
+        CPS_1_1, CPS_2_1, CPS_2_2, CPS_3_1, CPS_3_2, CPS_3_3,
+        CPS_4_1, CPS_4_2, CPS_4_3, CPS_4_4,
+        CPS_5_1, CPS_5_2, CPS_5_3, CPS_5_4, CPS_5_5,
+        CPS_6_1, CPS_6_2, CPS_6_3, CPS_6_4, CPS_6_5, CPS_6_6,
+        EulerGenus_1, EulerGenus_2, EulerGenus_3, EulerGenus_4, EulerGenus_5, EulerGenus_6,
+        NumTuningClasses
+    };
+
+    // what selecting a DAW key selects in its parent tuning; the order of CPSTuningBase's select methods
+    enum class Selection : uint8_t {
+        Parent,
+        S0_0, S0_1, S0_2, S0_3, S0_4, S0_5, S0_6, S0_7,
+        S1_0, S1_1, S1_2, S1_3, S1_4, S1_5, S1_6, S1_7,
+        NumSelections
+    };
+
+    // a set of the master terms: bit 0 is A, bit 1 is B, ... bit 5 is F
+    using Terms = uint8_t;
+    static constexpr size_t numTerms = 6;
+
+    struct Tuning {
+        std::string_view key {}; // TuningKey
+        TuningClass tuningClass {};
+        Terms masterSet = 0;
+        Terms commonTones = 0;
+        std::string_view parentKey {}; // the DAW key of the parent selected
+        uint16_t subsets0 = 0; // first index in subsetKeys
+        uint8_t numSubsets0 = 0;
+        uint16_t subsets1 = 0; // first index in subsetKeys
+        uint8_t numSubsets1 = 0;
+    };
+
+    struct DAWKey {
+        std::string_view key {};
+        uint16_t tuning = 0; // index in tunings: the parent tuning of the view model
+        Selection selection {};
+        std::string_view backKey {};
+        std::string_view drillKey {}; // EulerGenusModel::__daw_key_null at the leaves
+    };
+
+#include "./EulerGenusModelCodegen/EulerGenusTables_include.txt"
+
+    static const std::array<DAWKey, numDAWKeys> dawKeys;
+    static const std::array<Tuning, numTunings> tunings; // sorted by key
+    static const std::array<uint16_t, numSubsetKeys> subsetKeys; // indices in dawKeys of the subsets of the tunings
+
+    // the perfect hash of dawKeys: the bucket's displacement is the seed of the slot
+    static const std::array<uint16_t, numHashBuckets> hashDisplacements;
+    static const std::array<uint16_t, numDAWKeys> hashSlots; // index in dawKeys
+
+    // index of key in dawKeys, or -1
+    static int findDAWKey(std::string_view key);
+
+    // seeded FNV-1a with a murmur3 finalizer.  The codegen uses the same hash to build the tables.
+    static constexpr uint32_t hash(std::string_view key, uint32_t seed) {
+        uint32_t h = 2166136261u ^ seed;
+        for(auto c : key) {
+            h ^= static_cast<uint8_t>(c);
+            h *= 16777619u;
+        }
+        h ^= h >> 16;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35u;
+        h ^= h >> 16;
+
+        return h;
+    }
+
+    // for the codegen: a minimal perfect hash of unique keys into num_buckets buckets.  False if there is none.
+    static bool buildPerfectHash(const std::vector<std::string_view>& keys,
+                                 size_t num_buckets,
+                                 std::vector<uint16_t>& displacements,
+                                 std::vector<uint16_t>& slots);
+};
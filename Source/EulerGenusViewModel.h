@@ -24,6 +24,7 @@ struct EulerGenusViewModel
     // The unique key for all tuning/selection states of EulerGenus 6
     // NOTE: dawKey, dawBackKey, and dawDrillKey are the same set.
     DAWKey dawKey; // i.e., "CPS_6_3(A,B,C,D,E,F)__CPS_5_2(A,B,C,D,E)*F"
+    size_t dawKeyIndex = 0; // index in EulerGenusTables::dawKeys
 
     // the daw key for when you hit "back" for this selected state (command-click)
     DAWKey dawBackKey; // i.e., CPS_6_3(A,B,C,D,E,F)__CPS_6_3(A,B,C,D,E,F)
@@ -33,6 +34,7 @@ struct EulerGenusViewModel
 
     // The unique key for the parent CPSTuningBase and its subsets for the page
     TuningKey parentTuningKey; // i.e., "CPS_6_3(A,B,C,D,E,F)"
+    size_t parentTuningIndex = 0; // index in EulerGenusTables::tunings
 
     // parent tuning.  either the parent itself, or one of it's subsets is selected
     shared_ptr<CPSTuningBase> parentTuning;
@@ -464,8 +464,8 @@ void FavoritesComponent::buttonClicked(Button* button) {
     jassertfalse;
 }
 
-shared_ptr<Image> FavoritesComponent::getIcon(int rowNumber) {
-    return _processor.getFavoritesModelV2()->getIcon(rowNumber, FavoritesModelV2::DataList::Favorites);
+shared_ptr<Image> FavoritesComponent::getIcon(int rowNumber, IconService::Completion on_ready) {
+    return _processor.getFavoritesModelV2()->getIcon(rowNumber, FavoritesModelV2::DataList::Favorites, std::move(on_ready));
 }
 
 #pragma mark - key listener
@@ -88,7 +88,7 @@ private:
     int getSelection(const int rowNumber) const;
     void setSelection(const int rowNumber, const int newSelection);
     void buttonClicked(Button*) override;
-    shared_ptr<Image> getIcon(int rowNumber);
+    shared_ptr<Image> getIcon(int rowNumber, IconService::Completion on_ready);
 
     // KeyListener
     bool keyPressed(const KeyPress& key) override;
@@ -191,17 +191,26 @@ private:
         void setRowAndColumn(int newRow, int newColumn) {
             _row = newRow;
             _columnId = newColumn;
-            auto ip = _owner.getIcon(_row);
+            _updateImage();
+        }
+
+    private:
+        // the placeholder until the icon is loaded, then again when it's ready
+        void _updateImage() {
+            auto on_ready = [safe = Component::SafePointer<FavoritesIcon>(this), row = _row]() {
+                if(safe != nullptr && safe->_row == row) {
+                    safe->_updateImage();
+                }
+            };
+            auto ip = _owner.getIcon(_row, on_ready);
             if(ip != nullptr) {
                 auto rs = ip->rescaled(FavoritesIconRenderer::tableviewHeight, FavoritesIconRenderer::tableviewHeight);
                 setImage(rs);
             } else {
-                // TODO: set default image
                 jassertfalse;
             }
         }
 
-    private:
         FavoritesComponent& _owner;
         int _row, _columnId;
     };
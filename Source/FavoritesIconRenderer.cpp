@@ -15,70 +15,57 @@ const String FavoritesIconRenderer::__relativePathToIconDirectory = "icon_cache"
 /**
  * @brief Creates a favorites icon for a given hash code.
  * @param processor The WilsonicProcessor instance.
+ * @param icon_service The IconService.
  * @param hash_code The hash code for the favorite.
  * @param tuning The tuning for the favorite.
  */
-void FavoritesIconRenderer::createFavoritesIconForHashcode(WilsonicProcessor& processor, int hash_code, std::shared_ptr<Tuning> tuning)
+void FavoritesIconRenderer::createFavoritesIconForHashcode(WilsonicProcessor& processor, IconService& icon_service, int hash_code, std::shared_ptr<Tuning> tuning)
 {
-    // if we have a valid icon just return
-    auto const dont_need_icon = __favoritesIconExistsForHashcode(hash_code);
-    if (dont_need_icon)
-    {
-        DBG ("Icon exists for hash code: " + String(hash_code));
-        return;
-    }
-
     // must have a valid tuning
     jassert(tuning != nullptr);
 
-    // create bounds for icon
-    auto const bounds = Rectangle<int> (0, 0, icon_dimension_render, icon_dimension_render);
-
-    // create image
-    Image icon_image(Image::ARGB, icon_dimension_render, icon_dimension_render, true);
-
-    // create graphics context from image
-    Graphics g(icon_image);
-
-    // paint pitch wheel onto graphics context
-    paintFavoritesPitchWheel(processor, g, tuning, bounds);
-
-    // file path
-    auto path = __getFullPathToFavoritesImageForHashcode(hash_code);
-
-    // file output stream
-    FileOutputStream fstream((File(path)));
-
-    //
-    PNGImageFormat png_writer;
-    auto const success = png_writer.writeImageToStream(icon_image, fstream);
-
-    //
-    if(!success)
+    // the tuning and the colours can change before the worker runs, so capture them now.
+    // if the png already exists the worker just loads it
+    auto renderer = [spokes = __getPitchWheelSpokes(processor, tuning)]()
     {
-        DBG("Error writing icon: " + path);
-    }
+        auto const bounds = Rectangle<int>(0, 0, icon_dimension_render, icon_dimension_render);
+        Image icon_image(Image::ARGB, icon_dimension_render, icon_dimension_render, true);
+        Graphics g(icon_image);
+        __paintPitchWheelSpokes(g, spokes, bounds);
+
+        return icon_image;
+    };
+    auto const path = __getFullPathToFavoritesImageForHashcode(hash_code);
+    auto const key = getIconKeyForHashcode(hash_code);
+    icon_service.removeIcon(key); // in case a placeholder was cached before the png existed
+    icon_service.getIcon(key, File(path), renderer, nullptr);
 }
 
 /**
  * @brief Gets the favorites icon image for a given hash code.
+ * @param icon_service The IconService.
  * @param hash_code The hash code for the favorite.
- * @return A shared pointer to the image.
+ * @param on_ready Called on the message thread when the icon is loaded.
+ * @return A shared pointer to the image, or the placeholder.
  */
-shared_ptr<Image> FavoritesIconRenderer::getFavoritesIconImageForHashcode(int hash_code)
+shared_ptr<Image> FavoritesIconRenderer::getFavoritesIconImageForHashcode(IconService& icon_service, int hash_code, IconService::Completion on_ready)
 {
-    // if image exists return it
-    auto const file_name = __getFullPathToFavoritesImageForHashcode(hash_code);
-    auto const image = ImageFileFormat::loadFrom(File(file_name));
-    if (image.isValid())
-    {
-        return make_shared<Image>(std::move(image));
-    }
-    else
+    auto const key = getIconKeyForHashcode(hash_code);
+    auto icon = icon_service.getCachedIcon(key);
+    if (icon != nullptr)
     {
-        DBG ("FavoritesIconRenderer::getFavoritesIconImageForHashcode: no image for hashcode:" + String(hash_code) + ": " + file_name);
-        return nullptr;
+        return icon;
     }
+
+    // load only: the icon was rendered when the favorite was added
+    auto const file_name = __getFullPathToFavoritesImageForHashcode(hash_code);
+
+    return icon_service.getIcon(key, File(file_name), nullptr, std::move(on_ready));
+}
+
+String FavoritesIconRenderer::getIconKeyForHashcode(int hash_code)
+{
+    return "favorites/" + String(hash_code);
 }
 
 /**
@@ -102,19 +89,6 @@ void FavoritesIconRenderer::debugDeleteAllFavoritesIcons()
     }
 }
 
-/**
- * @brief Checks if a favorites icon exists for a given hash code.
- * @param hash_code The hash code for the favorite.
- * @return True if the icon exists, false otherwise.
- */
-bool FavoritesIconRenderer::__favoritesIconExistsForHashcode(int hash_code)
-{
-    auto const file_name = __getFullPathToFavoritesImageForHashcode(hash_code);
-    auto const image = ImageFileFormat::loadFrom(File(file_name));
-
-    return image.isValid();
-}
-
 /**
  * @brief Gets the full path to the favorites icon directory.
  * @return The full path to the directory.
@@ -159,11 +133,30 @@ void FavoritesIconRenderer::paintFavoritesPitchWheel(WilsonicProcessor& processo
         return;
     }
 
+    __paintPitchWheelSpokes(g, __getPitchWheelSpokes(processor, tuning), bounds);
+}
+
+vector<FavoritesIconRenderer::PitchWheelSpoke> FavoritesIconRenderer::__getPitchWheelSpokes(WilsonicProcessor& processor, shared_ptr<Tuning> tuning)
+{
     // copy tuning's processedArray
     auto ma = MicrotoneArray(tuning->getProcessedArrayNPO());
+    vector<PitchWheelSpoke> spokes;
+    spokes.reserve(ma.count());
+    for (unsigned long i = 0; i < ma.count(); i++)
+    {
+        // get colour based on microtone pitch
+        auto const p = ma.microtoneAtIndex(i)->getPitchValue01();
+        spokes.push_back({p, processor.getAppTuningModel()->colorForPitch01(p)});
+    }
 
+    return spokes;
+}
+
+// safe on any thread
+void FavoritesIconRenderer::__paintPitchWheelSpokes(Graphics& g, const vector<PitchWheelSpoke>& spokes, Rectangle<int> bounds)
+{
     // empty tuning is a "null" symbol
-    if (ma.count() == 0)
+    if (spokes.empty())
     {
         g.setColour(Colours::grey);
         g.drawText ("0", bounds, Justification::centred);
@@ -193,12 +186,10 @@ void FavoritesIconRenderer::paintFavoritesPitchWheel(WilsonicProcessor& processo
     };
 
     // LAMBDA for drawing a line from origin to the dot
-    auto draw = [&](auto& mt)
+    auto draw = [&](auto& spoke)
     {
-        // get colour based on microtone pitch
-        auto const p = mt->getPitchValue01();
-        auto const colour = processor.getAppTuningModel()->colorForPitch01(p);
-        g.setColour(colour);
+        auto const p = spoke.pitch01;
+        g.setColour(spoke.colour);
 
         // draw line
         auto const x1 = sx(radius, p);
@@ -213,10 +204,9 @@ void FavoritesIconRenderer::paintFavoritesPitchWheel(WilsonicProcessor& processo
     };
 
     // draw a constant line+dot for each microtone (min line width)
-    for (unsigned long i = 0; i < ma.count(); i++)
+    for (auto const& spoke : spokes)
     {
-        auto const mt = ma.microtoneAtIndex(i);
-        draw(mt);
+        draw(spoke);
     }
 }
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "IconService.h"
 #include "Tuning_Include.h"
 #include "WilsonicProcessor.h"
 
@@ -23,19 +24,30 @@ public:
     static constexpr int tableviewHeight = icon_dimension / 2; /// height of tableviews that use these icons
 
     /**
-     * @brief Creates a favorites icon for a given hash code.
+     * @brief Creates a favorites icon for a given hash code.  The pitch wheel is captured now, and
+     * rendered and written on an IconService worker.
      * @param processor The WilsonicProcessor instance.
+     * @param icon_service The IconService.
      * @param hash_code The hash code.
      * @param tuning The tuning.
      */
-    static void createFavoritesIconForHashcode(WilsonicProcessor& processor, int hash_code, std::shared_ptr<Tuning> tuning);
+    static void createFavoritesIconForHashcode(WilsonicProcessor& processor, IconService& icon_service, int hash_code, std::shared_ptr<Tuning> tuning);
     
     /**
-     * @brief Gets the favorites icon image for a given hash code.
+     * @brief Gets the favorites icon image for a given hash code, without blocking on disk.
+     * @param icon_service The IconService.
      * @param hash_code The hash code.
-     * @return A shared pointer to the image.
+     * @param on_ready Called on the message thread when the icon is loaded (can be nullptr).
+     * @return A shared pointer to the image, or to the placeholder until it is loaded.
      */
-    static shared_ptr<Image> getFavoritesIconImageForHashcode(int hash_code);
+    static shared_ptr<Image> getFavoritesIconImageForHashcode(IconService& icon_service, int hash_code, IconService::Completion on_ready);
+    
+    /**
+     * @brief The IconService key for a given hash code.
+     * @param hash_code The hash code.
+     * @return The key.
+     */
+    static String getIconKeyForHashcode(int hash_code);
     
     /**
      * @brief Deletes all favorites icons (for debugging purposes).
@@ -55,11 +67,29 @@ private:
     static const String __relativePathToIconDirectory; ///< The relative path to the icon directory.
     
     /**
-     * @brief Checks if a favorites icon exists for a given hash code.
-     * @param hash_code The hash code.
-     * @return True if the icon exists, false otherwise.
+     * @struct PitchWheelSpoke
+     * @brief One microtone of the pitch wheel, with its colour resolved.
+     */
+    struct PitchWheelSpoke {
+        float pitch01;
+        Colour colour;
+    };
+    
+    /**
+     * @brief Captures the pitch wheel, so it can be painted on another thread.
+     * @param processor The WilsonicProcessor instance.
+     * @param tuning The tuning.
+     * @return One spoke per microtone.
+     */
+    static vector<PitchWheelSpoke> __getPitchWheelSpokes(WilsonicProcessor& processor, shared_ptr<Tuning> tuning);
+    
+    /**
+     * @brief Paints captured spokes.  An empty tuning is a "0".
+     * @param g The graphics.
+     * @param spokes The spokes.
+     * @param bounds The bounds.
      */
-    static bool __favoritesIconExistsForHashcode(int hash_code);
+    static void __paintPitchWheelSpokes(Graphics& g, const vector<PitchWheelSpoke>& spokes, Rectangle<int> bounds);
 
     /**
      * @brief Gets the full path to the favorites icon directory.
@@ -0,0 +1,165 @@
+/**
+ * @file FavoritesIndex.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the FavoritesIndex class.
+ */
+
+#include "FavoritesIndex.h"
+#include <cstddef>
+#include <unordered_set>
+
+#pragma mark - records
+
+bool FavoritesIndex::add(int ID, int hash, bool morphable) {
+    if(contains(ID)) {
+        return false;
+    }
+    _hashForID[ID] = hash;
+    _countForHash[hash]++;
+    _append(0, ID);
+    if(morphable) {
+        for(int view = 1; view < numViews; view++) {
+            _append(view, ID);
+        }
+    }
+
+    return true;
+}
+
+bool FavoritesIndex::remove(int ID) {
+    auto const it = _hashForID.find(ID);
+    if(it == _hashForID.end()) {
+        return false;
+    }
+    auto const hash = _countForHash.find(it->second);
+    if(--hash->second == 0) {
+        _countForHash.erase(hash);
+    }
+    _hashForID.erase(it);
+    for(int view = 0; view < numViews; view++) {
+        _erase(view, ID);
+    }
+
+    return true;
+}
+
+void FavoritesIndex::clear() {
+    _views = {};
+    _hashForID.clear();
+    _countForHash.clear();
+}
+
+bool FavoritesIndex::contains(int ID) const {
+    return _hashForID.count(ID) > 0;
+}
+
+int FavoritesIndex::size() const {
+    return static_cast<int>(_hashForID.size());
+}
+
+bool FavoritesIndex::containsHash(int hash) const {
+    return _countForHash.count(hash) > 0;
+}
+
+int FavoritesIndex::getNewID(int min_ID, int max_ID) const {
+    for(int ID = min_ID; ID <= max_ID; ID++) {
+        if(!contains(ID)) {
+            return ID;
+        }
+    }
+
+    return notFound;
+}
+
+#pragma mark - views
+
+int FavoritesIndex::getNumRows(int view) const {
+    return static_cast<int>(_views.at(static_cast<size_t>(view)).IDs.size());
+}
+
+int FavoritesIndex::getID(int view, int row) const {
+    auto const& ids = _views.at(static_cast<size_t>(view)).IDs;
+    if(row < 0 || static_cast<size_t>(row) >= ids.size()) {
+        return notFound;
+    }
+
+    return ids[static_cast<size_t>(row)];
+}
+
+int FavoritesIndex::getRow(int view, int ID) const {
+    auto const& rows = _views.at(static_cast<size_t>(view)).rows;
+    auto const it = rows.find(ID);
+
+    return it == rows.end() ? notFound : it->second;
+}
+
+const std::vector<int>& FavoritesIndex::getIDs(int view) const {
+    return _views.at(static_cast<size_t>(view)).IDs;
+}
+
+void FavoritesIndex::setOrder(int view, const std::vector<int>& IDs) {
+    auto& v = _views.at(static_cast<size_t>(view));
+    std::vector<int> ordered;
+    ordered.reserve(v.IDs.size());
+    std::unordered_set<int> listed;
+    for(auto ID : IDs) {
+        if(v.rows.count(ID) > 0 && listed.insert(ID).second) {
+            ordered.push_back(ID);
+        }
+    }
+    for(auto ID : v.IDs) {
+        if(listed.count(ID) == 0) {
+            ordered.push_back(ID);
+        }
+    }
+    v.IDs = std::move(ordered);
+    _reindex(view, 0);
+}
+
+#pragma mark - selection
+
+void FavoritesIndex::setSelectedID(int view, int ID) {
+    _views.at(static_cast<size_t>(view)).selectedID = ID;
+}
+
+int FavoritesIndex::getSelectedID(int view) const {
+    return _views.at(static_cast<size_t>(view)).selectedID;
+}
+
+bool FavoritesIndex::isSelectedRow(int view, int row) const {
+    auto const ID = getID(view, row);
+
+    return ID != notFound && ID == getSelectedID(view);
+}
+
+#pragma mark - private
+
+void FavoritesIndex::_append(int view, int ID) {
+    auto& v = _views.at(static_cast<size_t>(view));
+    v.rows[ID] = static_cast<int>(v.IDs.size());
+    v.IDs.push_back(ID);
+}
+
+void FavoritesIndex::_erase(int view, int ID) {
+    auto& v = _views.at(static_cast<size_t>(view));
+    auto const it = v.rows.find(ID);
+    if(it == v.rows.end()) {
+        return;
+    }
+    auto const row = static_cast<size_t>(it->second);
+    v.rows.erase(it);
+    v.IDs.erase(v.IDs.begin() + static_cast<std::ptrdiff_t>(row));
+    if(v.selectedID == ID) {
+        v.selectedID = notFound;
+    }
+    _reindex(view, row);
+}
+
+// rows after from_row have moved
+void FavoritesIndex::_reindex(int view, size_t from_row) {
+    auto& v = _views.at(static_cast<size_t>(view));
+    for(size_t row = from_row; row < v.IDs.size(); row++) {
+        v.rows[v.IDs[row]] = static_cast<int>(row);
+    }
+}
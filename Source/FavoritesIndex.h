@@ -0,0 +1,83 @@
+/**
+ * @file FavoritesIndex.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the FavoritesIndex class.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class FavoritesIndex
+ * @brief The row views and lookup tables of the Favorites library, keyed by Favorite ID.
+ *
+ * View 0 is every Favorite, in library order.  Views 1 and 2 (Morph A and B) are the Favorites that
+ * can be morphed, each with its own sort order.  Rows are never copied: a view is a vector of IDs.
+ *
+ * ID <-> row, hash -> ID, and selection lookups are O(1), so host automation of the Favorites ID
+ * and the Morph A/B IDs doesn't depend on the size of the library.  add(), remove(), sort() and
+ * setOrder() are O(n) in the size of the views they change.
+ *
+ * Not thread safe: the owner locks.
+ */
+class FavoritesIndex final
+{
+public:
+    static constexpr int numViews = 3; // FavoritesModelV2::DataList
+    static constexpr int notFound = -1;
+
+    // records
+
+    // appends the ID to view 0, and to views 1 and 2 if morphable.  false if the ID exists.
+    bool add(int ID, int hash, bool morphable);
+    bool remove(int ID); // false if not found
+    void clear();
+    bool contains(int ID) const;
+    int size() const;
+    bool containsHash(int hash) const;
+    int getNewID(int min_ID, int max_ID) const; // the first unused ID, or notFound
+
+    // views
+    int getNumRows(int view) const;
+    int getID(int view, int row) const; // notFound if out of range
+    int getRow(int view, int ID) const; // notFound if not in the view
+    const std::vector<int>& getIDs(int view) const;
+
+    // stable sort.  less(ID, ID)
+    template<typename Less>
+    void sort(int view, Less less) {
+        auto& ids = _views.at(static_cast<size_t>(view)).IDs;
+        std::stable_sort(ids.begin(), ids.end(), less);
+        _reindex(view, 0);
+    }
+
+    // reorders a view: the listed IDs first, then any others, in their previous order.
+    // IDs not in the view are ignored.
+    void setOrder(int view, const std::vector<int>& IDs);
+
+    // selection: at most one ID per view
+    void setSelectedID(int view, int ID); // notFound clears
+    int getSelectedID(int view) const;
+    bool isSelectedRow(int view, int row) const;
+
+private:
+    struct View {
+        std::vector<int> IDs {}; // row -> ID
+        std::unordered_map<int, int> rows {}; // ID -> row
+        int selectedID = notFound;
+    };
+    std::array<View, numViews> _views {};
+    std::unordered_map<int, int> _hashForID {};
+    std::unordered_map<int, int> _countForHash {}; // libraries can have legacy duplicates
+
+    void _append(int view, int ID);
+    void _erase(int view, int ID);
+    void _reindex(int view, size_t from_row);
+};
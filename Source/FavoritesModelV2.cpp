@@ -20,6 +20,7 @@
 
 FavoritesModelV2::FavoritesModelV2(WilsonicProcessor& processor)
 : _processor(processor)
+, _store(_getFavoritesLibraryFile(), __morphDesignIndex)
 {
     auto favorites_library = _getFavoritesLibraryFile();
     auto favorites_fullpath = favorites_library.getFullPathName();
@@ -46,14 +47,17 @@ FavoritesModelV2::FavoritesModelV2(WilsonicProcessor& processor)
     //DBG("DEBUG: Reading existing file on disk: " << favorites_fullpath);
 #endif
     
-    // null or empty file...Create and Save
-    if(favorites_library == File() || ! favorites_library.exists()) {
-        // <FAVORITES_DATA>
-        XmlElement favorites_data("FAVORITES_DATA");
+    // null, empty, or invalid file...Create and Save
+    if(favorites_library == File() || ! favorites_library.exists() || ! _store.load()) {
+        if(favorites_library.existsAsFile()) {
+            // must be a valid favorites library: keep a copy of it
+            DBG("FavoritesModelV2: invalid favorites library: " << favorites_fullpath);
+            favorites_library.copyFileTo(favorites_library.getSiblingFile(favorites_library.getFileNameWithoutExtension() + "_invalid.xml"));
+            jassertfalse;
+        }
         
         //   <COLUMNS>
-        XmlElement* columns = new XmlElement("COLUMNS");
-        favorites_data.addChildElement(columns);
+        auto columns = make_unique<XmlElement>("COLUMNS");
         auto add_column = [&](int columnId, String name, int width, int visible, int editable, int sortable) {
             XmlElement* column = new XmlElement("COLUMN");
             column->setAttribute("columnId", columnId);
@@ -76,35 +80,8 @@ FavoritesModelV2::FavoritesModelV2(WilsonicProcessor& processor)
         add_column(7, "Parameter_Hash", 250, 0, 0, 0);
         // add_column(8, "MIDI_Learn", 150);
         
-        //   </DATA>
-        XmlElement* data = new XmlElement("DATA");
-        favorites_data.addChildElement(data);
-        
-        // </FAVORITES_DATA>
-        
-        // assign and save
-        _favoritesLibrary = make_unique<XmlElement>(std::move(favorites_data));
-        jassert(_favoritesLibrary != nullptr);
-        // must be a valid favorites library
-        jassert(_favoritesLibrary != nullptr);
-        _dataList = _favoritesLibrary->getChildByName("DATA");
-        jassert(_dataList != nullptr);
-        _dataListA = _getDataListNonMorph();
-        _dataListB = _getDataListNonMorph();
-        _columnList = _favoritesLibrary->getChildByName("COLUMNS");
-        jassert(_columnList != nullptr);
-        _writeFavoritesToDisk();
-    } else {
-        // just read and validate
-        _favoritesLibrary = XmlDocument::parse(favorites_library);
-        // must be a valid favorites library
-        jassert(_favoritesLibrary != nullptr);
-        _dataList = _favoritesLibrary->getChildByName("DATA");
-        jassert(_dataList != nullptr);
-        _dataListA = _getDataListNonMorph();
-        _dataListB = _getDataListNonMorph();
-        _columnList = _favoritesLibrary->getChildByName("COLUMNS");
-        jassert(_columnList != nullptr);
+        // <FAVORITES_DATA> with the columns and an empty <DATA>
+        _reportWriteResult(_store.create(std::move(columns)));
     }
     
     // visible columns have these flags:
@@ -115,7 +92,7 @@ FavoritesModelV2::FavoritesModelV2(WilsonicProcessor& processor)
     TableHeaderComponent::resizable |
     TableHeaderComponent::appearsOnColumnMenu |
     TableHeaderComponent::sortable;
-    for(auto* columnXml : _columnList->getChildIterator()) {
+    for(auto* columnXml : _store.getColumns()->getChildIterator()) {
         Columns c(columnXml->getStringAttribute("name"),
                   columnXml->getIntAttribute("columnId"),
                   columnXml->getIntAttribute("width"),
@@ -303,15 +280,7 @@ void FavoritesModelV2::uiAddNewFavorite
     // design params have at least one and have mutually exclusive keys
     auto const parametersString = parameters->toString();
     auto const hash_code = parametersString.hashCode(); // int, 32-bit
-    bool dup_favorite = false; {
-        for(auto data : _dataList->getChildIterator()) {
-            auto data_hash = data->getIntAttribute("Parameter_Hash");
-            if(hash_code == data_hash) {
-                dup_favorite = true;
-                break;
-            }
-        }
-    }
+    auto const dup_favorite = _store.getIndex().containsHash(hash_code);
     
     // duplicate tuning...NOP
     if(dup_favorite) {
@@ -338,20 +307,21 @@ void FavoritesModelV2::uiAddNewFavorite
     }
     
     // new Favorite
-    auto new_favorite = new XmlElement("FAVORITE");
-    new_favorite->setAttribute("ID", ID);
-    FavoritesIconRenderer::createFavoritesIconForHashcode(_processor, hash_code, tuning);
-    auto const icon_url = "dont need data for this column";
-    new_favorite->setAttribute("Icon", icon_url); // we actually don't need to store data for the icon column
-    new_favorite->setAttribute("Design_Index", static_cast<int>(design_index));
-    new_favorite->setAttribute("Design", design_description);
-    new_favorite->setAttribute("NPO", static_cast<int>(npo));
-    new_favorite->setAttribute("Description", tuning_description + "\n\n" + design_description + "\n\n" + param_description);
-    new_favorite->setAttribute("Parameters", tuning_param_description + "\n\n" + param_description);
-    new_favorite->setAttribute("Parameter_Hash", hash_code);
-    new_favorite->addChildElement(parameters);
-    _dataList->addChildElement(new_favorite);
-    _writeFavoritesToDisk();
+    FavoritesRecord new_favorite;
+    new_favorite.ID = ID;
+    FavoritesIconRenderer::createFavoritesIconForHashcode(_processor, *_iconService, hash_code, tuning);
+    new_favorite.designIndex = static_cast<int>(design_index);
+    new_favorite.design = design_description;
+    new_favorite.NPO = static_cast<int>(npo);
+    new_favorite.description = tuning_description + "\n\n" + design_description + "\n\n" + param_description;
+    new_favorite.parameters = tuning_param_description + "\n\n" + param_description;
+    new_favorite.parameterHash = hash_code;
+    for(auto parameter : parameters->getChildIterator()) {
+        auto const key = parameter->getAttributeName(0);
+        new_favorite.parameterValues.emplace_back(key, parameter->getDoubleAttribute(key));
+    }
+    delete parameters;
+    _reportWriteResult(_store.put(std::move(new_favorite)));
     uiSetFavoriteID(ID, "Created new Favorite ID: " + String(_favoriteID) + " at row: " + String(_favoriteRowNumber));
 }
 
@@ -378,7 +348,7 @@ void FavoritesModelV2::_uiRecallFavoriteInternal(int favorite_index) {
     
     //
     const ScopedLock sl(_lock);
-    auto const child = _dataList->getChildElement(favorite_index);
+    auto const child = _store.getRecordAtRow(static_cast<int>(DataList::Favorites), favorite_index);
     if(child == nullptr) {
         DBG("FavoritesModelV2::recallFavorite: favorite_index not found: " + String(favorite_index));
         _status_message = "Can't find Favorite at index: " + String(favorite_index);
@@ -387,16 +357,10 @@ void FavoritesModelV2::_uiRecallFavoriteInternal(int favorite_index) {
     }
     
     // grab attributes
-    auto const ID = child->getIntAttribute("ID");
-    auto const design_index = child->getIntAttribute("Design_Index");
-    auto const parameters = child->getChildByName("Parameters");
-    if(parameters == nullptr) {
-        DBG("FavoritesModelV2::recallFavorite: parameters are null for favorite_index: " + String(favorite_index) + ", ID: " + String(ID));
-        _status_message = "Internal Error: No params for Favorite at index: " + String(favorite_index);
-        FavoritesComponentMessageBus::getInstance().broadcastMessage(_status_message);
-        return;
-    }
-    if (parameters->getNumChildElements() == 0) {
+    auto const ID = child->ID;
+    auto const design_index = child->designIndex;
+    auto const& parameters = child->parameterValues;
+    if (parameters.empty()) {
         DBG("FavoritesModelV2::recallFavorite: parameters are empty for favorite_index: " + String(favorite_index) + ", ID: " + String(ID));
         _status_message = "Internal Error: No params for Favorite at index: " + String(favorite_index);
         FavoritesComponentMessageBus::getInstance().broadcastMessage(_status_message);
@@ -404,13 +368,10 @@ void FavoritesModelV2::_uiRecallFavoriteInternal(int favorite_index) {
     }
     
     // iterate through parameters.
-    // "PARAMETER" has only 1 attribute/value
-    for(auto parameter : parameters->getChildIterator()) {
-        auto const key = parameter->getAttributeName(0);
-        jassert(key != String()); // empty string
+    for(auto const& [key, parameter_value] : parameters) {
         auto param = _apvts->getParameter(key);
         auto range = _apvts->getParameterRange(key);
-        auto const value = static_cast<float>(parameter->getDoubleAttribute(key));
+        auto const value = static_cast<float>(parameter_value);
         auto const value01 = range.convertTo0to1(value);
         param->setValueNotifyingHost(value01);
     }
@@ -432,22 +393,21 @@ void FavoritesModelV2::uiDeleteFavoriteAtRowNumber(int favorite_index) {
     }
     
     const ScopedLock sl(_lock);
-    auto const child = _dataList->getChildElement(favorite_index);
+    auto const child = _store.getRecordAtRow(static_cast<int>(DataList::Favorites), favorite_index);
     if(child == nullptr) {
         DBG("FavoritesModelV2::deleteFavoriteAtRow: row not found:" + String(favorite_index));
         _status_message = "Cannot delete Favorite at row: " + String(favorite_index) + " because it cannot be found";
         FavoritesComponentMessageBus::getInstance().broadcastMessage(_status_message);
     } else {
-        auto const ID = child->getIntAttribute("ID");
-        auto const design_index = child->getIntAttribute("Design_Index");
-        auto const isFavoritesDesignMorph = (design_index == _processor.getMorphModel()->ModelBase::getDesignIndex());
-        _dataList->removeChildElement(child, true);
+        auto const ID = child->ID;
+        auto const design_index = child->designIndex;
+        auto const isFavoritesDesignMorph = (design_index == DesignsModel::morphDesignIndex);
         
         // TODO:
         // how do you safely delete a Favorites icon?
         // it could be referred to by Morph favorites
         
-        _writeFavoritesToDisk();
+        _reportWriteResult(_store.remove(ID)); // child is invalid after this
         
         // Deleting a morph favorite doesn't result in a stranded favorite
         if(!isFavoritesDesignMorph) {
@@ -554,38 +514,25 @@ Favorite FavoritesModelV2::_getFavoriteForID(int ID) {
     jassert(ID <= FavoritesModelV2::getFavoritesMaxID());
     
     const ScopedLock sl(_lock);
-    for(auto data : _dataList->getChildIterator()) {
+    if(auto const data = _store.getRecord(ID)) {
         // create a Favorite object
-        auto childID = data->getIntAttribute("ID");
-        if(childID == ID) {
-            auto data_hash = data->getIntAttribute("Parameter_Hash");
-            auto iconImageURL = FavoritesIconRenderer::getFavoritesIconImageForHashcode(data_hash);
-            jassert(iconImageURL != nullptr);
-            auto designIndex = data->getIntAttribute("Design_Index");
-            auto designDescription = data->getStringAttribute("Description");
-            auto NPO = data->getIntAttribute("NPO");
-            auto tuningDescription = data->getStringAttribute("Description");
-            auto const parameters = data->getChildByName("Parameters");
-            if(parameters == nullptr) {
-                DBG("FavoritesModelV2::getFavoriteForID: parameters are null for ID: " + String(ID));
-                _status_message = "INTERNAL ERROR: parameters null for Favorite ID: " + String(ID);
-                FavoritesComponentMessageBus::getInstance().broadcastMessage(_status_message);
-                jassertfalse;
-                return Favorite();
-            }
-            // iterate through parameters.
-            vector<FavoriteParam01> params;
-            for(auto parameter : parameters->getChildIterator()) {
-                auto const key = parameter->getAttributeName(0);
-                jassert(key != String()); // empty string
-                auto const value = static_cast<float>(parameter->getDoubleAttribute(key));
-                auto f01 = FavoriteParam01(key, value);
-                params.push_back(f01);
-            }
-            // the Favorite representation
-            auto f = Favorite(ID, iconImageURL, designIndex, designDescription, NPO, tuningDescription, params);
-            return f;
+        auto iconImageURL = _iconService->getCachedIcon(FavoritesIconRenderer::getIconKeyForHashcode(data->parameterHash)); // nullptr if not loaded yet
+        if(data->parameterValues.empty()) {
+            DBG("FavoritesModelV2::getFavoriteForID: parameters are null for ID: " + String(ID));
+            _status_message = "INTERNAL ERROR: parameters null for Favorite ID: " + String(ID);
+            FavoritesComponentMessageBus::getInstance().broadcastMessage(_status_message);
+            jassertfalse;
+            return Favorite();
         }
+        // iterate through parameters.
+        vector<FavoriteParam01> params;
+        params.reserve(data->parameterValues.size());
+        for(auto const& [key, value] : data->parameterValues) {
+            params.push_back(FavoriteParam01(key, static_cast<float>(value)));
+        }
+        // the Favorite representation
+        auto f = Favorite(ID, iconImageURL, data->designIndex, data->description, data->NPO, data->description, params);
+        return f;
     }
     
     // TODO: Make this return preset 12ET
@@ -604,27 +551,12 @@ int FavoritesModelV2::_IDForRowNumber(int rowNumber, DataList dataList) {
     }
     
     const ScopedLock sl(_lock);
-    XmlElement* child = nullptr;
-    switch(dataList) {
-        case DataList::Favorites:
-            child = _dataList->getChildElement(rowNumber);
-            break;
-        case DataList::FavoritesA:
-            child = _dataListA->getChildElement(rowNumber);
-            break;
-        case DataList::FavoritesB:
-            child = _dataListB->getChildElement(rowNumber);
-            break;
-        default:
-            jassertfalse;
-    }
-    
-    if(child == nullptr) {
+    auto const ID = _store.getIndex().getID(static_cast<int>(dataList), rowNumber);
+    if(ID == FavoritesIndex::notFound) {
         DBG("FavoritesModelV2::IDForRowNumber: rowNumber not found: " + String(rowNumber));
         jassertfalse;
         return -1;
     } else {
-        auto const ID = child->getIntAttribute("ID");
         jassert(ID >= FavoritesModelV2::getFavoritesMinID());
         jassert(ID <= FavoritesModelV2::getFavoritesMaxID());
         return ID;
@@ -645,44 +577,8 @@ int FavoritesModelV2::_rowNumberForID(int ID, DataList dataList) {
     // lock
     const ScopedLock sl(_lock);
     
-    int row = 0;
-    switch(dataList) {
-        case DataList::Favorites:
-            for(auto data : _dataList->getChildIterator()) {
-                // create a Favorite object
-                auto childID = data->getIntAttribute("ID");
-                if(childID == ID) {
-                    return row;
-                }
-                row++;
-            }
-            break;
-        case DataList::FavoritesA:
-            for(auto data : _dataListA->getChildIterator()) {
-                // create a Favorite object
-                auto childID = data->getIntAttribute("ID");
-                if(childID == ID) {
-                    return row;
-                }
-                row++;
-            }
-            break;
-        case DataList::FavoritesB:
-            for(auto data : _dataListB->getChildIterator()) {
-                // create a Favorite object
-                auto childID = data->getIntAttribute("ID");
-                if(childID == ID) {
-                    return row;
-                }
-                row++;
-            }
-            break;
-        default:
-            jassertfalse;
-    }
-    
     // TODO: if ID is not found is it fatal?
-    return -1;
+    return _store.getIndex().getRow(static_cast<int>(dataList), ID); // -1 if not found
 }
 
 #pragma mark - _getFavoritesLibraryFile
@@ -693,23 +589,10 @@ File FavoritesModelV2::_getFavoritesLibraryFile() {
     return favorites_library;
 }
 
-#pragma mark - _writeFavoritesToDisk
+#pragma mark - _reportWriteResult
 
-bool FavoritesModelV2::_writeFavoritesToDisk() {
-    const ScopedLock sl(_lock);
-    
-    // keep _dataListA/B in sync (before saving)
-    jassert(_dataList != nullptr);
-    _dataListA = _getDataListNonMorph();
-    _dataListB = _getDataListNonMorph();
-    
-    // must be a valid favorites library
-    jassert(_favoritesLibrary != nullptr);
-    auto fl = _favoritesLibrary->toString();
-    
-    // TODO: replace this with writeTo
-    auto file = _getFavoritesLibraryFile();
-    auto success = file.replaceWithText(fl);
+// the store journals every change, and compacts the library file in the background
+bool FavoritesModelV2::_reportWriteResult(bool success) {
     if(!success) {
         FavoritesComponentMessageBus::getInstance().broadcastMessage("FATAL ERROR: Can NOT write Favorites file to disk");
     }
@@ -726,7 +609,7 @@ void FavoritesModelV2::_logXML() {
     const ScopedLock sl(_lock);
     
     // default
-    auto root_as_xml = _favoritesLibrary->toString();
+    auto root_as_xml = _store.createXml()->toString();
     DBG("DEBUG: favorites library as xml string:");
     DBG(root_as_xml);
     DBG("");
@@ -735,10 +618,10 @@ void FavoritesModelV2::_logXML() {
 #pragma mark - _getAttributeNameForColumnId
 
 String FavoritesModelV2::_getAttributeNameForColumnId(const int columnId) const {
-    const ScopedLock sl(_lock);
-    for(auto* columnXml : _columnList->getChildIterator()) {
-        if(columnXml->getIntAttribute("columnId") == columnId) {
-            return columnXml->getStringAttribute("name");
+    // _columns doesn't mutate, so no lock
+    for(auto const& c : _columns) {
+        if(c.columnId == columnId) {
+            return c.columnName;
         }
     }
     return {};
@@ -765,22 +648,7 @@ void FavoritesModelV2::actionListenerCallback(const String& message) {
 
 int FavoritesModelV2::getNumRows(DataList dataList) {
     const ScopedLock sl(_lock);
-    // get num rows
-    switch(dataList) {
-        case DataList::Favorites:
-            return _dataList->getNumChildElements();
-            break;
-        case DataList::FavoritesA:
-            return _dataListA->getNumChildElements();
-            break;
-        case DataList::FavoritesB:
-            return _dataListB->getNumChildElements();            
-            break;
-        default:
-            jassertfalse;
-    }
-    jassertfalse;
-    return -1;
+    return _store.getIndex().getNumRows(static_cast<int>(dataList));
 }
 
 int FavoritesModelV2::getColumnAutoSizeWidth(int columnId) {
@@ -790,8 +658,8 @@ int FavoritesModelV2::getColumnAutoSizeWidth(int columnId) {
         if(i == 2) {
             // icon
             return widest;
-        } else if(auto* rowElement = _dataList->getChildElement(i)) {
-            auto text = rowElement->getStringAttribute(_getAttributeNameForColumnId(columnId));
+        } else if(auto* rowElement = _store.getRecordAtRow(static_cast<int>(DataList::Favorites), i)) {
+            auto text = rowElement->getAttribute(_getAttributeNameForColumnId(columnId));
             widest = jmax(widest, _font.getStringWidth(text));
         }
     }
@@ -817,20 +685,7 @@ void FavoritesModelV2::sortOrderChanged(int newSortColumnId, bool isForwards, Da
     const ScopedLock sl(_lock);
     // sort
     // TODO: save newSortColumnId for each DataList type
-    FavoritesDataSorter sorter(_getAttributeNameForColumnId(newSortColumnId), isForwards);
-    switch(dataList) {
-        case DataList::Favorites:
-            _dataList->sortChildElements(sorter);
-            break;
-        case DataList::FavoritesA:
-            _dataListA->sortChildElements(sorter);
-            break;
-        case DataList::FavoritesB:
-            _dataListB->sortChildElements(sorter);
-            break;
-        default:
-            jassertfalse;
-    }
+    _store.sort(static_cast<int>(dataList), _getAttributeNameForColumnId(newSortColumnId), isForwards);
 }
 
 # pragma mark - private helpers
@@ -847,16 +702,12 @@ bool FavoritesModelV2::_deleteFavoriteID(int favoritesID) {
     jassert(favoritesID <= FavoritesModelV2::getFavoritesMaxID());
     
     const ScopedLock sl(_lock);
-    for(auto data : _dataList->getChildIterator()) {
-        auto const ID = data->getIntAttribute("ID");
-        if(ID == favoritesID) {
-            DBG("FavoritesModelV2::_deleteFavoriteID: deleting favoritesID:" + String(favoritesID));
-            _dataList->removeChildElement(data, true);
-            _writeFavoritesToDisk();
-            _favoriteRowNumber = -1;
-            _favoriteID = -1;
-            return true;
-        }
+    if(_store.getRecord(favoritesID) != nullptr) {
+        DBG("FavoritesModelV2::_deleteFavoriteID: deleting favoritesID:" + String(favoritesID));
+        _reportWriteResult(_store.remove(favoritesID));
+        _favoriteRowNumber = -1;
+        _favoriteID = -1;
+        return true;
     }
     DBG("FavoritesModelV2::_deleteFavoriteID: favoriteID not found:" + String(favoritesID));
     return false;
@@ -871,15 +722,14 @@ bool FavoritesModelV2::_performUserScalaIntegrityCheck() {
     
     // Collect all Favorite IDs that refer to a missing User Scala File ID
     vector<int> invalid_IDs;
-    for(auto data : _dataList->getChildIterator()) {
-        auto const favorite_ID = data->getIntAttribute("ID");
+    for(auto const favorite_ID : _store.getIndex().getIDs(static_cast<int>(DataList::Favorites))) {
+        auto const data = _store.getRecord(favorite_ID);
         
         // Is this a Scala Favorite?
-        auto const design_index = data->getIntAttribute("Design_Index");
-        if(design_index == _processor.getScalaModel()->getDesignIndex()) {
+        auto const design_index = data->designIndex;
+        if(design_index == DesignsModel::scalaDesignIndex) {
             // if so get it's parameters
-            auto const parameters = data->getChildByName("Parameters");
-            if(parameters == nullptr) {
+            if(data->parameterValues.empty()) {
                 jassertfalse;
                 continue;
             }
@@ -887,10 +737,8 @@ bool FavoritesModelV2::_performUserScalaIntegrityCheck() {
             // iterate through parameters for user scala file id
             bool isFavoriteUserScala = false;
             int favoriteUserScalaID = -1;
-            for(auto parameter : parameters->getChildIterator()) {
-                auto const parameterKey = parameter->getAttributeName(0);
-                jassert(parameterKey != String()); // empty string
-                auto const parameterValue = parameter->getIntAttribute(parameterKey);
+            for(auto const& [parameterKey, value] : data->parameterValues) {
+                auto const parameterValue = static_cast<int>(value);
                 if(parameterKey == ScalaModel::getScalaLibraryParameterID().getParamID()) {
                     if(parameterValue == ScalaModel::Library::User) {
                         isFavoriteUserScala = true;
@@ -932,15 +780,14 @@ bool FavoritesModelV2::_performFavoritesIntegrityCheck() {
     
     // Collect Morph Favorite ID's that refer to a missing A ID, or B ID (i.e., referring to the Favorite that referred to a deleted Scala file)
     unordered_map<int, int> ids;
-    for(auto data : _dataList->getChildIterator()) {
-        auto const ID = data->getIntAttribute("ID");
+    for(auto const ID : _store.getIndex().getIDs(static_cast<int>(DataList::Favorites))) {
+        auto const data = _store.getRecord(ID);
         
         // Is this a Morph Favorite?
-        auto const design_index = data->getIntAttribute("Design_Index");
-        if(design_index == _processor.getMorphModel()->getDesignIndex()) {
+        auto const design_index = data->designIndex;
+        if(design_index == DesignsModel::morphDesignIndex) {
             // if so get it's parameters
-            auto const parameters = data->getChildByName("Parameters");
-            if(parameters == nullptr) {
+            if(data->parameterValues.empty()) {
                 jassertfalse;
                 continue;
             }
@@ -948,10 +795,8 @@ bool FavoritesModelV2::_performFavoritesIntegrityCheck() {
             // iterate through parameters for both A and B IDs
             int has_A_ID = -1;
             int has_B_ID = -1;
-            for(auto parameter : parameters->getChildIterator()) {
-                auto const key = parameter->getAttributeName(0);
-                jassert(key != String()); // empty string
-                auto const param = parameter->getIntAttribute(key);
+            for(auto const& [key, value] : data->parameterValues) {
+                auto const param = static_cast<int>(value);
                 if(key == MorphModel::getMorphFavoriteAParameterID().getParamID()) {
                     has_A_ID = param;
                 } else if(key == MorphModel::getMorphFavoriteBParameterID().getParamID()) {
@@ -998,29 +843,7 @@ bool FavoritesModelV2::_performFavoritesIntegrityCheck() {
 // return the first available id
 int FavoritesModelV2::_getNewID() {
     const ScopedLock sl(_lock);
-    
-    // Collect all IDs into a vector
-    vector<int> ids;
-    for(auto data : _dataList->getChildIterator()) {
-        ids.push_back(data->getIntAttribute("ID"));
-    }
-    
-    // Sort the vector of IDs
-    sort(ids.begin(), ids.end());
-    
-    // Find the first available ID
-    int newID = getFavoritesMinID();
-    for(int id : ids) {
-        if(id == newID) {
-            newID++;
-        } else if(id > newID) {
-            break; // Found a gap
-        }
-    }
-    if(newID > getFavoritesMaxID()) {
-        return -1; // Or handle the error as appropriate
-    }
-    return newID;
+    return _store.getIndex().getNewID(getFavoritesMinID(), getFavoritesMaxID()); // -1 if full
 }
 
 Font FavoritesModelV2::getFont() {
@@ -1029,27 +852,8 @@ Font FavoritesModelV2::getFont() {
 
 String FavoritesModelV2::getText(int rowNumber, int columnId, DataList dataList) {
     const ScopedLock sl(_lock);
-    switch(dataList) {
-        case DataList::Favorites:
-            if(auto* rowElement = _dataList->getChildElement(rowNumber)) {
-                auto text = rowElement->getStringAttribute(_getAttributeNameForColumnId(columnId));
-                return text;
-            }
-            break;
-        case DataList::FavoritesA:
-            if(auto* rowElementA = _dataListA->getChildElement(rowNumber)) {
-                auto text = rowElementA->getStringAttribute(_getAttributeNameForColumnId(columnId));
-                return text;
-            }
-            break;
-        case DataList::FavoritesB:
-            if(auto* rowElementB = _dataListB->getChildElement(rowNumber)) {
-                auto text = rowElementB->getStringAttribute(_getAttributeNameForColumnId(columnId));
-                return text;
-            }
-            break;
-        default:
-            jassertfalse;
+    if(auto const rowElement = _store.getRecordAtRow(static_cast<int>(dataList), rowNumber)) {
+        return rowElement->getAttribute(_getAttributeNameForColumnId(columnId));
     }
     
     return {};
@@ -1059,72 +863,45 @@ void FavoritesModelV2::setText(String columnName, const int rowNumber, const Str
     const ScopedLock sl(_lock);
     
     // set text
-    _dataList->getChildElement(rowNumber)->setAttribute(columnName, newText);
+    auto const rowElement = _store.getRecordAtRow(static_cast<int>(DataList::Favorites), rowNumber);
+    if(rowElement == nullptr) {
+        jassertfalse;
+        return;
+    }
+    auto record = *rowElement;
+    if(columnName == "Description") {
+        record.description = newText;
+    } else {
+        // only Description is editable
+        jassertfalse;
+        return;
+    }
     
     // store on disk
-    _writeFavoritesToDisk();
+    _reportWriteResult(_store.put(std::move(record)));
 }
 
 int FavoritesModelV2::getSelection(const int rowNumber, DataList dataList) const {
     const ScopedLock sl(_lock);
     
     // get selection
-    switch(dataList) {
-        case DataList::Favorites:
-            return _dataList->getChildElement(rowNumber)->getIntAttribute("Select");
-            break;
-        case DataList::FavoritesA:
-            return _dataListA->getChildElement(rowNumber)->getIntAttribute("Select");
-            break;
-        case DataList::FavoritesB:
-            return _dataListB->getChildElement(rowNumber)->getIntAttribute("Select");
-            break;
-        default:
-            jassertfalse;
-    }
-    jassertfalse;
-    return -1;
+    return _store.getIndex().isSelectedRow(static_cast<int>(dataList), rowNumber) ? 1 : 0;
 }
 
 void FavoritesModelV2::setSelection(const int rowNumber, const int newSelection, DataList dataList) {
     const ScopedLock sl(_lock);
     
-    // set selection
-    switch(dataList) {
-        case DataList::Favorites:
-            // clear all selections
-            for(auto data : _dataList->getChildIterator()) {
-                data->setAttribute("Select", 0);
-            }
-            
-            // select
-            _dataList->getChildElement(rowNumber)->setAttribute("Select", newSelection);
-            break;
-        case DataList::FavoritesA:
-            // clear all selections
-            for(auto data : _dataListA->getChildIterator()) {
-                data->setAttribute("Select", 0);
-            }
-            
-            // select
-            _dataListA->getChildElement(rowNumber)->setAttribute("Select", newSelection);
-            break;
-        case DataList::FavoritesB:
-            // clear all selections
-            for(auto data : _dataListB->getChildIterator()) {
-                data->setAttribute("Select", 0);
-            }
-            
-            // select
-            _dataListB->getChildElement(rowNumber)->setAttribute("Select", newSelection);
-            break;
-        default:
-            jassertfalse;
+    // set selection: one row per list, so there's nothing to clear
+    auto const view = static_cast<int>(dataList);
+    auto const ID = _store.getIndex().getID(view, rowNumber);
+    if(newSelection != 0) {
+        _store.setSelectedID(view, ID);
+    } else if(_store.getIndex().getSelectedID(view) == ID) {
+        _store.setSelectedID(view, FavoritesIndex::notFound);
     }
 }
 
 int FavoritesModelV2::getFavoriteRowNumber(DataList dataList) {
-    auto const mm = _processor.getMorphModel();
     switch(dataList) {
         case DataList::Favorites: {
             return _favoriteRowNumber;
@@ -1132,14 +909,14 @@ int FavoritesModelV2::getFavoriteRowNumber(DataList dataList) {
         }
         case DataList::FavoritesA:
         {
-            auto const IDa = mm->uiGetID_A();
+            auto const IDa = _processor.getMorphModel()->uiGetID_A();
             auto const rowNumber = _rowNumberForID(IDa, DataList::FavoritesA);
             return rowNumber;
             break;
         }
         case DataList::FavoritesB:
         {
-            auto const IDb = mm->uiGetID_B();
+            auto const IDb = _processor.getMorphModel()->uiGetID_B();
             auto const rowNumber = _rowNumberForID(IDb, DataList::FavoritesB);
             return rowNumber;
             break;
@@ -1153,57 +930,29 @@ vector<Columns> FavoritesModelV2::getColumns() {
     return _columns;
 }
 
-shared_ptr<Image> FavoritesModelV2::getIcon(int rowNumber, DataList dataList) {
+shared_ptr<Image> FavoritesModelV2::getIcon(int rowNumber, DataList dataList, IconService::Completion on_ready) {
     const ScopedLock sl(_lock);
-    int hash_code = 0;
     
     // get hash
-    switch(dataList) {
-        case DataList::Favorites:
-            hash_code = _dataList->getChildElement(rowNumber)->getIntAttribute("Parameter_Hash");
-            break;
-        case DataList::FavoritesA:
-            hash_code = _dataListA->getChildElement(rowNumber)->getIntAttribute("Parameter_Hash");
-            break;
-        case DataList::FavoritesB:
-            hash_code = _dataListB->getChildElement(rowNumber)->getIntAttribute("Parameter_Hash");
-            break;
-        default:
-            jassertfalse;
+    auto const rowElement = _store.getRecordAtRow(static_cast<int>(dataList), rowNumber);
+    if(rowElement == nullptr) {
+        jassertfalse;
+        return _iconService->getPlaceholderIcon();
     }
+    auto const hash_code = rowElement->parameterHash;
     
-    // get ptr to Image
-    auto img_ptr = FavoritesIconRenderer::getFavoritesIconImageForHashcode(hash_code);
+    // get ptr to Image, or the placeholder until it's loaded
+    auto img_ptr = FavoritesIconRenderer::getFavoritesIconImageForHashcode(*_iconService, hash_code, std::move(on_ready));
     
-    // TODO: return a default icon? YES
     return img_ptr;
 }
 
-unique_ptr<XmlElement> FavoritesModelV2::_getDataListNonMorph() {
-    const ScopedLock sl(_lock);
-    
-    if (_dataList == nullptr) {
-        return nullptr;
-    }
-    
-    auto nonMorphChildren = make_unique<XmlElement>(_dataList->getTagName());
-    for(auto* child : _dataList->getChildIterator()) {
-        if(child->getIntAttribute("Design_Index") != 11) {
-            // Deep copy the child and add it to the filtered root
-            nonMorphChildren->addChildElement(new XmlElement(*child));
-        }
-    }
-    return nonMorphChildren;
-}
-
 unordered_map<int, int> FavoritesModelV2::_getNonMorphIntegrityCheck() {
     const ScopedLock sl(_lock);
         
     // assert on duplicates
     unordered_map<int, int> integrity {};
-    auto dataList = _getDataListNonMorph();
-    for(auto data : dataList->getChildIterator()) {
-        auto const ID = data->getIntAttribute("ID");
+    for(auto const ID : _store.getIndex().getIDs(static_cast<int>(DataList::FavoritesA))) {
         jassert(ID >= FavoritesModelV2::getFavoritesMinID());
         jassert(ID <= FavoritesModelV2::getFavoritesMaxID());
         auto it = integrity.find(ID);
@@ -10,6 +10,8 @@
 #include <JuceHeader.h>
 #include "Columns.h"
 #include "Favorite.h"
+#include "FavoritesStore.h"
+#include "IconService.h"
 #include "ModelBase.h"
 #include "Tuning_Include.h"
 #include "Tuning.h"
@@ -58,10 +60,10 @@ public:
 
     // ModelBase
     shared_ptr<Tuning> getTuning() override;
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    unique_ptr<AudioProcessorParameterGroup> createParams();
+    String getGroupID();
+    String getGroupName();
+    String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // key for this design's Favorites array
     StringArray getFavoritesParameterIDs() override; // used for Favorites
     void attachParameterListeners() override;// called only once: when assigning _avpts
@@ -109,34 +111,31 @@ public:
     void setText(String columnName, const int rowNumber, const String& newText); // not for A,B
     int getSelection(const int rowNumber, DataList dataList) const;
     void setSelection(const int rowNumber, const int newSelection, DataList dataList);
-    shared_ptr<Image> getIcon(int rowNumber, DataList dataList);
+    shared_ptr<Image> getIcon(int rowNumber, DataList dataList, IconService::Completion on_ready); // placeholder until on_ready
 
 private:
     // private members
     WilsonicProcessor& _processor;
     vector<Columns> _columns; // init at construction and never mutated
-    unique_ptr<XmlElement> _favoritesLibrary; // OWNER
-    XmlElement* _columnList = nullptr;
-    XmlElement* _dataList = nullptr; // unfiltered
-    unique_ptr<XmlElement> _dataListA = nullptr; // filtered out Morph
-    unique_ptr<XmlElement> _dataListB = nullptr; // filtered out Morph
+    static constexpr int __morphDesignIndex = 11; // Morph favorites are filtered out of A, B
+    FavoritesStore _store; // the library: records by ID, row views for each DataList
     Font _font {14.0f};
     int _favoriteRowNumber = 0; // source of truth for favoritesA,B are based on ID's from MorphModel
     int _favoriteID = -1; // set by model, throttled by updateUI
     int _favoriteIDHost = -1; // set by host in parameterChanged
     String _status_message = "";
+    SharedResourcePointer<IconService> _iconService;
 
     // private methods
     void _uiRecallFavoriteInternal(int favorite_row_number); // this actually recalls the favorite
     bool _deleteFavoriteID(int favoriteID); // returns success
     bool _performUserScalaIntegrityCheck();
     bool _performFavoritesIntegrityCheck();
-    bool _writeFavoritesToDisk();
-    File _getFavoritesLibraryFile();
+    bool _reportWriteResult(bool success);
+    static File _getFavoritesLibraryFile();
     void _logXML();
     String _getAttributeNameForColumnId(const int columnId) const;
     int _getNewID();
-    unique_ptr<XmlElement> _getDataListNonMorph();
     unordered_map<int, int> _getNonMorphIntegrityCheck();
 
     // friend helpers
@@ -147,26 +146,4 @@ private:
     friend class MorphABModel;
     friend class MorphFavoritesAComponent;
     friend class MorphFavoritesBComponent;
-    
-    // private helper class
-    class FavoritesDataSorter {
-    public:
-        FavoritesDataSorter(const String& attributeToSortBy, bool forwards)
-        : _attributeToSort(attributeToSortBy)
-        , _direction(forwards ? 1 : -1)
-        {}
-        int compareElements(XmlElement* first, XmlElement* second) const {
-            auto result = first->getStringAttribute(_attributeToSort)
-                .compareNatural(second->getStringAttribute(_attributeToSort));
-            if(result == 0) {
-                result = first->getStringAttribute("ID")
-                    .compareNatural(second->getStringAttribute("ID"));
-            }
-            return _direction * result;
-        }
-
-    private:
-        String _attributeToSort;
-        int _direction;
-    };
 };
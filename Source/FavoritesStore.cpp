@@ -0,0 +1,393 @@
+/**
+ * @file FavoritesStore.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the FavoritesRecord struct and the FavoritesStore class.
+ */
+
+#include "FavoritesStore.h"
+
+namespace
+{
+    // we actually don't need to store data for the icon column
+    const String __iconText = "dont need data for this column";
+
+    unique_ptr<XmlElement> __createLibraryXml(const XmlElement& columns, const vector<FavoritesRecord>& records) {
+        auto library = make_unique<XmlElement>("FAVORITES_DATA");
+        library->addChildElement(new XmlElement(columns));
+        auto data = new XmlElement("DATA");
+        for(auto const& record : records) {
+            data->addChildElement(record.createXml().release());
+        }
+        library->addChildElement(data);
+
+        return library;
+    }
+
+    // InterProcessLock does not exclude the stores of this process, i.e., instances in one host
+    CriticalSection& __processLock() {
+        static CriticalSection lock;
+
+        return lock;
+    }
+
+    // every store of this library, in any process
+    class __LibraryLock final
+    {
+    public:
+        explicit __LibraryLock(InterProcessLock& file_lock)
+        : _processLock(__processLock())
+        , _fileLock(file_lock)
+        {
+
+        }
+        bool isLocked() const { return _fileLock.isLocked(); }
+
+    private:
+        const ScopedLock _processLock;
+        InterProcessLock::ScopedLockType _fileLock;
+    };
+}
+
+#pragma mark - FavoritesRecord
+
+String FavoritesRecord::getAttribute(const String& attribute_name) const {
+    if(attribute_name == "ID") return String(ID);
+    if(attribute_name == "Icon") return __iconText;
+    if(attribute_name == "Design_Index") return String(designIndex);
+    if(attribute_name == "Design") return design;
+    if(attribute_name == "NPO") return String(NPO);
+    if(attribute_name == "Description") return description;
+    if(attribute_name == "Parameters") return parameters;
+    if(attribute_name == "Parameter_Hash") return String(parameterHash);
+
+    return {};
+}
+
+unique_ptr<XmlElement> FavoritesRecord::createXml() const {
+    auto xml = make_unique<XmlElement>("FAVORITE");
+    xml->setAttribute("ID", ID);
+    xml->setAttribute("Icon", __iconText);
+    xml->setAttribute("Design_Index", designIndex);
+    xml->setAttribute("Design", design);
+    xml->setAttribute("NPO", NPO);
+    xml->setAttribute("Description", description);
+    xml->setAttribute("Parameters", parameters);
+    xml->setAttribute("Parameter_Hash", parameterHash);
+    auto parameters_xml = new XmlElement("Parameters");
+    for(auto const& [key, value] : parameterValues) {
+        // "Parameter" has only 1 attribute/value
+        auto const parameter_xml = new XmlElement("Parameter");
+        parameter_xml->setAttribute(Identifier(key), value);
+        parameters_xml->addChildElement(parameter_xml);
+    }
+    xml->addChildElement(parameters_xml);
+
+    return xml;
+}
+
+bool FavoritesRecord::fromXml(const XmlElement& xml, FavoritesRecord& record) {
+    if(!xml.hasTagName("FAVORITE") || !xml.hasAttribute("ID")) {
+        return false;
+    }
+    record = FavoritesRecord();
+    record.ID = xml.getIntAttribute("ID");
+    record.designIndex = xml.getIntAttribute("Design_Index");
+    record.design = xml.getStringAttribute("Design");
+    record.NPO = xml.getIntAttribute("NPO");
+    record.description = xml.getStringAttribute("Description");
+    record.parameters = xml.getStringAttribute("Parameters");
+    record.parameterHash = xml.getIntAttribute("Parameter_Hash");
+    if(auto const parameters_xml = xml.getChildByName("Parameters")) {
+        for(auto parameter_xml : parameters_xml->getChildIterator()) {
+            auto const key = parameter_xml->getAttributeName(0);
+            jassert(key != String()); // empty string
+            record.parameterValues.emplace_back(key, parameter_xml->getDoubleAttribute(key));
+        }
+    }
+
+    return true;
+}
+
+#pragma mark - lifecycle
+
+FavoritesStore::FavoritesStore(const File& library_file, int morph_design_index)
+: _libraryFile(library_file)
+, _journalFile(library_file.withFileExtension("journal"))
+, _morphDesignIndex(morph_design_index)
+, _columns(make_unique<XmlElement>("COLUMNS"))
+, _fileLock("Wilsonic_Favorites_" + String::toHexString(library_file.getFullPathName().hashCode64()))
+{
+
+}
+
+FavoritesStore::~FavoritesStore() {
+    // a compaction that is writing finishes; one that hasn't started happens after the next load
+    _compactor.removeAllJobs(false, 5000);
+}
+
+#pragma mark - persistence
+
+bool FavoritesStore::load() {
+    auto success = false;
+    {
+        __LibraryLock lock(_fileLock);
+        if(lock.isLocked()) {
+            success = _read(_libraryFile, _journalFile, _morphDesignIndex, _columns, _records, _index, _journalEntries);
+        }
+    }
+    if(!success) {
+        return false;
+    }
+
+    // changes since the last compaction
+    if(_journalEntries > 0) {
+        _compactAsync();
+    }
+
+    return true;
+}
+
+bool FavoritesStore::create(unique_ptr<XmlElement> columns) {
+    jassert(columns != nullptr);
+    _compactor.removeAllJobs(false, 5000);
+    _compacting = false;
+    _journalEntries = 0;
+    _columns = std::move(columns);
+    _records.clear();
+    _index.clear();
+
+    __LibraryLock lock(_fileLock);
+    if(!lock.isLocked()) {
+        return false;
+    }
+    _journalFile.deleteFile();
+
+    return _writeLibrary(_libraryFile, *createXml());
+}
+
+const XmlElement* FavoritesStore::getColumns() const {
+    return _columns.get();
+}
+
+unique_ptr<XmlElement> FavoritesStore::createXml() const {
+    vector<FavoritesRecord> records;
+    records.reserve(_records.size());
+    for(auto ID : _index.getIDs(0)) {
+        records.push_back(_records.at(ID));
+    }
+
+    return __createLibraryXml(*_columns, records);
+}
+
+#pragma mark - records
+
+const FavoritesRecord* FavoritesStore::getRecord(int ID) const {
+    auto const it = _records.find(ID);
+
+    return it == _records.end() ? nullptr : &it->second;
+}
+
+const FavoritesRecord* FavoritesStore::getRecordAtRow(int view, int row) const {
+    auto const ID = _index.getID(view, row);
+
+    return ID == FavoritesIndex::notFound ? nullptr : getRecord(ID);
+}
+
+bool FavoritesStore::put(FavoritesRecord record) {
+    auto const entry = record.createXml();
+    _put(std::move(record), _records, _index, _morphDesignIndex);
+
+    return _appendToJournal(*entry);
+}
+
+bool FavoritesStore::remove(int ID) {
+    if(_records.erase(ID) == 0) {
+        return false;
+    }
+    _index.remove(ID);
+    XmlElement entry("DELETE");
+    entry.setAttribute("ID", ID);
+
+    return _appendToJournal(entry);
+}
+
+void FavoritesStore::sort(int view, const String& attribute_name, bool forwards) {
+    auto const direction = forwards ? 1 : -1;
+    _index.sort(view, [&](int a, int b) {
+        auto result = _records.at(a).getAttribute(attribute_name).compareNatural(_records.at(b).getAttribute(attribute_name));
+        if(result == 0) {
+            result = a < b ? -1 : (a > b ? 1 : 0);
+        }
+        return direction * result < 0;
+    });
+
+    // only the library order is persisted
+    if(view == 0) {
+        String IDs;
+        for(auto ID : _index.getIDs(0)) {
+            IDs << ID << " ";
+        }
+        XmlElement entry("ORDER");
+        entry.setAttribute("IDs", IDs.trimEnd());
+        _appendToJournal(entry);
+    }
+}
+
+#pragma mark - private
+
+void FavoritesStore::_put(FavoritesRecord record, unordered_map<int, FavoritesRecord>& records, FavoritesIndex& index, int morph_design_index) {
+    auto const ID = record.ID;
+    auto const morphable = record.designIndex != morph_design_index;
+    auto const it = records.find(ID);
+    if(it == records.end()) {
+        index.add(ID, record.parameterHash, morphable);
+    } else if(it->second.parameterHash != record.parameterHash || (it->second.designIndex != morph_design_index) != morphable) {
+        // not from the ui, which only edits the description
+        index.remove(ID);
+        index.add(ID, record.parameterHash, morphable);
+    }
+    records[ID] = std::move(record);
+}
+
+// FAVORITE, DELETE, or ORDER
+bool FavoritesStore::_replay(const XmlElement& entry, unordered_map<int, FavoritesRecord>& records, FavoritesIndex& index, int morph_design_index) {
+    FavoritesRecord record;
+    if(FavoritesRecord::fromXml(entry, record)) {
+        _put(std::move(record), records, index, morph_design_index);
+    } else if(entry.hasTagName("DELETE")) {
+        auto const ID = entry.getIntAttribute("ID", FavoritesIndex::notFound);
+        records.erase(ID);
+        index.remove(ID);
+    } else if(entry.hasTagName("ORDER")) {
+        vector<int> IDs;
+        for(auto const& ID : StringArray::fromTokens(entry.getStringAttribute("IDs"), " ", "")) {
+            IDs.push_back(ID.getIntValue());
+        }
+        index.setOrder(0, IDs);
+    } else {
+        DBG("FavoritesStore::_replay: unknown entry: " + entry.getTagName());
+        return false;
+    }
+
+    return true;
+}
+
+// the library, then the journal; the caller holds the library lock
+bool FavoritesStore::_read(const File& library_file,
+                           const File& journal_file,
+                           int morph_design_index,
+                           unique_ptr<XmlElement>& columns,
+                           unordered_map<int, FavoritesRecord>& records,
+                           FavoritesIndex& index,
+                           int& journal_entries) {
+    auto library = XmlDocument::parse(library_file);
+    if(library == nullptr) {
+        return false;
+    }
+    auto const columns_xml = library->getChildByName("COLUMNS");
+    auto const data = library->getChildByName("DATA");
+    if(columns_xml == nullptr || data == nullptr) {
+        return false;
+    }
+    columns = make_unique<XmlElement>(*columns_xml);
+    records.clear();
+    index.clear();
+    for(auto child : data->getChildIterator()) {
+        _replay(*child, records, index, morph_design_index);
+    }
+
+    journal_entries = 0;
+    if(!journal_file.existsAsFile()) {
+        return true;
+    }
+    StringArray lines;
+    lines.addLines(journal_file.loadFileAsString());
+    for(auto const& line : lines) {
+        if(line.isEmpty()) {
+            continue;
+        }
+        // a torn last line is skipped
+        if(auto const entry = parseXML(line)) {
+            journal_entries += _replay(*entry, records, index, morph_design_index) ? 1 : 0;
+        } else {
+            DBG("FavoritesStore::_read: skipping: " + line);
+        }
+    }
+
+    return true;
+}
+
+// one entry per line
+bool FavoritesStore::_appendToJournal(const XmlElement& entry) {
+    auto success = false;
+    {
+        __LibraryLock lock(_fileLock);
+        if(lock.isLocked()) {
+            // opened by path every time: another instance may have compacted the journal away
+            FileOutputStream journal(_journalFile); // appends
+            success = journal.openedOk();
+            if(success) {
+                success = journal.writeText(entry.toString(XmlElement::TextFormat().singleLine().withoutHeader()) + "\n", false, false, nullptr);
+                journal.flush();
+                success = success && journal.getStatus().wasOk();
+            }
+        }
+    }
+    if(!success) {
+        DBG("FavoritesStore::_appendToJournal: can't write: " + _journalFile.getFullPathName());
+        return false;
+    }
+
+    if(++_journalEntries >= __compactAfterEntries) {
+        _compactAsync();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Folds the journal into the library on the compactor thread.
+ *
+ * The library and journal are re-read under the library lock, rather than snapshotted from this store,
+ * so the entries every other instance appended are kept.
+ */
+void FavoritesStore::_compactAsync() {
+    if(_compacting.exchange(true)) {
+        // next time
+        return;
+    }
+    _journalEntries = 0;
+    _compactor.addJob([this]() {
+        {
+            __LibraryLock lock(_fileLock);
+            unique_ptr<XmlElement> columns;
+            unordered_map<int, FavoritesRecord> records;
+            FavoritesIndex index;
+            int journal_entries = 0;
+            if(lock.isLocked() && _read(_libraryFile, _journalFile, _morphDesignIndex, columns, records, index, journal_entries)) {
+                vector<FavoritesRecord> snapshot;
+                snapshot.reserve(records.size());
+                for(auto ID : index.getIDs(0)) {
+                    snapshot.push_back(std::move(records.at(ID)));
+                }
+                if(_writeLibrary(_libraryFile, *__createLibraryXml(*columns, snapshot))) {
+                    _journalFile.deleteFile();
+                } else {
+                    DBG("FavoritesStore::_compactAsync: can't write: " + _libraryFile.getFullPathName());
+                }
+            }
+        }
+        _compacting = false;
+    });
+}
+
+// atomic: the library is replaced only if the whole file was written
+bool FavoritesStore::_writeLibrary(const File& library_file, const XmlElement& library) {
+    TemporaryFile temp(library_file);
+    if(!library.writeTo(temp.getFile())) {
+        return false;
+    }
+
+    return temp.overwriteTargetFileWithTemporary();
+}
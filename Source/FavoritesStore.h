@@ -0,0 +1,102 @@
+/**
+ * @file FavoritesStore.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the FavoritesRecord struct and the FavoritesStore class.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "FavoritesIndex.h"
+#include "Tuning_Include.h"
+
+/**
+ * @struct FavoritesRecord
+ * @brief One Favorite, decoded from its "FAVORITE" element.
+ */
+struct FavoritesRecord {
+    int ID = -1;
+    int designIndex = 0;
+    String design {};
+    int NPO = 0;
+    String description {};
+    String parameters {}; // human readable
+    int parameterHash = 0;
+    vector<pair<String, double>> parameterValues {}; // the "Parameters" child: key, value
+
+    String getAttribute(const String& attribute_name) const; // the text of a column
+    unique_ptr<XmlElement> createXml() const;
+    static bool fromXml(const XmlElement& xml, FavoritesRecord& record); // false if it isn't a FAVORITE
+};
+
+/**
+ * @class FavoritesStore
+ * @brief The Favorites library: records by ID, and their row views (see FavoritesIndex).
+ *
+ * The xml library file is only the persistence format.  It is read once; after that every change
+ * is appended, as one line of xml, to a journal next to it.  Once the journal is long enough it is
+ * compacted on a background thread: the library and the journal are re-read, the library is rewritten,
+ * and the journal is deleted.  Loading replays the library, then the journal; entries are idempotent.
+ *
+ * Every instance, in this process or another, shares the library: appends, loads and compactions hold
+ * a lock on it, and the journal is opened by path for each append, so no instance's entries are lost.
+ *
+ * Not thread safe, apart from compaction: the owner locks.
+ */
+class FavoritesStore final
+{
+public:
+    // lifecycle
+    FavoritesStore(const File& library_file, int morph_design_index);
+    ~FavoritesStore();
+private:
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FavoritesStore)
+
+public:
+    // persistence
+    bool load(); // false if the library doesn't exist or can't be parsed
+    bool create(unique_ptr<XmlElement> columns); // a new, empty library, written synchronously
+    const XmlElement* getColumns() const;
+    unique_ptr<XmlElement> createXml() const; // the whole library
+
+    // records
+    const FavoritesRecord* getRecord(int ID) const; // nullptr if not found
+    const FavoritesRecord* getRecordAtRow(int view, int row) const; // nullptr if out of range
+    // false if the journal can't be written (the change is still made in memory)
+    bool put(FavoritesRecord record); // adds, or replaces the record with the same ID
+    bool remove(int ID); // also false if not found
+    void sort(int view, const String& attribute_name, bool forwards);
+
+    // views, selection
+    const FavoritesIndex& getIndex() const { return _index; }
+    void setSelectedID(int view, int ID) { _index.setSelectedID(view, ID); }
+
+private:
+    // private members
+    static constexpr int __compactAfterEntries = 64;
+    File _libraryFile;
+    File _journalFile;
+    int const _morphDesignIndex;
+    unique_ptr<XmlElement> _columns;
+    unordered_map<int, FavoritesRecord> _records;
+    FavoritesIndex _index;
+    InterProcessLock _fileLock; // with a lock for this process, see __LibraryLock
+    int _journalEntries = 0; // appended by this instance since its last compaction
+    std::atomic<bool> _compacting {false};
+    ThreadPool _compactor {1}; // last: jobs finish before the members above are destroyed
+
+    // private methods
+    static void _put(FavoritesRecord record, unordered_map<int, FavoritesRecord>& records, FavoritesIndex& index, int morph_design_index);
+    static bool _replay(const XmlElement& entry, unordered_map<int, FavoritesRecord>& records, FavoritesIndex& index, int morph_design_index);
+    static bool _read(const File& library_file,
+                      const File& journal_file,
+                      int morph_design_index,
+                      unique_ptr<XmlElement>& columns,
+                      unordered_map<int, FavoritesRecord>& records,
+                      FavoritesIndex& index,
+                      int& journal_entries); // false if the library doesn't exist or can't be parsed
+    bool _appendToJournal(const XmlElement& entry);
+    void _compactAsync();
+    static bool _writeLibrary(const File& library_file, const XmlElement& library);
+};
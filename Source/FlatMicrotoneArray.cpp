@@ -0,0 +1,285 @@
+/**
+ * @file FlatMicrotoneArray.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the FlatMicrotoneArray class.
+ */
+
+#include "FlatMicrotoneArray.h"
+
+#pragma mark - building
+
+void FlatMicrotoneArray::clear() {
+    _frequencies.clear();
+    _pitches.clear();
+    _logPeriodValues.clear();
+    _numerators.clear();
+    _denominators.clear();
+    _sourceIndices.clear();
+}
+
+void FlatMicrotoneArray::reserve(size_t n) {
+    _frequencies.reserve(n);
+    _pitches.reserve(n);
+    _logPeriodValues.reserve(n);
+    _numerators.reserve(n);
+    _denominators.reserve(n);
+    _sourceIndices.reserve(n);
+}
+
+void FlatMicrotoneArray::addFrequency(float frequency, unsigned long sourceIndex) {
+    jassert(frequency > 0.f);
+    jassert(!std::isnan(frequency));
+    jassert(!std::isinf(frequency));
+    _frequencies.push_back(frequency);
+    _pitches.push_back(log2f(frequency));
+    _logPeriodValues.push_back(-1.f);
+    _numerators.push_back(0);
+    _denominators.push_back(0);
+    _sourceIndices.push_back(sourceIndex);
+}
+
+void FlatMicrotoneArray::addRational(unsigned long numerator, unsigned long denominator, unsigned long sourceIndex) {
+    jassert(numerator > 0);
+    jassert(denominator > 0);
+    auto const gcd = _gcd(numerator, denominator);
+    numerator /= gcd;
+    denominator /= gcd;
+    auto const f = float(numerator) / float(denominator);
+    _frequencies.push_back(f);
+    _pitches.push_back(log2f(f));
+    _logPeriodValues.push_back(-1.f);
+    _numerators.push_back(numerator);
+    _denominators.push_back(denominator);
+    _sourceIndices.push_back(sourceIndex);
+}
+
+void FlatMicrotoneArray::addLogPeriod(float pitch, float period, unsigned long sourceIndex) {
+    jassert(pitch >= 0.f);
+    jassert(period >= TuningConstants::minPeriod);
+    auto const f = pow(period, pitch);
+    _frequencies.push_back(f);
+    _pitches.push_back(log2f(f));
+    _logPeriodValues.push_back(pitch);
+    _numerators.push_back(0);
+    _denominators.push_back(0);
+    _sourceIndices.push_back(sourceIndex);
+}
+
+#pragma mark - accessors
+
+float FlatMicrotoneArray::frequencyAtIndex(size_t index) const {
+    jassert(index < _frequencies.size());
+    return _frequencies[index];
+}
+
+float FlatMicrotoneArray::pitchAtIndex(size_t index) const {
+    jassert(index < _pitches.size());
+    return _pitches[index];
+}
+
+bool FlatMicrotoneArray::isRationalAtIndex(size_t index) const {
+    jassert(index < _numerators.size());
+    return _numerators[index] > 0;
+}
+
+unsigned long FlatMicrotoneArray::numeratorAtIndex(size_t index) const {
+    jassert(index < _numerators.size());
+    return _numerators[index];
+}
+
+unsigned long FlatMicrotoneArray::denominatorAtIndex(size_t index) const {
+    jassert(index < _denominators.size());
+    return _denominators[index];
+}
+
+unsigned long FlatMicrotoneArray::sourceIndexAtIndex(size_t index) const {
+    jassert(index < _sourceIndices.size());
+    return _sourceIndices[index];
+}
+
+#pragma mark - processing
+
+/**
+ * @brief In-place period reduction of every entry to [1, period).
+ *
+ * This mirrors Microtone::octaveReduce(period) for each space: rationals are reduced
+ * exactly when the period is an integer, otherwise they become floats; log-period
+ * entries are reduced modulo 1 and re-expressed in the new period.
+ * @param period The period.
+ */
+void FlatMicrotoneArray::octaveReduce(float period) {
+    jassert(period >= TuningConstants::minPeriod);
+    jassert(period <= TuningConstants::maxPeriod);
+    auto const n = _frequencies.size();
+
+    // degenerate period: everything is unison
+    if(WilsonicMath::floatsAreEqual(period, TuningConstants::minPeriod)) {
+        for(size_t i = 0; i < n; i++) {
+            _frequencies[i] = 1.f;
+            _pitches[i] = 0.f;
+            if(_numerators[i] > 0) {
+                _numerators[i] = 1;
+                _denominators[i] = 1;
+            }
+        }
+        return;
+    }
+
+    auto const periodIsInteger = fmodf(period, 1.f) == 0.f;
+    auto const period_ul = static_cast<unsigned long>(period);
+    for(size_t i = 0; i < n; i++) {
+        auto f = _frequencies[i];
+        if(_numerators[i] > 0 && periodIsInteger) {
+            // rational: same as Fraction division/multiplication, reduced at every step
+            auto num = _numerators[i];
+            auto den = _denominators[i];
+            while(float(num) / float(den) >= period) {
+                den *= period_ul;
+                auto const gcd = _gcd(num, den);
+                num /= gcd;
+                den /= gcd;
+            }
+            while(float(num) / float(den) < 1.f) {
+                num *= period_ul;
+                auto const gcd = _gcd(num, den);
+                num /= gcd;
+                den /= gcd;
+            }
+            _numerators[i] = num;
+            _denominators[i] = den;
+            f = float(num) / float(den);
+        } else if(_logPeriodValues[i] >= 0.f) {
+            // log-period: pitch modulo 1, expressed in the new period
+            auto const p = fmod(_logPeriodValues[i], 1.f);
+            _logPeriodValues[i] = p;
+            f = pow(period, p);
+        } else {
+            // a rational in a non-integer period becomes a float
+            _numerators[i] = 0;
+            _denominators[i] = 0;
+            jassert(f > 0.f);
+            while(f < 1.f)
+                f *= period;
+            while(f >= period)
+                f /= period;
+        }
+        jassert(!std::isnan(f));
+        jassert(!std::isinf(f));
+        _frequencies[i] = f;
+        _pitches[i] = log2f(f);
+    }
+}
+
+/**
+ * @brief In-place sort by frequency.
+ *
+ * The sort is stable, so entries with equal frequencies keep their relative order.
+ */
+void FlatMicrotoneArray::sort() {
+    auto const n = _frequencies.size();
+    _order.resize(n);
+    std::iota(_order.begin(), _order.end(), 0);
+    std::stable_sort(_order.begin(), _order.end(), [this](size_t a, size_t b) {
+        return _frequencies[a] < _frequencies[b];
+    });
+    _applyOrder(n);
+}
+
+/**
+ * @brief In-place uniquify.
+ *
+ * Same contract as MicrotoneArray::uniquify: the result is sorted by frequency, and of
+ * several entries with exactly the same frequency the last one in the input wins.
+ */
+void FlatMicrotoneArray::uniquify() {
+    auto const n = _frequencies.size();
+    _order.resize(n);
+    std::iota(_order.begin(), _order.end(), 0);
+    std::stable_sort(_order.begin(), _order.end(), [this](size_t a, size_t b) {
+        return _frequencies[a] < _frequencies[b];
+    });
+
+    // within each run of equal frequencies keep the last (stable sort => last in input order)
+    size_t unique = 0;
+    for(size_t i = 0; i < n; i++) {
+        auto const isLastOfRun = (i + 1 == n) || (_frequencies[_order[i]] != _frequencies[_order[i + 1]]);
+        if(isLastOfRun) {
+            _order[unique++] = _order[i];
+        }
+    }
+    _applyOrder(unique);
+}
+
+/**
+ * @brief Duplicates/removes entries as neccessary so that dest has newNPO entries.
+ *
+ * Uses the same index mapping as MicrotoneArray::npoOverride.  dest and npoMap are
+ * overwritten; their capacity is reused.
+ * @param newNPO The new number of notes per octave.
+ * @param dest The destination array.
+ * @param npoMap On return npoMap[i] is the first dest index of entry i, or -1 if entry i was dropped.
+ */
+void FlatMicrotoneArray::npoOverride(int newNPO, FlatMicrotoneArray& dest, vector<int>& npoMap) const {
+    jassert(&dest != this);
+    jassert(newNPO >= 0);
+    auto const npo = _frequencies.size();
+    dest.clear();
+    dest.reserve(static_cast<size_t>(newNPO));
+    npoMap.assign(npo, -1);
+    if(npo == 0 || newNPO <= 0) {
+        return;
+    }
+
+    auto const npo_fac = static_cast<float>(npo) / static_cast<float>(newNPO);
+    for(auto i = 0; i < newNPO; i++) {
+        auto const npo_f = static_cast<float>(i) * npo_fac;
+        auto const npo_i = static_cast<size_t>(npo_f);
+        jassert(npo_i < npo);
+        dest._frequencies.push_back(_frequencies[npo_i]);
+        dest._pitches.push_back(_pitches[npo_i]);
+        dest._logPeriodValues.push_back(_logPeriodValues[npo_i]);
+        dest._numerators.push_back(_numerators[npo_i]);
+        dest._denominators.push_back(_denominators[npo_i]);
+        dest._sourceIndices.push_back(_sourceIndices[npo_i]);
+        if(npoMap[npo_i] == -1) {
+            npoMap[npo_i] = i;
+        }
+    }
+}
+
+#pragma mark - private
+
+void FlatMicrotoneArray::_applyOrder(size_t newCount) {
+    jassert(newCount <= _order.size());
+    auto gatherFloat = [&](vector<float>& v) {
+        _scratchFloat.resize(newCount);
+        for(size_t i = 0; i < newCount; i++) {
+            _scratchFloat[i] = v[_order[i]];
+        }
+        v.swap(_scratchFloat);
+    };
+    auto gatherULong = [&](vector<unsigned long>& v) {
+        _scratchULong.resize(newCount);
+        for(size_t i = 0; i < newCount; i++) {
+            _scratchULong[i] = v[_order[i]];
+        }
+        v.swap(_scratchULong);
+    };
+    gatherFloat(_frequencies);
+    gatherFloat(_pitches);
+    gatherFloat(_logPeriodValues);
+    gatherULong(_numerators);
+    gatherULong(_denominators);
+    gatherULong(_sourceIndices);
+}
+
+unsigned long FlatMicrotoneArray::_gcd(unsigned long a, unsigned long b) {
+    while(b != 0) {
+        auto const t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a == 0 ? 1 : a;
+}
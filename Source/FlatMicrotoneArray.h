@@ -0,0 +1,72 @@
+/**
+ * @file FlatMicrotoneArray.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the FlatMicrotoneArray class.
+ */
+
+#pragma once
+
+#include "Tuning_Include.h"
+#include "TuningConstants.h"
+
+/**
+ * @class FlatMicrotoneArray
+ * @brief A contiguous, structure-of-arrays view of a scale used by the tuning processing chain.
+ *
+ * MicrotoneArray holds shared Microtone objects (strings, Gral points, paths) and every
+ * operation on it returns a deep copy.  FlatMicrotoneArray holds only the numbers the
+ * processing chain needs: frequencies, log2 pitches, rationals, and the index of the
+ * source microtone each entry came from.  octaveReduce, sort, uniquify and npoOverride
+ * all run in place, and the scratch buffers are reused so that a steady-state update
+ * does not touch the allocator.
+ *
+ * The source index lets TuningImp build full Microtone objects lazily, only when the UI asks.
+ */
+class FlatMicrotoneArray final
+{
+public:
+    // lifecycle
+    FlatMicrotoneArray() = default;
+    ~FlatMicrotoneArray() = default;
+
+    // building
+    void clear(); ///< Removes all entries, keeps capacity
+    void reserve(size_t n); ///< Reserves capacity for n entries
+    void addFrequency(float frequency, unsigned long sourceIndex); ///< Adds a linear frequency
+    void addRational(unsigned long numerator, unsigned long denominator, unsigned long sourceIndex); ///< Adds a rational frequency
+    void addLogPeriod(float pitch, float period, unsigned long sourceIndex); ///< Adds a log-period pitch, i.e., pow(period, pitch)
+
+    // accessors
+    size_t count() const { return _frequencies.size(); }
+    float frequencyAtIndex(size_t index) const; ///< Linear frequency
+    float pitchAtIndex(size_t index) const; ///< log2 of the frequency
+    bool isRationalAtIndex(size_t index) const;
+    unsigned long numeratorAtIndex(size_t index) const; ///< 0 when the entry is not rational
+    unsigned long denominatorAtIndex(size_t index) const; ///< 0 when the entry is not rational
+    unsigned long sourceIndexAtIndex(size_t index) const; ///< index of the source microtone
+    const vector<float>& getFrequencies() const { return _frequencies; }
+    const vector<float>& getPitches() const { return _pitches; }
+
+    // in-place processing: these mirror the MicrotoneArray methods of the same name
+    void octaveReduce(float period); ///< Reduces every entry to [1, period)
+    void sort(); ///< Sorts by frequency, ascending
+    void uniquify(); ///< Sorts by frequency and removes exact duplicates.  Like MicrotoneArray::uniquify the last duplicate wins.
+    void npoOverride(int newNPO, FlatMicrotoneArray& dest, vector<int>& npoMap) const; ///< duplicates/removes entries so dest has newNPO entries.  npoMap: source index -> first dest index, or -1
+
+private:
+    void _applyOrder(size_t newCount); // gathers every buffer through _order[0..newCount)
+    static unsigned long _gcd(unsigned long a, unsigned long b);
+
+    vector<float> _frequencies {}; // linear frequency
+    vector<float> _pitches {}; // log2(frequency)
+    vector<float> _logPeriodValues {}; // pitch for log-period entries, -1 for linear entries
+    vector<unsigned long> _numerators {}; // 0 when not rational
+    vector<unsigned long> _denominators {}; // 0 when not rational
+    vector<unsigned long> _sourceIndices {};
+
+    // scratch, reused between calls
+    vector<size_t> _order {};
+    vector<float> _scratchFloat {};
+    vector<unsigned long> _scratchULong {};
+};
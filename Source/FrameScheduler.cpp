@@ -0,0 +1,117 @@
+/**
+ * @file FrameScheduler.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the FrameScheduler class.
+ */
+
+#include "FrameScheduler.h"
+#include <algorithm>
+#include <cmath>
+#include <JuceHeader.h>
+
+#pragma mark - clients
+
+void FrameScheduler::addClient(Client& client) {
+    jassert(_find(client) == nullptr);
+    _entries.push_back({&client, 0, 1, 1});
+}
+
+// during a tick the entry is only cleared, so the indices of the entries being called do not move
+void FrameScheduler::removeClient(Client& client) {
+    auto entry = _find(client);
+    if(entry == nullptr) {
+        return;
+    }
+    if(_isTicking) {
+        entry->client = nullptr;
+        entry->hz = 0;
+    } else {
+        _entries.erase(_entries.begin() + (entry - _entries.data()));
+    }
+}
+
+void FrameScheduler::setClientRate(Client& client, int hz) {
+    auto entry = _find(client);
+    jassert(entry != nullptr);
+    if(entry == nullptr) {
+        return;
+    }
+    entry->hz = std::max(0, hz);
+    entry->period = periodForRate(entry->hz);
+    entry->countdown = entry->period;
+}
+
+int FrameScheduler::getClientRate(const Client& client) const {
+    auto entry = _find(client);
+
+    return entry != nullptr ? entry->hz : 0;
+}
+
+size_t FrameScheduler::getNumClients() const {
+    return static_cast<size_t>(std::count_if(_entries.begin(), _entries.end(), [](auto const& e) { return e.client != nullptr; }));
+}
+
+size_t FrameScheduler::getNumRunningClients() const {
+    return static_cast<size_t>(std::count_if(_entries.begin(), _entries.end(), [](auto const& e) { return e.client != nullptr && e.hz > 0; }));
+}
+
+int FrameScheduler::periodForRate(int hz) {
+    if(hz <= 0) {
+        return 1;
+    }
+
+    return std::max(1, static_cast<int>(std::lround(static_cast<double>(frameRateHz) / hz)));
+}
+
+#pragma mark - tick
+
+size_t FrameScheduler::tick() {
+    jassert(!_isTicking);
+    _isTicking = true;
+    size_t retVal = 0;
+
+    // clients added by a callback are appended, and wait for the next frame
+    auto const count = _entries.size();
+    for(size_t i = 0; i < count; i++) {
+        auto& entry = _entries[i];
+        if(entry.client == nullptr || entry.hz <= 0 || --entry.countdown > 0) {
+            continue;
+        }
+        entry.countdown = entry.period;
+        if(!entry.client->isFrameVisible()) {
+            continue;
+        }
+        // the callback may add clients, so index again after it
+        _entries[i].client->frameCallback();
+        retVal++;
+    }
+
+    // removed during the tick
+    _entries.erase(std::remove_if(_entries.begin(), _entries.end(), [](auto const& e) { return e.client == nullptr; }), _entries.end());
+    _isTicking = false;
+
+    return retVal;
+}
+
+#pragma mark - private
+
+FrameScheduler::Entry* FrameScheduler::_find(const Client& client) {
+    for(auto& entry : _entries) {
+        if(entry.client == &client) {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+const FrameScheduler::Entry* FrameScheduler::_find(const Client& client) const {
+    for(auto const& entry : _entries) {
+        if(entry.client == &client) {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
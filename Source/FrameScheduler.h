@@ -0,0 +1,71 @@
+/**
+ * @file FrameScheduler.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the FrameScheduler class.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class FrameScheduler
+ * @brief Runs the UI's periodic work in one pass per frame, instead of one timer per model and component.
+ *
+ * Each client asks for a rate; tick() is called once per frame at frameRateHz, and calls every client whose
+ * period has elapsed, so clients that share a rate are called in the same frame.  A client at rate 0 stays
+ * registered but is not called.  A client that is not visible when it is due is skipped until its next period.
+ *
+ * Clients can be added, removed and re-rated from inside a frameCallback().  Not thread safe: see FrameTimer.
+ */
+class FrameScheduler final
+{
+public:
+    static constexpr int frameRateHz = 60;
+
+    /**
+     * @class Client
+     * @brief Work that runs once per period.
+     */
+    class Client
+    {
+    public:
+        virtual ~Client() = default;
+        virtual void frameCallback() = 0;
+        virtual bool isFrameVisible() { return true; } ///< Components return isShowing()
+    };
+
+    // lifecycle
+    FrameScheduler() = default;
+    ~FrameScheduler() = default;
+    FrameScheduler(const FrameScheduler&) = delete;
+    FrameScheduler& operator=(const FrameScheduler&) = delete;
+
+    // clients
+    void addClient(Client& client); ///< At rate 0
+    void removeClient(Client& client);
+    void setClientRate(Client& client, int hz); ///< hz <= 0 stops it.  Restarts the client's period.
+    int getClientRate(const Client& client) const; ///< 0 if stopped or not added
+    size_t getNumClients() const;
+    size_t getNumRunningClients() const; ///< Rate > 0, i.e., the frames are needed
+    static int periodForRate(int hz); ///< In frames, >= 1
+
+    // one frame
+    size_t tick(); ///< Returns the number of clients called
+
+private:
+    struct Entry {
+        Client* client = nullptr; // nullptr: removed during a tick
+        int hz = 0;
+        int period = 1; // frames
+        int countdown = 1; // frames until due
+    };
+    std::vector<Entry> _entries {};
+    bool _isTicking = false;
+    Entry* _find(const Client& client);
+    const Entry* _find(const Client& client) const;
+};
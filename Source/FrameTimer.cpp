@@ -0,0 +1,78 @@
+/**
+ * @file FrameTimer.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the FrameTimer and FrameTimerService classes.
+ */
+
+#include "FrameTimer.h"
+
+#pragma mark - FrameTimerService
+
+FrameTimerService::~FrameTimerService() {
+    stopTimer();
+    jassert(_scheduler.getNumClients() == 0);
+}
+
+void FrameTimerService::addClient(FrameScheduler::Client& client) {
+    const ScopedLock sl(_lock);
+    _scheduler.addClient(client);
+}
+
+void FrameTimerService::removeClient(FrameScheduler::Client& client) {
+    const ScopedLock sl(_lock);
+    _scheduler.removeClient(client);
+    _updateTimer();
+}
+
+void FrameTimerService::setClientRate(FrameScheduler::Client& client, int hz) {
+    const ScopedLock sl(_lock);
+    _scheduler.setClientRate(client, hz);
+    _updateTimer();
+}
+
+int FrameTimerService::getClientRate(const FrameScheduler::Client& client) const {
+    const ScopedLock sl(_lock);
+    return _scheduler.getClientRate(client);
+}
+
+void FrameTimerService::_updateTimer() {
+    if(_scheduler.getNumRunningClients() == 0) {
+        stopTimer();
+    } else if(!isTimerRunning()) {
+        startTimerHz(FrameScheduler::frameRateHz);
+    }
+}
+
+void FrameTimerService::timerCallback() {
+    const ScopedLock sl(_lock);
+    _scheduler.tick();
+    _updateTimer();
+}
+
+#pragma mark - FrameTimer
+
+FrameTimer::FrameTimer(Component* component)
+: _component(component) {
+    _service->addClient(*this);
+}
+
+FrameTimer::~FrameTimer() {
+    _service->removeClient(*this);
+}
+
+void FrameTimer::startFrameTimerHz(int hz) {
+    _service->setClientRate(*this, hz);
+}
+
+void FrameTimer::stopFrameTimer() {
+    _service->setClientRate(*this, 0);
+}
+
+bool FrameTimer::isFrameTimerRunning() const {
+    return _service->getClientRate(*this) > 0;
+}
+
+bool FrameTimer::isFrameVisible() {
+    return _component == nullptr || _component->isShowing();
+}
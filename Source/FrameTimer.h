@@ -0,0 +1,69 @@
+/**
+ * @file FrameTimer.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the FrameTimer and FrameTimerService classes.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "FrameScheduler.h"
+
+/**
+ * @class FrameTimerService
+ * @brief The one juce::Timer that drives the FrameScheduler, shared by every plugin instance with SharedResourcePointer.
+ *
+ * The timer only runs while a client has a rate, so a closed editor with idle models costs no wakeups.
+ * The lock is held while the clients are called, so a client removed on another thread is never called after
+ * its removal returns.
+ */
+class FrameTimerService final
+: private Timer
+{
+public:
+    // lifecycle
+    FrameTimerService() = default;
+    ~FrameTimerService() override;
+
+    // clients, any thread
+    void addClient(FrameScheduler::Client& client);
+    void removeClient(FrameScheduler::Client& client);
+    void setClientRate(FrameScheduler::Client& client, int hz);
+    int getClientRate(const FrameScheduler::Client& client) const;
+
+private:
+    CriticalSection _lock;
+    FrameScheduler _scheduler {};
+
+    void _updateTimer(); // call with the lock held
+    void timerCallback() override;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrameTimerService)
+};
+
+/**
+ * @class FrameTimer
+ * @brief A drop-in for juce::Timer whose callbacks are coalesced with every other FrameTimer's, once per frame.
+ *
+ * Pass the component, if any, so it is skipped while it is not showing.
+ */
+class FrameTimer
+: public FrameScheduler::Client
+{
+public:
+    // lifecycle
+    explicit FrameTimer(Component* component = nullptr);
+    ~FrameTimer() override;
+
+    void startFrameTimerHz(int hz); ///< hz <= 0 stops it
+    void stopFrameTimer();
+    bool isFrameTimerRunning() const;
+    bool isFrameVisible() override;
+
+private:
+    Component* _component = nullptr;
+    SharedResourcePointer<FrameTimerService> _service;
+
+    JUCE_DECLARE_NON_COPYABLE(FrameTimer)
+};
@@ -311,40 +311,40 @@ void HexadicDiamond::update()
     auto const D_Freq = _D->getFrequencyValue();
     auto const E_Freq = _E->getFrequencyValue();
     auto const F_Freq = _F->getFrequencyValue();
-    _A_B->mt  = CPS::A_div_B(CPS::A(A_Freq), CPS::B(B_Freq));
-    _A_C->mt  = CPS::A_div_B(CPS::A(A_Freq), CPS::C(C_Freq));
-    _A_D->mt  = CPS::A_div_B(CPS::A(A_Freq), CPS::D(D_Freq));
-    _A_E->mt  = CPS::A_div_B(CPS::A(A_Freq), CPS::E(E_Freq));
-    _A_F->mt  = CPS::A_div_B(CPS::A(A_Freq), CPS::F(F_Freq));
-    _B_A->mt  = CPS::A_div_B(CPS::B(B_Freq), CPS::A(A_Freq));
-    _B_C->mt  = CPS::A_div_B(CPS::B(B_Freq), CPS::C(C_Freq));
-    _B_D->mt  = CPS::A_div_B(CPS::B(B_Freq), CPS::D(D_Freq));
-    _B_E->mt  = CPS::A_div_B(CPS::B(B_Freq), CPS::E(E_Freq));
-    _B_F->mt  = CPS::A_div_B(CPS::B(B_Freq), CPS::F(F_Freq));
-    _C_A->mt  = CPS::A_div_B(CPS::C(C_Freq), CPS::A(A_Freq));
-    _C_B->mt  = CPS::A_div_B(CPS::C(C_Freq), CPS::B(B_Freq));
-    _C_D->mt  = CPS::A_div_B(CPS::C(C_Freq), CPS::D(D_Freq));
-    _C_E->mt  = CPS::A_div_B(CPS::C(C_Freq), CPS::E(E_Freq));
-    _C_F->mt  = CPS::A_div_B(CPS::C(C_Freq), CPS::F(F_Freq));
-    _D_A->mt  = CPS::A_div_B(CPS::D(D_Freq), CPS::A(A_Freq));
-    _D_B->mt  = CPS::A_div_B(CPS::D(D_Freq), CPS::B(B_Freq));
-    _D_C->mt  = CPS::A_div_B(CPS::D(D_Freq), CPS::C(C_Freq));
-    _D_E->mt  = CPS::A_div_B(CPS::D(D_Freq), CPS::E(E_Freq));
-    _D_F->mt  = CPS::A_div_B(CPS::D(D_Freq), CPS::F(F_Freq));
-    _E_A->mt  = CPS::A_div_B(CPS::E(E_Freq), CPS::A(A_Freq));
-    _E_B->mt  = CPS::A_div_B(CPS::E(E_Freq), CPS::B(B_Freq));
-    _E_C->mt  = CPS::A_div_B(CPS::E(E_Freq), CPS::C(C_Freq));
-    _E_D->mt  = CPS::A_div_B(CPS::E(E_Freq), CPS::D(D_Freq));
-    _E_F->mt  = CPS::A_div_B(CPS::E(E_Freq), CPS::F(F_Freq));
-    _F_A->mt  = CPS::A_div_B(CPS::F(F_Freq), CPS::A(A_Freq));
-    _F_B->mt  = CPS::A_div_B(CPS::F(F_Freq), CPS::B(B_Freq));
-    _F_C->mt  = CPS::A_div_B(CPS::F(F_Freq), CPS::C(C_Freq));
-    _F_D->mt  = CPS::A_div_B(CPS::F(F_Freq), CPS::D(D_Freq));
-    _F_E->mt  = CPS::A_div_B(CPS::F(F_Freq), CPS::E(E_Freq));
+    _A_B->mt  = _recordProduct(CPS::A_div_B(CPS::A(A_Freq), CPS::B(B_Freq)), {_A}, {_B});
+    _A_C->mt  = _recordProduct(CPS::A_div_B(CPS::A(A_Freq), CPS::C(C_Freq)), {_A}, {_C});
+    _A_D->mt  = _recordProduct(CPS::A_div_B(CPS::A(A_Freq), CPS::D(D_Freq)), {_A}, {_D});
+    _A_E->mt  = _recordProduct(CPS::A_div_B(CPS::A(A_Freq), CPS::E(E_Freq)), {_A}, {_E});
+    _A_F->mt  = _recordProduct(CPS::A_div_B(CPS::A(A_Freq), CPS::F(F_Freq)), {_A}, {_F});
+    _B_A->mt  = _recordProduct(CPS::A_div_B(CPS::B(B_Freq), CPS::A(A_Freq)), {_B}, {_A});
+    _B_C->mt  = _recordProduct(CPS::A_div_B(CPS::B(B_Freq), CPS::C(C_Freq)), {_B}, {_C});
+    _B_D->mt  = _recordProduct(CPS::A_div_B(CPS::B(B_Freq), CPS::D(D_Freq)), {_B}, {_D});
+    _B_E->mt  = _recordProduct(CPS::A_div_B(CPS::B(B_Freq), CPS::E(E_Freq)), {_B}, {_E});
+    _B_F->mt  = _recordProduct(CPS::A_div_B(CPS::B(B_Freq), CPS::F(F_Freq)), {_B}, {_F});
+    _C_A->mt  = _recordProduct(CPS::A_div_B(CPS::C(C_Freq), CPS::A(A_Freq)), {_C}, {_A});
+    _C_B->mt  = _recordProduct(CPS::A_div_B(CPS::C(C_Freq), CPS::B(B_Freq)), {_C}, {_B});
+    _C_D->mt  = _recordProduct(CPS::A_div_B(CPS::C(C_Freq), CPS::D(D_Freq)), {_C}, {_D});
+    _C_E->mt  = _recordProduct(CPS::A_div_B(CPS::C(C_Freq), CPS::E(E_Freq)), {_C}, {_E});
+    _C_F->mt  = _recordProduct(CPS::A_div_B(CPS::C(C_Freq), CPS::F(F_Freq)), {_C}, {_F});
+    _D_A->mt  = _recordProduct(CPS::A_div_B(CPS::D(D_Freq), CPS::A(A_Freq)), {_D}, {_A});
+    _D_B->mt  = _recordProduct(CPS::A_div_B(CPS::D(D_Freq), CPS::B(B_Freq)), {_D}, {_B});
+    _D_C->mt  = _recordProduct(CPS::A_div_B(CPS::D(D_Freq), CPS::C(C_Freq)), {_D}, {_C});
+    _D_E->mt  = _recordProduct(CPS::A_div_B(CPS::D(D_Freq), CPS::E(E_Freq)), {_D}, {_E});
+    _D_F->mt  = _recordProduct(CPS::A_div_B(CPS::D(D_Freq), CPS::F(F_Freq)), {_D}, {_F});
+    _E_A->mt  = _recordProduct(CPS::A_div_B(CPS::E(E_Freq), CPS::A(A_Freq)), {_E}, {_A});
+    _E_B->mt  = _recordProduct(CPS::A_div_B(CPS::E(E_Freq), CPS::B(B_Freq)), {_E}, {_B});
+    _E_C->mt  = _recordProduct(CPS::A_div_B(CPS::E(E_Freq), CPS::C(C_Freq)), {_E}, {_C});
+    _E_D->mt  = _recordProduct(CPS::A_div_B(CPS::E(E_Freq), CPS::D(D_Freq)), {_E}, {_D});
+    _E_F->mt  = _recordProduct(CPS::A_div_B(CPS::E(E_Freq), CPS::F(F_Freq)), {_E}, {_F});
+    _F_A->mt  = _recordProduct(CPS::A_div_B(CPS::F(F_Freq), CPS::A(A_Freq)), {_F}, {_A});
+    _F_B->mt  = _recordProduct(CPS::A_div_B(CPS::F(F_Freq), CPS::B(B_Freq)), {_F}, {_B});
+    _F_C->mt  = _recordProduct(CPS::A_div_B(CPS::F(F_Freq), CPS::C(C_Freq)), {_F}, {_C});
+    _F_D->mt  = _recordProduct(CPS::A_div_B(CPS::F(F_Freq), CPS::D(D_Freq)), {_F}, {_D});
+    _F_E->mt  = _recordProduct(CPS::A_div_B(CPS::F(F_Freq), CPS::E(E_Freq)), {_F}, {_E});
     //_one->mt  = CPS::A_div_B(CPS::A(1),                       CPS::A(1));
 
     auto ma = MicrotoneArray();
-    ma.addMicrotone(_one->mt);
+    ma.addMicrotone(_recordProduct(_one->mt, {})); // 1/1 has no terms
     ma.addMicrotone(_A_B->mt);
     ma.addMicrotone(_A_C->mt);
     ma.addMicrotone(_A_D->mt);
@@ -0,0 +1,109 @@
+/**
+ * @file IconService.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the IconService class.
+ */
+
+#include "IconService.h"
+#include "ScalaIconRenderer.h"
+
+#pragma mark - lifecycle
+
+IconService::IconService() {
+    auto const dim = ScalaIconRenderer::icon_dimension_render;
+    Image placeholder(Image::ARGB, dim, dim, true);
+    Graphics g(placeholder);
+    g.setColour(Colours::grey.withAlpha(0.5f));
+    g.drawEllipse(Rectangle<float>(0.f, 0.f, dim, dim).reduced(0.2f * dim), 1.5f);
+    _placeholder = make_shared<Image>(std::move(placeholder));
+}
+
+IconService::~IconService() {
+    _pool.removeAllJobs(true, 5000);
+}
+
+#pragma mark - icons
+
+shared_ptr<Image> IconService::getCachedIcon(const String& key) {
+    const ScopedLock sl(_lock);
+    auto const icon = _cache.find(key.toStdString());
+
+    return icon != nullptr ? *icon : nullptr;
+}
+
+shared_ptr<Image> IconService::getIcon(const String& key, const File& png_file, Renderer renderer, Completion on_ready) {
+    auto const k = key.toStdString();
+    {
+        const ScopedLock sl(_lock);
+        if(auto const icon = _cache.find(k)) {
+            return *icon;
+        }
+        auto pending = _pending.find(k);
+        if(pending != _pending.end()) {
+            if(on_ready != nullptr) {
+                pending->second.push_back(std::move(on_ready));
+            }
+            return _placeholder;
+        }
+        auto& waiting = _pending[k];
+        if(on_ready != nullptr) {
+            waiting.push_back(std::move(on_ready));
+        }
+    }
+    _pool.addJob([this, key, png_file, renderer = std::move(renderer)]() {
+        _runJob(key, png_file, renderer);
+    });
+
+    return _placeholder;
+}
+
+void IconService::removeIcon(const String& key) {
+    const ScopedLock sl(_lock);
+    _cache.erase(key.toStdString());
+}
+
+shared_ptr<Image> IconService::getPlaceholderIcon() const {
+    return _placeholder;
+}
+
+#pragma mark - private
+
+// worker thread
+void IconService::_runJob(const String& key, const File& png_file, const Renderer& renderer) {
+    auto image = ImageFileFormat::loadFrom(png_file);
+    if(!image.isValid() && renderer != nullptr) {
+        image = renderer();
+        if(image.isValid()) {
+            png_file.deleteFile(); // FileOutputStream appends
+            FileOutputStream fstream(png_file);
+            PNGImageFormat png_writer;
+            if(fstream.failedToOpen() || !png_writer.writeImageToStream(image, fstream)) {
+                DBG("IconService: Error writing icon: " + png_file.getFullPathName());
+            }
+        }
+    }
+    if(!image.isValid()) {
+        DBG("IconService: no icon for: " + key);
+    }
+
+    // failures get the placeholder, so they are not retried until removeIcon()
+    vector<Completion> waiting;
+    {
+        const ScopedLock sl(_lock);
+        auto const k = key.toStdString();
+        _cache.put(k, image.isValid() ? make_shared<Image>(std::move(image)) : _placeholder);
+        auto pending = _pending.find(k);
+        if(pending != _pending.end()) {
+            waiting = std::move(pending->second);
+            _pending.erase(pending);
+        }
+    }
+    if(!waiting.empty()) {
+        MessageManager::callAsync([waiting = std::move(waiting)]() {
+            for(auto& on_ready : waiting) {
+                on_ready();
+            }
+        });
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * @file IconService.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the IconService class.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "LruCache.h"
+#include "Tuning_Include.h"
+
+/**
+ * @class IconService
+ * @brief Loads and renders table icons on worker threads, and keeps the decoded Images in an LRU cache.
+ *
+ * Icons are keyed by a string (i.e., "scala_bundle/ennea45.scl", "favorites/12345") and backed by a png
+ * file.  getIcon() never blocks on disk or zlib: a miss queues a job that loads the png, or renders and
+ * writes it if it doesn't exist, and returns the placeholder.  When the job is done on_ready is called
+ * on the message thread, and the caller asks again.
+ *
+ * Shared by the models with SharedResourcePointer.
+ */
+class IconService final
+{
+public:
+    using Renderer = std::function<Image()>; ///< called on a worker thread, returns an invalid Image on failure
+    using Completion = std::function<void()>; ///< called on the message thread
+
+    // lifecycle
+    IconService();
+    ~IconService();
+
+    /**
+     * @brief The cached icon, or nullptr.  Never queues a job.
+     */
+    shared_ptr<Image> getCachedIcon(const String& key);
+
+    /**
+     * @brief The cached icon, or the placeholder while a job loads/renders it.
+     * @param key The cache key.
+     * @param png_file The icon on disk.
+     * @param renderer Renders the icon if png_file doesn't exist (nullptr: only load).  Must not capture
+     * anything that can be mutated or deleted before it runs.
+     * @param on_ready Called on the message thread when the icon is in the cache (can be nullptr).
+     */
+    shared_ptr<Image> getIcon(const String& key, const File& png_file, Renderer renderer, Completion on_ready);
+
+    /**
+     * @brief Call when the png is deleted.
+     */
+    void removeIcon(const String& key);
+
+    /**
+     * @brief A grey circle, shown until the icon arrives, and for icons that failed.
+     */
+    shared_ptr<Image> getPlaceholderIcon() const;
+
+private:
+    static constexpr size_t __cacheSize = 512; // 64x64 ARGB = 16kb each
+    static constexpr int __numThreads = 2;
+    CriticalSection _lock;
+    LruCache<string, shared_ptr<Image>> _cache {__cacheSize};
+    unordered_map<string, vector<Completion>> _pending {}; // jobs in flight, and who is waiting
+    shared_ptr<Image> _placeholder;
+    ThreadPool _pool {__numThreads}; // last: destroyed first, so no job outlives the members
+
+    void _runJob(const String& key, const File& png_file, const Renderer& renderer);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(IconService)
+};
@@ -0,0 +1,78 @@
+/**
+ * @file IntervalMatrixModel.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the IntervalMatrixModel class.
+ */
+
+#include "IntervalMatrixModel.h"
+#include <JuceHeader.h>
+
+#pragma mark - frequencies
+
+bool IntervalMatrixModel::setFrequencies(const std::vector<float>& frequencies) {
+    if(frequencies == _frequencies) {
+        return false;
+    }
+    _frequencies = frequencies;
+    auto const npo = frequencies.size();
+    _size = (npo == 0) ? 0 : npo + 1;
+    _values.assign(_size * _size, 0.f);
+    _texts.assign(_size * _size, std::string());
+    if(_size == 0) {
+        return true;
+    }
+
+    // (0, 0) upper left cell
+    _texts[0] = "x";
+
+    // header column: the frequency
+    std::vector<std::string> frequencyTexts;
+    frequencyTexts.reserve(npo);
+    for(size_t i = 1; i < _size; i++) {
+        auto const f = frequencies[i - 1];
+        jassert(f > 0);
+        frequencyTexts.push_back(std::to_string(f));
+        _values[i * _size] = f;
+        _texts[i * _size] = frequencyTexts.back();
+    }
+
+    // header row: 1/frequency
+    for(size_t j = 1; j < _size; j++) {
+        auto const f = frequencies[j - 1];
+        _values[j] = 1.f / f;
+        _texts[j] = "1/" + frequencyTexts[j - 1];
+    }
+
+    // intervals, octave reduced
+    for(size_t i = 1; i < _size; i++) {
+        auto const iFrequency = frequencies[i - 1];
+        for(size_t j = 1; j < _size; j++) {
+            auto const jFrequency = frequencies[j - 1];
+            jassert(jFrequency > 0);
+            auto pFinal = iFrequency / jFrequency;
+            jassert(pFinal > 0);
+            while(pFinal < 1) {
+                pFinal *= 2.f;
+            }
+            _values[i * _size + j] = pFinal;
+            _texts[i * _size + j] = std::to_string(pFinal);
+        }
+    }
+
+    return true;
+}
+
+#pragma mark - cells
+
+float IntervalMatrixModel::getValue(size_t i, size_t j) const {
+    jassert(i < _size && j < _size);
+
+    return _values[i * _size + j];
+}
+
+const std::string& IntervalMatrixModel::getText(size_t i, size_t j) const {
+    jassert(i < _size && j < _size);
+
+    return _texts[i * _size + j];
+}
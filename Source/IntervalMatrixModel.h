@@ -0,0 +1,46 @@
+/**
+ * @file IntervalMatrixModel.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the IntervalMatrixModel class.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class IntervalMatrixModel
+ * @brief The cells of WilsonicIntervalMatrixComponent, computed once per tuning instead of on every paint.
+ *
+ * The matrix is (npo+1) x (npo+1).  Cell (0, 0) is "x", column 0 and row 0 are the headers with each
+ * frequency and its inverse, and the rest are the octave-reduced intervals frequency[i-1]/frequency[j-1].
+ * Values and strings are stored in flat arrays, column-major, i.e., index = i * size + j.
+ */
+class IntervalMatrixModel final
+{
+public:
+    // lifecycle
+    IntervalMatrixModel() = default;
+    ~IntervalMatrixModel() = default;
+
+    // returns false, and keeps the cells, if the frequencies are unchanged
+    bool setFrequencies(const std::vector<float>& frequencies);
+    const std::vector<float>& getFrequencies() const { return _frequencies; }
+
+    // cells
+    size_t getSize() const { return _size; } ///< npo + 1, or 0 if there are no frequencies
+    bool isHeader(size_t i, size_t j) const { return i == 0 || j == 0; }
+    float getValue(size_t i, size_t j) const; ///< The frequency the cell is coloured by.  0 for (0, 0).
+    const std::string& getText(size_t i, size_t j) const;
+
+private:
+    std::vector<float> _frequencies {};
+    size_t _size = 0;
+    std::vector<float> _values {};
+    std::vector<std::string> _texts {};
+};
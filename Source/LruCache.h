@@ -0,0 +1,85 @@
+/**
+ * @file LruCache.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the LruCache class template.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * @class LruCache
+ * @brief A bounded map that evicts the least recently used entry when it is full.
+ *
+ * find() and put() are O(1).  Not thread safe: the owner locks.
+ */
+template<typename Key, typename Value>
+class LruCache final
+{
+public:
+    explicit LruCache(size_t capacity) : _capacity(capacity > 0 ? capacity : 1) {}
+
+    // nullptr if not found.  Marks the entry as most recently used.
+    // The pointer is valid until the next put(), erase(), or clear().
+    Value* find(const Key& key) {
+        auto const it = _index.find(key);
+        if(it == _index.end()) {
+            return nullptr;
+        }
+        _entries.splice(_entries.begin(), _entries, it->second);
+
+        return &it->second->second;
+    }
+
+    bool contains(const Key& key) const {
+        return _index.find(key) != _index.end();
+    }
+
+    // inserts or replaces, as the most recently used entry
+    void put(const Key& key, Value value) {
+        auto const it = _index.find(key);
+        if(it != _index.end()) {
+            it->second->second = std::move(value);
+            _entries.splice(_entries.begin(), _entries, it->second);
+            return;
+        }
+        _entries.emplace_front(key, std::move(value));
+        _index.emplace(key, _entries.begin());
+        if(_entries.size() > _capacity) {
+            _index.erase(_entries.back().first);
+            _entries.pop_back();
+        }
+    }
+
+    bool erase(const Key& key) {
+        auto const it = _index.find(key);
+        if(it == _index.end()) {
+            return false;
+        }
+        _entries.erase(it->second);
+        _index.erase(it);
+
+        return true;
+    }
+
+    void clear() {
+        _entries.clear();
+        _index.clear();
+    }
+
+    size_t size() const { return _entries.size(); }
+    size_t capacity() const { return _capacity; }
+
+private:
+    using Entries = std::list<std::pair<Key, Value>>; // most recently used first
+    size_t _capacity;
+    Entries _entries {};
+    std::unordered_map<Key, typename Entries::iterator> _index {};
+};
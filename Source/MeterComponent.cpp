@@ -27,16 +27,19 @@ void MeterComponent::paintOverChildren (Graphics& g)
     auto leftMeter = bounds.removeFromTop (bounds.getHeight() / 2).reduced (0, 5);
     auto rightMeter = bounds.reduced (0, 5);
     
+    // rms and peak of the same frame
+    auto const& telemetry = processor.getSynthTelemetry();
+
     g.setColour (Colour::fromRGB (247, 190, 67));
-    const atomic<float>& rms = processor.getRMS();
-    auto rmsLevel = jmap<float> (rms.load(), 0.0f, 1.0f, 0.1f, leftMeter.getWidth());
+    auto const rms = telemetry.rms;
+    auto rmsLevel = jmap<float> (rms, 0.0f, 1.0f, 0.1f, leftMeter.getWidth());
     
     g.fillRoundedRectangle (leftMeter.getX(), leftMeter.getY(), rmsLevel, leftMeter.getHeight(), 5);
     g.fillRoundedRectangle (rightMeter.getX(), rightMeter.getY(), rmsLevel, rightMeter.getHeight(), 5);
     
     g.setColour (Colour::fromRGB (246, 87, 64).withAlpha (0.5f));
-    const atomic<float>& peak = processor.getPeak();
-    auto peakLevel = jmap<float> (peak.load(), 0.0f, 1.0f, 0.1f, leftMeter.getWidth());
+    auto const peak = telemetry.peak;
+    auto peakLevel = jmap<float> (peak, 0.0f, 1.0f, 0.1f, leftMeter.getWidth());
     
     g.fillRoundedRectangle (leftMeter.getX(), leftMeter.getY(), peakLevel, leftMeter.getHeight(), 5);
     g.fillRoundedRectangle (rightMeter.getX(), rightMeter.getY(), peakLevel, rightMeter.getHeight(), 5);
@@ -10,12 +10,12 @@
 
 #include "MeterData.h"
 
-const atomic<float>& MeterData::getRMS()
+float MeterData::getRMS() const
 {
     return _rms;
 }
 
-const atomic<float>& MeterData::getPeak()
+float MeterData::getPeak() const
 {
     return _peak;
 }
@@ -39,7 +39,7 @@ void MeterData::process (AudioBuffer<float>& buffer)
                 max = mabs;
         }
         auto avg = sum / buffer.getNumSamples();
-        _rms.store (sqrtf (avg));
-        _peak.store (max);
+        _rms = sqrtf (avg);
+        _peak = max;
     }
 }
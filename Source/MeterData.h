@@ -19,13 +19,13 @@ public:
 
     void process (AudioBuffer<float>& buffer);
 
-    const atomic<float>& getRMS();
+    float getRMS() const; // audio thread: published to the ui with SynthTelemetry
 
-    const atomic<float>& getPeak();
+    float getPeak() const;
     
 private:
 
-    atomic<float> _rms {0.f};
+    float _rms {0.f};
     
-    atomic<float> _peak {0.f};
+    float _peak {0.f};
 };
@@ -308,6 +308,10 @@ float Microtone::getFrequencyValue() {
     }
 }
 
+float Microtone::getPeriod() {
+    return _period;
+}
+
 /**
  * @brief Sets the frequency value of the Microtone object.
  *
@@ -43,6 +43,7 @@ public:
     void setPitchValue01(float); /**< Log Period */
     float getFrequencyValue(); /**< Linear */
     void setFrequencyValue(float); /**< Linear */
+    float getPeriod(); /**< The period this microtone is expressed/reduced in */
     const string getFrequencyValueDescription(); /**< Truncates "integer" values: "3.000000" -> "3" */
     const string getPitchValueDescription(); /**< Truncates "integer" values: "3.000000" -> "3" */
     const string getCentsValueDescription();
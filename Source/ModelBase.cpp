@@ -16,7 +16,7 @@
 ModelBase::ModelBase() {}
 
 ModelBase::~ModelBase() {
-    stopTimer();
+    stopFrameTimer();
 }
 
 #pragma mark - public methods
@@ -29,14 +29,32 @@ void ModelBase::setApvts(shared_ptr<AudioProcessorValueTreeState> apvts) {
     _apvts = apvts;
     
     // now start the ui update timer
-    startTimerHz(WilsonicProcessorConstants::defaultUIUpdateFrequencyHz);
+    startFrameTimerHz(WilsonicProcessorConstants::defaultUIUpdateFrequencyHz);
+}
+
+// replays the parameters that changed before this model was listening, i.e., a restored state
+void ModelBase::syncParameters() {
+    jassert(_apvts != nullptr);
+    for(auto pid : getFavoritesParameterIDs()) {
+        parameterChanged(pid, _apvts->getRawParameterValue(pid)->load());
+    }
 }
 
 void ModelBase::uiNeedsUpdate() {
     _uiNeedsUpdate = true;
+
+    // the tuning is needed now, i.e., by the audio thread, not at the next ui frame
+    if(_onTuningChanged != nullptr) {
+        _onTuningChanged();
+    }
+}
+
+void ModelBase::setOnTuningChanged(function<void()> onTuningChanged) {
+    jassert(_apvts == nullptr); // i.e., before any parameter listener can call it
+    _onTuningChanged = onTuningChanged;
 }
 
-void ModelBase::timerCallback() {
+void ModelBase::frameCallback() {
     if(_uiNeedsUpdate.exchange(false)) { // atomic
         _tuningChangedUpdateUI();
     }
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "FrameTimer.h"
 #include "Tuning_Include.h"
 
 // forward
@@ -19,7 +20,7 @@ class Tuning;
 //
 class ModelBase
 : public AudioProcessorValueTreeState::Listener
-, private Timer
+, private FrameTimer
 {
     // lifecycle
 public:
@@ -31,19 +32,18 @@ private:
 public:
     // public methods
     void setApvts(shared_ptr<AudioProcessorValueTreeState>);
-    virtual String getGroupID() = 0;
-    virtual String getGroupName() = 0;
-    virtual String getSubgroupSeparator() = 0;
     virtual ParameterID getDesignParameterID() = 0; // key for this design's Favorites array
     virtual StringArray getFavoritesParameterIDs() = 0; // used for Favorites
     virtual void setDesignIndex(int index);
     virtual int getDesignIndex();
     
-    // called only once: on construction of processor
-    virtual unique_ptr<AudioProcessorParameterGroup> createParams() = 0;
+    // createParams(), getGroupID(), getGroupName() and getSubgroupSeparator() are static on each model,
+    // so the processor can create every parameter without constructing the models
     virtual void attachParameterListeners() = 0;
+    void syncParameters(); // DesignsModel calls this after attachParameterListeners() on the models it creates on first use
     virtual shared_ptr<Tuning> getTuning() = 0;
     virtual void updateProperties() = 0;
+    void setOnTuningChanged(function<void()> onTuningChanged); // called by uiNeedsUpdate(), on the thread that changed the tuning. Set once, before setApvts().
 
 protected:
     // protected members
@@ -51,11 +51,12 @@ protected:
     shared_ptr<AudioProcessorValueTreeState> _apvts {nullptr};
     int _designIndex = -1;
     atomic<bool> _uiNeedsUpdate {false};
+    function<void()> _onTuningChanged {nullptr};
     
     // protected methods
     virtual void detachParameterListeners() = 0;
     virtual void _tuningChangedUpdateUI() = 0;
     void uiNeedsUpdate();
     void parameterChanged(const String &parameterID, float newValue) override;
-    void timerCallback() override;
+    void frameCallback() override; // coalesced with the UI's frames; does nothing unless _uiNeedsUpdate
 };
@@ -14,6 +14,8 @@
 #include "TuningTableImp.h"
 #include "WilsonicProcessor.h"
 
+static_assert(MorphPath::numNotes == WilsonicProcessorConstants::numMidiNotes);
+
 #pragma mark - lifecycle
 
 const StringArray Morph::__interpolationTypes {
@@ -32,19 +34,23 @@ Morph::Morph() {
     setCanScala(false);
     _interpolationType = Morph::InterpolationType::Linear;
     _interpolationValue = 0.f;
-    Morph::_update();
+    _update();
 }
 
 void Morph::setA(shared_ptr<Tuning> A) {
     jassert(A != nullptr);
+    const ScopedLock sl(_lock);
     _A = A;
-    Morph::_update();
+    _endpointsAreStale = true;
+    _update();
 }
 
 void Morph::setB(shared_ptr<Tuning> B) {
     jassert(B != nullptr);
+    const ScopedLock sl(_lock);
     _B = B;
-    Morph::_update();
+    _endpointsAreStale = true;
+    _update();
 }
 
 float Morph::getInterpolationValue() {
@@ -55,7 +61,7 @@ void Morph::setInterpolationValue(float value) {
     auto value01 = jlimit(getInterpolationMin(), getInterpolationMax(), value);
     if(WilsonicMath::floatsAreNotEqual(value01, _interpolationValue)) {
         _interpolationValue = value01;
-        Morph::_update();
+        _update();
     }
 }
 
@@ -67,81 +73,196 @@ void Morph::setInterpolationType(Morph::InterpolationType type) {
     jassert(type == Morph::InterpolationType::Linear || type == Morph::InterpolationType::Log2);
     if(type != _interpolationType) {
         _interpolationType = type;
-        Morph::_update();
+        _update();
     }
 }
 
 #pragma mark - _update
 
-void Morph::_update() {
+/**
+ * @brief Re-morphs the tuning table from the cached endpoints.
+ *
+ * This runs for every change of the interpolation value, which can be automated at audio rate, so it is
+ * one vectorized pass over the endpoints (see MorphPath).  A and B are only read when they change.
+ * The Microtones, processed arrays and triads are built by _buildMorph(), when they are asked for.
+ */
+void Morph::_updateFromStage(UpdateStage) {
     const ScopedLock sl(_lock);
-    // Loop through each MIDI note number, morph frequency
-    for (int i = 0; i < static_cast<int>(WilsonicProcessorConstants::numMidiNotes); i++) { // keep as int
-        auto const il = static_cast<unsigned long>(i);
-        auto const af = _A->getTuningTableFrequency(il);
-        auto const bf = _B->getTuningTableFrequency(il);
-        auto f = 0.f;
-        if(_interpolationType == Morph::InterpolationType::Linear) {
-            f = WilsonicMath::linearInterp(af, bf, _interpolationValue);
-        } else if (_interpolationType == Morph::InterpolationType::Log2) {
-            f = exp2f(WilsonicMath::linearInterp(log2f(af), log2f(bf), _interpolationValue));
-        } else {
-            jassertfalse;
-        }
-        setTuningTable(f, il); // this is asserting on nyquist
-        auto tone = make_shared<Microtone>(f);
-        setMicrotoneAtNoteNumber(tone, il);
+    if(_endpointsAreStale) {
+        _updateEndpoints();
     }
-    
+    array<float, WilsonicProcessorConstants::numMidiNotes> frequencies;
+    _path.evaluate(_interpolationValue, _interpolationType, frequencies.data());
+    for(unsigned long i = 0; i < WilsonicProcessorConstants::numMidiNotes; i++) {
+        setTuningTable(frequencies[i], i); // this is asserting on nyquist
+    }
+    _morphIsStale = true;
+    _updateCount++;
+
+    // Call the post-process block
+    callPostProcessBlock();
+
+    // Call the completion block
+    callOnTuningUpdate();
+}
+
+void Morph::_updateEndpoints() {
+    const ScopedLock sl(_lock);
+    _endpointsAreStale = false;
+    array<float, WilsonicProcessorConstants::numMidiNotes> af;
+    array<float, WilsonicProcessorConstants::numMidiNotes> bf;
+    for(unsigned long i = 0; i < WilsonicProcessorConstants::numMidiNotes; i++) {
+        af[i] = _A->getTuningTableFrequency(i);
+        bf[i] = _B->getTuningTableFrequency(i);
+    }
+    _path.setEndpoints(af.data(), bf.data());
+
     // A and B use _processedArrayNPO
     auto const npoA = _A->getProcessedArrayNPOCount();
     auto const npoB = _B->getProcessedArrayNPOCount();
-    auto const npo = jmax(npoA, npoB); // pick largest npo for pitch wheel
     auto const middleCNN = 60UL;
-    auto const c = microtoneAtNoteNumber(middleCNN);
-    auto const cf = c->getFrequencyValue();
+    _npo = jmin(jmax(npoA, npoB), WilsonicProcessorConstants::numMidiNotes - middleCNN); // pick largest npo for pitch wheel
+}
+
+// the tuning table -> Microtones, processed arrays, triads
+void Morph::_buildMorph() {
+    const ScopedLock sl(_lock);
+    if(!_morphIsStale) {
+        return;
+    }
+    _morphIsStale = false;
+    for(unsigned long i = 0; i < WilsonicProcessorConstants::numMidiNotes; i++) {
+        auto tone = make_shared<Microtone>(getTuningTableFrequency(i));
+        TuningImp::setMicrotoneAtNoteNumber(tone, i);
+    }
+
+    auto const middleCNN = 60UL;
+    auto const cf = getTuningTableFrequency(middleCNN);
     auto pa = MicrotoneArray();
-    for(auto i = middleCNN; i < middleCNN + npo; i++) {
-        auto mt = microtoneAtNoteNumber(i);
-        auto mtf = mt->getFrequencyValue() / cf; // normalize  // TODO: this is why pitch wheel isn't working
+    for(auto i = middleCNN; i < middleCNN + _npo; i++) {
+        auto mtf = getTuningTableFrequency(i) / cf; // normalize  // TODO: this is why pitch wheel isn't working
         auto mtfmt = make_shared<Microtone>(mtf);
         pa.addMicrotone(mtfmt);
     }
-    _processedArray = pa;
-    _processedArrayNPO = pa;
     _microtoneArray = pa;
-    
+    _processMicrotoneArray(false, false, false, false); // pa is already the processed array
+
     // triads
     _analyzeProportionalTriads();
-    
-    // Call the post-process block
-    callPostProcessBlock();
-    
-    // Call the completion block
-    callOnTuningUpdate();
 }
 
 void Morph::setNoteNumberMiddleC(unsigned long nn) {
+    const ScopedUpdate su(*this); // one morph instead of two
     TuningImp::setNoteNumberMiddleC(nn);
     _A->setNoteNumberMiddleC(nn);
     _B->setNoteNumberMiddleC(nn);
-    Morph::_update();
+    _endpointsAreStale = true;
+    _requestUpdate(UpdateStage::TuningTable);
 }
 
 void Morph::setFrequencyMiddleC(float f) {
+    const ScopedUpdate su(*this); // one morph instead of two
     TuningImp::setFrequencyMiddleC(f);
     _A->setFrequencyMiddleC(f);
     _B->setFrequencyMiddleC(f);
-    Morph::_update();
+    _endpointsAreStale = true;
+    _requestUpdate(UpdateStage::TuningTable);
 }
 
 void Morph::setOctaveMiddleC(int o) {
+    const ScopedUpdate su(*this); // one morph instead of two
     TuningImp::setOctaveMiddleC(o);
     _A->setOctaveMiddleC(o);
     _B->setOctaveMiddleC(o);
-    Morph::_update();
+    _endpointsAreStale = true;
+    _requestUpdate(UpdateStage::TuningTable);
 }
 
+MorphPath Morph::getMorphPath() {
+    const ScopedLock sl(_lock);
+    if(_endpointsAreStale) {
+        _updateEndpoints();
+    }
+
+    return _path;
+}
+
+#pragma mark - lazy microtones
+
+MicrotoneArray Morph::getMicrotoneArray() {
+    const ScopedLock sl(_lock);
+    _buildMorph();
+    return TuningImp::getMicrotoneArray();
+}
+
+unsigned long Morph::getMicrotoneArrayCount() {
+    const ScopedLock sl(_lock);
+    return _npo;
+}
+
+MicrotoneArray Morph::getProcessedArray() {
+    const ScopedLock sl(_lock);
+    _buildMorph();
+    return TuningImp::getProcessedArray();
+}
+
+unsigned long Morph::getProcessedArrayCount() {
+    const ScopedLock sl(_lock);
+    return _npo;
+}
+
+MicrotoneArray Morph::getProcessedArrayNPO() {
+    const ScopedLock sl(_lock);
+    _buildMorph();
+    return TuningImp::getProcessedArrayNPO();
+}
+
+unsigned long Morph::getProcessedArrayNPOCount() {
+    const ScopedLock sl(_lock);
+    return _npo;
+}
+
+const vector<PythagoreanMeans> Morph::getProportionalTriads() {
+    const ScopedLock sl(_lock);
+    _buildMorph();
+    return TuningImp::getProportionalTriads();
+}
+
+const vector<PythagoreanMeans> Morph::getGeometricTriads() {
+    const ScopedLock sl(_lock);
+    _buildMorph();
+    return TuningImp::getGeometricTriads();
+}
+
+const vector<PythagoreanMeans> Morph::getSubcontraryTriads() {
+    const ScopedLock sl(_lock);
+    _buildMorph();
+    return TuningImp::getSubcontraryTriads();
+}
+
+const vector<PythagoreanMeans> Morph::getAllTriads() {
+    const ScopedLock sl(_lock);
+    _buildMorph();
+    return TuningImp::getAllTriads();
+}
+
+void Morph::setMicrotoneAtNoteNumber(Microtone_p microtone, unsigned long nn) {
+    const ScopedLock sl(_lock);
+    _buildMorph();
+    TuningImp::setMicrotoneAtNoteNumber(microtone, nn);
+}
+
+Microtone_p Morph::microtoneAtNoteNumber(unsigned long nn) {
+    const ScopedLock sl(_lock);
+    _buildMorph();
+    return TuningImp::microtoneAtNoteNumber(nn);
+}
+
+// the morphed Microtones are never filtered, so there is no need to build them
+bool Morph::getFilterNoteAtNoteNumber(unsigned long nn) {
+    const ScopedLock sl(_lock);
+    return _morphIsStale ? false : TuningImp::getFilterNoteAtNoteNumber(nn);
+}
 
 #pragma mark - drawing
 
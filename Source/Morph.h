@@ -11,6 +11,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "MorphPath.h"
 #include "TuningImp.h"
 #include "Tuning_Include.h"
 
@@ -20,10 +21,7 @@ class Morph
 : public TuningImp
 {
 public:
-    enum class InterpolationType {
-        Linear = 0,
-        Log2 = 1
-    };
+    using InterpolationType = MorphPath::Interpolation; // Linear, Log2
     static constexpr int num_interpolation_types = 2;
     static StringArray getInterpolationTypeNames() { return __interpolationTypes; }
     static const StringArray __interpolationTypes;
@@ -48,18 +46,43 @@ public:
     bool canPaintTuning() override; ///< Check if the tuning can be painted.
     void paint(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bounds) override; ///< Paint the tuning.
 
-    // overrides TuningImp::update, modifies the tuningtable directly.
-    void _update() override;
     void setNoteNumberMiddleC(unsigned long nn) override;
     void setFrequencyMiddleC(float f) override;
     void setOctaveMiddleC(int o) override;
-    
+
+    // the endpoints, for the audio thread to interpolate per block (see TuningSnapshot)
+    MorphPath getMorphPath();
+
+    // the Microtones, processed arrays and triads are only built when one of these is called
+    MicrotoneArray getMicrotoneArray() override;
+    unsigned long getMicrotoneArrayCount() override;
+    MicrotoneArray getProcessedArray() override;
+    unsigned long getProcessedArrayCount() override;
+    MicrotoneArray getProcessedArrayNPO() override;
+    unsigned long getProcessedArrayNPOCount() override;
+    const vector<PythagoreanMeans> getProportionalTriads() override;
+    const vector<PythagoreanMeans> getGeometricTriads() override;
+    const vector<PythagoreanMeans> getSubcontraryTriads() override;
+    const vector<PythagoreanMeans> getAllTriads() override;
+    void setMicrotoneAtNoteNumber(Microtone_p microtone, unsigned long nn) override;
+    Microtone_p microtoneAtNoteNumber(unsigned long nn) override;
+    bool getFilterNoteAtNoteNumber(unsigned long nn) override;
+
 private:
     // members
     shared_ptr<Tuning> _A;
     shared_ptr<Tuning> _B;
     float _interpolationValue = 0.f;
     Morph::InterpolationType _interpolationType = Morph::InterpolationType::Linear;
+    MorphPath _path {}; // A and B tuning tables
+    unsigned long _npo = 0; // the larger of A and B
+    bool _endpointsAreStale = true; // A, B, or their middle C changed
+    bool _morphIsStale = true; // Microtones, processed arrays and triads
+
+    // overrides TuningImp::_updateFromStage, modifies the tuningtable directly.  Every stage re-morphs.
+    void _updateFromStage(UpdateStage stage) override;
+    void _updateEndpoints();
+    void _buildMorph();
 
     // methods
     void paint01(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bounds); // both A and B are normalized, not very revealing
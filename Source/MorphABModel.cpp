@@ -16,6 +16,7 @@
 #include "CoPrimeMorphModel.h"
 #include "CPSModel.h"
 #include "CPSMorphModel.h"
+#include "DesignsModel.h"
 #include "DiamondsModel.h"
 #include "DiamondsMorphModel.h"
 #include "EqualTemperamentModel.h"
@@ -75,31 +76,31 @@ shared_ptr<Tuning> MorphABModel::getTuningForFavoritesID(int ID) {
     
     // ADD NEW SCALE DESIGN HERE
 
-    if(_favorite.designIndex == _processor.getPresetsModel()->getDesignIndex()) {
+    if(_favorite.designIndex == DesignsModel::presetsDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _presetsMorphModel);
-    } else if(_favorite.designIndex == _processor.getBrun2Model()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::brun2DesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _brun2MorphModel);
-    } else if(_favorite.designIndex == _processor.getPersian17NorthIndianModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::persian17NorthIndianDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _persian17NorthIndianMorphModel);
-    } else if(_favorite.designIndex == _processor.getCPSModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::cpsDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _cpsMorphModel);
-    } else if(_favorite.designIndex == _processor.getEulerGenusModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::eulerGenusDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _eulerGenusMorphModel);
-    } else if(_favorite.designIndex == _processor.getRecurrenceRelationModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::recurrenceRelationDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _recurrenceRelationMorphModel);
-    } else if(_favorite.designIndex == _processor.getEqualTemperamentModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::equalTemperamentDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _equalTemperamentMorphModel);
-    } else if(_favorite.designIndex == _processor.getTritriadicModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::tritriadicDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _tritriadicMorphModel);
-    } else if(_favorite.designIndex == _processor.getScalaModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::scalaDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _scalaMorphModel);
-    } else if(_favorite.designIndex == _processor.getCoPrimeModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::coPrimeDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _coPrimeMorphModel);
-    } else if(_favorite.designIndex == _processor.getDiamondsModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::diamondsDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _diamondsMorphModel);
-    } else if(_favorite.designIndex == _processor.getMorphModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::morphDesignIndex) {
         jassertfalse; // You cannot morph a morph
-    } else if(_favorite.designIndex == _processor.getPartchModel()->getDesignIndex()) {
+    } else if(_favorite.designIndex == DesignsModel::partchDesignIndex) {
         _tuning = _getFavoriteAppliedToMorphModel(_favorite, _partchMorphModel);
     } else {
         jassertfalse;
@@ -126,8 +127,9 @@ shared_ptr<Tuning> MorphABModel::_getFavoriteAppliedToMorphModel(Favorite favori
     auto retVal = morphModel->getTuning();
     jassert(retVal != nullptr);
     
-    // sync with AppTuningModel BEFORE morphing
+    // sync with AppTuningModel BEFORE morphing, with one recompute for all five setters
     auto const atm = _processor.getAppTuningModel();
+    const Tuning::ScopedUpdate su(*retVal);
     retVal->setOctaveMiddleC(static_cast<int>(atm->uiGetOctaveMiddleC()));
     retVal->setNoteNumberMiddleC(static_cast<unsigned long>(atm->uiGetNoteNumberMiddleC()));
     retVal->setFrequencyMiddleC(atm->uiGetFrequencyMiddleC());
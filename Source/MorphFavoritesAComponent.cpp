@@ -273,7 +273,7 @@ void MorphFavoritesAComponent::setSelection(const int rowNumber, const int newSe
     _processor.getFavoritesModelV2()->setSelection(rowNumber, newSelection, FavoritesModelV2::DataList::FavoritesA);
 }
 
-shared_ptr<Image> MorphFavoritesAComponent::getIcon(int rowNumber)
+shared_ptr<Image> MorphFavoritesAComponent::getIcon(int rowNumber, IconService::Completion on_ready)
 {
-    return _processor.getFavoritesModelV2()->getIcon(rowNumber, FavoritesModelV2::DataList::FavoritesA);
+    return _processor.getFavoritesModelV2()->getIcon(rowNumber, FavoritesModelV2::DataList::FavoritesA, std::move(on_ready));
 }
@@ -271,7 +271,7 @@ void MorphFavoritesBComponent::setSelection(const int rowNumber, const int newSe
     _processor.getFavoritesModelV2()->setSelection(rowNumber, newSelection, FavoritesModelV2::DataList::FavoritesB);
 }
 
-shared_ptr<Image> MorphFavoritesBComponent::getIcon(int rowNumber)
+shared_ptr<Image> MorphFavoritesBComponent::getIcon(int rowNumber, IconService::Completion on_ready)
 {
-    return _processor.getFavoritesModelV2()->getIcon(rowNumber, FavoritesModelV2::DataList::FavoritesB);
+    return _processor.getFavoritesModelV2()->getIcon(rowNumber, FavoritesModelV2::DataList::FavoritesB, std::move(on_ready));
 }
@@ -58,7 +58,7 @@ public:
     void setText(const int columnNumber, const int rowNumber, const String& newText);
     int getSelection(const int rowNumber) const;
     void setSelection(const int rowNumber, const int newSelection);
-    shared_ptr<Image> getIcon(int rowNumber);
+    shared_ptr<Image> getIcon(int rowNumber, IconService::Completion on_ready);
 
     // action listener
     void actionListenerCallback(const String& message) override;
@@ -125,7 +125,21 @@ private:
         {
             _row = newRow;
             _columnId = newColumn;
-            auto ip = _owner.getIcon(_row);
+            _updateImage();
+        }
+
+    private:
+        // the placeholder until the icon is loaded, then again when it's ready
+        void _updateImage()
+        {
+            auto on_ready = [safe = Component::SafePointer<FavoritesIcon>(this), row = _row]()
+            {
+                if(safe != nullptr && safe->_row == row)
+                {
+                    safe->_updateImage();
+                }
+            };
+            auto ip = _owner.getIcon(_row, on_ready);
             if(ip != nullptr)
             {
                 auto rs = ip->rescaled(FavoritesIconRenderer::tableviewHeight, FavoritesIconRenderer::tableviewHeight);
@@ -133,12 +147,10 @@ private:
             }
             else
             {
-                // TODO: set default image
                 jassertfalse;
             }
         }
 
-    private:
         MorphFavoritesBComponent& _owner;
         int _row, _columnId;
     };
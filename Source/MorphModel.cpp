@@ -89,7 +89,7 @@ unique_ptr<AudioProcessorParameterGroup> MorphModel::createParams() {
      (getMorphInterpolationParameterID(),
       getMorphInterpolationParameterName(),
       NormalisableRange<float> (morphInterpolationParameterMin, morphInterpolationParameterMax, 0.f),
-      _morph->getInterpolationValue(),
+      morphInterpolationParameterDefault,
       getMorphInterpolationParameterName(),
       AudioProcessorParameter::genericParameter,
 [](float value, int maxLength) { return String (value).substring (0, maxLength); },
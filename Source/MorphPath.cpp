@@ -0,0 +1,60 @@
+/**
+ * @file MorphPath.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the MorphPath class.
+ */
+
+#include "MorphPath.h"
+#include <algorithm>
+#include <cmath>
+
+#pragma mark - endpoints
+
+void MorphPath::setEndpoints(const float* A, const float* B) {
+    // exp2 domain; log2 of 0 is -inf.  Every point between two logs in the domain is in the domain.
+    auto log2 = [](float f) { return std::clamp(std::log2(f), -126.f, 127.f); };
+    for(size_t i = 0; i < numNotes; i++) {
+        _A[i] = A[i];
+        _B[i] = B[i];
+        _delta[i] = B[i] - A[i];
+        _log2A[i] = log2(A[i]);
+        _log2Delta[i] = log2(B[i]) - _log2A[i];
+    }
+}
+
+#pragma mark - evaluate
+
+void MorphPath::evaluate(float t, Interpolation interpolation, float* dest) const {
+    if(!(t > 0.f)) { // also nan
+        std::copy(_A.begin(), _A.end(), dest);
+        return;
+    }
+    if(t >= 1.f) {
+        std::copy(_B.begin(), _B.end(), dest);
+        return;
+    }
+    if(interpolation == Interpolation::Log2) {
+        for(size_t i = 0; i < numNotes; i++) {
+            dest[i] = exp2(_log2A[i] + t * _log2Delta[i]);
+        }
+    } else {
+        for(size_t i = 0; i < numNotes; i++) {
+            dest[i] = _A[i] + t * _delta[i];
+        }
+    }
+}
+
+float MorphPath::evaluate(size_t nn, float t, Interpolation interpolation) const {
+    if(!(t > 0.f)) {
+        return _A[nn];
+    }
+    if(t >= 1.f) {
+        return _B[nn];
+    }
+    if(interpolation == Interpolation::Log2) {
+        return exp2(_log2A[nn] + t * _log2Delta[nn]);
+    }
+
+    return _A[nn] + t * _delta[nn];
+}
@@ -0,0 +1,74 @@
+/**
+ * @file MorphPath.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the MorphPath class.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @class MorphPath
+ * @brief The tuning tables of the two ends of a Morph, precomputed so any point between them is one pass over flat arrays.
+ *
+ * The endpoints are stored as A and B - A, and for Log2 interpolation as log2(A) and log2(B) - log2(A),
+ * so evaluating a note is a multiply-add, plus an exp2 for Log2.  The loops have no branches or calls
+ * and vectorize.  exp2 is a polynomial that is accurate to float precision for the range of the tuning table.
+ *
+ * t is clamped to [0, 1].  0 and 1 return the endpoints exactly.
+ */
+class MorphPath final
+{
+public:
+    static constexpr size_t numNotes = 128; // WilsonicProcessorConstants::numMidiNotes
+
+    enum class Interpolation {
+        Linear = 0,
+        Log2 = 1
+    };
+
+    // endpoints: numNotes frequencies each, > 0
+    void setEndpoints(const float* A, const float* B);
+    float getA(size_t nn) const { return _A[nn]; }
+    float getB(size_t nn) const { return _B[nn]; }
+
+    // all notes: dest has numNotes frequencies
+    void evaluate(float t, Interpolation interpolation, float* dest) const;
+
+    // one note: nn < numNotes
+    float evaluate(size_t nn, float t, Interpolation interpolation) const;
+
+    // 2^x for x in [-126, 127], relative error < 1e-6.  Not clamped: a branch here stops the loops vectorizing
+    static inline float exp2(float x) {
+        auto const n = static_cast<int32_t>(x + 127.5f) - 127; // round, x + 127.5 > 0
+        auto const f = x - static_cast<float>(n); // [-0.5, 0.5]
+        // taylor series of e^(f ln 2) through f^7
+        auto p = 1.5252733804059841e-05f;
+        p = p * f + 1.5403530393381606e-04f;
+        p = p * f + 1.3333558146428443e-03f;
+        p = p * f + 9.6181291076284772e-03f;
+        p = p * f + 5.5504108664821580e-02f;
+        p = p * f + 2.4022650695910071e-01f;
+        p = p * f + 6.9314718055994531e-01f;
+        p = p * f + 1.f;
+        auto const bits = static_cast<uint32_t>(n + 127) << 23; // 2^n
+        float scale;
+        std::memcpy(&scale, &bits, sizeof(scale));
+
+        return p * scale;
+    }
+
+private:
+    alignas(16) std::array<float, numNotes> _A {};
+    alignas(16) std::array<float, numNotes> _B {};
+    alignas(16) std::array<float, numNotes> _delta {}; // B - A
+    alignas(16) std::array<float, numNotes> _log2A {};
+    alignas(16) std::array<float, numNotes> _log2Delta {}; // log2(B) - log2(A)
+};
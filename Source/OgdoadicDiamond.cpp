@@ -478,66 +478,66 @@ void OgdoadicDiamond::update()
     auto const Gf = _G->getFrequencyValue();
     auto const Hf = _H->getFrequencyValue();
 
-    _A_B->mt = CPS::A_div_B(CPS::A(Af), CPS::B(Bf));
-    _A_C->mt = CPS::A_div_B(CPS::A(Af), CPS::C(Cf));
-    _A_D->mt = CPS::A_div_B(CPS::A(Af), CPS::D(Df));
-    _A_E->mt = CPS::A_div_B(CPS::A(Af), CPS::E(Ef));
-    _A_F->mt = CPS::A_div_B(CPS::A(Af), CPS::F(Ff));
-    _A_G->mt = CPS::A_div_B(CPS::A(Af), CPS::G(Gf));
-    _A_H->mt = CPS::A_div_B(CPS::A(Af), CPS::H(Hf));
-    _B_A->mt = CPS::A_div_B(CPS::B(Bf), CPS::A(Af));
-    _B_C->mt = CPS::A_div_B(CPS::B(Bf), CPS::C(Cf));
-    _B_D->mt = CPS::A_div_B(CPS::B(Bf), CPS::D(Df));
-    _B_E->mt = CPS::A_div_B(CPS::B(Bf), CPS::E(Ef));
-    _B_F->mt = CPS::A_div_B(CPS::B(Bf), CPS::F(Ff));
-    _B_G->mt = CPS::A_div_B(CPS::B(Bf), CPS::G(Gf));
-    _B_H->mt = CPS::A_div_B(CPS::B(Bf), CPS::H(Hf));
-    _C_A->mt = CPS::A_div_B(CPS::C(Cf), CPS::A(Af));
-    _C_B->mt = CPS::A_div_B(CPS::C(Cf), CPS::B(Bf));
-    _C_D->mt = CPS::A_div_B(CPS::C(Cf), CPS::D(Df));
-    _C_E->mt = CPS::A_div_B(CPS::C(Cf), CPS::E(Ef));
-    _C_F->mt = CPS::A_div_B(CPS::C(Cf), CPS::F(Ff));
-    _C_G->mt = CPS::A_div_B(CPS::C(Cf), CPS::G(Gf));
-    _C_H->mt = CPS::A_div_B(CPS::C(Cf), CPS::H(Hf));
-    _D_A->mt = CPS::A_div_B(CPS::D(Df), CPS::A(Af));
-    _D_B->mt = CPS::A_div_B(CPS::D(Df), CPS::B(Bf));
-    _D_C->mt = CPS::A_div_B(CPS::D(Df), CPS::C(Cf));
-    _D_E->mt = CPS::A_div_B(CPS::D(Df), CPS::E(Ef));
-    _D_F->mt = CPS::A_div_B(CPS::D(Df), CPS::F(Ff));
-    _D_G->mt = CPS::A_div_B(CPS::D(Df), CPS::G(Gf));
-    _D_H->mt = CPS::A_div_B(CPS::D(Df), CPS::H(Hf));
-    _E_A->mt = CPS::A_div_B(CPS::E(Ef), CPS::A(Af));
-    _E_B->mt = CPS::A_div_B(CPS::E(Ef), CPS::B(Bf));
-    _E_C->mt = CPS::A_div_B(CPS::E(Ef), CPS::C(Cf));
-    _E_D->mt = CPS::A_div_B(CPS::E(Ef), CPS::D(Df));
-    _E_F->mt = CPS::A_div_B(CPS::E(Ef), CPS::F(Ff));
-    _E_G->mt = CPS::A_div_B(CPS::E(Ef), CPS::G(Gf));
-    _E_H->mt = CPS::A_div_B(CPS::E(Ef), CPS::H(Hf));
-    _F_A->mt = CPS::A_div_B(CPS::F(Ff), CPS::A(Af));
-    _F_B->mt = CPS::A_div_B(CPS::F(Ff), CPS::B(Bf));
-    _F_C->mt = CPS::A_div_B(CPS::F(Ff), CPS::C(Cf));
-    _F_D->mt = CPS::A_div_B(CPS::F(Ff), CPS::D(Df));
-    _F_E->mt = CPS::A_div_B(CPS::F(Ff), CPS::E(Ef));
-    _F_G->mt = CPS::A_div_B(CPS::F(Ff), CPS::G(Gf));
-    _F_H->mt = CPS::A_div_B(CPS::F(Ff), CPS::H(Hf));
-    _G_A->mt = CPS::A_div_B(CPS::G(Gf), CPS::A(Af));
-    _G_B->mt = CPS::A_div_B(CPS::G(Gf), CPS::B(Bf));
-    _G_C->mt = CPS::A_div_B(CPS::G(Gf), CPS::C(Cf));
-    _G_D->mt = CPS::A_div_B(CPS::G(Gf), CPS::D(Df));
-    _G_E->mt = CPS::A_div_B(CPS::G(Gf), CPS::E(Ef));
-    _G_F->mt = CPS::A_div_B(CPS::G(Gf), CPS::F(Ff));
-    _G_H->mt = CPS::A_div_B(CPS::G(Gf), CPS::H(Hf));
-    _H_A->mt = CPS::A_div_B(CPS::H(Hf), CPS::A(Af));
-    _H_B->mt = CPS::A_div_B(CPS::H(Hf), CPS::B(Bf));
-    _H_C->mt = CPS::A_div_B(CPS::H(Hf), CPS::C(Cf));
-    _H_D->mt = CPS::A_div_B(CPS::H(Hf), CPS::D(Df));
-    _H_E->mt = CPS::A_div_B(CPS::H(Hf), CPS::E(Ef));
-    _H_F->mt = CPS::A_div_B(CPS::H(Hf), CPS::F(Ff));
-    _H_G->mt = CPS::A_div_B(CPS::H(Hf), CPS::G(Gf));
+    _A_B->mt = _recordProduct(CPS::A_div_B(CPS::A(Af), CPS::B(Bf)), {_A}, {_B});
+    _A_C->mt = _recordProduct(CPS::A_div_B(CPS::A(Af), CPS::C(Cf)), {_A}, {_C});
+    _A_D->mt = _recordProduct(CPS::A_div_B(CPS::A(Af), CPS::D(Df)), {_A}, {_D});
+    _A_E->mt = _recordProduct(CPS::A_div_B(CPS::A(Af), CPS::E(Ef)), {_A}, {_E});
+    _A_F->mt = _recordProduct(CPS::A_div_B(CPS::A(Af), CPS::F(Ff)), {_A}, {_F});
+    _A_G->mt = _recordProduct(CPS::A_div_B(CPS::A(Af), CPS::G(Gf)), {_A}, {_G});
+    _A_H->mt = _recordProduct(CPS::A_div_B(CPS::A(Af), CPS::H(Hf)), {_A}, {_H});
+    _B_A->mt = _recordProduct(CPS::A_div_B(CPS::B(Bf), CPS::A(Af)), {_B}, {_A});
+    _B_C->mt = _recordProduct(CPS::A_div_B(CPS::B(Bf), CPS::C(Cf)), {_B}, {_C});
+    _B_D->mt = _recordProduct(CPS::A_div_B(CPS::B(Bf), CPS::D(Df)), {_B}, {_D});
+    _B_E->mt = _recordProduct(CPS::A_div_B(CPS::B(Bf), CPS::E(Ef)), {_B}, {_E});
+    _B_F->mt = _recordProduct(CPS::A_div_B(CPS::B(Bf), CPS::F(Ff)), {_B}, {_F});
+    _B_G->mt = _recordProduct(CPS::A_div_B(CPS::B(Bf), CPS::G(Gf)), {_B}, {_G});
+    _B_H->mt = _recordProduct(CPS::A_div_B(CPS::B(Bf), CPS::H(Hf)), {_B}, {_H});
+    _C_A->mt = _recordProduct(CPS::A_div_B(CPS::C(Cf), CPS::A(Af)), {_C}, {_A});
+    _C_B->mt = _recordProduct(CPS::A_div_B(CPS::C(Cf), CPS::B(Bf)), {_C}, {_B});
+    _C_D->mt = _recordProduct(CPS::A_div_B(CPS::C(Cf), CPS::D(Df)), {_C}, {_D});
+    _C_E->mt = _recordProduct(CPS::A_div_B(CPS::C(Cf), CPS::E(Ef)), {_C}, {_E});
+    _C_F->mt = _recordProduct(CPS::A_div_B(CPS::C(Cf), CPS::F(Ff)), {_C}, {_F});
+    _C_G->mt = _recordProduct(CPS::A_div_B(CPS::C(Cf), CPS::G(Gf)), {_C}, {_G});
+    _C_H->mt = _recordProduct(CPS::A_div_B(CPS::C(Cf), CPS::H(Hf)), {_C}, {_H});
+    _D_A->mt = _recordProduct(CPS::A_div_B(CPS::D(Df), CPS::A(Af)), {_D}, {_A});
+    _D_B->mt = _recordProduct(CPS::A_div_B(CPS::D(Df), CPS::B(Bf)), {_D}, {_B});
+    _D_C->mt = _recordProduct(CPS::A_div_B(CPS::D(Df), CPS::C(Cf)), {_D}, {_C});
+    _D_E->mt = _recordProduct(CPS::A_div_B(CPS::D(Df), CPS::E(Ef)), {_D}, {_E});
+    _D_F->mt = _recordProduct(CPS::A_div_B(CPS::D(Df), CPS::F(Ff)), {_D}, {_F});
+    _D_G->mt = _recordProduct(CPS::A_div_B(CPS::D(Df), CPS::G(Gf)), {_D}, {_G});
+    _D_H->mt = _recordProduct(CPS::A_div_B(CPS::D(Df), CPS::H(Hf)), {_D}, {_H});
+    _E_A->mt = _recordProduct(CPS::A_div_B(CPS::E(Ef), CPS::A(Af)), {_E}, {_A});
+    _E_B->mt = _recordProduct(CPS::A_div_B(CPS::E(Ef), CPS::B(Bf)), {_E}, {_B});
+    _E_C->mt = _recordProduct(CPS::A_div_B(CPS::E(Ef), CPS::C(Cf)), {_E}, {_C});
+    _E_D->mt = _recordProduct(CPS::A_div_B(CPS::E(Ef), CPS::D(Df)), {_E}, {_D});
+    _E_F->mt = _recordProduct(CPS::A_div_B(CPS::E(Ef), CPS::F(Ff)), {_E}, {_F});
+    _E_G->mt = _recordProduct(CPS::A_div_B(CPS::E(Ef), CPS::G(Gf)), {_E}, {_G});
+    _E_H->mt = _recordProduct(CPS::A_div_B(CPS::E(Ef), CPS::H(Hf)), {_E}, {_H});
+    _F_A->mt = _recordProduct(CPS::A_div_B(CPS::F(Ff), CPS::A(Af)), {_F}, {_A});
+    _F_B->mt = _recordProduct(CPS::A_div_B(CPS::F(Ff), CPS::B(Bf)), {_F}, {_B});
+    _F_C->mt = _recordProduct(CPS::A_div_B(CPS::F(Ff), CPS::C(Cf)), {_F}, {_C});
+    _F_D->mt = _recordProduct(CPS::A_div_B(CPS::F(Ff), CPS::D(Df)), {_F}, {_D});
+    _F_E->mt = _recordProduct(CPS::A_div_B(CPS::F(Ff), CPS::E(Ef)), {_F}, {_E});
+    _F_G->mt = _recordProduct(CPS::A_div_B(CPS::F(Ff), CPS::G(Gf)), {_F}, {_G});
+    _F_H->mt = _recordProduct(CPS::A_div_B(CPS::F(Ff), CPS::H(Hf)), {_F}, {_H});
+    _G_A->mt = _recordProduct(CPS::A_div_B(CPS::G(Gf), CPS::A(Af)), {_G}, {_A});
+    _G_B->mt = _recordProduct(CPS::A_div_B(CPS::G(Gf), CPS::B(Bf)), {_G}, {_B});
+    _G_C->mt = _recordProduct(CPS::A_div_B(CPS::G(Gf), CPS::C(Cf)), {_G}, {_C});
+    _G_D->mt = _recordProduct(CPS::A_div_B(CPS::G(Gf), CPS::D(Df)), {_G}, {_D});
+    _G_E->mt = _recordProduct(CPS::A_div_B(CPS::G(Gf), CPS::E(Ef)), {_G}, {_E});
+    _G_F->mt = _recordProduct(CPS::A_div_B(CPS::G(Gf), CPS::F(Ff)), {_G}, {_F});
+    _G_H->mt = _recordProduct(CPS::A_div_B(CPS::G(Gf), CPS::H(Hf)), {_G}, {_H});
+    _H_A->mt = _recordProduct(CPS::A_div_B(CPS::H(Hf), CPS::A(Af)), {_H}, {_A});
+    _H_B->mt = _recordProduct(CPS::A_div_B(CPS::H(Hf), CPS::B(Bf)), {_H}, {_B});
+    _H_C->mt = _recordProduct(CPS::A_div_B(CPS::H(Hf), CPS::C(Cf)), {_H}, {_C});
+    _H_D->mt = _recordProduct(CPS::A_div_B(CPS::H(Hf), CPS::D(Df)), {_H}, {_D});
+    _H_E->mt = _recordProduct(CPS::A_div_B(CPS::H(Hf), CPS::E(Ef)), {_H}, {_E});
+    _H_F->mt = _recordProduct(CPS::A_div_B(CPS::H(Hf), CPS::F(Ff)), {_H}, {_F});
+    _H_G->mt = _recordProduct(CPS::A_div_B(CPS::H(Hf), CPS::G(Gf)), {_H}, {_G});
     //_one->mt  = CPS::A_div_B(CPS::A(1),                       CPS::A(1));
 
     auto ma = MicrotoneArray();
-    ma.addMicrotone(_one->mt);
+    ma.addMicrotone(_recordProduct(_one->mt, {})); // 1/1 has no terms
     ma.addMicrotone(_A_B->mt);
     ma.addMicrotone(_A_C->mt);
     ma.addMicrotone(_A_D->mt);
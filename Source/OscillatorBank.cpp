@@ -0,0 +1,465 @@
+/**
+ * @file OscillatorBank.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the OscillatorBank class.
+ */
+
+#include "OscillatorBank.h"
+#include <cmath>
+#include <JuceHeader.h>
+
+static constexpr double __pi = 3.14159265358979323846;
+
+#pragma mark - lifecycle
+
+OscillatorBank::OscillatorBank() {
+    _sine = getTable(Waveform::Sine, 0);
+    for(auto& tables : _table) {
+        tables.fill(_sine);
+    }
+    _g.fill(0.f);
+    _h.fill(1.f);
+    _ampRates = __rates(_ampEnvelope, _sampleRate);
+    _filterRates = __rates(_filterEnvelope, _sampleRate);
+}
+
+void OscillatorBank::prepare(double sampleRate) {
+    jassert(sampleRate > 0.0);
+    _sampleRate = sampleRate;
+    _inverseSampleRate = static_cast<float>(1.0 / sampleRate);
+    _ampRates = __rates(_ampEnvelope, _sampleRate);
+    _filterRates = __rates(_filterEnvelope, _sampleRate);
+    reset();
+}
+
+void OscillatorBank::reset() {
+    for(size_t v = 0; v < maxVoices; v++) {
+        _silence(v);
+        _sumSquares[v] = 0.f;
+        _peakSinceUpdate[v] = 0.f;
+        _rms[v] = 0.f;
+        _peak[v] = 0.f;
+    }
+    _meterSamples = 0;
+}
+
+#pragma mark - voices
+
+void OscillatorBank::noteOn(size_t voice, unsigned long noteNumber, float velocity) {
+    jassert(voice < maxVoices);
+    jassert(noteNumber < numNotes);
+    if(_active[voice] == 0) {
+        _silence(voice); // starts from a clean slate
+    }
+    _active[voice] = 1;
+    _noteNumber[voice] = noteNumber;
+    _velocity[voice] = velocity;
+    _isNewNote[voice] = 1;
+    __noteOn(_ampStage[voice], _ampValue[voice], _ampRates);
+    __noteOn(_filterStage[voice], _filterValue[voice], _filterRates);
+}
+
+void OscillatorBank::noteOff(size_t voice, bool allowTailOff) {
+    jassert(voice < maxVoices);
+    if(!allowTailOff) {
+        // juce::Synthesiser stops a voice this way before stealing or retriggering it: fade out instead of
+        // cutting mid-waveform, keeping phase and filter state, so a noteOn before the fade ends carries on from it
+        if(_active[voice] != 0 && _ampStage[voice] != Idle && _ampValue[voice] > 0.f) {
+            _ampReleaseRate[voice] = _ampValue[voice] / static_cast<float>(controlInterval);
+            _ampStage[voice] = Release;
+        } else {
+            // nothing to fade, i.e., stopped before it rendered a sample
+            _silence(voice);
+        }
+        return;
+    }
+    __noteOff(_ampStage[voice], _ampValue[voice], _ampReleaseRate[voice], _ampRates);
+    __noteOff(_filterStage[voice], _filterValue[voice], _filterReleaseRate[voice], _filterRates);
+}
+
+size_t OscillatorBank::getNumActiveVoices() const {
+    return static_cast<size_t>(std::count_if(_active.begin(), _active.end(), [](uint8_t a) { return a != 0; }));
+}
+
+void OscillatorBank::_silence(size_t v) {
+    _active[v] = 0;
+    _ampStage[v] = Idle;
+    _ampValue[v] = 0.f;
+    _filterStage[v] = Idle;
+    _filterValue[v] = 0.f;
+    _gain[v] = 0.f;
+    _gainStep[v] = 0.f;
+    _s1[v] = 0.f;
+    _s2[v] = 0.f;
+    for(size_t k = 0; k < numOscillators; k++) {
+        _phase[k][v] = 0.f;
+        _fmPhase[k][v] = 0.f;
+        _increment[k][v] = 0.f;
+        _targetIncrement[k][v] = 0.f;
+    }
+}
+
+bool OscillatorBank::_isGroupActive(size_t group) const {
+    for(size_t v = group; v < group + laneWidth; v++) {
+        if(_active[v] != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#pragma mark - parameters
+
+void OscillatorBank::setOscillator(size_t oscillator, Waveform waveform, float gainDecibels, int pitch, float fmFrequency, float fmDepth) {
+    jassert(oscillator < numOscillators);
+    jassert(waveform < Waveform::NumWaveforms);
+    _waveform[oscillator] = waveform;
+    _oscillatorGain[oscillator] = std::pow(10.f, gainDecibels / 20.f);
+    _pitch[oscillator] = pitch;
+    _fmFrequency[oscillator] = fmFrequency;
+    _fmDepth[oscillator] = fmDepth;
+}
+
+void OscillatorBank::setAmpEnvelope(const Envelope& envelope) {
+    _ampEnvelope = envelope;
+    _ampRates = __rates(envelope, _sampleRate);
+}
+
+void OscillatorBank::setFilterEnvelope(const Envelope& envelope) {
+    _filterEnvelope = envelope;
+    _filterRates = __rates(envelope, _sampleRate);
+}
+
+// juce::dsp::StateVariableTPTFilter: resonance 1/sqrt(2) is flat
+void OscillatorBank::setFilter(FilterType type, float cutoff, float resonance, float envelopeDepth) {
+    jassert(resonance > 0.f);
+    _filterR2 = 1.f / resonance;
+    _filterCutoff = cutoff;
+    _filterEnvelopeDepth = envelopeDepth;
+    _lowPass = type == FilterType::LowPass ? 1.f : 0.f;
+    _bandPass = type == FilterType::BandPass ? 1.f : 0.f;
+    _highPass = type == FilterType::HighPass ? 1.f : 0.f;
+}
+
+void OscillatorBank::setGlide(float seconds) {
+    _glideSeconds = std::max(0.f, seconds);
+}
+
+#pragma mark - envelopes
+
+// juce::ADSR's rates, per sample
+OscillatorBank::EnvelopeRates OscillatorBank::__rates(const Envelope& envelope, double sampleRate) {
+    EnvelopeRates retVal;
+    auto const sr = static_cast<float>(sampleRate);
+    retVal.sustain = std::clamp(envelope.sustain, 0.f, 1.f);
+    retVal.attack = envelope.attack > 0.f ? 1.f / (envelope.attack * sr) : 0.f;
+    retVal.decay = envelope.decay > 0.f ? (1.f - retVal.sustain) / (envelope.decay * sr) : 0.f;
+    retVal.release = envelope.release > 0.f ? 1.f / (envelope.release * sr) : 0.f;
+
+    return retVal;
+}
+
+// the attack starts from the current value, so a retriggered voice does not click
+void OscillatorBank::__noteOn(uint8_t& stage, float& value, const EnvelopeRates& rates) {
+    if(rates.attack > 0.f) {
+        stage = Attack;
+    } else if(rates.decay > 0.f) {
+        value = 1.f;
+        stage = Decay;
+    } else {
+        value = rates.sustain;
+        stage = Sustain;
+    }
+}
+
+void OscillatorBank::__noteOff(uint8_t& stage, float& value, float& releaseRate, const EnvelopeRates& rates) {
+    if(stage == Idle) {
+        return;
+    }
+    if(rates.release > 0.f && value > 0.f) {
+        releaseRate = value * rates.release;
+        stage = Release;
+    } else {
+        value = 0.f;
+        stage = Idle;
+    }
+}
+
+// advances an envelope by a number of samples, through as many stages as it takes
+void OscillatorBank::__advance(uint8_t& stage, float& value, float releaseRate, const EnvelopeRates& rates, float samples) {
+    while(samples > 0.f) {
+        switch(stage) {
+            case Attack:
+                value += rates.attack * samples;
+                if(value < 1.f) {
+                    return;
+                }
+                samples = (value - 1.f) / rates.attack; // left over
+                value = 1.f;
+                stage = rates.decay > 0.f ? Decay : Sustain;
+                break;
+            case Decay:
+                value -= rates.decay * samples;
+                if(value > rates.sustain) {
+                    return;
+                }
+                value = rates.sustain;
+                stage = Sustain;
+                return;
+            case Sustain:
+                value = rates.sustain;
+                return;
+            case Release:
+                value -= releaseRate * samples;
+                if(value <= 0.f) {
+                    value = 0.f;
+                    stage = Idle;
+                }
+                return;
+            case Idle:
+            default:
+                return;
+        }
+    }
+}
+
+#pragma mark - rendering
+
+void OscillatorBank::render(float* output, size_t numSamples) {
+    auto const withFM = std::any_of(_fmDepth.begin(), _fmDepth.end(), [](float d) { return d != 0.f; });
+    for(size_t group = 0; group < maxVoices; group += laneWidth) {
+        if(!_isGroupActive(group)) {
+            continue;
+        }
+        for(size_t s = 0; s < numSamples; s += controlInterval) {
+            auto const n = std::min(controlInterval, numSamples - s);
+            _control(group, n);
+            if(withFM) {
+                _renderGroup<true>(group, output + s, n);
+            } else {
+                _renderGroup<false>(group, output + s, n);
+            }
+        }
+
+        // voices whose amp envelope finished have ramped to 0
+        for(size_t v = group; v < group + laneWidth; v++) {
+            if(_active[v] != 0 && _ampStage[v] == Idle) {
+                _silence(v);
+            }
+        }
+    }
+    _meterSamples += numSamples;
+}
+
+void OscillatorBank::_control(size_t group, size_t numSamples) {
+    auto const samples = static_cast<float>(numSamples);
+    auto const nyquist = 0.45f * static_cast<float>(_sampleRate);
+    auto const pi = static_cast<float>(__pi);
+    auto const glides = _glideSeconds > 0.f;
+    auto const glide = glides ? 1.f - std::exp(-samples * _inverseSampleRate / _glideSeconds) : 0.f; // one-pole per interval
+    for(size_t v = group; v < group + laneWidth; v++) {
+        if(_active[v] == 0) {
+            _gain[v] = 0.f;
+            _gainStep[v] = 0.f;
+            continue;
+        }
+
+        // envelopes
+        __advance(_ampStage[v], _ampValue[v], _ampReleaseRate[v], _ampRates, samples);
+        __advance(_filterStage[v], _filterValue[v], _filterReleaseRate[v], _filterRates, samples);
+
+        // amp ramps to the envelope at the end of the interval
+        auto const target = _ampValue[v] * _velocity[v] * voiceGain;
+        _gainStep[v] = (target - _gain[v]) / samples;
+
+        // filter
+        auto const cutoff = std::clamp(_filterCutoff + _filterEnvelopeDepth * _filterValue[v], 20.f, nyquist);
+        auto const g = std::tan(pi * cutoff * _inverseSampleRate);
+        _g[v] = g;
+        _h[v] = 1.f / (1.f + _filterR2 * g + g * g);
+
+        // the table with the most harmonics below Nyquist at the highest frequency FM reaches
+        for(size_t k = 0; k < numOscillators; k++) {
+            if(glides) {
+                _increment[k][v] += glide * (_targetIncrement[k][v] - _increment[k][v]);
+            }
+            auto const increment = std::fabs(_increment[k][v]) + _fmDepth[k] * _inverseSampleRate;
+            _table[k][v] = getTable(_waveform[k], tableLevelForIncrement(increment));
+        }
+    }
+}
+
+/**
+ * @brief Renders a group's laneWidth voices for up to controlInterval samples, and adds their mix to output.
+ *
+ * The group's state is copied to locals, which cannot alias output, and the loop over the lanes has no
+ * branches, so it vectorizes.  Without FM the modulators are skipped.
+ */
+template<bool withFM>
+void OscillatorBank::_renderGroup(size_t group, float* output, size_t numSamples) {
+    using Lane = std::array<float, laneWidth>;
+    std::array<Lane, numOscillators> phase, fmPhase, increment;
+    std::array<std::array<const float*, laneWidth>, numOscillators> table;
+    Lane gain, gainStep, g, h, s1, s2, sumSquares, peak;
+    for(size_t i = 0; i < laneWidth; i++) {
+        auto const v = group + i;
+        for(size_t k = 0; k < numOscillators; k++) {
+            phase[k][i] = _phase[k][v];
+            fmPhase[k][i] = _fmPhase[k][v];
+            increment[k][i] = _increment[k][v];
+            table[k][i] = _table[k][v];
+        }
+        gain[i] = _gain[v];
+        gainStep[i] = _gainStep[v];
+        g[i] = _g[v];
+        h[i] = _h[v];
+        s1[i] = _s1[v];
+        s2[i] = _s2[v];
+        sumSquares[i] = _sumSquares[v];
+        peak[i] = _peakSinceUpdate[v];
+    }
+    std::array<float, numOscillators> fmIncrement, fmDepth;
+    for(size_t k = 0; k < numOscillators; k++) {
+        fmIncrement[k] = _fmFrequency[k] * _inverseSampleRate;
+        fmDepth[k] = _fmDepth[k] * _inverseSampleRate;
+    }
+    auto const R2 = _filterR2;
+    auto const lowPass = _lowPass;
+    auto const bandPass = _bandPass;
+    auto const highPass = _highPass;
+    auto const oscillatorGain = _oscillatorGain;
+
+    for(size_t s = 0; s < numSamples; s++) {
+        Lane out;
+        for(size_t i = 0; i < laneWidth; i++) {
+            auto y = 0.f;
+            for(size_t k = 0; k < numOscillators; k++) {
+                auto p = phase[k][i] + increment[k][i];
+                if constexpr(withFM) {
+                    fmPhase[k][i] = __wrap(fmPhase[k][i] + fmIncrement[k]);
+                    p += fmDepth[k] * __lookup(_sine, fmPhase[k][i]);
+                }
+                phase[k][i] = __wrap(p);
+                y += oscillatorGain[k] * __lookup(table[k][i], phase[k][i]);
+            }
+            auto const x = y * gain[i];
+            gain[i] += gainStep[i];
+
+            // topology-preserving transform state variable filter
+            auto const hp = h[i] * (x - s1[i] * (g[i] + R2) - s2[i]);
+            auto const bp = hp * g[i] + s1[i];
+            auto const lp = bp * g[i] + s2[i];
+            s1[i] = hp * g[i] + bp;
+            s2[i] = bp * g[i] + lp;
+            out[i] = lowPass * lp + bandPass * bp + highPass * hp;
+
+            sumSquares[i] += out[i] * out[i];
+            peak[i] = std::max(peak[i], std::fabs(out[i]));
+        }
+        auto mix = 0.f;
+        for(size_t i = 0; i < laneWidth; i++) {
+            mix += out[i];
+        }
+        output[s] += mix;
+    }
+
+    for(size_t i = 0; i < laneWidth; i++) {
+        auto const v = group + i;
+        for(size_t k = 0; k < numOscillators; k++) {
+            _phase[k][v] = phase[k][i];
+            _fmPhase[k][v] = fmPhase[k][i];
+        }
+        _gain[v] = gain[i];
+        _s1[v] = s1[i];
+        _s2[v] = s2[i];
+        _sumSquares[v] = sumSquares[i];
+        _peakSinceUpdate[v] = peak[i];
+    }
+}
+
+void OscillatorBank::updateMeters() {
+    auto const n = static_cast<float>(std::max<size_t>(_meterSamples, 1));
+    for(size_t v = 0; v < maxVoices; v++) {
+        _rms[v] = std::sqrt(_sumSquares[v] / n);
+        _peak[v] = _peakSinceUpdate[v];
+        _sumSquares[v] = 0.f;
+        _peakSinceUpdate[v] = 0.f;
+    }
+    _meterSamples = 0;
+}
+
+#pragma mark - wavetables
+
+const float* OscillatorBank::getTable(Waveform waveform, size_t level) {
+    static const std::vector<float> tables = __buildTables(); // once, shared
+    jassert(waveform < Waveform::NumWaveforms);
+    jassert(level < numTableLevels);
+    auto const index = static_cast<size_t>(waveform) * numTableLevels + level;
+
+    return tables.data() + index * (tableSize + 2);
+}
+
+size_t OscillatorBank::tableLevelForIncrement(float increment) {
+    if(!(increment > 0.f)) {
+        return numTableLevels - 1;
+    }
+    auto const harmonics = 0.5f / increment; // below Nyquist
+    if(harmonics < 2.f) {
+        return 0;
+    }
+
+    return std::min(static_cast<size_t>(std::ilogb(harmonics)), numTableLevels - 1); // floor(log2)
+}
+
+/**
+ * @brief Builds every table by additive synthesis: level l of a waveform has its harmonics 1...2^l.
+ *
+ * Each level is the one below plus the next octave of harmonics, and sin(h x) is read from a sine table at (h i) mod tableSize.
+ * Saw and square are the Fourier series of juce::dsp::Oscillator's x / pi and sign(x).
+ * Each table has 2 guard samples, so a lookup never wraps.
+ */
+std::vector<float> OscillatorBank::__buildTables() {
+    constexpr auto stride = tableSize + 2;
+    constexpr auto numWaveforms = static_cast<size_t>(Waveform::NumWaveforms);
+    std::vector<float> retVal(numWaveforms * numTableLevels * stride, 0.f);
+    std::vector<double> sine(tableSize);
+    for(size_t i = 0; i < tableSize; i++) {
+        sine[i] = std::sin(2.0 * __pi * static_cast<double>(i) / static_cast<double>(tableSize));
+    }
+    auto amplitude = [](Waveform waveform, size_t h) {
+        auto const hd = static_cast<double>(h);
+        switch(waveform) {
+            case Waveform::Sine: return h == 1 ? 1.0 : 0.0;
+            case Waveform::Saw: return (h % 2 == 1 ? 2.0 : -2.0) / (__pi * hd);
+            case Waveform::Square: return h % 2 == 1 ? 4.0 / (__pi * hd) : 0.0;
+            case Waveform::NumWaveforms:
+            default: return 0.0;
+        }
+    };
+    std::vector<double> sum(tableSize);
+    for(size_t w = 0; w < numWaveforms; w++) {
+        std::fill(sum.begin(), sum.end(), 0.0);
+        size_t h = 1;
+        for(size_t level = 0; level < numTableLevels; level++) {
+            for(; h <= (size_t(1) << level); h++) {
+                auto const a = amplitude(static_cast<Waveform>(w), h);
+                if(a == 0.0) {
+                    continue;
+                }
+                for(size_t i = 0; i < tableSize; i++) {
+                    sum[i] += a * sine[(h * i) % tableSize];
+                }
+            }
+            auto* table = retVal.data() + (w * numTableLevels + level) * stride;
+            for(size_t i = 0; i < tableSize; i++) {
+                table[i] = static_cast<float>(sum[i]);
+            }
+            table[tableSize] = table[0];
+            table[tableSize + 1] = table[1];
+        }
+    }
+
+    return retVal;
+}
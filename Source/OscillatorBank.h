@@ -0,0 +1,217 @@
+/**
+ * @file OscillatorBank.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the OscillatorBank class.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class OscillatorBank
+ * @brief Every voice of the synth, rendered together: two wavetable oscillators with FM, an amp and a filter
+ * envelope, and a state variable filter per voice.
+ *
+ * Voice state is stored as structure-of-arrays, one lane per voice, and voices are rendered laneWidth at a time:
+ * the per-sample loop over a group's lanes has no branches, so it vectorizes.  Envelopes and filter coefficients
+ * are updated every controlInterval samples, and the amp is ramped linearly between updates.  Groups with no
+ * active voice are skipped.
+ *
+ * The wavetables are band-limited: each waveform has a table per octave of harmonics, and each voice reads the
+ * table with the most harmonics below Nyquist for its frequency.  They are built once and shared.
+ *
+ * The voice count is fixed at maxVoices, and nothing is allocated after construction.  Every method but the
+ * constructor is called on the audio thread.
+ */
+class OscillatorBank final
+{
+public:
+    static constexpr size_t maxVoices = 128;
+    static constexpr size_t laneWidth = 8; // voices rendered together
+    static constexpr size_t numOscillators = 2;
+    static constexpr size_t numNotes = 128; // WilsonicProcessorConstants::numMidiNotes
+    static constexpr size_t controlInterval = 16; // samples between envelope and filter updates
+    static constexpr size_t tableSize = 2048;
+    static constexpr size_t numTableLevels = 11; // table level l has 2^l harmonics
+    static constexpr float voiceGain = 0.07f;
+    static_assert(maxVoices % laneWidth == 0, "voices are rendered in groups of laneWidth");
+
+    // the order of the SYNTHOSC1/2 choices
+    enum class Waveform : uint8_t {
+        Sine = 0,
+        Saw = 1,
+        Square = 2,
+        NumWaveforms
+    };
+
+    // the order of the SYNTHFILTERTYPE choices
+    enum class FilterType : uint8_t {
+        LowPass = 0,
+        BandPass = 1,
+        HighPass = 2
+    };
+
+    // like juce::ADSR::Parameters: times in seconds, sustain level in [0, 1]
+    struct Envelope {
+        float attack = 0.1f;
+        float decay = 0.1f;
+        float sustain = 1.f;
+        float release = 0.4f;
+    };
+
+    // lifecycle
+    OscillatorBank();
+    ~OscillatorBank() = default;
+    void prepare(double sampleRate);
+    void reset(); ///< Silences every voice
+
+    // voices
+    void noteOn(size_t voice, unsigned long noteNumber, float velocity);
+    void noteOff(size_t voice, bool allowTailOff); ///< allowTailOff false: fades out over one control interval
+    bool isVoiceActive(size_t voice) const { return _active[voice] != 0; }
+    unsigned long noteNumberAtVoice(size_t voice) const { return _noteNumber[voice]; }
+    float velocityAtVoice(size_t voice) const { return _velocity[voice]; }
+    float frequencyAtVoice(size_t voice) const { return _noteFrequency[voice]; }
+    float rmsAtVoice(size_t voice) const { return _rms[voice]; }
+    float peakAtVoice(size_t voice) const { return _peak[voice]; }
+    size_t getNumActiveVoices() const;
+
+    // parameters, shared by every voice
+    void setOscillator(size_t oscillator, Waveform waveform, float gainDecibels, int pitch, float fmFrequency, float fmDepth);
+    void setAmpEnvelope(const Envelope& envelope);
+    void setFilterEnvelope(const Envelope& envelope);
+    void setFilter(FilterType type, float cutoff, float resonance, float envelopeDepth);
+    void setGlide(float seconds); ///< Held notes glide to tuning changes.  0: they jump.
+
+    /**
+     * @brief Reads the frequency of every active voice's notes, i.e., from the tuning table.
+     * Call before render(), so held notes follow tuning changes.  With glide, held notes move to the new
+     * frequencies over the glide time; notes started since the last call start at theirs.
+     * @param frequencyOfNote unsigned long note number in [0, numNotes) -> Hz
+     */
+    template<typename F>
+    void updateFrequencies(F&& frequencyOfNote) {
+        for(size_t v = 0; v < maxVoices; v++) {
+            if(_active[v] == 0) {
+                continue;
+            }
+            _noteFrequency[v] = frequencyOfNote(_noteNumber[v]);
+            auto const jump = _glideSeconds <= 0.f || _isNewNote[v] != 0;
+            for(size_t k = 0; k < numOscillators; k++) {
+                auto const nn = std::clamp(static_cast<long>(_noteNumber[v]) + _pitch[k], 0L, static_cast<long>(numNotes) - 1);
+                _targetIncrement[k][v] = frequencyOfNote(static_cast<unsigned long>(nn)) * _inverseSampleRate;
+                if(jump) {
+                    _increment[k][v] = _targetIncrement[k][v];
+                }
+            }
+            _isNewNote[v] = 0;
+        }
+    }
+
+    // rendering
+    void render(float* output, size_t numSamples); ///< Adds the mono mix of the active voices to output
+    void updateMeters(); ///< After a block: the rms and peak of each voice since the last call
+
+    // wavetables
+    static const float* getTable(Waveform waveform, size_t level); ///< tableSize + 2 samples of one period
+    static size_t tableLevelForIncrement(float increment); ///< The level with the most harmonics below Nyquist
+
+private:
+    template<typename T> using Lanes = std::array<T, maxVoices>;
+
+    // envelope stages, like juce::ADSR
+    enum Stage : uint8_t { Idle = 0, Attack, Decay, Sustain, Release };
+    struct EnvelopeRates {
+        float attack = 0.f; // per sample, 0 = instant
+        float decay = 0.f;
+        float sustain = 1.f;
+        float release = 0.f; // 1 / (release samples), 0 = instant
+    };
+    static EnvelopeRates __rates(const Envelope& envelope, double sampleRate);
+    static void __noteOn(uint8_t& stage, float& value, const EnvelopeRates& rates);
+    static void __noteOff(uint8_t& stage, float& value, float& releaseRate, const EnvelopeRates& rates);
+    static void __advance(uint8_t& stage, float& value, float releaseRate, const EnvelopeRates& rates, float samples);
+
+    static std::vector<float> __buildTables();
+    static inline float __lookup(const float* table, float phase) { // phase in [0, 1]
+        auto const x = phase * static_cast<float>(tableSize);
+        auto const i = static_cast<size_t>(x);
+        auto const f = x - static_cast<float>(i);
+        return table[i] + f * (table[i + 1] - table[i]);
+    }
+    static inline float __wrap(float phase) { // to [0, 1), without floor()
+        auto const w = phase - static_cast<float>(static_cast<int>(phase));
+        return w < 0.f ? w + 1.f : w;
+    }
+
+    void _control(size_t group, size_t numSamples); // envelopes, amp ramps and filter coefficients for the next numSamples
+    template<bool withFM> void _renderGroup(size_t group, float* output, size_t numSamples);
+    void _silence(size_t voice);
+    bool _isGroupActive(size_t group) const;
+
+    // shared
+    const float* _sine = nullptr; // for FM
+    double _sampleRate = 44100.0;
+    float _inverseSampleRate = 1.f / 44100.f;
+    std::array<Waveform, numOscillators> _waveform {Waveform::Sine, Waveform::Sine};
+    std::array<float, numOscillators> _oscillatorGain {1.f, 1.f};
+    std::array<long, numOscillators> _pitch {0, 0};
+    std::array<float, numOscillators> _fmFrequency {0.f, 0.f}; // Hz
+    std::array<float, numOscillators> _fmDepth {0.f, 0.f}; // Hz
+    Envelope _ampEnvelope {};
+    Envelope _filterEnvelope {0.01f, 0.1f, 1.f, 0.1f};
+    EnvelopeRates _ampRates {};
+    EnvelopeRates _filterRates {};
+    float _filterR2 = 10.f; // 1 / resonance
+    float _filterCutoff = 20000.f;
+    float _filterEnvelopeDepth = 10000.f;
+    float _lowPass = 1.f;
+    float _bandPass = 0.f;
+    float _highPass = 0.f;
+    float _glideSeconds = 0.f;
+    size_t _meterSamples = 0;
+
+    // voices
+    alignas(32) Lanes<uint8_t> _active {};
+    alignas(32) Lanes<unsigned long> _noteNumber {};
+    alignas(32) Lanes<float> _velocity {};
+    alignas(32) Lanes<float> _noteFrequency {};
+    alignas(32) Lanes<uint8_t> _isNewNote {}; // since the last updateFrequencies(): does not glide
+
+    // oscillators
+    alignas(32) std::array<Lanes<float>, numOscillators> _phase {}; // [0, 1)
+    alignas(32) std::array<Lanes<float>, numOscillators> _fmPhase {};
+    alignas(32) std::array<Lanes<float>, numOscillators> _increment {}; // frequency / sample rate
+    alignas(32) std::array<Lanes<float>, numOscillators> _targetIncrement {}; // _increment glides to it
+    std::array<Lanes<const float*>, numOscillators> _table {};
+
+    // envelopes
+    alignas(32) Lanes<uint8_t> _ampStage {};
+    alignas(32) Lanes<float> _ampValue {};
+    alignas(32) Lanes<float> _ampReleaseRate {};
+    alignas(32) Lanes<uint8_t> _filterStage {};
+    alignas(32) Lanes<float> _filterValue {};
+    alignas(32) Lanes<float> _filterReleaseRate {};
+
+    // amp ramp and filter, per control interval
+    alignas(32) Lanes<float> _gain {};
+    alignas(32) Lanes<float> _gainStep {};
+    alignas(32) Lanes<float> _g {};
+    alignas(32) Lanes<float> _h {};
+    alignas(32) Lanes<float> _s1 {};
+    alignas(32) Lanes<float> _s2 {};
+
+    // meters
+    alignas(32) Lanes<float> _sumSquares {};
+    alignas(32) Lanes<float> _peakSinceUpdate {};
+    alignas(32) Lanes<float> _rms {};
+    alignas(32) Lanes<float> _peak {};
+};
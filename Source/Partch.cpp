@@ -497,6 +497,11 @@ void Partch::_paintPartch(WilsonicProcessor& processor, Graphics& g, Rectangle<i
     // Get the global transform for all drawing and mouse events
     auto const finalGralPaintTransform = _gralPaintTransform(); // we're locked in for the rest of this method
 
+#if JucePlugin_IsSynth
+    // One frame of voice states for every note of this paint
+    auto const& vs = processor.getVoiceStates();
+#endif
+
     // Lambda for painting
     auto paint = [&](unsigned long i, PartchMicrotone* note_mt) {
         jassert(note_mt != nullptr);
@@ -507,10 +512,9 @@ void Partch::_paintPartch(WilsonicProcessor& processor, Graphics& g, Rectangle<i
         bool voice_is_playing = false;
         auto voice_rms = 0.f;
 #if JucePlugin_IsSynth
-        // If the plugin is a synth, get the voice states
-        auto vs = processor.getVoiceStates();
+        // If the plugin is a synth, use the voice states
         if(!vs.noVoicesPlaying()) {
-            for (unsigned long vsi = 0; vsi < WilsonicProcessorConstants::numVoices; vsi++) {
+            for (unsigned long vsi = 0; vsi < WilsonicProcessorConstants::maxVoices; vsi++) {
                 auto const v = vs.voiceState[vsi];
                 auto const nnv = v.nn;
                 if (nnv == note_mt->getMidiNoteNumber()) {
@@ -17,6 +17,7 @@
 
 PartchComponent::PartchComponent(WilsonicProcessor& processor)
 : WilsonicAppTuningComponent(processor)
+, FrameTimer(this)
 , _scaleBubble(BubblePlacement::below, "P", "Partch Scales")
 {
     auto const pm = _processor.getPartchModel();
@@ -176,7 +177,7 @@ PartchComponent::PartchComponent(WilsonicProcessor& processor)
 }
 
 PartchComponent::~PartchComponent() {
-    stopTimer();
+    stopFrameTimer();
     _processor.getPartchModel()->removeActionListener(this);
     _processor.getAppTuningModel()->removeActionListener(this);
     _o1->removeListener(this);
@@ -371,7 +372,7 @@ void PartchComponent::actionListenerCallback(const String& message) {
 
 #pragma mark - Timer
 
-void PartchComponent::timerCallback() {
+void PartchComponent::frameCallback() {
     if (isShowing()) {
         _partchGraph->repaint();
     }
@@ -385,7 +386,7 @@ void PartchComponent::_timerHelper() {
 
     if (displayMode != Brun::DisplayMode::Gral)
     {
-        stopTimer();
+        stopFrameTimer();
         return;
     }
 */
@@ -395,9 +396,9 @@ void PartchComponent::_timerHelper() {
 //    auto const hz = AppExperiments::getFrameRateForNPO(npo);
     auto const hz = 20;
     if (hz > 0) {
-        startTimerHz(hz);
+        startFrameTimerHz(hz);
     } else {
-        stopTimer();
+        stopFrameTimer();
     }
 }
 
@@ -14,6 +14,7 @@
 #include "AppTuningModel.h"
 #include "BubbleDrawable.h"
 #include "DeltaComboBox.h"
+#include "FrameTimer.h"
 #include "PartchGraphComponent.h"
 #include "WilsonicAppTuningComponent.h"
 #include "WilsonicPitchWheelComponent.h"
@@ -23,7 +24,7 @@ class PartchComponent
 : public WilsonicAppTuningComponent
 , private ActionListener
 , private Button::Listener
-, private Timer
+, private FrameTimer
 {
 public:
     PartchComponent(WilsonicProcessor& processor);
@@ -51,7 +52,7 @@ private:
     // private methods
     void actionListenerCallback(const String& actionName) override;
     void _tuningChangedUpdateUI();
-    void timerCallback() override;
+    void frameCallback() override;
     void _timerHelper();
     void buttonClicked(Button* button) override;
 };
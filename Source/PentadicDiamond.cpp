@@ -226,30 +226,30 @@ void PentadicDiamond::update()
     auto const freqC = _C->getFrequencyValue();
     auto const freqD = _D->getFrequencyValue();
     auto const freqE = _E->getFrequencyValue();
-    _A_B->mt  = CPS::A_div_B(CPS::A(freqA), CPS::B(freqB));
-    _A_C->mt  = CPS::A_div_B(CPS::A(freqA), CPS::C(freqC));
-    _A_D->mt  = CPS::A_div_B(CPS::A(freqA), CPS::D(freqD));
-    _A_E->mt  = CPS::A_div_B(CPS::A(freqA), CPS::E(freqE));
-    _B_A->mt  = CPS::A_div_B(CPS::B(freqB), CPS::A(freqA));
-    _B_C->mt  = CPS::A_div_B(CPS::B(freqB), CPS::C(freqC));
-    _B_D->mt  = CPS::A_div_B(CPS::B(freqB), CPS::D(freqD));
-    _B_E->mt  = CPS::A_div_B(CPS::B(freqB), CPS::E(freqE));
-    _C_A->mt  = CPS::A_div_B(CPS::C(freqC), CPS::A(freqA));
-    _C_B->mt  = CPS::A_div_B(CPS::C(freqC), CPS::B(freqB));
-    _C_D->mt  = CPS::A_div_B(CPS::C(freqC), CPS::D(freqD));
-    _C_E->mt  = CPS::A_div_B(CPS::C(freqC), CPS::E(freqE));
-    _D_A->mt  = CPS::A_div_B(CPS::D(freqD), CPS::A(freqA));
-    _D_B->mt  = CPS::A_div_B(CPS::D(freqD), CPS::B(freqB));
-    _D_C->mt  = CPS::A_div_B(CPS::D(freqD), CPS::C(freqC));
-    _D_E->mt  = CPS::A_div_B(CPS::D(freqD), CPS::E(freqE));
-    _E_A->mt  = CPS::A_div_B(CPS::E(freqE), CPS::A(freqA));
-    _E_B->mt  = CPS::A_div_B(CPS::E(freqE), CPS::B(freqB));
-    _E_C->mt  = CPS::A_div_B(CPS::E(freqE), CPS::C(freqC));
-    _E_D->mt  = CPS::A_div_B(CPS::E(freqE), CPS::D(freqD));
+    _A_B->mt  = _recordProduct(CPS::A_div_B(CPS::A(freqA), CPS::B(freqB)), {_A}, {_B});
+    _A_C->mt  = _recordProduct(CPS::A_div_B(CPS::A(freqA), CPS::C(freqC)), {_A}, {_C});
+    _A_D->mt  = _recordProduct(CPS::A_div_B(CPS::A(freqA), CPS::D(freqD)), {_A}, {_D});
+    _A_E->mt  = _recordProduct(CPS::A_div_B(CPS::A(freqA), CPS::E(freqE)), {_A}, {_E});
+    _B_A->mt  = _recordProduct(CPS::A_div_B(CPS::B(freqB), CPS::A(freqA)), {_B}, {_A});
+    _B_C->mt  = _recordProduct(CPS::A_div_B(CPS::B(freqB), CPS::C(freqC)), {_B}, {_C});
+    _B_D->mt  = _recordProduct(CPS::A_div_B(CPS::B(freqB), CPS::D(freqD)), {_B}, {_D});
+    _B_E->mt  = _recordProduct(CPS::A_div_B(CPS::B(freqB), CPS::E(freqE)), {_B}, {_E});
+    _C_A->mt  = _recordProduct(CPS::A_div_B(CPS::C(freqC), CPS::A(freqA)), {_C}, {_A});
+    _C_B->mt  = _recordProduct(CPS::A_div_B(CPS::C(freqC), CPS::B(freqB)), {_C}, {_B});
+    _C_D->mt  = _recordProduct(CPS::A_div_B(CPS::C(freqC), CPS::D(freqD)), {_C}, {_D});
+    _C_E->mt  = _recordProduct(CPS::A_div_B(CPS::C(freqC), CPS::E(freqE)), {_C}, {_E});
+    _D_A->mt  = _recordProduct(CPS::A_div_B(CPS::D(freqD), CPS::A(freqA)), {_D}, {_A});
+    _D_B->mt  = _recordProduct(CPS::A_div_B(CPS::D(freqD), CPS::B(freqB)), {_D}, {_B});
+    _D_C->mt  = _recordProduct(CPS::A_div_B(CPS::D(freqD), CPS::C(freqC)), {_D}, {_C});
+    _D_E->mt  = _recordProduct(CPS::A_div_B(CPS::D(freqD), CPS::E(freqE)), {_D}, {_E});
+    _E_A->mt  = _recordProduct(CPS::A_div_B(CPS::E(freqE), CPS::A(freqA)), {_E}, {_A});
+    _E_B->mt  = _recordProduct(CPS::A_div_B(CPS::E(freqE), CPS::B(freqB)), {_E}, {_B});
+    _E_C->mt  = _recordProduct(CPS::A_div_B(CPS::E(freqE), CPS::C(freqC)), {_E}, {_C});
+    _E_D->mt  = _recordProduct(CPS::A_div_B(CPS::E(freqE), CPS::D(freqD)), {_E}, {_D});
     //_one->mt  = CPS::A_div_B(CPS::A(1),                       CPS::A(1));
 
     auto ma = MicrotoneArray();
-    ma.addMicrotone(_one->mt);
+    ma.addMicrotone(_recordProduct(_one->mt, {})); // 1/1 has no terms
     ma.addMicrotone(_A_B->mt);
     ma.addMicrotone(_A_C->mt);
     ma.addMicrotone(_A_D->mt);
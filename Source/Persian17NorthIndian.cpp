@@ -357,7 +357,7 @@ void Persian17NorthIndian::paint00(WilsonicProcessor& processor, Graphics& g, Re
 
 #if JucePlugin_IsSynth
     // optimization
-    auto vs = processor.getVoiceStates();
+    auto const& vs = processor.getVoiceStates();
     if(vs.noVoicesPlaying()) {
         return;
     }
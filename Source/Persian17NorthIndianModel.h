@@ -45,14 +45,14 @@ public:
     // public methods
     shared_ptr<Tuning> getTuning() override;
     int getNumScales();
-    StringArray getScaleNames();
+    static StringArray getScaleNames();
     int uiGetSelectedScaleIndex();
     void uiSetScale(int index = 0);
     // called only once: on construction of processor
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    static unique_ptr<AudioProcessorParameterGroup> createParams();
+    static String getGroupID();
+    static String getGroupName();
+    static String getSubgroupSeparator();
     ParameterID getDesignParameterID() override;
     StringArray getFavoritesParameterIDs() override;
     void attachParameterListeners() override;
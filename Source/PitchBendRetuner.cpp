@@ -0,0 +1,85 @@
+/**
+ * @file PitchBendRetuner.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the PitchBendRetuner class.
+ */
+
+#include "PitchBendRetuner.h"
+#include <algorithm>
+#include <JuceHeader.h>
+
+#pragma mark - configuration
+
+void PitchBendRetuner::setNumMemberChannels(int numMemberChannels) {
+    jassert(getNumActiveNotes() == 0);
+    _numMemberChannels = std::clamp(numMemberChannels, 1, maxMemberChannels);
+}
+
+void PitchBendRetuner::setBendRange(int semitones) {
+    jassert(getNumActiveNotes() == 0);
+    _bendRange = std::clamp(semitones, minBendRange, maxBendRange);
+}
+
+void PitchBendRetuner::reset() {
+    _voices.fill(Voice());
+    _order = 0;
+}
+
+#pragma mark - pitch bend
+
+int PitchBendRetuner::noteForFrequency(float frequency) {
+    if(!(frequency > 0.f) || std::isinf(frequency)) {
+        return 69;
+    }
+    auto const nn = 69.f + 12.f * std::log2(frequency / 440.f);
+
+    return std::clamp(static_cast<int>(std::lround(nn)), 0, 127);
+}
+
+int PitchBendRetuner::bendForFrequency(float frequency, int note, int bendRange) {
+    jassert(bendRange >= minBendRange);
+    if(!(frequency > 0.f) || std::isinf(frequency)) {
+        return bendCenter;
+    }
+    auto const nn = 69.f + 12.f * std::log2(frequency / 440.f);
+    auto const bend = static_cast<float>(bendCenter) + (nn - static_cast<float>(note)) / static_cast<float>(bendRange) * static_cast<float>(bendCenter);
+
+    return std::clamp(static_cast<int>(std::lround(bend)), 0, 16383);
+}
+
+#pragma mark - held notes
+
+int PitchBendRetuner::getNumActiveNotes() const {
+    return static_cast<int>(std::count_if(_voices.begin(), _voices.end(), [](auto const& v) { return v.isActive; }));
+}
+
+int PitchBendRetuner::getMemberChannelForNote(int inChannel, int inNote) const {
+    auto const v = _findVoice(inChannel, inNote);
+
+    return (v >= 0) ? _channelForVoice(static_cast<size_t>(v)) : 0;
+}
+
+int PitchBendRetuner::_findVoice(int inChannel, int inNote) const {
+    for(int v = 0; v < _numMemberChannels; v++) {
+        auto const& voice = _voices[static_cast<size_t>(v)];
+        if(voice.isActive && voice.inChannel == inChannel && voice.inNote == inNote) {
+            return v;
+        }
+    }
+
+    return -1;
+}
+
+// the free member channel that was released longest ago
+int PitchBendRetuner::_allocateVoice() {
+    int retVal = -1;
+    for(int v = 0; v < _numMemberChannels; v++) {
+        auto const& voice = _voices[static_cast<size_t>(v)];
+        if(!voice.isActive && (retVal < 0 || voice.releaseOrder < _voices[static_cast<size_t>(retVal)].releaseOrder)) {
+            retVal = v;
+        }
+    }
+
+    return retVal;
+}
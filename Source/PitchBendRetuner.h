@@ -0,0 +1,246 @@
+/**
+ * @file PitchBendRetuner.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the PitchBendRetuner class.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class PitchBendRetuner
+ * @brief Retunes MIDI in process, without MTS-ESP: each note is rewritten to its own MPE member channel,
+ * as the nearest 12ET note plus a 14-bit pitch bend to the frequency of the tuning table.
+ *
+ * MPE lower zone: channel 1 is the master channel, and channels 2...1+numMemberChannels are the member
+ * channels, one note each.  A new note gets the free member channel that was released longest ago, so
+ * release tails keep their bend.  When every member channel is busy, the steal policy either ends the
+ * oldest note, or drops the new one.  Channel messages other than notes are moved to the master channel,
+ * polyphonic pressure becomes the member channel's pressure, and system messages pass through.
+ *
+ * Messages are written to a sink, void(const uint8_t* data, int numBytes), in order.  Nothing allocates,
+ * so the whole class is safe on the audio thread.  Not thread safe: the audio thread owns it.
+ */
+class PitchBendRetuner final
+{
+public:
+    enum class StealPolicy {
+        Oldest = 0, // end the oldest note
+        None // drop the new note
+    };
+    static constexpr int masterChannel = 1; // 1-16
+    static constexpr int maxMemberChannels = 15;
+    static constexpr int defaultNumMemberChannels = 15;
+    static constexpr int minBendRange = 1; // semitones
+    static constexpr int maxBendRange = 96;
+    static constexpr int defaultBendRange = 48; // the MPE default for member channels
+    static constexpr int bendCenter = 8192;
+
+    // lifecycle
+    PitchBendRetuner() = default;
+    ~PitchBendRetuner() = default;
+
+    // configuration.  Changing it while notes are held strands them: call allNotesOff() first.
+    void setNumMemberChannels(int numMemberChannels); ///< 1...15
+    int getNumMemberChannels() const { return _numMemberChannels; }
+    void setBendRange(int semitones); ///< minBendRange...maxBendRange
+    int getBendRange() const { return _bendRange; }
+    void setStealPolicy(StealPolicy policy) { _stealPolicy = policy; }
+    StealPolicy getStealPolicy() const { return _stealPolicy; }
+    void reset(); ///< Forgets every note, without writing note offs
+
+    // the 14-bit pitch bend, and note, that sound frequency with this bend range
+    static int noteForFrequency(float frequency); ///< 0...127
+    static int bendForFrequency(float frequency, int note, int bendRange); ///< 0...16383
+
+    // the MPE configuration message and each member channel's pitch bend sensitivity
+    template<typename Sink>
+    void writeConfiguration(Sink&& sink) const;
+
+    /**
+     * @brief Rewrites one incoming message.
+     * @param data The raw message.
+     * @param numBytes The size of the message.
+     * @param frequencyForNote float(int nn), i.e., ScheduledTuning::getFrequency
+     * @param sink Receives the rewritten messages.
+     */
+    template<typename FrequencyForNote, typename Sink>
+    void process(const uint8_t* data, int numBytes, FrequencyForNote&& frequencyForNote, Sink&& sink);
+
+    // writes a pitch bend for every held note whose frequency changed, i.e., after the tuning changed
+    template<typename FrequencyForNote, typename Sink>
+    void updateBends(FrequencyForNote&& frequencyForNote, Sink&& sink);
+
+    // writes a note off for every held note
+    template<typename Sink>
+    void allNotesOff(Sink&& sink);
+
+    // held notes
+    int getNumActiveNotes() const;
+    int getMemberChannelForNote(int inChannel, int inNote) const; ///< 2-16, or 0 if not held
+
+private:
+    struct Voice {
+        bool isActive = false;
+        uint8_t inChannel = 0; // 1-16
+        uint8_t inNote = 0;
+        uint8_t outNote = 0;
+        int bend = bendCenter;
+        uint64_t startOrder = 0;
+        uint64_t releaseOrder = 0;
+    };
+    std::array<Voice, maxMemberChannels> _voices {};
+    int _numMemberChannels = defaultNumMemberChannels;
+    int _bendRange = defaultBendRange;
+    StealPolicy _stealPolicy = StealPolicy::Oldest;
+    uint64_t _order = 0;
+
+    static int _channelForVoice(size_t v) { return masterChannel + 1 + static_cast<int>(v); }
+    int _findVoice(int inChannel, int inNote) const; // -1 if not held
+    int _allocateVoice(); // -1 if every member channel is busy
+    template<typename Sink>
+    static void _write(Sink& sink, uint8_t status, int channel, int data1, int data2);
+    template<typename Sink>
+    static void _writeRpn(Sink& sink, int channel, int rpn, int msb, int lsb);
+    template<typename Sink>
+    void _noteOff(size_t v, int velocity, Sink& sink);
+};
+
+#pragma mark - template implementation
+
+template<typename Sink>
+void PitchBendRetuner::_write(Sink& sink, uint8_t status, int channel, int data1, int data2) {
+    uint8_t const message[3] {
+        static_cast<uint8_t>(status | ((channel - 1) & 0x0f)),
+        static_cast<uint8_t>(data1 & 0x7f),
+        static_cast<uint8_t>(data2 & 0x7f)
+    };
+    sink(message, (status == 0xc0 || status == 0xd0) ? 2 : 3);
+}
+
+template<typename Sink>
+void PitchBendRetuner::_writeRpn(Sink& sink, int channel, int rpn, int msb, int lsb) {
+    _write(sink, 0xb0, channel, 101, 0);
+    _write(sink, 0xb0, channel, 100, rpn);
+    _write(sink, 0xb0, channel, 6, msb);
+    _write(sink, 0xb0, channel, 38, lsb);
+    _write(sink, 0xb0, channel, 101, 127); // null rpn
+    _write(sink, 0xb0, channel, 100, 127);
+}
+
+template<typename Sink>
+void PitchBendRetuner::writeConfiguration(Sink&& sink) const {
+    _writeRpn(sink, masterChannel, 6, _numMemberChannels, 0); // MPE configuration message, lower zone
+    for(int v = 0; v < _numMemberChannels; v++) {
+        _writeRpn(sink, _channelForVoice(static_cast<size_t>(v)), 0, _bendRange, 0); // pitch bend sensitivity
+    }
+}
+
+template<typename Sink>
+void PitchBendRetuner::_noteOff(size_t v, int velocity, Sink& sink) {
+    auto& voice = _voices[v];
+    _write(sink, 0x80, _channelForVoice(v), voice.outNote, velocity);
+    voice.isActive = false;
+    voice.releaseOrder = ++_order;
+}
+
+template<typename FrequencyForNote, typename Sink>
+void PitchBendRetuner::process(const uint8_t* data, int numBytes, FrequencyForNote&& frequencyForNote, Sink&& sink) {
+    if(numBytes <= 0) {
+        return;
+    }
+    auto const status = static_cast<uint8_t>(data[0] & 0xf0);
+    auto const inChannel = (data[0] & 0x0f) + 1;
+
+    // system messages pass through
+    if(status < 0x80 || status == 0xf0) {
+        sink(data, numBytes);
+        return;
+    }
+    auto const data1 = (numBytes > 1) ? data[1] : 0;
+    auto const data2 = (numBytes > 2) ? data[2] : 0;
+    auto const isNoteOn = (status == 0x90 && data2 > 0);
+    auto const isNoteOff = (status == 0x80 || (status == 0x90 && data2 == 0));
+
+    if(isNoteOn) {
+        // retrigger
+        auto const held = _findVoice(inChannel, data1);
+        if(held >= 0) {
+            _noteOff(static_cast<size_t>(held), 64, sink);
+        }
+        auto v = _allocateVoice();
+        if(v < 0) {
+            if(_stealPolicy == StealPolicy::None) {
+                return;
+            }
+            // steal the oldest
+            v = 0;
+            for(int i = 1; i < _numMemberChannels; i++) {
+                if(_voices[static_cast<size_t>(i)].startOrder < _voices[static_cast<size_t>(v)].startOrder) {
+                    v = i;
+                }
+            }
+            _noteOff(static_cast<size_t>(v), 64, sink);
+        }
+        auto const frequency = frequencyForNote(data1);
+        auto const outNote = noteForFrequency(frequency);
+        auto& voice = _voices[static_cast<size_t>(v)];
+        voice.isActive = true;
+        voice.inChannel = static_cast<uint8_t>(inChannel);
+        voice.inNote = static_cast<uint8_t>(data1);
+        voice.outNote = static_cast<uint8_t>(outNote);
+        voice.bend = bendForFrequency(frequency, outNote, _bendRange);
+        voice.startOrder = ++_order;
+        auto const channel = _channelForVoice(static_cast<size_t>(v));
+        _write(sink, 0xe0, channel, voice.bend & 0x7f, voice.bend >> 7);
+        _write(sink, 0x90, channel, outNote, data2);
+    } else if(isNoteOff) {
+        auto const v = _findVoice(inChannel, data1);
+        if(v >= 0) {
+            _noteOff(static_cast<size_t>(v), (status == 0x80) ? data2 : 64, sink);
+        }
+    } else if(status == 0xa0) {
+        // polyphonic pressure -> the member channel's pressure
+        auto const v = _findVoice(inChannel, data1);
+        if(v >= 0) {
+            _write(sink, 0xd0, _channelForVoice(static_cast<size_t>(v)), data2, 0);
+        }
+    } else {
+        // all notes off and all sound off end the held notes, then go to the master channel like every other channel message
+        if(status == 0xb0 && (data1 == 120 || data1 == 123)) {
+            allNotesOff(sink);
+        }
+        _write(sink, status, masterChannel, data1, data2);
+    }
+}
+
+template<typename FrequencyForNote, typename Sink>
+void PitchBendRetuner::updateBends(FrequencyForNote&& frequencyForNote, Sink&& sink) {
+    for(size_t v = 0; v < static_cast<size_t>(_numMemberChannels); v++) {
+        auto& voice = _voices[v];
+        if(!voice.isActive) {
+            continue;
+        }
+        auto const bend = bendForFrequency(frequencyForNote(voice.inNote), voice.outNote, _bendRange);
+        if(bend != voice.bend) {
+            voice.bend = bend;
+            _write(sink, 0xe0, _channelForVoice(v), bend & 0x7f, bend >> 7);
+        }
+    }
+}
+
+template<typename Sink>
+void PitchBendRetuner::allNotesOff(Sink&& sink) {
+    for(size_t v = 0; v < static_cast<size_t>(_numMemberChannels); v++) {
+        if(_voices[v].isActive) {
+            _noteOff(v, 64, sink);
+        }
+    }
+}
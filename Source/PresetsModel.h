@@ -68,16 +68,16 @@ private:
 public:
     // Public methods
     shared_ptr<Tuning> getTuning() override;
-    StringArray getTuningPresetNames();
+    static StringArray getTuningPresetNames();
     unsigned long uiGetSelectedPresetIndex();
     void uiSetPreset(unsigned long index = 0);
 
     // Called only once: on construction of processor
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;
+    static unique_ptr<AudioProcessorParameterGroup> createParams();
 
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    static String getGroupID();
+    static String getGroupName();
+    static String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // Key for this design's Favorites array
     StringArray getFavoritesParameterIDs() override; // Used for Favorites
     // Called only once: when assigning _avpts
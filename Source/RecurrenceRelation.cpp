@@ -402,6 +402,12 @@ unsigned long RecurrenceRelation::getOffset()
 
 const string RecurrenceRelation::getLog()
 {
+    const ScopedLock sl(_lock);
+    if(_logIsStale)
+    {
+        _updateLog();
+    }
+
     return _log;
 }
 
@@ -411,45 +417,120 @@ void RecurrenceRelation::setOnDivergence(function<void()> completionBlock)
     _divergenceCompletionBlock = completionBlock;
 }
 
-// note the _log doubles as the scalaComments, so preprend "! " to each newline
+// each term is octave reduced once, and inserted into the sorted unique set, so a
+// term costs a binary search instead of reducing, sorting and uniquifying the whole sequence
 void RecurrenceRelation::_updateRecurrenceRelation()
 {
     // lock
     const ScopedLock sl(_lock);
 
-    // lambda for filtering
-    auto reap = [this](MicrotoneArray field)
+    // reset
+    _sequence.clear();
+    _reducedTerms.clear();
+    _finalScale = MicrotoneArray();
+    _finalScaleDescription.clear();
+    _logIsStale = true;
+    auto const minNumReducedTerms = _offset + _numberOfTerms;
+
+    // plant seeds(seeds are the initial conditions so don't use coefficients)
+    for(auto j = _j; j > 0; j--) // _j > _i > 0
     {
-        if(field.count() == 0)
-            return field;
-
-        auto retVal = MicrotoneArray(field); // copy
-        retVal = retVal.octaveReduce(getOctave());
-        retVal = retVal.sort();
-        retVal = retVal.uniquify();
-        return retVal;
-    };
-
-    // working variables
-    auto raw_ma      = MicrotoneArray(); // init with seeds to term, then accumulates a new term every iteration
-    auto filtered_ma = MicrotoneArray(); // filters raw_ma(octave reduce, sort, uniquify) every iteration
-    auto final_ma    = MicrotoneArray(); // takes final slice(offset, num_terms) of filtered_ma, then does final filter
-    auto log_final_scale = [this](MicrotoneArray ma)
+        auto seed = _seeds.microtoneAtIndex(j - 1);
+        _addTerm(seed->getFrequencyValue(), seed->clone());
+
+        // filtering initial seeds lets you do cool things
+        if(_reducedTerms.size() >= minNumReducedTerms && _updateFinalScale())
+        {
+            // calls super update
+            _outcome = Outcome::Seeds;
+            setMicrotoneArray(_finalScale);
+            return;
+        }
+    }
+
+    // if you made it here then _numberOfTerms >= _j << check
+
+    // now that _sequence has the seeds, iterate the recurrence relation
+    auto const ci = getValueForCoefficient(_coefficients[_i - 1]);
+    auto const cj = getValueForCoefficient(_coefficients[_j - 1]);
+    _outcome = Outcome::Diverged;
+    for(auto num_iterations = 0; num_iterations < __maxNumUpdateIterations; num_iterations++)
     {
-        _log += "\n!\n! Final Scale:\n!  ";
-        for(unsigned long ii = 0; ii < ma.count(); ii++)
+        auto const index = _sequence.size();
+        auto const f = ci * _sequence[index - _i] + cj * _sequence[index - _j];
+        if(std::isnan(f) || std::isinf(f) || f < 0)
+        {
+            break;
+        }
+        _addTerm(f, make_shared<Microtone>(f));
+        if(_reducedTerms.size() >= minNumReducedTerms && _updateFinalScale())
         {
-            auto mt = ma.microtoneAtIndex(ii);
-            _log += mt->getShortDescriptionText();
-            if(ii != ma.count() - 1)
-            {
-                _log += ", ";
-            }
+            _outcome = Outcome::Converged;
+            break;
         }
-        _log += "\n! ";
-    };
+    }
+
+    if(_outcome == Outcome::Diverged)
+    {
+        if(_divergenceCompletionBlock != nullptr)
+        {
+            _divergenceCompletionBlock();
+            return;
+        }
+        else
+        {
+            jassertfalse;
+            _updateFinalScale(); // whatever there is
+        }
+    }
+
+    // calls super update
+    setMicrotoneArray(_finalScale);
+}
+
+void RecurrenceRelation::_addTerm(float f, Microtone_p mt)
+{
+    _sequence.push_back(f);
+    mt->octaveReduce(getOctave());
+    auto const reduced = mt->getFrequencyValue();
+    auto it = std::lower_bound(_reducedTerms.begin(), _reducedTerms.end(), reduced, [](auto const& term, float value) {
+        return term.first < value;
+    });
+    if(it != _reducedTerms.end() && it->first == reduced) // unique by frequency, like MicrotoneArray::uniquify()
+    {
+        it->second = mt;
+    }
+    else
+    {
+        _reducedTerms.insert(it, {reduced, mt});
+    }
+}
+
+bool RecurrenceRelation::_updateFinalScale()
+{
+    // takes the slice(offset, num_terms) of the reduced terms, then does the final filter
+    auto slice = MicrotoneArray();
+    auto const end = std::min(_reducedTerms.size(), static_cast<size_t>(_offset + _numberOfTerms));
+    for(auto i = static_cast<size_t>(_offset); i < end; i++)
+    {
+        slice.addMicrotone(_reducedTerms[i].second->clone());
+    }
+    _finalScale = slice.octaveReduce(getOctave()).sort().uniquify();
+    _finalScaleDescription.clear();
+    for(unsigned long i = 0; i < _finalScale.count(); i++)
+    {
+        _finalScaleDescription.push_back(_finalScale.microtoneAtIndex(i)->getShortDescriptionText());
+    }
+
+    return _finalScale.count() >= _numberOfTerms;
+}
 
-    // init _log
+// note the _log doubles as the scalaComments, so preprend "! " to each newline
+void RecurrenceRelation::_updateLog()
+{
+    _logIsStale = false;
+
+    // the relation
     _log = "! H[n] = ";
     if(_coefficients[_i - 1] == Coefficient::_1)
     {
@@ -476,122 +557,46 @@ void RecurrenceRelation::_updateRecurrenceRelation()
     _log += to_string(_j);
     _log += "]\n! \n! Integer Sequence, including seeds:\n!  ";
 
-    // plant seeds(seeds are the initial conditions so don't use coefficients)
-    for(auto j = _j; j > 0; j--) // _j > _i > 0
+    // the sequence: the last term ends it, unless it diverged
+    for(size_t i = 0; i < _sequence.size(); i++)
     {
-        auto seed = _seeds.microtoneAtIndex(j - 1);
-        raw_ma.addMicrotone(seed);
-        _log += seed->getFrequencyValueDescription();
-
-        // filtering initial seeds lets you do cool things
-        filtered_ma = reap(raw_ma);
-        final_ma = MicrotoneArray(filtered_ma); // copy
-        final_ma = final_ma.subarrayWithRange(_offset, _numberOfTerms);
-        final_ma = final_ma.octaveReduce(getOctave());
-        final_ma = final_ma.sort();
-        final_ma = final_ma.uniquify();
-        auto const numTerms = final_ma.count();
-        if(numTerms >= _numberOfTerms)
-        {
-            // calls super update
-            log_final_scale(final_ma);
-            setMicrotoneArray(final_ma);
-            return;
-        }
-        else
-        {
-            if(j > 0)
-            {
-                _log += ", ";
-            }
-        }
-    }
-
-    // if you made it here then _numberOfTerms >= _j << check
-
-    // now that raw_ma has the seeds, iterate the recurrence relation(grow raw_ma and filter)
-    auto num_iterations = 0;
-    auto index = static_cast<unsigned long>(raw_ma.count());
-    for(num_iterations = 0; num_iterations < __maxNumUpdateIterations; num_iterations++)
-    {
-        auto const i   = index - _i;
-        auto const j   = index - _j;
-        auto const ci  = getValueForCoefficient(_coefficients[_i - 1]);
-        auto const cj  = getValueForCoefficient(_coefficients[_j - 1]);
-        auto const mti = raw_ma.microtoneAtIndex(i);
-        auto const mtj = raw_ma.microtoneAtIndex(j);
-        auto const f   = ci * mti->getFrequencyValue() + cj * mtj->getFrequencyValue();
-        if(std::isnan(f) || std::isinf(f) || f < 0)
-        {
-            _log += "\n! \n! Sequence did not converge.\n";
-            if(_divergenceCompletionBlock != nullptr)
-            {
-                _divergenceCompletionBlock();
-                return;
-            }
-            else
-            {
-                jassertfalse;
-            }
-        }
-        auto const mtf = make_shared<Microtone>(f);
-        raw_ma.addMicrotone(mtf);
-        _log += mtf->getFrequencyValueDescription();
-
-        filtered_ma = reap(raw_ma);
-        final_ma = MicrotoneArray(filtered_ma); // copy
-        final_ma = final_ma.subarrayWithRange(_offset, _numberOfTerms);
-        final_ma = final_ma.octaveReduce(getOctave());
-        final_ma = final_ma.sort();
-        final_ma = final_ma.uniquify();
-        auto const numTerms = final_ma.count();
-        if(numTerms >= _numberOfTerms)
-        {
-            break;
-        }
-        else
+        _log += Microtone::getFrequencyValueDescription(_sequence[i]);
+        if(i != _sequence.size() - 1 || _outcome == Outcome::Diverged)
         {
             _log += ", ";
         }
-
-        index++;
     }
 
-    if(num_iterations >= __maxNumUpdateIterations)
+    if(_outcome == Outcome::Diverged)
     {
         _log += "\n! \n! Sequence did not converge.\n";
         if(_divergenceCompletionBlock != nullptr)
         {
-            _divergenceCompletionBlock();
             return;
         }
-        else
-        {
-            jassertfalse;
-        }
     }
-    else
+    else if(_outcome == Outcome::Converged && _sequence.size() > 1)
+    {
+        // the two largest terms
+        auto largest = _sequence;
+        std::partial_sort(largest.begin(), largest.begin() + 2, largest.end(), std::greater<float>());
+        auto const f = largest[0] / largest[1];
+        auto const p = log2f(f);
+        _log += "\n! \n! Sequence converges to: \n!  F = ";
+        _log += to_string(f);
+        _log += "\n!  P = ";
+        _log += to_string(p);
+    }
+
+    // the final scale
+    _log += "\n!\n! Final Scale:\n!  ";
+    for(size_t i = 0; i < _finalScaleDescription.size(); i++)
     {
-        if(raw_ma.count() > 1)
+        _log += _finalScaleDescription[i];
+        if(i != _finalScaleDescription.size() - 1)
         {
-            raw_ma = raw_ma.sort();
-            auto const mt1 = raw_ma.microtoneAtIndex(raw_ma.count()-1);
-            auto const mt2 = raw_ma.microtoneAtIndex(raw_ma.count()-2);
-            auto const f1 = mt1->getFrequencyValue();
-            auto const f2 = mt2->getFrequencyValue();
-            auto const f =(f1 > f2) ? f1/f2 : f2/f1;
-            auto const p = log2f(f);
-            _log += "\n! \n! Sequence converges to: \n!  F = ";
-            _log += to_string(f);
-            _log += "\n!  P = ";
-            _log += to_string(p);
+            _log += ", ";
         }
     }
-
-    //
-    log_final_scale(final_ma);
-
-    // calls super update
-    setMicrotoneArray(final_ma);
+    _log += "\n! ";
 }
-
@@ -112,6 +112,9 @@ public:
 private:
     // private methods
     void _updateRecurrenceRelation();
+    void _addTerm(float f, Microtone_p mt); // adds mt, octave reduced, to _reducedTerms
+    bool _updateFinalScale(); // slices _reducedTerms into _finalScale, returns true if it has _numberOfTerms
+    void _updateLog(); // builds _log from the last update
 
     // private members
     unsigned long _indices {0}; // the index into the set of indices
@@ -120,6 +123,15 @@ private:
     vector<Coefficient> _coefficients {Coefficient::_1, Coefficient::_1, Coefficient::_1, Coefficient::_1, Coefficient::_1, Coefficient::_1, Coefficient::_1, Coefficient::_1, Coefficient::_1, Coefficient::_1}; // 0, 1-9, automatable
     unsigned long _numberOfTerms {7}; // automatable.  1 <= _numberOfTerms < WilsonicProcessorConstants::numMidiNotes
     unsigned long _offset {0}; // automatable
-    string _log;
     function<void()> _divergenceCompletionBlock;
+
+    // the last update.  The log is only built when it is asked for, because the sequence can be long.
+    enum class Outcome { Seeds, Converged, Diverged };
+    Outcome _outcome {Outcome::Seeds};
+    vector<float> _sequence; // including seeds
+    vector<pair<float, Microtone_p>> _reducedTerms; // _sequence octave reduced, sorted and unique by frequency
+    MicrotoneArray _finalScale;
+    vector<string> _finalScaleDescription; // descriptions as they were when the scale was made
+    string _log;
+    bool _logIsStale {true};
 };
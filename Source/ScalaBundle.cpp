@@ -0,0 +1,178 @@
+/**
+ * @file ScalaBundle.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the ScalaBundle class.
+ */
+
+#include "ScalaBundle.h"
+
+using F = ScalaBundleFormat;
+
+#pragma mark - lifecycle
+
+ScalaBundle::ScalaBundle(const void* data, size_t size)
+: _data(static_cast<const uint8_t*>(data))
+, _size(size) {
+    _isValid = _validate();
+    if(!_isValid) {
+        _numColumns = 0;
+        _numEntries = 0;
+    }
+}
+
+#pragma mark - columns
+
+int ScalaBundle::getNumColumns() const {
+    return static_cast<int>(_numColumns);
+}
+
+ScalaBundle::Column ScalaBundle::getColumn(int column_index) const {
+    jassert(column_index >= 0 && static_cast<uint32_t>(column_index) < _numColumns);
+    auto const p = _data + _columnsOffset + static_cast<uint32_t>(column_index) * F::columnSize;
+    Column c;
+    c.name = _text(p + F::ColumnName);
+    c.columnId = static_cast<int>(F::readU32(p + F::ColumnId));
+    c.width = static_cast<int>(F::readU32(p + F::ColumnWidth));
+    c.visible = p[F::ColumnVisible];
+    c.editable = p[F::ColumnEditable];
+    c.sortable = p[F::ColumnSortable];
+
+    return c;
+}
+
+#pragma mark - entries
+
+int ScalaBundle::getNumEntries() const {
+    return static_cast<int>(_numEntries);
+}
+
+int ScalaBundle::getID(int entry_index) const {
+    return static_cast<int>(F::readU32(_entry(entry_index) + F::EntryID));
+}
+
+string_view ScalaBundle::getText(int entry_index, int column_index) const {
+    jassert(column_index >= 0 && static_cast<uint32_t>(column_index) < _numColumns);
+    return _text(_entry(entry_index) + F::EntryTexts + static_cast<uint32_t>(column_index) * F::textSize);
+}
+
+string_view ScalaBundle::getFileName(int entry_index) const {
+    return _text(_entry(entry_index) + F::EntryTexts + _numColumns * F::textSize);
+}
+
+string_view ScalaBundle::getSclDescription(int entry_index) const {
+    return _text(_entry(entry_index) + F::EntryTexts + (_numColumns + 1) * F::textSize);
+}
+
+int ScalaBundle::getNumDegrees(int entry_index) const {
+    return static_cast<int>(F::readU32(_entry(entry_index) + F::EntryNumDegrees));
+}
+
+ScalaBundle::Degree ScalaBundle::getDegree(int entry_index, int degree_index) const {
+    auto const e = _entry(entry_index);
+    jassert(degree_index >= 0 && static_cast<uint32_t>(degree_index) < F::readU32(e + F::EntryNumDegrees));
+    auto const i = F::readU32(e + F::EntryFirstDegree) + static_cast<uint32_t>(degree_index);
+    auto const p = _data + _degreesOffset + i * F::degreeSize;
+    Degree d;
+    switch(_data[_degreeKindsOffset + i]) {
+        case F::Ratio32:
+            d.isRatio = true;
+            d.numerator = F::readU32(p);
+            d.denominator = F::readU32(p + 4);
+            break;
+        case F::Cents:
+            d.cents = F::bitsToDouble(F::readU64(p));
+            break;
+        default: { // F::Ratio64, index checked by _validate
+            auto const r = _data + _ratiosOffset + F::readU32(p) * F::ratioSize;
+            d.isRatio = true;
+            d.numerator = F::readU64(r);
+            d.denominator = F::readU64(r + 8);
+            break;
+        }
+    }
+
+    return d;
+}
+
+#pragma mark - private
+
+// checks that every section, and every reference in the columns and entries, is in bounds,
+// so the accessors don't have to
+bool ScalaBundle::_validate() {
+    if(_data == nullptr || _size < F::headerSize) {
+        return false;
+    }
+    if(memcmp(_data + F::Magic, F::magic, sizeof(F::magic)) != 0 || F::readU32(_data + F::Version) != F::version) {
+        return false;
+    }
+    _numColumns = F::readU32(_data + F::NumColumns);
+    _numEntries = F::readU32(_data + F::NumEntries);
+    _entryStride = F::readU32(_data + F::EntryStride);
+    _columnsOffset = F::readU32(_data + F::ColumnsOffset);
+    _entriesOffset = F::readU32(_data + F::EntriesOffset);
+    _degreesOffset = F::readU32(_data + F::DegreesOffset);
+    _numDegrees = F::readU32(_data + F::NumDegrees);
+    _degreeKindsOffset = F::readU32(_data + F::DegreeKindsOffset);
+    _ratiosOffset = F::readU32(_data + F::RatiosOffset);
+    _numRatios = F::readU32(_data + F::NumRatios);
+    _stringsOffset = F::readU32(_data + F::StringsOffset);
+    _stringsSize = F::readU32(_data + F::StringsSize);
+    if(_entryStride != F::entryStrideForColumns(_numColumns)) {
+        return false;
+    }
+
+    // sections
+    auto const inBounds = [this](uint64_t offset, uint64_t count, uint64_t size) {
+        return offset + count * size <= _size;
+    };
+    if(!inBounds(_columnsOffset, _numColumns, F::columnSize) ||
+       !inBounds(_entriesOffset, _numEntries, _entryStride) ||
+       !inBounds(_degreesOffset, _numDegrees, F::degreeSize) ||
+       !inBounds(_degreeKindsOffset, _numDegrees, 1) ||
+       !inBounds(_ratiosOffset, _numRatios, F::ratioSize) ||
+       !inBounds(_stringsOffset, _stringsSize, 1)) {
+        return false;
+    }
+
+    // references
+    auto const textInBounds = [this](const uint8_t* p) {
+        return uint64_t(F::readU32(p)) + F::readU32(p + 4) <= _stringsSize;
+    };
+    for(uint32_t i = 0; i < _numColumns; i++) {
+        if(!textInBounds(_data + _columnsOffset + i * F::columnSize + F::ColumnName)) {
+            return false;
+        }
+    }
+    for(uint32_t i = 0; i < _numDegrees; i++) {
+        auto const kind = _data[_degreeKindsOffset + i];
+        if(kind > F::Ratio64 || (kind == F::Ratio64 && F::readU32(_data + _degreesOffset + i * F::degreeSize) >= _numRatios)) {
+            return false;
+        }
+    }
+    for(uint32_t i = 0; i < _numEntries; i++) {
+        auto const e = _data + _entriesOffset + i * _entryStride;
+        if(uint64_t(F::readU32(e + F::EntryFirstDegree)) + F::readU32(e + F::EntryNumDegrees) > _numDegrees) {
+            return false;
+        }
+        for(uint32_t t = 0; t < _numColumns + F::entryExtraTexts; t++) {
+            if(!textInBounds(e + F::EntryTexts + t * F::textSize)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+const uint8_t* ScalaBundle::_entry(int entry_index) const {
+    jassert(entry_index >= 0 && static_cast<uint32_t>(entry_index) < _numEntries);
+    return _data + _entriesOffset + static_cast<uint32_t>(entry_index) * _entryStride;
+}
+
+string_view ScalaBundle::_text(const uint8_t* p) const {
+    auto const offset = F::readU32(p);
+    auto const length = F::readU32(p + 4);
+
+    return string_view(reinterpret_cast<const char*>(_data + _stringsOffset + offset), length);
+}
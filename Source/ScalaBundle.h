@@ -0,0 +1,78 @@
+/**
+ * @file ScalaBundle.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the ScalaBundle class.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <string_view>
+#include "ScalaBundleFormat.h"
+#include "ScalaFileTokenizer.h"
+#include "Tuning_Include.h"
+
+/**
+ * @class ScalaBundle
+ * @brief A read-only view of a binary scala bundle (see ScalaBundleFormat).
+ *
+ * Nothing is parsed or copied up front: the constructor only validates the header and the section
+ * bounds, and every accessor decodes a single field in place.  The bundle memory (BinaryData, or a
+ * memory-mapped file) must outlive this object.
+ */
+class ScalaBundle final
+{
+public:
+    using Degree = ScalaFileTokenizer::Degree; // pre-parsed by ScalaFileTokenizer
+
+    struct Column {
+        string_view name {};
+        int columnId = 0;
+        int width = 0;
+        int visible = 0;
+        int editable = 0;
+        int sortable = 0;
+    };
+
+    // lifecycle
+    ScalaBundle(const void* data, size_t size);
+    ~ScalaBundle() = default;
+
+    // validity: false if the data is not a bundle of this version, or is truncated
+    bool isValid() const { return _isValid; }
+
+    // columns
+    int getNumColumns() const;
+    Column getColumn(int column_index) const;
+
+    // entries, in bundle order
+    int getNumEntries() const;
+    int getID(int entry_index) const;
+    string_view getText(int entry_index, int column_index) const; ///< text of column column_index
+    string_view getFileName(int entry_index) const; ///< first comment line of the .scl
+    string_view getSclDescription(int entry_index) const; ///< comment lines and description line of the .scl
+    int getNumDegrees(int entry_index) const; ///< not counting the implicit 1/1
+    Degree getDegree(int entry_index, int degree_index) const;
+
+private:
+    const uint8_t* _data = nullptr;
+    size_t _size = 0;
+    bool _isValid = false;
+    uint32_t _numColumns = 0;
+    uint32_t _numEntries = 0;
+    uint32_t _entryStride = 0;
+    uint32_t _columnsOffset = 0;
+    uint32_t _entriesOffset = 0;
+    uint32_t _degreesOffset = 0;
+    uint32_t _numDegrees = 0;
+    uint32_t _degreeKindsOffset = 0;
+    uint32_t _ratiosOffset = 0;
+    uint32_t _numRatios = 0;
+    uint32_t _stringsOffset = 0;
+    uint32_t _stringsSize = 0;
+
+    bool _validate();
+    const uint8_t* _entry(int entry_index) const;
+    string_view _text(const uint8_t* p) const;
+};
@@ -0,0 +1,130 @@
+/**
+ * @file ScalaBundleFormat.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the on-disk layout of the binary scala bundle.
+ *
+ * Shared by the reader (ScalaBundle) and the generator (tools/make_scala_bundle), so it does not
+ * depend on JUCE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @class ScalaBundleFormat
+ * @brief Layout of Resources/scala_bundle_00_v1.bin.
+ *
+ * All integers are little-endian and every section starts on a 4-byte boundary, but nothing is
+ * assumed about the alignment or byte order of the buffer itself (BinaryData is a char array), so
+ * fields are read a byte at a time.
+ *
+ *     Header
+ *     Column  [numColumns]
+ *     Entry   [numEntries]   entryStride bytes each, in bundle ("ID") order
+ *     Degree  [numDegrees]   8 bytes each
+ *     uint8   [numDegrees]   DegreeKind of each Degree, padded to 4 bytes
+ *     Ratio   [numRatios]    { uint64 numerator, uint64 denominator }, for ratios that don't fit in 32 bits
+ *     char    [stringsSize]  interned UTF-8 strings, not NUL-terminated
+ *
+ * An Entry is { int32 ID, uint32 firstDegree, uint32 numDegrees, Text field[numColumns], Text fileName,
+ * Text sclDescription }, where field[i] is the text of column i.  fileName and sclDescription are what
+ * ScalaFileScl would have parsed from the Scala column.
+ *
+ * A Degree is { uint32 numerator, uint32 denominator } (Ratio32), a double (Cents), or a uint32 index
+ * into the Ratio table (Ratio64).  The implicit 1/1 is not stored.
+ */
+struct ScalaBundleFormat final
+{
+    static constexpr char magic[4] = {'W', 'S', 'C', 'B'};
+    static constexpr uint32_t version = 1;
+
+    // record sizes, in bytes
+    static constexpr uint32_t headerSize = 56;
+    static constexpr uint32_t columnSize = 20;
+    static constexpr uint32_t textSize = 8;
+    static constexpr uint32_t degreeSize = 8;
+    static constexpr uint32_t ratioSize = 16;
+    static constexpr uint32_t entryFixedSize = 12;
+    static constexpr uint32_t entryExtraTexts = 2; // fileName, sclDescription
+
+    static constexpr uint32_t entryStrideForColumns(uint32_t numColumns) {
+        return entryFixedSize + (numColumns + entryExtraTexts) * textSize;
+    }
+
+    // header field offsets
+    enum HeaderField : uint32_t {
+        Magic = 0,
+        Version = 4,
+        NumColumns = 8,
+        NumEntries = 12,
+        EntryStride = 16,
+        ColumnsOffset = 20,
+        EntriesOffset = 24,
+        DegreesOffset = 28,
+        NumDegrees = 32,
+        DegreeKindsOffset = 36,
+        RatiosOffset = 40,
+        NumRatios = 44,
+        StringsOffset = 48,
+        StringsSize = 52
+    };
+
+    enum DegreeKind : uint8_t {
+        Ratio32 = 0,
+        Cents = 1,
+        Ratio64 = 2
+    };
+
+    // column record: Text name, int32 columnId, int32 width, uint8 visible, uint8 editable, uint8 sortable, uint8 pad
+    enum ColumnField : uint32_t {
+        ColumnName = 0,
+        ColumnId = 8,
+        ColumnWidth = 12,
+        ColumnVisible = 16,
+        ColumnEditable = 17,
+        ColumnSortable = 18
+    };
+
+    // entry record
+    enum EntryField : uint32_t {
+        EntryID = 0,
+        EntryFirstDegree = 4,
+        EntryNumDegrees = 8,
+        EntryTexts = 12
+    };
+
+    static uint32_t readU32(const uint8_t* p) {
+        return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+    }
+
+    static uint64_t readU64(const uint8_t* p) {
+        return uint64_t(readU32(p)) | (uint64_t(readU32(p + 4)) << 32);
+    }
+
+    static void writeU32(uint8_t* p, uint32_t v) {
+        p[0] = uint8_t(v);
+        p[1] = uint8_t(v >> 8);
+        p[2] = uint8_t(v >> 16);
+        p[3] = uint8_t(v >> 24);
+    }
+
+    static void writeU64(uint8_t* p, uint64_t v) {
+        writeU32(p, uint32_t(v));
+        writeU32(p + 4, uint32_t(v >> 32));
+    }
+
+    static double bitsToDouble(uint64_t bits) {
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        return d;
+    }
+
+    static uint64_t doubleToBits(double d) {
+        uint64_t bits;
+        std::memcpy(&bits, &d, sizeof(d));
+        return bits;
+    }
+};
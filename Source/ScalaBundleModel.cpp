@@ -14,21 +14,11 @@
 
 ScalaBundleModel::ScalaBundleModel(File iconCacheDirectory)
 : _iconCacheDirectory(iconCacheDirectory) // File(String&)
+, _bundle(BinaryData::scala_bundle_00_v1_bin, static_cast<size_t>(BinaryData::scala_bundle_00_v1_binSize))
 {
-    // read bundled library xml from BinaryData
-    auto data = BinaryData::scala_bundle_00_v0_xml;
-    auto data_size = BinaryData::scala_bundle_00_v0_xmlSize;
-    //TODO: does this need to be UTF8?  see String class docs
-    String xmlContent(data, (size_t)data_size);
-    XmlDocument xmlDoc(xmlContent);
-    _scalaLibrary = xmlDoc.getDocumentElement();
-    
-    // must be a valid favorites library
-    jassert(_scalaLibrary != nullptr);
-    _dataList = _scalaLibrary->getChildByName ("DATA");
-    jassert(_dataList != nullptr);
-    _columnList = _scalaLibrary->getChildByName ("COLUMNS");
-    jassert(_columnList != nullptr);
+    // the bundle is read in place from BinaryData, and validating it only touches the index.
+    // generated from scala_bundle_00_v0.xml by tools/make_scala_bundle
+    jassert(_bundle.isValid());
     
     // visible columns have these flags:
     auto const visibleFlag =
@@ -38,26 +28,28 @@ ScalaBundleModel::ScalaBundleModel(File iconCacheDirectory)
     TableHeaderComponent::resizable |
     TableHeaderComponent::appearsOnColumnMenu |
     TableHeaderComponent::sortable;
-    for(auto* columnXml : _columnList->getChildIterator())
+    for(int i = 0; i < _bundle.getNumColumns(); i++)
     {
-        Columns c(columnXml->getStringAttribute("name"),
-                  columnXml->getIntAttribute("columnId"),
-                  columnXml->getIntAttribute("width"),
+        auto const column = _bundle.getColumn(i);
+        Columns c(String::fromUTF8(column.name.data(), static_cast<int>(column.name.size())),
+                  column.columnId,
+                  column.width,
                   50, // unused actually
                   400, // unused actually
                   visibleFlag, // overwritten later if visible == 0
                   -1, // insertIndex, unused
-                  columnXml->getIntAttribute("visible"),
-                  columnXml->getIntAttribute("editable"),
-                  columnXml->getIntAttribute("sortable")
+                  column.visible,
+                  column.editable,
+                  column.sortable
                   );
         _columns.push_back(c);
     }
     
     // _columns is never mutated after this
     
-    // debug
-    //_logXML();
+    // rows start in bundle order
+    _rows.resize(static_cast<size_t>(_bundle.getNumEntries()));
+    std::iota(_rows.begin(), _rows.end(), 0);
 }
 
 
@@ -84,57 +76,30 @@ shared_ptr<ScalaTuningImp> ScalaBundleModel::getScalaTuningForID(int ID)
 // nullptr is row is out of range
 shared_ptr<ScalaTuningImp> ScalaBundleModel::getScalaTuningForRow(int row_number)
 {
-    // xml is read-only, so no lock required
-    
     //DBG ("ScalaBundleModel::getScalaTuningForRow: row: " + String(row_number));
     
-    // get scala file text from column 8
-    auto scl_text = getText(row_number, 8);
-    auto scala_tuning = ScalaTuningImp::createScalaTuningFromSclString(scl_text);
+    // the bundle is read-only, but sorting permutes _rows
+    int entry = -1;
+    {
+        const ScopedLock sl(_lock);
+        if(row_number < 0 || row_number >= static_cast<int>(_rows.size()))
+        {
+            jassertfalse;
+            return nullptr;
+        }
+        entry = _rows[static_cast<size_t>(row_number)];
+    }
+    
+    // the degrees were parsed when the bundle was generated
+    auto scala_tuning = ScalaTuningImp::createScalaTuningFromScl(_decodeScl(entry));
     if(scala_tuning == nullptr)
     {
         DBG ("ScalaBundleModel::getScalaTuningForRow: row: " + String(row_number) + ": FATAL...can't parse file");
         jassertfalse;
     }
     
-    // this code duplicated from ScalaUserModel
+    // icons are created by getIcon, on a worker thread
     
-    // create icon if necessary
-    auto scl_file_name = _getIconFilename(row_number); // icon file name same as .scl
-    auto icon_file = _fullPathToIconFile(scl_file_name);
-    auto image = ImageFileFormat::loadFrom(icon_file);
-    if (!image.isValid())
-    {
-        //DBG ("ScalaBundleModel::getScalaTuningForRow: icon does not exist for: " + scl_file_name);
-        
-        // create bounds for icon
-        auto dim = ScalaIconRenderer::icon_dimension_render;
-        auto const bounds = Rectangle<int>(0, 0, dim, dim);
-        
-        // create image
-        Image icon_image(Image::ARGB, dim, dim, true);
-        
-        // create graphics context from image
-        Graphics g(icon_image);
-        
-        // paint pitch wheel onto graphics context
-        ScalaIconRenderer::paintPitchWheel(g, scala_tuning, bounds);
-        
-        // file output stream
-        FileOutputStream fstream(icon_file);
-        
-        // write png
-        PNGImageFormat png_writer;
-        auto const success = png_writer.writeImageToStream(icon_image, fstream);
-        
-        // successful?
-        if (!success)
-        {
-            DBG("ScalaBundleModel::getScalaTuningForRow: " + String(row_number) + "Error writing icon: " + icon_file.getFullPathName());
-            jassertfalse;
-        }
-    }
-        
     // selection state
     auto const ID = _getIDForRow(row_number);
     if(ID >= ScalaModel::getScalaBundledMinID() && ID <= ScalaModel::getScalaBundledMaxID())
@@ -236,7 +201,7 @@ int ScalaBundleModel::getNumRows()
     // lock
     const ScopedLock sl(_lock);
     
-    return _scalaLibrary->getChildByName("DATA")->getNumChildElements();
+    return static_cast<int>(_rows.size());
 }
 
 // this code duplicated from ScalaUserModel
@@ -246,15 +211,16 @@ int ScalaBundleModel::getColumnAutoSizeWidth(int columnId)
     const ScopedLock sl(_lock);
     
     auto widest = FavoritesIconRenderer::icon_dimension;
+    auto const column_index = _getColumnIndexForId(columnId);
     for(auto i = getNumRows(); --i >= 0;)
     {
         if(i == 2) // icon
         {
             return widest;
         }
-        else if(auto* rowElement = _dataList->getChildElement(i))
+        else if(column_index >= 0)
         {
-            auto text = rowElement->getStringAttribute(_getAttributeNameForColumnId(columnId));
+            auto text = _getEntryText(_rows[static_cast<size_t>(i)], column_index);
             widest = jmax(widest, _font.getStringWidth(text));
         }
     }
@@ -289,8 +255,10 @@ void ScalaBundleModel::sortOrderChanged(int new_sort_column_id, bool is_forwards
     const ScopedLock sl(_lock);
     
     // sort
-    ScalaLibraryDataSorter sorter(_getAttributeNameForColumnId(new_sort_column_id), is_forwards);
-    _dataList->sortChildElements(sorter);
+    ScalaBundleDataSorter sorter(*this, _getColumnIndexForId(new_sort_column_id), _getColumnIndexForId(1), is_forwards); // id 1 is ID
+    std::stable_sort(_rows.begin(), _rows.end(), [&sorter](int first, int second) {
+        return sorter.compareElements(first, second) < 0;
+    });
 }
 
 // this code duplicated from ScalaUserModel
@@ -300,9 +268,10 @@ String ScalaBundleModel::getText(int rowNumber, int columnId)
     const ScopedLock sl(_lock);
     
     //
-    if(auto* rowElement = _dataList->getChildElement(rowNumber))
+    auto const column_index = _getColumnIndexForId(columnId);
+    if(rowNumber >= 0 && rowNumber < static_cast<int>(_rows.size()) && column_index >= 0)
     {
-        auto text = rowElement->getStringAttribute(_getAttributeNameForColumnId(columnId));
+        auto text = _getEntryText(_rows[static_cast<size_t>(rowNumber)], column_index);
         
         return text;
     }
@@ -317,7 +286,12 @@ int ScalaBundleModel::getIsSelectedForRow(const int rowNumber) const
     const ScopedLock sl(_lock);
     
     // get selection
-    return _dataList->getChildElement(rowNumber)->getIntAttribute ("Select");
+    if(rowNumber < 0 || rowNumber >= static_cast<int>(_rows.size()))
+    {
+        return 0;
+    }
+    
+    return _rows[static_cast<size_t>(rowNumber)] == _selectedEntry ? 1 : 0;
 }
 
 // this code duplicated from ScalaUserModel
@@ -328,37 +302,40 @@ void ScalaBundleModel::selectRow(const int rowNumber)
     
     //DBG ("ScalaUserModel::setSelection: (" + String(rowNumber) + ")");
     
-    // can only select one item...if selecting this row: de-select all others and update _selectedID
-    for(auto data : _dataList->getChildIterator())
-    {
-        data->setAttribute("Select", 0);
-    }
-    
-    // select
-    _dataList->getChildElement(rowNumber)->setAttribute("Select", 1);
+    // can only select one item
+    jassert(rowNumber >= 0 && rowNumber < static_cast<int>(_rows.size()));
+    _selectedEntry = _rows[static_cast<size_t>(rowNumber)];
 }
 
 // this code duplicated from ScalaUserModel
-shared_ptr<Image> ScalaBundleModel::getIcon(int row_number)
+// returns the placeholder until the icon is loaded/rendered, then calls on_ready on the message thread
+shared_ptr<Image> ScalaBundleModel::getIcon(int row_number, IconService::Completion on_ready)
 {
-    // get icon if it exists
     auto icon_name = _getIconFilename(row_number);
-    auto icon_file = _fullPathToIconFile(icon_name);
-    if (! icon_file.existsAsFile())
+    auto const key = "scala_bundle/" + icon_name;
+    auto icon = _iconService->getCachedIcon(key);
+    if(icon != nullptr)
     {
-        // inefficient reuse of file import's creation of icon
-        auto lazy_way_to_make_an_icon = getScalaTuningForRow(row_number);
-        jassert(lazy_way_to_make_an_icon != nullptr);
+        return icon;
     }
     
-    // should be valid now
-    auto image = ImageFileFormat::loadFrom(icon_file);
-    if (! image.isValid())
+    // miss: the renderer gets its own copy of the degrees
+    int entry = -1;
     {
-        jassertfalse;
+        const ScopedLock sl(_lock);
+        if(row_number < 0 || row_number >= static_cast<int>(_rows.size()))
+        {
+            jassertfalse;
+            return _iconService->getPlaceholderIcon();
+        }
+        entry = _rows[static_cast<size_t>(row_number)];
     }
+    auto renderer = [scl = _decodeScl(entry)]()
+    {
+        return ScalaIconRenderer::renderPitchWheelIcon(ScalaTuningImp::createScalaTuningFromScl(scl));
+    };
     
-    return make_shared<Image>(std::move(image));
+    return _iconService->getIcon(key, _fullPathToIconFile(icon_name), renderer, std::move(on_ready));
 }
 
 #pragma mark - private methods
@@ -378,32 +355,44 @@ String ScalaBundleModel::_getIconFilename(int rowNumber)
     return getText(rowNumber, 3);  // id 3 is scala filename
 }
 
-// this code duplicated from ScalaUserModel
-void ScalaBundleModel::_logXML()
+// -1 if there is no column with this id
+int ScalaBundleModel::_getColumnIndexForId(const int columnId) const
 {
-    // lock
-    const ScopedLock sl(_lock);
+    for(size_t i = 0; i < _columns.size(); i++) // doesn't mutate, so no lock
+    {
+        if(_columns[i].columnId == columnId)
+            return static_cast<int>(i);
+    }
     
-    // default
-    auto root_as_xml = _scalaLibrary->toString();
-    DBG("ScalaBundleModel::_logXML: scala bundle library as xml string:");
-    DBG(root_as_xml);
-    DBG("");
+    return -1;
 }
 
-// this code duplicated from ScalaUserModel
-String ScalaBundleModel::_getAttributeNameForColumnId(const int columnId) const
+String ScalaBundleModel::_getEntryText(int entry, int column_index) const
 {
-    // lock
-    const ScopedLock sl(_lock);
+    auto const text = _bundle.getText(entry, column_index);
     
-    for(auto* columnXml : _columnList->getChildIterator())
+    return String::fromUTF8(text.data(), static_cast<int>(text.size()));
+}
+
+// rebuilds what ScalaFileScl would have parsed from the Scala column
+ScalaFileScl ScalaBundleModel::_decodeScl(int entry) const
+{
+    ScalaFileScl scl_file; // has the implicit 1/1
+    auto const num_degrees = _bundle.getNumDegrees(entry);
+    for(int i = 0; i < num_degrees; i++)
     {
-        if(columnXml->getIntAttribute ("columnId") == columnId)
-            return columnXml->getStringAttribute ("name");
+        auto const d = _bundle.getDegree(entry, i);
+        scl_file.add_degree(d.isRatio ? ScalaFileDegree(d.numerator, d.denominator) : ScalaFileDegree(d.cents));
     }
+    scl_file.set_filename(string(_bundle.getFileName(entry)));
+    scl_file.set_desc(string(_bundle.getSclDescription(entry)));
     
-    return {};
+    // the parser accumulates lines without their line feeds
+    auto scala_content = string(_bundle.getText(entry, _getColumnIndexForId(8))); // id 8 is Scala
+    scala_content.erase(std::remove(scala_content.begin(), scala_content.end(), '\n'), scala_content.end());
+    scl_file.add_scala_content(scala_content);
+    
+    return scl_file;
 }
 
 // this code duplicated from ScalaUserModel
@@ -412,15 +401,10 @@ int ScalaBundleModel::_getIDForRow(int row_number)
     // lock
     const ScopedLock sl(_lock);
     
-    int row = 0;
-    for(auto data : _dataList->getChildIterator())
+    if(row_number >= 0 && row_number < static_cast<int>(_rows.size()))
     {
-        if(row == row_number)
-        {
-            auto id_number = data->getIntAttribute("ID");
-            return id_number;
-        }
-        row++;
+        auto id_number = _bundle.getID(_rows[static_cast<size_t>(row_number)]);
+        return id_number;
     }
     
     // if you get here it's because you asked for an id that does not exist
@@ -435,9 +419,9 @@ int ScalaBundleModel::_getRowForID(int id_number)
     const ScopedLock sl(_lock);
     
     int row = 0;
-    for(auto data : _dataList->getChildIterator())
+    for(auto entry : _rows)
     {
-        auto id_row = data->getIntAttribute("ID");
+        auto id_row = _bundle.getID(entry);
         if(id_row == id_number)
         {
             return row;
@@ -445,6 +429,6 @@ int ScalaBundleModel::_getRowForID(int id_number)
         row++;
     }
     
-    // if you get here it's because you asked for an id that doesn't exist in _dataList
+    // if you get here it's because you asked for an id that doesn't exist in the bundle
     return -1;
 }
@@ -15,12 +15,15 @@ class ScalaBundleModel;
 #include <JuceHeader.h>
 #include "Columns.h"
 #include "FavoritesIconRenderer.h"
+#include "IconService.h"
+#include "ScalaBundle.h"
 #include "ScalaIconRenderer.h"
 #include "ScalaModelProtocol.h"
 #include "ScalaTuningImp.h"
 #include "Tuning_Include.h"
 
-// this class reads a "bundled" BinaryData xml file.
+// this class reads the "bundled" BinaryData binary scala bundle, see ScalaBundleFormat.h.
+// nothing is parsed at construction: rows are decoded from the bundle when they are asked for.
 
 class ScalaBundleModel final 
 : public ScalaModelProtocol
@@ -49,51 +52,57 @@ public:
     String getText(int row_number, int column_id) override;
     int getIsSelectedForRow(const int row_number) const override;
     void selectRow(const int row_number) override;
-    shared_ptr<Image> getIcon(int row_number) override;
+    shared_ptr<Image> getIcon(int row_number, IconService::Completion on_ready) override;
     
 private:
     // private members
     File _iconCacheDirectory;
     vector<Columns> _columns; // init at construction and never mutated
-    unique_ptr<XmlElement> _scalaLibrary; // OWNER
-    XmlElement* _columnList = nullptr;
-    XmlElement* _dataList = nullptr;
+    ScalaBundle _bundle; // view of BinaryData, never mutated
+    vector<int> _rows; // row number -> bundle entry index, permuted by sorting
+    int _selectedEntry = -1; // bundle entry index of the selected row
     int _selectedID = -1;
     Font _font {WilsonicAppSkin::tableViewFontSize};
     CriticalSection _lock;
+    SharedResourcePointer<IconService> _iconService;
     
     // private methods
     File _fullPathToIconFile(String file_name); // for icon
     String _getIconFilename(int row_number);
-    void _logXML();
-    String _getAttributeNameForColumnId(const int column_id) const;
+    int _getColumnIndexForId(const int column_id) const;
+    String _getEntryText(int entry, int column_index) const;
+    ScalaFileScl _decodeScl(int entry) const;
     int _getIDForRow(int row_number);
     int _getRowForID(int id_number);
     
     // private helper class
-    class ScalaLibraryDataSorter
+    class ScalaBundleDataSorter
     {
     public:
-        ScalaLibraryDataSorter(const String& attribute_to_sort_by, bool forwards)
-        : _attributeToSort(attribute_to_sort_by)
+        ScalaBundleDataSorter(const ScalaBundleModel& model, int column_index_to_sort_by, int id_column_index, bool forwards)
+        : _model(model)
+        , _columnIndexToSort(column_index_to_sort_by)
+        , _idColumnIndex(id_column_index)
         , _direction(forwards ? 1 : -1)
         {}
         
-        int compareElements(XmlElement* first, XmlElement* second) const
+        int compareElements(int first, int second) const
         {
-            auto result = first->getStringAttribute(_attributeToSort)
-                .compareNatural(second->getStringAttribute(_attributeToSort));
+            auto result = _model._getEntryText(first, _columnIndexToSort)
+                .compareNatural(_model._getEntryText(second, _columnIndexToSort));
             if(result == 0)
             {
-                result = first->getStringAttribute("ID")
-                    .compareNatural(second->getStringAttribute("ID"));
+                result = _model._getEntryText(first, _idColumnIndex)
+                    .compareNatural(_model._getEntryText(second, _idColumnIndex));
             }
             
             return _direction * result;
         }
         
     private:
-        String _attributeToSort;
+        const ScalaBundleModel& _model;
+        int _columnIndexToSort;
+        int _idColumnIndex;
         int _direction;
     };
 };
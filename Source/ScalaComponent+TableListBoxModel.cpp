@@ -185,7 +185,7 @@ void ScalaComponent::setSelection(const int rowNumber, const int /* newSelection
     _processor.getScalaModel()->selectRow(rowNumber);
 }
 
-shared_ptr<Image> ScalaComponent::getIcon(int rowNumber)
+shared_ptr<Image> ScalaComponent::getIcon(int rowNumber, IconService::Completion on_ready)
 {
-    return _processor.getScalaModel()->getIcon(rowNumber);
+    return _processor.getScalaModel()->getIcon(rowNumber, std::move(on_ready));
 }
@@ -14,6 +14,7 @@
 #include "AppTuningModel.h"
 #include "BubbleDrawable.h"
 #include "DeltaComboBox.h"
+#include "IconService.h"
 #include "Microtone.h"
 #include "ScalaComponentMessageBus.h"
 #include "ScalaIconRenderer.h"
@@ -109,7 +110,7 @@ private:
     int getSelection(const int rowNumber) const;
     void setSelection(const int rowNumber, const int newSelection);
     void buttonClicked(Button*) override;
-    shared_ptr<Image> getIcon(int rowNumber);
+    shared_ptr<Image> getIcon(int rowNumber, IconService::Completion on_ready);
     
     // private helper classes
     //==============================================================================
@@ -224,7 +225,21 @@ private:
         {
             _row = newRow;
             _columnId = newColumn;
-            auto ip = _owner.getIcon(_row);
+            _updateImage();
+        }
+        
+    private:
+        // the placeholder until the icon is loaded/rendered, then again when it's ready
+        void _updateImage()
+        {
+            auto on_ready = [safe = Component::SafePointer<ScalaIcon>(this), row = _row]()
+            {
+                if(safe != nullptr && safe->_row == row)
+                {
+                    safe->_updateImage();
+                }
+            };
+            auto ip = _owner.getIcon(_row, on_ready);
             if(ip != nullptr)
             {
                 auto rs = ip->rescaled(ScalaIconRenderer::tableviewHeight, ScalaIconRenderer::tableviewHeight);
@@ -232,12 +247,11 @@ private:
             }
             else
             {
-                // TODO: set default image
                 jassertfalse;
             }
         }
         
-    private:
+
         ScalaComponent& _owner;
         int _row, _columnId;
     };
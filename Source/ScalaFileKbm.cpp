@@ -21,91 +21,28 @@ ScalaFileKbm::ScalaFileKbm()
     octave_degree = 0;
 }
 
-ScalaFileKbm::ScalaFileKbm(ifstream& input_file)
+ScalaFileKbm::ScalaFileKbm(string_view input)
 : ScalaFileKbm()
 {
-    string buffer;
-    int current_entry = 0;
-    ScalaFileKbm keyboard_mapping;
-    regex COMMENT_REGEX = regex ("[ \t]*!.*");
-    regex EX = regex ("^[ \t]*[xX]{1}.*");
-
-    while(input_file)
+    // see ScalaFileTokenizer.  On failure is_valid() is false, and get_error() has the line number.
+    ScalaFileTokenizer::Kbm kbm;
+    ScalaFileTokenizer::Error parse_error;
+    valid = ScalaFileTokenizer::parseKbm(input, kbm, parse_error);
+    if(! valid)
     {
-        getline(input_file, buffer); // TODO: should this go up in the while loop to detect EOF?
-        if(regex_match(buffer, COMMENT_REGEX))
-        {
-            // Ignore comments
-        }
-        else if(regex_match(buffer, regex("[ \t]*") ))
-        {
-            // Blank line. If we're in strict mode this means end of file.
-            // Stop parsing.
-        }
-        else
-        {
-            switch(current_entry)
-            {
-                case MAP_SIZE:
-                    map_size = stoi(buffer);
-                    current_entry += 1;
-                    break;
-                case FIRST_NOTE:
-                    first_note = stoi(buffer);
-                    current_entry += 1;
-                    break;
-                case LAST_NOTE:
-                    last_note = stoi(buffer);
-                    current_entry += 1;
-                    break;
-                case MIDDLE_NOTE:
-                    middle_note = stoi(buffer);
-                    current_entry += 1;
-                    break;
-                case REFERENCE_NOTE:
-                    reference_note = stoi(buffer);
-                    current_entry += 1;
-                    break;
-                case REFERENCE_FREQUENCY:
-                    reference_frequency = stod(buffer);
-                    current_entry += 1;
-                    break;
-                case OCTAVE_DEGREE:
-                    octave_degree = stoi(buffer);
-                    current_entry += 1;
-                    break;
-                case ACTUAL_MAP:
-                    // This one is a little more complicated.  If we have an x
-                    if(regex_match(buffer, EX))
-                    {
-                        // A non-entry
-                        add_mapping(KBM_NON_ENTRY);
-                        jassertfalse;
-                    }
-                    else
-                    {
-                        // A mapping entry
-                        add_mapping(stoi(buffer));
-                    }
-            }
-        }
-    }
-
-    if(static_cast <size_t> (keyboard_mapping.map_size) != keyboard_mapping.mapping.size())
-    {
-#if 0
-        // This is an error, strict mode or not
-        if(static_cast <size_t> (keyboard_mapping.map_size) < keyboard_mapping.mapping.size())
-        {
-            throw runtime_error ("ERROR: Too few entries in mapping file");
-        }
-        else
-        {
-            throw runtime_error ("ERROR: Too many entries in mapping file");
-        }
-#endif
-        jassertfalse;
+        error = parse_error.toString();
+        DBG ("ScalaFileKbm: " + error);
+        return;
     }
+    
+    map_size = kbm.mapSize;
+    first_note = kbm.firstNote;
+    last_note = kbm.lastNote;
+    middle_note = kbm.middleNote;
+    reference_note = kbm.referenceNote;
+    reference_frequency = kbm.referenceFrequency;
+    octave_degree = kbm.octaveDegree;
+    mapping = std::move(kbm.mapping); // KBM_NON_ENTRY for "x"
 }
 
 ScalaFileKbm::~ScalaFileKbm()
@@ -127,6 +64,18 @@ ScalaFileKbm::ScalaFileKbm(const ScalaFileKbm &k2)
     middle_note = k2.middle_note;
     reference_note = k2.reference_note;
     octave_degree = k2.octave_degree;
+    valid = k2.valid;
+    error = k2.error;
+}
+
+bool ScalaFileKbm::is_valid()
+{
+    return valid;
+}
+
+string ScalaFileKbm::get_error()
+{
+    return error;
 }
 
 void ScalaFileKbm::add_mapping(int n)
@@ -11,6 +11,8 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <string_view>
+#include "ScalaFileTokenizer.h"
 #include "Tuning_Include.h"
 
 class ScalaFileKbm
@@ -28,13 +30,15 @@ public:
         ACTUAL_MAP
     };
 
-    static constexpr int KBM_NON_ENTRY = -1;
+    static constexpr int KBM_NON_ENTRY = ScalaFileTokenizer::kbmNonEntry;
 
     ScalaFileKbm();
-    ScalaFileKbm(ifstream& input_file);
+    explicit ScalaFileKbm(string_view input); // .kbm text, i.e., a memory-mapped file
     ~ScalaFileKbm();
     ScalaFileKbm(const ScalaFileKbm &k2);
     
+    bool is_valid(); // false if the input could not be parsed
+    string get_error(); // the parse error, with its line number
     void add_mapping(int n);
     double reference_frequency;
     int map_size;
@@ -44,4 +48,6 @@ public:
     int reference_note;
     int octave_degree;
     vector<int> mapping;
+    bool valid = true;
+    string error = "";
 };
@@ -13,201 +13,43 @@
 ScalaFileScl::ScalaFileScl ()
 {
     // The first degree is a scala file is always implicit. Make it explicit.
-    degrees.push_back( *(new ScalaFileDegree(0.0)));
+    degrees.push_back(ScalaFileDegree(0.0));
 }
 
-ScalaFileScl::ScalaFileScl(ifstream& input_file)
+ScalaFileScl::ScalaFileScl(string_view input)
 : ScalaFileScl()
 {
     /*
-     C++ Code to parse the Scala scale file, as documented here:
+     Parses the Scala scale file, as documented here:
      
      http://www.huygens-fokker.org/scala/scl_format.html
      
-     A couple of extensions:
-     
-     - Allow white-space before the comment character.  Spec is a little ambiguous.
-     - Allow blank lines. In the standard only the scale name is mentioned as potentially blank.
+     See ScalaFileTokenizer for the extensions.  On failure is_valid() is false,
+     and get_error() has the line number.
      */
+    ScalaFileTokenizer::Scl scl;
+    ScalaFileTokenizer::Error parse_error;
+    valid = ScalaFileTokenizer::parseScl(input, scl, parse_error);
+    if(! valid)
+    {
+        error = parse_error.toString();
+        DBG ("ScalaFileScl: " + error);
+        return;
+    }
     
-    // this guy wasn't clear that c++ regex "." does not match line feeds \r \n
-    
-    int non_comments_processed = 0;
-    //int entries = 0;
-    unsigned long long numerator = 1, denominator = 1;
-    string buffer;
-    smatch match, trimmed;
-    //bool description_parsed = false ;
-    bool file_name_parsed = false;
-    regex COMMENT_REGEX = regex ("[ \t]*!(.|\\r|\\n)*");
-    
-    while(getline(input_file, buffer)) // ends on EOF
+    degrees.reserve(scl.degrees.size() + 1);
+    for(auto const& d : scl.degrees)
     {
-        add_scala_content(buffer); // accumulate scala file
-        
-        //
-        if(regex_match(buffer, COMMENT_REGEX)) // ! desc
-        {
-            // We're defining a comment as the first non-whitespace character being a "!".
-            add_description(buffer);
-            
-            // the first comment is by convention the filename
-            if (!file_name_parsed)
-            {
-                file_name = "";
-                file_name += buffer;
-                file_name_parsed = true;
-            }
-        }
-        else if(regex_match(buffer, regex ("[ \t]*") ))
-        {
-            // Blank line. Discard. This may be an extension of the format.
-            if(non_comments_processed == 0)
-            {
-                //description_parsed = true;
-            }
-            non_comments_processed = non_comments_processed + 1;
-        }
-        else
-        {
-            // Extract the part after optional leading whitespace and before an optional space and label
-            regex_search(buffer, trimmed, regex ("([ \t]*)([^ \t]*)(.*)"));
-            string entry = trimmed[2];
-            if(non_comments_processed == 0)
-            {
-                // First non-comment is the description. Can be ignored
-                non_comments_processed = non_comments_processed + 1;
-                //description_parsed = true;
-                add_description(buffer);
-                continue;
-            }
-            else if(non_comments_processed == 1)
-            {
-                // TODO: we don't even need the number of entries really except for validation
-                // Second non-comment line contains the number of entries.
-                //entries  = stoi(entry);
-                non_comments_processed = non_comments_processed + 1;
-                continue;
-            }
-            else if(regex_match(entry, regex (".*[\\.]+.*[\\n|\\r]*") ))
-            {
-                // Cent values *must* have a period. It's the law.
-                double cents = stod(entry);
-                add_degree (*new ScalaFileDegree(cents));
-            }
-            else if(regex_match(entry, regex (".*[/]{1}.*[\\n|\\r]*") ))
-            {
-                // A ratio
-                regex_search(entry, match, regex ("(.*)/(.*)"));
-                numerator = stoull(match.str(1));
-                denominator = stoull(match.str(2));
-                add_degree (*new ScalaFileDegree(numerator, denominator));
-            }
-            else if(regex_match(entry, regex("^[0-9]+[\\r\\n]*$")))
-            {
-                // According to the standard, single numbers should be treated as ratios
-                numerator = stoull(entry);
-                denominator = 1;
-                add_degree (*new ScalaFileDegree(numerator, denominator));
-            }
-        }
+        add_degree(d.isRatio ? ScalaFileDegree(d.numerator, d.denominator) : ScalaFileDegree(d.cents));
     }
+    file_name = std::move(scl.fileName);
+    desc = std::move(scl.description);
+    scala_content = std::move(scl.content);
 }
 
-// this is so embarassing...so much duplicate code from above
 ScalaFileScl::ScalaFileScl(String in_input)
-: ScalaFileScl()
+: ScalaFileScl(string_view(in_input.toRawUTF8(), in_input.getNumBytesAsUTF8()))
 {
-    if(in_input.isEmpty())
-    {
-        DBG ("ScalaFileScl: input String is empty");
-        jassertfalse;
-    }
-    
-    string input = in_input.toStdString();
-    istringstream input_stream(input);
-    int non_comments_processed = 0;
-    //int entries = 0;
-    unsigned long long numerator = 1, denominator = 1;
-    string buffer;
-    smatch match, trimmed;
-    //bool description_parsed = false ;
-    bool file_name_parsed = false;
-    regex COMMENT_REGEX = regex ("[ \t]*!(.|\\r|\\n)*");
-    
-    while(getline(input_stream, buffer))
-    {
-        // accumulate scala file
-        add_scala_content(buffer);
-        
-        //
-        if(regex_match(buffer, COMMENT_REGEX)) // ! desc
-        {
-            // We're defining a comment as the first non-whitespace character being a "!".
-            add_description(buffer);
-            
-            // the first comment is by convention the filename
-            if (!file_name_parsed)
-            {
-                file_name = "";
-                file_name += buffer;
-                file_name_parsed = true;
-            }
-        }
-        else if(regex_match(buffer, regex ("[ \t]*") ))
-        {
-            // Blank line. Discard. This may be an extension of the format.
-            if(non_comments_processed == 0)
-            {
-                //description_parsed = true;
-            }
-            non_comments_processed = non_comments_processed + 1;
-        }
-        else
-        {
-            // Extract the part after optional leading whitespace and before an optional space and label
-            regex_search(buffer, trimmed, regex ("([ \t]*)([^ \t]*)(.*)"));
-            string entry = trimmed[2];
-            if(non_comments_processed == 0)
-            {
-                // First non-comment is the description. Can be ignored
-                non_comments_processed = non_comments_processed + 1;
-                //description_parsed = true;
-                add_description(buffer);
-                continue;
-            }
-            else if(non_comments_processed == 1)
-            {
-                // TODO: we don't even need the number of entries really except for validation
-                // Second non-comment line contains the number of entries.
-                //entries  = stoi(entry);
-                non_comments_processed = non_comments_processed + 1;
-                continue;
-            }
-            else if(regex_match(entry, regex (".*[\\.]+.*[\\n|\\r]*") ))
-            {
-                // Cent values *must* have a period. It's the law.
-                double cents = stod(entry);
-                add_degree (*new ScalaFileDegree(cents));
-            }
-            else if(regex_match(entry, regex (".*[/]{1}.*[\\n|\\r]*") ))
-            {
-                // A ratio
-                regex_search(entry, match, regex ("(.*)/(.*)"));
-                numerator = stoull(match.str(1));
-                denominator = stoull(match.str(2));
-                add_degree (*new ScalaFileDegree(numerator, denominator));
-            }
-            else if(regex_match(entry, regex ("^[0-9]+[\\r\\n]*$")))
-            {
-                // According to the standard, single numbers should be treated as ratios
-                numerator = stoull(entry);
-                denominator = 1;
-                add_degree (*new ScalaFileDegree(numerator, denominator));
-            }
-        }
-    }
-    
 }
 
 ScalaFileScl::~ScalaFileScl()
@@ -252,11 +94,13 @@ ScalaFileScl::~ScalaFileScl()
  */
 
 ScalaFileScl::ScalaFileScl(const ScalaFileScl &s2)
+: degrees(s2.degrees)
+, file_name(s2.file_name)
+, desc(s2.desc)
+, scala_content(s2.scala_content)
+, valid(s2.valid)
+, error(s2.error)
 {
-    for(size_t i = 0; i < s2.degrees.size(); i++)
-    {
-        degrees.push_back(s2.degrees[i]);
-    }
 }
 
 ScalaFileDegree ScalaFileScl::get_degree(size_t i)
@@ -291,6 +135,24 @@ string ScalaFileScl::get_filename()
     return file_name;
 }
 
+// false if the input could not be parsed
+bool ScalaFileScl::is_valid()
+{
+    return valid;
+}
+
+// "line 7: invalid pitch '3/0'", or empty if valid
+string ScalaFileScl::get_error()
+{
+    return error;
+}
+
+// set the filename
+void ScalaFileScl::set_filename(string fn)
+{
+    file_name = fn;
+}
+
 // return the cumulative comment content
 string ScalaFileScl::get_description()
 {
@@ -11,14 +11,16 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <string_view>
 #include "ScalaFileDegree.h"
+#include "ScalaFileTokenizer.h"
 #include "Tuning_Include.h"
 
 class ScalaFileScl
 {
 public:
     ScalaFileScl();
-    ScalaFileScl(std::ifstream& input_file);
+    explicit ScalaFileScl(string_view input); // .scl text, i.e., a memory-mapped file
     ScalaFileScl(String input);
     ScalaFileScl(const ScalaFileScl &s2);
     ~ScalaFileScl();
@@ -28,6 +30,12 @@ public:
     ScalaFileScl& operator=(ScalaFileScl&& other); // Move assignment operator
 */
 
+    // false if the input could not be parsed
+    bool is_valid();
+
+    // the parse error, with its line number
+    string get_error();
+
     // add a new degree
     void add_degree (ScalaFileDegree d);
 
@@ -37,6 +45,9 @@ public:
     // get the first comment, which is typically the filename
     string get_filename();
 
+    // set the filename, for scales that were parsed ahead of time
+    void set_filename (string fn);
+
     // return the cumulative comment content
     string get_description();
 
@@ -68,4 +79,6 @@ private:
     string file_name = "placeholder.scl";
     string desc = "";
     string scala_content = "";
+    bool valid = true;
+    string error = "";
 };
@@ -0,0 +1,253 @@
+/**
+ * @file ScalaFileTokenizer.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the ScalaFileTokenizer class.
+ */
+
+#include "ScalaFileTokenizer.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#pragma mark - LineReader
+
+/**
+ * @class ScalaFileTokenizer::LineReader
+ * @brief Splits text into lines (without the line ending) and classifies them.
+ */
+class ScalaFileTokenizer::LineReader
+{
+public:
+    explicit LineReader(std::string_view text) : _text(text) {}
+
+    // false at the end of the text
+    bool next() {
+        if(_pos >= _text.size()) {
+            return false;
+        }
+        auto end = _text.find('\n', _pos);
+        if(end == std::string_view::npos) {
+            end = _text.size();
+        }
+        line = _text.substr(_pos, end - _pos);
+        if(!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        _pos = end + 1;
+        lineNumber++;
+
+        // first token: after leading white-space, up to the next white-space
+        auto const first = line.find_first_not_of(" \t");
+        if(first == std::string_view::npos) {
+            token = {};
+        } else {
+            token = line.substr(first);
+            auto const last = token.find_first_of(" \t");
+            if(last != std::string_view::npos) {
+                token = token.substr(0, last);
+            }
+        }
+
+        return true;
+    }
+
+    bool isBlank() const { return token.empty(); }
+    bool isComment() const { return !token.empty() && token.front() == '!'; }
+
+    std::string_view line {};
+    std::string_view token {};
+    unsigned long lineNumber = 0;
+
+private:
+    std::string_view _text;
+    size_t _pos = 0;
+};
+
+#pragma mark - scl
+
+bool ScalaFileTokenizer::parseScl(std::string_view text, Scl& scl, Error& error) {
+    scl = Scl();
+    error = Error();
+    enum class Expect { Description, Count, Degree } expect = Expect::Description;
+    bool file_name_parsed = false;
+    LineReader reader(text);
+    while(reader.next()) {
+        scl.content.append(reader.line);
+        if(reader.isComment()) {
+            scl.description.append(reader.line).push_back('\n');
+            if(!file_name_parsed) {
+                scl.fileName.assign(reader.line);
+                file_name_parsed = true;
+            }
+        } else if(reader.isBlank()) {
+            // a blank description is allowed; other blank lines are ignored
+            if(expect == Expect::Description) {
+                expect = Expect::Count;
+            }
+        } else if(expect == Expect::Description) {
+            scl.description.append(reader.line).push_back('\n');
+            expect = Expect::Count;
+        } else if(expect == Expect::Count) {
+            unsigned long long count = 0;
+            if(!parseUnsigned(reader.token, count) || count > std::numeric_limits<unsigned long>::max()) {
+                error = {reader.lineNumber, "expected the number of notes, found '" + std::string(reader.token) + "'"};
+                return false;
+            }
+            scl.count = static_cast<unsigned long>(count);
+            scl.degrees.reserve(scl.count);
+            expect = Expect::Degree;
+        } else {
+            Degree degree;
+            if(!parseDegree(reader.token, degree)) {
+                error = {reader.lineNumber, "invalid pitch '" + std::string(reader.token) + "'"};
+                return false;
+            }
+            scl.degrees.push_back(degree);
+        }
+    }
+
+    if(text.empty()) {
+        error = {0, "file is empty"};
+        return false;
+    }
+    if(expect != Expect::Degree) {
+        error = {reader.lineNumber, "missing the number of notes"};
+        return false;
+    }
+    if(scl.degrees.size() != scl.count) {
+        error = {reader.lineNumber, "expected " + std::to_string(scl.count) + " notes, found " + std::to_string(scl.degrees.size())};
+        return false;
+    }
+
+    return true;
+}
+
+#pragma mark - kbm
+
+bool ScalaFileTokenizer::parseKbm(std::string_view text, Kbm& kbm, Error& error) {
+    kbm = Kbm();
+    error = Error();
+    int field = 0; // the 7 header fields, then the mapping
+    LineReader reader(text);
+    while(reader.next()) {
+        if(reader.isComment() || reader.isBlank()) {
+            continue;
+        }
+        auto const token = reader.token;
+        bool ok = true;
+        switch(field) {
+            case 0: ok = parseInt(token, kbm.mapSize) && kbm.mapSize >= 0 && kbm.mapSize <= 128; break; // WilsonicProcessorConstants::numMidiNotes
+            case 1: ok = parseInt(token, kbm.firstNote); break;
+            case 2: ok = parseInt(token, kbm.lastNote); break;
+            case 3: ok = parseInt(token, kbm.middleNote); break;
+            case 4: ok = parseInt(token, kbm.referenceNote); break;
+            case 5: ok = parseDouble(token, kbm.referenceFrequency) && kbm.referenceFrequency > 0; break;
+            case 6: ok = parseInt(token, kbm.octaveDegree); break;
+            default: {
+                if(static_cast<int>(kbm.mapping.size()) >= kbm.mapSize) {
+                    error = {reader.lineNumber, "more than " + std::to_string(kbm.mapSize) + " mapping entries"};
+                    return false;
+                }
+                int degree = kbmNonEntry;
+                ok = token == "x" || token == "X" || (parseInt(token, degree) && degree >= 0);
+                kbm.mapping.push_back(degree);
+                break;
+            }
+        }
+        if(!ok) {
+            static constexpr const char* names[] = {"map size", "first note", "last note", "middle note", "reference note", "reference frequency", "octave degree", "mapping entry"};
+            error = {reader.lineNumber, std::string("invalid ") + names[field < 7 ? field : 7] + " '" + std::string(token) + "'"};
+            return false;
+        }
+        field++;
+    }
+
+    if(field < 7) {
+        error = {reader.lineNumber, "missing header fields"};
+        return false;
+    }
+
+    // missing entries are unmapped
+    kbm.mapping.resize(static_cast<size_t>(kbm.mapSize), kbmNonEntry);
+
+    return true;
+}
+
+#pragma mark - tokens
+
+bool ScalaFileTokenizer::parseUnsigned(std::string_view token, unsigned long long& value) {
+    if(token.empty()) {
+        return false;
+    }
+    unsigned long long v = 0;
+    for(auto c : token) {
+        if(c < '0' || c > '9') {
+            return false;
+        }
+        auto const digit = static_cast<unsigned long long>(c - '0');
+        if(v > (std::numeric_limits<unsigned long long>::max() - digit) / 10) {
+            return false; // overflow
+        }
+        v = v * 10 + digit;
+    }
+    value = v;
+
+    return true;
+}
+
+bool ScalaFileTokenizer::parseInt(std::string_view token, int& value) {
+    auto const negative = !token.empty() && token.front() == '-';
+    if(negative) {
+        token.remove_prefix(1);
+    }
+    unsigned long long v = 0;
+    if(!parseUnsigned(token, v) || v > static_cast<unsigned long long>(std::numeric_limits<int>::max())) {
+        return false;
+    }
+    value = negative ? -static_cast<int>(v) : static_cast<int>(v);
+
+    return true;
+}
+
+// strtod needs a terminated string: the token is copied to the stack, not the heap
+bool ScalaFileTokenizer::parseDouble(std::string_view token, double& value) {
+    char buffer[64];
+    if(token.empty() || token.size() >= sizeof(buffer)) {
+        return false;
+    }
+    std::memcpy(buffer, token.data(), token.size());
+    buffer[token.size()] = '\0';
+    char* end = nullptr;
+    auto const v = std::strtod(buffer, &end);
+    if(end != buffer + token.size() || !std::isfinite(v)) {
+        return false;
+    }
+    value = v;
+
+    return true;
+}
+
+// "123.4" is cents (cents must have a period), "3/2" is a ratio, "3" is 3/1
+bool ScalaFileTokenizer::parseDegree(std::string_view token, Degree& degree) {
+    degree = Degree();
+    if(token.find('.') != std::string_view::npos) {
+        return parseDouble(token, degree.cents);
+    }
+    degree.isRatio = true;
+    auto const slash = token.find('/');
+    if(slash == std::string_view::npos) {
+        return parseUnsigned(token, degree.numerator) && degree.numerator > 0;
+    }
+
+    return parseUnsigned(token.substr(0, slash), degree.numerator) &&
+           parseUnsigned(token.substr(slash + 1), degree.denominator) &&
+           degree.numerator > 0 && degree.denominator > 0;
+}
+
+#pragma mark - Error
+
+std::string ScalaFileTokenizer::Error::toString() const {
+    return line > 0 ? "line " + std::to_string(line) + ": " + message : message;
+}
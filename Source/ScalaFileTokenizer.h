@@ -0,0 +1,86 @@
+/**
+ * @file ScalaFileTokenizer.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the ScalaFileTokenizer class.
+ *
+ * Shared by ScalaFileScl/ScalaFileKbm and the scala bundle generator (tools/make_scala_bundle),
+ * so it does not depend on JUCE.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class ScalaFileTokenizer
+ * @brief Single-pass parser for the Scala .scl and .kbm formats.
+ *
+ * See http://www.huygens-fokker.org/scala/scl_format.html and
+ * http://www.huygens-fokker.org/scala/help.htm#mappings
+ *
+ * The text is scanned in place: lines are string_views into it, and numbers are parsed without
+ * building strings, so nothing is allocated per line apart from the results themselves.
+ * LF and CRLF line endings are both accepted.
+ *
+ * Extensions, as before:
+ * - white-space before the comment character is allowed
+ * - blank lines are allowed anywhere (a blank line where the description is expected is an empty description)
+ *
+ * On failure the result is unspecified and error has the 1-based line number and a message.
+ */
+class ScalaFileTokenizer final
+{
+public:
+    /**
+     * @struct Degree
+     * @brief One pitch of a .scl.  Either a ratio (or integer, n/1), or cents.
+     */
+    struct Degree {
+        bool isRatio = false;
+        unsigned long long numerator = 1;
+        unsigned long long denominator = 1;
+        double cents = 0;
+    };
+
+    struct Scl {
+        std::string fileName {"placeholder.scl"}; // the first comment line, by convention "! name.scl"
+        std::string description {}; // comment lines and the description line, each followed by \n
+        std::string content {}; // every line, without line feeds
+        unsigned long count = 0; // declared number of notes
+        std::vector<Degree> degrees {}; // not including the implicit 1/1
+    };
+
+    static constexpr int kbmNonEntry = -1; // "x": key is not mapped
+
+    struct Kbm {
+        int mapSize = 0;
+        int firstNote = 0;
+        int lastNote = 0;
+        int middleNote = 0;
+        int referenceNote = 0;
+        double referenceFrequency = 0;
+        int octaveDegree = 0;
+        std::vector<int> mapping {}; // mapSize entries, kbmNonEntry for "x"
+    };
+
+    struct Error {
+        unsigned long line = 0; // 1-based, 0 if not specific to a line
+        std::string message {};
+        std::string toString() const; // "line 7: ..."
+    };
+
+    static bool parseScl(std::string_view text, Scl& scl, Error& error);
+    static bool parseKbm(std::string_view text, Kbm& kbm, Error& error);
+
+    // token parsers, exposed for tests: the whole token must be consumed
+    static bool parseUnsigned(std::string_view token, unsigned long long& value);
+    static bool parseInt(std::string_view token, int& value);
+    static bool parseDouble(std::string_view token, double& value);
+    static bool parseDegree(std::string_view token, Degree& degree);
+
+private:
+    class LineReader;
+};
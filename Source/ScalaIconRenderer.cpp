@@ -482,6 +482,21 @@ void ScalaIconRenderer::__debugDeleteAllIcons()
 
 #pragma mark - drawing
 
+// invalid Image if tuning is nullptr
+Image ScalaIconRenderer::renderPitchWheelIcon(shared_ptr<Tuning> tuning)
+{
+    if(tuning == nullptr)
+    {
+        return Image();
+    }
+    auto const bounds = Rectangle<int>(0, 0, icon_dimension_render, icon_dimension_render);
+    Image icon_image(Image::ARGB, icon_dimension_render, icon_dimension_render, true);
+    Graphics g(icon_image);
+    paintPitchWheel(g, tuning, bounds);
+    
+    return icon_image;
+}
+
 void ScalaIconRenderer::paintPitchWheel(Graphics& g, shared_ptr<Tuning> tuning, Rectangle<int> bounds)
 {
     // null tuning = NOP
@@ -48,6 +48,7 @@ public:
     
     // drawing
     static void paintPitchWheel(Graphics& g, shared_ptr<Tuning> tuning, Rectangle<int> bounds);
+    static Image renderPitchWheelIcon(shared_ptr<Tuning> tuning); // thread safe: used by IconService workers
     
     // debug
     static void __debugDeleteAllIcons();// user and codegen icon dirs get moved to the trash
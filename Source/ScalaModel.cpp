@@ -571,17 +571,17 @@ vector<Columns> ScalaModel::getColumns() {
     return _userScalaLibrary->getColumns();
 }
 
-shared_ptr<Image> ScalaModel::getIcon(int row_number) {
+shared_ptr<Image> ScalaModel::getIcon(int row_number, IconService::Completion on_ready) {
     const ScopedLock sl(_lock);
     if(_library == ScalaModel::Library::Bundled) {
         // lazily creates icon
-        auto image = _bundledScalaLibrary->getIcon(row_number);
+        auto image = _bundledScalaLibrary->getIcon(row_number, std::move(on_ready));
         jassert(image != nullptr);
         
         return image;
     } else {
         // lazily creates icon
-        auto image = _userScalaLibrary->getIcon(row_number);
+        auto image = _userScalaLibrary->getIcon(row_number, std::move(on_ready));
         jassert(image != nullptr);
         
         return image;
@@ -69,10 +69,10 @@ private:
     
 public:
     // ModelBase (public)
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    static unique_ptr<AudioProcessorParameterGroup> createParams();
+    static String getGroupID();
+    static String getGroupName();
+    static String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // key for this design's Favorites array
     StringArray getFavoritesParameterIDs() override; // used for Favorites
     void attachParameterListeners() override; // called only once: when assigning _avpts
@@ -112,7 +112,7 @@ public:
     int getIsSelectedForRow(const int rowNumber) const;
     void selectRow(const int rowNumber); // sets selectedID
     vector<Columns> getColumns();
-    shared_ptr<Image> getIcon(int rowNumber);
+    shared_ptr<Image> getIcon(int rowNumber, IconService::Completion on_ready);
     
 protected:
     void detachParameterListeners() override;
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "IconService.h"
 #include "ScalaTuningImp.h"
 
 // Abstract base class for methods common to ScalaUserModel and ScalaBundleModel
@@ -35,6 +36,6 @@ public:
     virtual int getIsSelectedForRow(const int row_number) const = 0;
     virtual void selectRow(const int row_number) = 0;
 
-    // lazily creates icon
-    virtual shared_ptr<Image> getIcon(int rowNumber) = 0;
+    // lazily creates icon, on a worker thread: the placeholder until on_ready is called
+    virtual shared_ptr<Image> getIcon(int rowNumber, IconService::Completion on_ready) = 0;
 };
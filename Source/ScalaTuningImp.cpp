@@ -14,11 +14,14 @@
 
 // static factory
 
-shared_ptr<ScalaTuningImp> ScalaTuningImp::createScalaTuningFromSclKbm(String full_path_to_scl, String full_path_to_kbm) {
+shared_ptr<ScalaTuningImp> ScalaTuningImp::createScalaTuningFromSclKbm(String full_path_to_scl, String full_path_to_kbm, String* error_message) {
     // validate path
     auto scl = File(full_path_to_scl);
     if(! scl.existsAsFile()) {
         DBG("ScalaTuningImp::createScalaTuning: Scala file does not exist: " + full_path_to_scl);
+        if(error_message != nullptr) {
+            *error_message = "file does not exist";
+        }
         
         return nullptr;
     }
@@ -29,81 +32,49 @@ shared_ptr<ScalaTuningImp> ScalaTuningImp::createScalaTuningFromSclKbm(String fu
         // TODO: actually handle kbm
     }
     
-    // parse
-    ifstream ifs;
-    ifs.open(full_path_to_scl.toRawUTF8()); // read file as a string
-    auto scl_file = ScalaFileScl(ifs);
-    ifs.close();
-    size_t const scale_length = scl_file.get_scale_length();
-    
-    // we can only handle WilsonicProcessorConstants::numMidiNotes notes
-    if(scale_length > WilsonicProcessorConstants::numMidiNotes) {
-        DBG("ScalaTuningImp::createScalaTuning: Invalid Scala file: " + full_path_to_scl);
-        DBG("ScalaTuningImp::createScalaTuning: Must have <= 128 notes per octave: " + String(scale_length));
-        
-        return nullptr;
-    }
-    
-    // validate repeating interval
-    auto const repeating_interval =(float)scl_file.get_period();
-    if(repeating_interval <= 0) {
-        DBG("ScalaTuningImp::createScalaTuning: Invalid repeating interval(" + String(repeating_interval) + ") in Scala file: " + full_path_to_scl);
-        
-        return nullptr;
-    }
-    
-    // we are all validated, now create return value
-    auto st = make_shared<ScalaTuningImp>();
-    st->_scalaFile.scl = scl_file;
+    // parse the file in place
+    MemoryMappedFile mapped_scl(scl, MemoryMappedFile::readOnly);
+    auto const scl_text = (mapped_scl.getData() != nullptr) ? string_view(static_cast<const char*>(mapped_scl.getData()), mapped_scl.getSize()) : string_view();
+    auto st = createScalaTuningFromScl(ScalaFileScl(scl_text), error_message);
     // st->scalaFile.kbm = kbm_file; // TODO: implement kbm
-    st->setScalaContent(scl_file.get_scala_content());
-    st->setTuningDescription(scl_file.get_description());
-    
-    // configure return value
-    st->setScalaFilename(scl.getFileName().toStdString());
-    if(scale_length == 1) { // only one degree: 1.0{
-        auto const repeatingInterval = 2.f; // default to 2...a period of 1 is problematic
-        st->setRepeatingInterval(repeatingInterval);
-        Microtone_p mt = make_shared<Microtone>(1, 1, "1", Microtone::Space::Linear, repeatingInterval);
-        auto ma = MicrotoneArray();
-        ma.addMicrotone(mt);
-        st->setMicrotoneArray(ma);
-    } else {
-        st->setRepeatingInterval(repeating_interval);
-        auto ma = MicrotoneArray();
-        for(size_t i = 0; i < scale_length - 1; i++) {
-            auto const d = scl_file.get_ratio(i);
-            auto desc = scl_file.get_desc(i);
-            Microtone_p d_mt = make_shared<Microtone>((float)d, desc, Microtone::Space::Linear, repeating_interval);
-            ma.addMicrotone(d_mt);
-        }
-        
-        // deep copy; calls _update
-        st->setMicrotoneArray(ma);
+    if(st != nullptr) {
+        st->setScalaFilename(scl.getFileName().toStdString());
     }
     
     //
     return st;
 }
 
-shared_ptr<ScalaTuningImp> ScalaTuningImp::createScalaTuningFromSclString(String scl_string) {
-    auto scl_file = ScalaFileScl(scl_string);
-    size_t const scale_length = scl_file.get_scale_length();
+shared_ptr<ScalaTuningImp> ScalaTuningImp::createScalaTuningFromSclString(String scl_string, String* error_message) {
+    return createScalaTuningFromScl(ScalaFileScl(scl_string), error_message);
+}
+
+// scl_file has already been parsed, i.e., from a file or the binary scala bundle
+shared_ptr<ScalaTuningImp> ScalaTuningImp::createScalaTuningFromScl(ScalaFileScl scl_file, String* error_message) {
+    auto const fail = [error_message](String message) -> shared_ptr<ScalaTuningImp> {
+        DBG("ScalaTuningImp::createScalaTuning: " + message);
+        if(error_message != nullptr) {
+            *error_message = message;
+        }
+        
+        return nullptr;
+    };
+    
+    // parse errors have line numbers
+    if(! scl_file.is_valid()) {
+        return fail(scl_file.get_error());
+    }
     
     // we can only handle WilsonicProcessorConstants::numMidiNotes notes
+    size_t const scale_length = scl_file.get_scale_length();
     if(scale_length > WilsonicProcessorConstants::numMidiNotes) {
-        DBG("ScalaTuningImp::createScalaTuning: Invalid Scala file: \n" + scl_string);
-        DBG("ScalaTuningImp::createScalaTuning: Must have <= 128 notes per octave: " + String(scale_length));
-        
-        return nullptr;
+        return fail("Must have <= 128 notes per octave: " + String(scale_length));
     }
     
     // validate repeating interval
     auto const repeating_interval =(float)scl_file.get_period();
     if(repeating_interval <= 0) {
-        DBG("ScalaTuningImp::createScalaTuning: Invalid repeating interval(" + String(repeating_interval) + ") in Scala file: \n" + scl_string);
-        
-        return nullptr;
+        return fail("Invalid repeating interval(" + String(repeating_interval) + ")");
     }
     
     // we are all validated, now create return value
@@ -510,6 +481,28 @@ String ScalaTuningImp::scalaComments() {
     return String(_scalaFile.scl.get_description());
 }
 
+#pragma mark - batch updates
+
+void ScalaTuningImp::beginUpdate() {
+    const ScopedLock sl(_lock);
+    _updateDepth++;
+}
+
+void ScalaTuningImp::endUpdate() {
+    const ScopedLock sl(_lock);
+    jassert(_updateDepth > 0);
+    _updateDepth = jmax(0, _updateDepth - 1);
+    if(_updateDepth == 0 && _updateIsPending) {
+        _updateIsPending = false;
+        _update();
+    }
+}
+
+uint64_t ScalaTuningImp::getUpdateCount() {
+    const ScopedLock sl(_lock);
+    return _updateCount;
+}
+
 #pragma mark - drawing
 
 // default is false because a tuning must implement a custom paint method(below)
@@ -551,6 +544,12 @@ void ScalaTuningImp::_update() {
     // Lock to prevent other threads from accessing the same data simultaneously
     const ScopedLock sl(_lock);
 
+    // inside a batch: defer to endUpdate
+    if(_updateDepth > 0) {
+        _updateIsPending = true;
+        return;
+    }
+
     // Create a deep copy of the microtone array before processing
     _processedArray = MicrotoneArray(_microtoneArray);
 
@@ -627,6 +626,7 @@ void ScalaTuningImp::_update() {
 
         // No scale analysis for this case
     }
+    _updateCount++;
 
     // Call the post-process block
     callPostProcessBlock();
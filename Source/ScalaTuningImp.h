@@ -25,9 +25,10 @@ class ScalaTuningImp
 : public Tuning
 {
 public:
-    // static factory methods...returns nullptr if invalid
-    static shared_ptr<ScalaTuningImp> createScalaTuningFromSclKbm(String full_path_to_scl, String full_path_to_kbm);
-    static shared_ptr<ScalaTuningImp> createScalaTuningFromSclString(String scl_string);
+    // static factory methods...returns nullptr if invalid, and the reason in error_message (with the line number for parse errors)
+    static shared_ptr<ScalaTuningImp> createScalaTuningFromSclKbm(String full_path_to_scl, String full_path_to_kbm, String* error_message = nullptr);
+    static shared_ptr<ScalaTuningImp> createScalaTuningFromSclString(String scl_string, String* error_message = nullptr);
+    static shared_ptr<ScalaTuningImp> createScalaTuningFromScl(ScalaFileScl scl_file, String* error_message = nullptr);
     
     // lifecycle
     ScalaTuningImp();
@@ -175,6 +176,11 @@ public:
     // drawing
     bool canPaintTuning() override;
     void paint(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bounds) override;
+
+    // batch updates
+    void beginUpdate() override;
+    void endUpdate() override;
+    uint64_t getUpdateCount() override;
     
     // string helper
     friend ostream& operator <<(ostream&, ScalaTuningImp& m);
@@ -276,6 +282,11 @@ private:
     // lock
     CriticalSection _lock;
     
+    // batch updates: _update() is deferred while _updateDepth > 0
+    int _updateDepth = 0;
+    bool _updateIsPending = false;
+    uint64_t _updateCount = 0; // incremented by _update()
+
     // private methods
     void _update() override;
     
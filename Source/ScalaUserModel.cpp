@@ -128,7 +128,6 @@ shared_ptr<ScalaTuningImp> ScalaUserModel::getScalaTuningForID(int ID)
 }
 
 // Return ScalaTuningImp of Scala file at row_number.
-// Lazily creates icon for both bundled and user.
 shared_ptr<ScalaTuningImp> ScalaUserModel::getScalaTuningForRow(int row_number)
 {
     // lock
@@ -156,50 +155,18 @@ shared_ptr<ScalaTuningImp> ScalaUserModel::getScalaTuningForRow(int row_number)
     }
     
     // parse the scala file and create the Tuning
-    auto scala_tuning = ScalaTuningImp::createScalaTuningFromSclKbm(scl_file.getFullPathName(), scl_file.getFullPathName()); // TODO: KBM
+    String error_message;
+    auto scala_tuning = ScalaTuningImp::createScalaTuningFromSclKbm(scl_file.getFullPathName(), scl_file.getFullPathName(), &error_message); // TODO: KBM
     if(scala_tuning == nullptr)
     {
-        auto debug = "ScalaUserModel::getScalaTuningForRow: row: " + String(row_number) + ", file_name:" + scl_file_name + ": FATAL...can't parse file";
+        auto debug = "ScalaUserModel::getScalaTuningForRow: row: " + String(row_number) + ", file_name:" + scl_file_name + ": FATAL...can't parse file: " + error_message;
         DBG(debug);
-        ScalaComponentMessageBus::getInstance().broadcastMessage("Can not parse User Scala file: " + scl_file_name + ", at row: " + String(row_number));
+        ScalaComponentMessageBus::getInstance().broadcastMessage("Can not parse User Scala file: " + scl_file_name + ", at row: " + String(row_number) + ": " + error_message);
         
         return nullptr;
     }
     
-    // this code duplicated in ScalaBundleModel
-    
-    // create icon if necessary
-    auto icon_file = _fullPathToIconFile(scl_file_name);
-    auto image = ImageFileFormat::loadFrom(icon_file);
-    if(!image.isValid())
-    {
-        // create bounds for icon
-        auto dim = ScalaIconRenderer::icon_dimension_render;
-        auto const bounds = Rectangle<int> (0, 0, dim, dim);
-        
-        // create image
-        Image icon_image(Image::ARGB, dim, dim, true);
-        
-        // create graphics context from image
-        Graphics g(icon_image);
-        
-        // paint pitch wheel onto graphics context
-        ScalaIconRenderer::paintPitchWheel(g, scala_tuning, bounds);
-        
-        // file output stream
-        FileOutputStream fstream(icon_file);
-        
-        // write png
-        PNGImageFormat png_writer;
-        auto const success = png_writer.writeImageToStream(icon_image, fstream);
-        
-        // successful?
-        if (!success)
-        {
-            DBG("ScalaUserModel::getScalaTuningForRow: " + String(row_number) + "Error writing icon: " + icon_file.getFullPathName());
-            ScalaComponentMessageBus::getInstance().broadcastMessage("Internal Error: Can not create icon: " + icon_file.getFullPathName());
-        }
-    }
+    // icons are created by getIcon, on a worker thread
     
     // selection state
     auto const ID = getIDForRow(row_number);
@@ -334,6 +301,7 @@ bool ScalaUserModel::deleteScalaTuningAtRow(int row_number)
     {
         icon_file.moveToTrash();
     }
+    _iconService->removeIcon("scala_user/" + scl_file_name);
     
     // delete the element
     _dataList->removeChildElement(child, true);
@@ -390,7 +358,7 @@ unordered_map<int, int> ScalaUserModel::getIntegrityCheck()
 
 // Given .scl and optional .kbm:
 //   creates new SCALA child with attributes ID, Icon, Period, NPO, Description
-// Does NOT create icon asset--that happens lazily in getScalaTuningForRow
+// Does NOT create icon asset--that happens lazily in getIcon
 bool ScalaUserModel::addScalaKbm(File scl_file, File kbm_file)
 {
     auto scl_file_name = scl_file.getFileName();
@@ -408,12 +376,13 @@ bool ScalaUserModel::addScalaKbm(File scl_file, File kbm_file)
     }
     
     // parse the scala file and create the Tuning
-    auto scala_tuning = ScalaTuningImp::createScalaTuningFromSclKbm(scl_full_path, kbm_full_path);
+    String error_message;
+    auto scala_tuning = ScalaTuningImp::createScalaTuningFromSclKbm(scl_full_path, kbm_full_path, &error_message);
     if(scala_tuning == nullptr)
     {
-        auto debug = "ScalaUserModel::addScalaKbm: cannot create tuning because " + scl_file_name + ": is invalid";
+        auto debug = "ScalaUserModel::addScalaKbm: cannot create tuning because " + scl_file_name + ": is invalid: " + error_message;
         DBG(debug);
-        ScalaComponentMessageBus::getInstance().broadcastMessage("Can not create User Scala file because " + scl_file_name + " is invalid");
+        ScalaComponentMessageBus::getInstance().broadcastMessage("Can not create User Scala file because " + scl_file_name + " is invalid: " + error_message);
         
         return false;
     }
@@ -614,26 +583,24 @@ vector<Columns> ScalaUserModel::getColumns()
 }
 
 // this code duplicated in ScalaBundleModel
-shared_ptr<Image> ScalaUserModel::getIcon(int row_number)
+// returns the placeholder until the icon is loaded/rendered, then calls on_ready on the message thread
+shared_ptr<Image> ScalaUserModel::getIcon(int row_number, IconService::Completion on_ready)
 {
-    // get icon if it exists
     auto icon_name = _getIconFilename(row_number);
-    auto icon_file = _fullPathToIconFile(icon_name);
-    if (! icon_file.existsAsFile())
+    auto const key = "scala_user/" + icon_name;
+    auto icon = _iconService->getCachedIcon(key);
+    if(icon != nullptr)
     {
-        // inefficient reuse of file import's creation of icon
-        auto lazy_way_to_make_an_icon = getScalaTuningForRow(row_number);
-        jassert(lazy_way_to_make_an_icon != nullptr);
+        return icon;
     }
     
-    // should be valid now
-    auto image = ImageFileFormat::loadFrom(icon_file);
-    if (! image.isValid())
+    // miss: the .scl is parsed by the renderer (TODO: KBM)
+    auto renderer = [scl_path = _fullPathToSclFile(icon_name).getFullPathName()]()
     {
-        jassertfalse;
-    }
+        return ScalaIconRenderer::renderPitchWheelIcon(ScalaTuningImp::createScalaTuningFromSclKbm(scl_path, scl_path));
+    };
     
-    return make_shared<Image>(std::move(image));
+    return _iconService->getIcon(key, _fullPathToIconFile(icon_name), renderer, std::move(on_ready));
 }
 
 #pragma mark - private methods
@@ -13,6 +13,7 @@
 #include <JuceHeader.h>
 #include "Columns.h"
 #include "FavoritesIconRenderer.h"
+#include "IconService.h"
 #include "ScalaIconRenderer.h"
 #include "ScalaModelProtocol.h"
 #include "ScalaTuningImp.h"
@@ -56,7 +57,7 @@ public:
     int getIsSelectedForRow(const int row_number) const override;
     void selectRow(const int row_number) override;
     vector<Columns> getColumns();
-    shared_ptr<Image> getIcon(int row_number) override;
+    shared_ptr<Image> getIcon(int row_number, IconService::Completion on_ready) override;
     
 private:
     // private members
@@ -70,6 +71,7 @@ private:
     int _selectedID = -1;
     Font _font {WilsonicAppSkin::tableViewFontSize};
     CriticalSection _lock;
+    SharedResourcePointer<IconService> _iconService;
     
     // private methods
     File _fullPathToSclFile(String file_name); // helper, you need to validate
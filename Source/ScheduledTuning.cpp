@@ -0,0 +1,60 @@
+/**
+ * @file ScheduledTuning.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the ScheduledTuning class.
+ */
+
+#include "ScheduledTuning.h"
+
+#pragma mark - lifecycle
+
+ScheduledTuning::ScheduledTuning() {
+    // default to 12ET, same as TuningSnapshotBuffer
+    _buffer.read(_active);
+}
+
+#pragma mark - writer
+
+void ScheduledTuning::schedule(const TuningSnapshot& snapshot) {
+    _buffer.publish(snapshot);
+    _scheduled.fetch_add(1, std::memory_order_release);
+}
+
+void ScheduledTuning::setMorphPositionSource(const atomic<float>* morph_position) {
+    _morphPosition = morph_position;
+}
+
+#pragma mark - audio thread
+
+/**
+ * @brief Copies the latest snapshot into the active one, if any was scheduled since the last call.
+ *
+ * A snapshot published between the load of _scheduled and the copy is taken now, and again at the next
+ * block: copying it twice is harmless, missing it is not.
+ */
+bool ScheduledTuning::applyPending() {
+    auto const scheduled = _scheduled.load(std::memory_order_acquire);
+    if(scheduled == _applied) {
+        return false;
+    }
+    _buffer.read(_active);
+    _applied = scheduled;
+
+    return true;
+}
+
+float ScheduledTuning::getFrequency(unsigned long nn) const {
+    auto const i = jlimit<unsigned long>(0, WilsonicProcessorConstants::numMidiNotes - 1, nn);
+    if(_morphPosition != nullptr && _active.morphIsEnabled) {
+        return _active.morphPath.evaluate(i, _morphPosition->load(std::memory_order_relaxed), _active.morphInterpolation);
+    }
+
+    return _active.frequencies[i];
+}
+
+bool ScheduledTuning::getFilterNote(unsigned long nn) const {
+    auto const i = jlimit<unsigned long>(0, WilsonicProcessorConstants::numMidiNotes - 1, nn);
+
+    return _active.filterNotes[i];
+}
@@ -0,0 +1,54 @@
+/**
+ * @file ScheduledTuning.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the ScheduledTuning class.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "TuningSnapshot.h"
+
+/**
+ * @class ScheduledTuning
+ * @brief The tuning as the audio thread plays it: the latest TuningSnapshot scheduled, taken once per block.
+ *
+ * TuningSnapshotBuffer makes a new tuning current the moment it is published, wherever the audio thread is
+ * in a block.  Here the audio thread takes the latest published snapshot at the start of each block, so a
+ * block is always rendered with one tuning.  Host automation of a design reaches AppTuningModel on the
+ * audio thread, before the block it arrived with is rendered, so it is played from the start of that block.
+ * Changes made on the message thread are played from the start of the next block.
+ *
+ * Nothing locks or allocates.  If the writer publishes more than once between two blocks, the latest wins.
+ *
+ * One writer (AppTuningModel, under its lock), one reader (the audio thread).
+ */
+class ScheduledTuning final
+{
+public:
+    // lifecycle
+    ScheduledTuning(); // 12ET
+    ~ScheduledTuning() = default;
+    ScheduledTuning(const ScheduledTuning&) = delete;
+    ScheduledTuning& operator=(const ScheduledTuning&) = delete;
+
+    // writer
+    void schedule(const TuningSnapshot& snapshot);
+
+    // the morph position, i.e. the raw value of the morph interpolation parameter.  Set once, before audio starts.
+    void setMorphPositionSource(const atomic<float>* morph_position);
+
+    // audio thread
+    bool applyPending(); ///< At the start of a block: takes the latest snapshot scheduled.  Returns true if there was one.
+    float getFrequency(unsigned long nn) const; ///< nn is clamped to [0, 127].  Morphs at the current position.
+    bool getFilterNote(unsigned long nn) const; ///< nn is clamped to [0, 127]
+    const TuningSnapshot& getSnapshot() const { return _active; }
+
+private:
+    TuningSnapshotBuffer _buffer {};
+    atomic<uint64_t> _scheduled {0}; // written by the writer, after each publish
+    uint64_t _applied = 0; // audio thread only
+    TuningSnapshot _active {}; // audio thread only
+    const atomic<float>* _morphPosition = nullptr;
+};
@@ -44,8 +44,6 @@ public:
     const string getTuningName() override;
     const string getTuningNameAsSymbols() override;
     const string getTuningNameAsUnderscores() override;
-    const string getTuningCreationCodegen(string, vector<string>, vector<string>) override;
-    const string getTuningUpdateCodegen() override;
 
 protected:
     // properties
@@ -270,143 +270,3 @@ const string Seed6::getTuningNameAsUnderscores()
 
     return retVal;
 }
-
-// used by codegen to create the string used to construct this type of tuning:
-//shared_ptr<CPSTuningBase> EulerGenusModel::_create_tuning(CPS_Class tuning_class_name,
-//                                                           vector<Microtone_p> master_set,
-//                                                           vector<Microtone_p> common_terms,
-//                                                           DAWKey parent_key,
-//                                                           vector<DAWKey> s0_daw_keys,
-//                                                           vector<DAWKey> s1_daw_keys)
-//    cps->setShouldComputeSubsets(true); cps->selectParent();
-//    return cps;
-
-const string Seed6::getTuningCreationCodegen(string parent_key, vector<string> s0_keys, vector<string> s1_keys)
-{
-    // common tones
-    string ctstr = "";
-    if(_commonTones.size() > 0)
-    {
-        ctstr = "{";
-        sort(_commonTones.begin(), _commonTones.end(), less_than_key());
-        for(auto ct : _commonTones)
-        {
-            ctstr += "_" + ct->getShortDescriptionText() + ",";
-        }
-        ctstr.pop_back(); // remove last ","
-        ctstr += "}";
-    }
-    else
-    {
-        ctstr = "{}";
-    }
-
-    // s0
-    string s0str = "";
-    if(s0_keys.size() > 0)
-    {
-        s0str = "{";
-        for(auto ct : s0_keys)
-        {
-            s0str += "\"" + ct + "\"" + ",";
-        }
-        s0str.pop_back(); // remove last ","
-        s0str += "}";
-    }
-    else
-    {
-        s0str = "{}";
-    }
-
-    // s1
-    string s1str = "";
-    if(s1_keys.size() > 0)
-    {
-        s1str = "{";
-        for(auto ct : s1_keys)
-        {
-            s1str += "\"" + ct + "\"" + ",";
-        }
-        s1str.pop_back(); // remove last ","
-        s1str += "}";
-    }
-    else
-    {
-        s1str = "{}";
-    }
-
-    auto a = _A->getShortDescriptionText();
-    auto b = _B->getShortDescriptionText();
-    auto c = _C->getShortDescriptionText();
-    auto d = _D->getShortDescriptionText();
-    auto e = _E->getShortDescriptionText();
-    auto f = _F->getShortDescriptionText();
-
-    //shared_ptr<CPSTuningBase> _create_tuning (
-    //CPS_Class tuning_class_name,
-    //vector<Microtone_p> master_set,
-    //vector<Microtone_p>,
-    //common_terms,
-    //string parent_key,
-    //vector<string> s0_keys,
-    //vector<string> s1_keys);
-
-    // tuning class
-    string tuning_class_name = TuningImp::getTuningName();
-    string retVal = "[this](){ return _create_tuning(CPS_Class::" + tuning_class_name + ", ";
-
-    // master set
-    retVal += "{_" + a + ",_" + b + ",_" + c + ",_" + d + ",_" + e + ",_" + f + "}, ";
-
-    // common tones {}
-    retVal += ctstr + ", ";
-
-    // parent daw key
-    retVal += "\"" + parent_key + "\", ";
-
-    // s0 daw keys
-    retVal += s0str + ", "; 
-
-    // s1 daw keys
-    retVal += s1str;
-
-    //
-    retVal +=  + ");}";
-    return retVal;
-}
-
-
-// used by codegen to create the string used to update this type of tuning:
-//    cps->set ({_A,_B,_C,_D,_E,_F}, {});
-const string Seed6::getTuningUpdateCodegen()
-{
-    string ctstr = "";
-    //bool hasCommonTones = false;
-    if(_commonTones.size() > 0)
-    {
-        //hasCommonTones = true;
-        ctstr = "{";
-        sort(_commonTones.begin(), _commonTones.end(), less_than_key());
-        for(auto ct : _commonTones)
-        {
-            ctstr += "_" + ct->getShortDescriptionText() + ",";
-        }
-        ctstr.pop_back(); // remove last ","
-        ctstr += "}";
-    }
-    else
-    {
-        ctstr = "{}";
-    }
-
-    auto a = _A->getShortDescriptionText();
-    auto b = _B->getShortDescriptionText();
-    auto c = _C->getShortDescriptionText();
-    auto d = _D->getShortDescriptionText();
-    auto e = _E->getShortDescriptionText();
-    auto f = _F->getShortDescriptionText();
-
-    string retVal = "cps->set ({_" + a + ",_" + b + ",_" + c + ",_" + d + ",_" + e + ",_" + f + "}," + ctstr + ");";
-
-    return retVal;
-}
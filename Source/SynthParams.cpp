@@ -0,0 +1,139 @@
+/**
+ * @file SynthParams.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the SynthParams class.
+ */
+
+#include "SynthParams.h"
+#include <algorithm>
+#include <cmath>
+#include <JuceHeader.h>
+
+#pragma mark - parameters
+
+static constexpr std::array<const char*, SynthParams::NumParams> __parameterIDs {
+    "SYNTHVOICES",
+    "SYNTHOSC1",
+    "SYNTHOSC2",
+    "SYNTHOSC1GAIN",
+    "SYNTHOSC2GAIN",
+    "SYNTHOSC1PITCH",
+    "SYNTHOSC2PITCH",
+    "SYNTHOSC1FMFREQ",
+    "SYNTHOSC2FMFREQ",
+    "SYNTHOSC1FMDEPTH",
+    "SYNTHOSC2FMDEPTH",
+    "SYNTHLFO1FREQ",
+    "SYNTHLFO1DEPTH",
+    "SYNTHFILTERTYPE",
+    "SYNTHFILTERCUTOFF",
+    "SYNTHFILTERRESONANCE",
+    "SYNTHATTACK",
+    "SYNTHDECAY",
+    "SYNTHSUSTAIN",
+    "SYNTHRELEASE",
+    "SYNTHFILTERADSRDEPTH",
+    "SYNTHFILTERATTACK",
+    "SYNTHFILTERDECAY",
+    "SYNTHFILTERSUSTAIN",
+    "SYNTHFILTERRELEASE",
+    "SYNTHREVERBSIZE",
+    "SYNTHREVERBWIDTH",
+    "SYNTHREVERBDAMPING",
+    "SYNTHREVERBDRY",
+    "SYNTHREVERBWET",
+    "SYNTHREVERBFREEZE",
+    "SYNTHTUNINGGLIDE"
+};
+
+const char* SynthParams::getParameterID(ID id) {
+    jassert(id < NumParams);
+    return __parameterIDs[id];
+}
+
+bool SynthParams::isSmoothed(ID id) {
+    jassert(id < NumParams);
+    return (smoothedMask & bit(id)) != 0;
+}
+
+#pragma mark - lifecycle
+
+bool SynthParams::isResolved() const {
+    for(auto raw : _raw) {
+        if(raw == nullptr) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void SynthParams::invalidate() {
+    _invalid = true;
+}
+
+#pragma mark - audio thread
+
+SynthParams::Mask SynthParams::update(float blockSeconds) {
+    jassert(isResolved());
+    Mask retVal = 0;
+    if(_invalid) {
+        for(size_t i = 0; i < NumParams; i++) {
+            _value[i] = _raw[i]->load(std::memory_order_relaxed);
+        }
+        _invalid = false;
+
+        return ~Mask(0) >> (64 - NumParams);
+    }
+
+    // a one-pole per block, so the time constant does not depend on the block size
+    auto const coefficient = 1.f - std::exp(-blockSeconds / smoothingSeconds);
+    for(size_t i = 0; i < NumParams; i++) {
+        auto const target = _raw[i]->load(std::memory_order_relaxed);
+        auto& value = _value[i];
+        if(value == target) {
+            continue;
+        }
+        if(smoothedMask & (Mask(1) << i)) {
+            value += coefficient * (target - value);
+            if(std::fabs(target - value) <= 1e-4f * std::max(1.f, std::fabs(target))) {
+                value = target;
+            }
+        } else {
+            value = target;
+        }
+        retVal |= Mask(1) << i;
+    }
+
+    return retVal;
+}
+
+#pragma mark - apply
+
+void SynthParams::applyOscillators(OscillatorBank& bank, Mask changed) const {
+    if(changed & oscillator1Mask) {
+        bank.setOscillator(0, static_cast<OscillatorBank::Waveform>(getInt(Osc1)), get(Osc1Gain), getInt(Osc1Pitch), get(Osc1FmFreq), get(Osc1FmDepth));
+    }
+    if(changed & oscillator2Mask) {
+        bank.setOscillator(1, static_cast<OscillatorBank::Waveform>(getInt(Osc2)), get(Osc2Gain), getInt(Osc2Pitch), get(Osc2FmFreq), get(Osc2FmDepth));
+    }
+    if(changed & ampEnvelopeMask) {
+        bank.setAmpEnvelope({get(Attack), get(Decay), get(Sustain), get(Release)});
+    }
+    if(changed & filterEnvelopeMask) {
+        bank.setFilterEnvelope({get(FilterAttack), get(FilterDecay), get(FilterSustain), get(FilterRelease)});
+    }
+}
+
+void SynthParams::applyFilter(OscillatorBank& bank, Mask changed) const {
+    if(changed & filterMask) {
+        bank.setFilter(static_cast<OscillatorBank::FilterType>(getInt(FilterType)), get(FilterCutoff), get(FilterResonance), get(FilterAdsrDepth));
+    }
+}
+
+void SynthParams::applyGlide(OscillatorBank& bank, Mask changed) const {
+    if(changed & bit(TuningGlide)) {
+        bank.setGlide(get(TuningGlide));
+    }
+}
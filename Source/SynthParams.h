@@ -0,0 +1,97 @@
+/**
+ * @file SynthParams.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the SynthParams class.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "OscillatorBank.h"
+
+/**
+ * @class SynthParams
+ * @brief The synth's parameters as the audio thread sees them: resolved once, read once per block, and
+ * smoothed per block.
+ *
+ * resolve() looks up every parameter's raw value by ID, once.  update() then loads each of them, moves the
+ * continuous ones toward their targets with a one-pole per block, and returns a mask of the parameters whose
+ * value changed, so the processor only pushes what moved.  With no parameter motion, update() is a few loads
+ * and compares, and returns 0.  The values are shared by every voice.
+ */
+class SynthParams final
+{
+public:
+    // the order of getSynthParameterIDs()
+    enum ID : size_t {
+        Voices = 0,
+        Osc1, Osc2,
+        Osc1Gain, Osc2Gain,
+        Osc1Pitch, Osc2Pitch,
+        Osc1FmFreq, Osc2FmFreq,
+        Osc1FmDepth, Osc2FmDepth,
+        Lfo1Freq, Lfo1Depth,
+        FilterType, FilterCutoff, FilterResonance,
+        Attack, Decay, Sustain, Release,
+        FilterAdsrDepth, FilterAttack, FilterDecay, FilterSustain, FilterRelease,
+        ReverbSize, ReverbWidth, ReverbDamping, ReverbDry, ReverbWet, ReverbFreeze,
+        TuningGlide,
+        NumParams
+    };
+    using Mask = uint64_t;
+    static_assert(NumParams <= 64, "one bit per parameter");
+    static constexpr Mask bit(ID id) { return Mask(1) << id; }
+
+    // the parameters each consumer reads
+    static constexpr Mask oscillator1Mask = (Mask(1) << Osc1) | (Mask(1) << Osc1Gain) | (Mask(1) << Osc1Pitch) | (Mask(1) << Osc1FmFreq) | (Mask(1) << Osc1FmDepth);
+    static constexpr Mask oscillator2Mask = (Mask(1) << Osc2) | (Mask(1) << Osc2Gain) | (Mask(1) << Osc2Pitch) | (Mask(1) << Osc2FmFreq) | (Mask(1) << Osc2FmDepth);
+    static constexpr Mask ampEnvelopeMask = (Mask(1) << Attack) | (Mask(1) << Decay) | (Mask(1) << Sustain) | (Mask(1) << Release);
+    static constexpr Mask filterEnvelopeMask = (Mask(1) << FilterAttack) | (Mask(1) << FilterDecay) | (Mask(1) << FilterSustain) | (Mask(1) << FilterRelease);
+    static constexpr Mask filterMask = (Mask(1) << FilterType) | (Mask(1) << FilterCutoff) | (Mask(1) << FilterResonance) | (Mask(1) << FilterAdsrDepth);
+    static constexpr Mask reverbMask = (Mask(1) << ReverbSize) | (Mask(1) << ReverbWidth) | (Mask(1) << ReverbDamping) | (Mask(1) << ReverbDry) | (Mask(1) << ReverbWet) | (Mask(1) << ReverbFreeze);
+    static constexpr Mask smoothedMask = (Mask(1) << Osc1Gain) | (Mask(1) << Osc2Gain) | (Mask(1) << Osc1FmFreq) | (Mask(1) << Osc2FmFreq) | (Mask(1) << Osc1FmDepth) | (Mask(1) << Osc2FmDepth)
+                                       | (Mask(1) << FilterCutoff) | (Mask(1) << FilterResonance) | (Mask(1) << FilterAdsrDepth);
+    static constexpr float smoothingSeconds = 0.02f;
+
+    static const char* getParameterID(ID id); ///< i.e., "SYNTHOSC1"
+    static bool isSmoothed(ID id); ///< Continuous parameters: gains, frequencies, depths, and the filter
+
+    // lifecycle
+    SynthParams() = default;
+    ~SynthParams() = default;
+
+    /**
+     * @brief Resolves every parameter once, before audio starts.
+     * @param rawParameterValue const char* parameter ID -> const std::atomic<float>*, i.e., AudioProcessorValueTreeState::getRawParameterValue
+     */
+    template<typename F>
+    void resolve(F&& rawParameterValue) {
+        for(size_t i = 0; i < NumParams; i++) {
+            _raw[i] = rawParameterValue(getParameterID(static_cast<ID>(i)));
+        }
+        invalidate();
+    }
+    bool isResolved() const;
+    void invalidate(); ///< The next update() jumps to the targets and returns every bit
+
+    // audio thread
+    Mask update(float blockSeconds); ///< Reads the parameters, and returns the mask of the values that changed
+    float get(ID id) const { return _value[id]; } ///< The smoothed value, as of the last update()
+    int getInt(ID id) const { return static_cast<int>(_value[id]); } ///< Choices and ints
+
+    // push the changed values to the bank
+    void applyOscillators(OscillatorBank& bank, Mask changed) const; ///< Oscillators and envelopes
+    void applyFilter(OscillatorBank& bank, Mask changed) const;
+    void applyGlide(OscillatorBank& bank, Mask changed) const;
+
+private:
+    std::array<const std::atomic<float>*, NumParams> _raw {};
+    std::array<float, NumParams> _value {};
+    bool _invalid = true;
+};
@@ -0,0 +1,77 @@
+/**
+ * @file TelemetryChannel.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the TelemetryChannel class template.
+ *
+ * Does not depend on JUCE, so it can be unit tested.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class TelemetryChannel
+ * @brief Publishes frames from one writer thread to one reader thread, wait-free on both sides.
+ *
+ * A triple buffer: the writer fills its back slot in place, then exchanges it with the middle slot; the
+ * reader exchanges its front slot with the middle one when a newer frame is there.  Each side keeps
+ * reading and writing its own slot, so a frame is never torn, neither side ever waits, and a reader that
+ * polls without a new frame only loads the one shared atomic.  Frames the reader misses are dropped,
+ * i.e., it always sees the latest.
+ *
+ * Every frame has a sequence number, starting at 1, so the reader can tell whether anything changed.
+ *
+ * Single producer (the audio thread), single consumer (the message thread).
+ */
+template<typename T>
+class TelemetryChannel final
+{
+public:
+    // lifecycle
+    TelemetryChannel() = default;
+    ~TelemetryChannel() = default;
+    TelemetryChannel(const TelemetryChannel&) = delete;
+    TelemetryChannel& operator=(const TelemetryChannel&) = delete;
+
+    // writer
+    T& beginWrite() { return _slots[_back].value; } ///< The writer's slot: fill it, then publish()
+    void publish() {
+        _slots[_back].sequence = ++_sequence;
+        _back = _middle.exchange(static_cast<uint8_t>(_back | __fresh), std::memory_order_acq_rel) & __index;
+    }
+    void publish(const T& value) {
+        beginWrite() = value;
+        publish();
+    }
+
+    // reader
+    bool update() { ///< Takes the latest frame, if there is a newer one.  Returns true if there was.
+        if((_middle.load(std::memory_order_relaxed) & __fresh) == 0) {
+            return false;
+        }
+        _front = _middle.exchange(_front, std::memory_order_acq_rel) & __index;
+        return true;
+    }
+    const T& get() const { return _slots[_front].value; } ///< As of the last update()
+    uint64_t getSequence() const { return _slots[_front].sequence; } ///< 0 until the first frame
+
+private:
+    static constexpr uint8_t __index = 0x3;
+    static constexpr uint8_t __fresh = 0x4; // the middle slot has a frame the reader has not taken
+
+    // a cache line each, so the two sides do not share one
+    struct alignas(64) Slot {
+        T value {};
+        uint64_t sequence = 0;
+    };
+    std::array<Slot, 3> _slots {};
+    alignas(64) std::atomic<uint8_t> _middle {1};
+    alignas(64) uint8_t _back = 0; // writer only
+    uint64_t _sequence = 0; // writer only
+    alignas(64) uint8_t _front = 2; // reader only
+};
@@ -0,0 +1,81 @@
+/**
+ * @file TriadAnalyzer.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the TriadAnalyzer class.
+ */
+
+#include "TriadAnalyzer.h"
+
+#pragma mark - analysis
+
+/**
+ * @brief Finds every proportional and subcontrary triad of frequencies.
+ *
+ * The limits and tolerance are the same as the original cubic search in TuningImp: the mean must
+ * be between a major 2nd and a fourth above the root, and the third must be within tolerance of it.
+ * @param frequencies The scale, i.e., the processed array.  Does not need to be sorted.
+ */
+void TriadAnalyzer::analyze(const vector<float>& frequencies) {
+    _proportionalTriads.clear();
+    _subcontraryTriads.clear();
+    auto const npo = frequencies.size();
+    if(npo < 3) {
+        return;
+    }
+
+    // (frequency, index) sorted by frequency
+    _sortedIndices.resize(npo);
+    std::iota(_sortedIndices.begin(), _sortedIndices.end(), 0UL);
+    std::stable_sort(_sortedIndices.begin(), _sortedIndices.end(), [&](unsigned long a, unsigned long b) {
+        return frequencies[a] < frequencies[b];
+    });
+    _sortedFrequencies.resize(npo);
+    for(size_t i = 0; i < npo; i++) {
+        _sortedFrequencies[i] = frequencies[_sortedIndices[i]];
+    }
+
+    constexpr float major_2nd = 9.f/8.f;
+    constexpr float fourth = 4.f/3.f;
+    for(unsigned long i = 0; i < npo; i++) { // root
+        auto const imf = frequencies[i];
+        for(unsigned long j = i + 2; j < npo; j++) { // fifth
+            auto const jmf = frequencies[j];
+            auto const major = (imf + jmf) / 2;
+            auto const minor = 2 * (imf * jmf) / (imf + jmf);
+            if(major / imf > major_2nd && major / imf < fourth) {
+                _findThirds(major, i, j);
+                for(auto k : _thirds) {
+                    _proportionalTriads.push_back(PythagoreanMeans(i, k, j, PythagoreanMeans::Type::Proportional));
+                }
+            }
+            if(minor / imf > major_2nd && minor / imf < fourth) {
+                _findThirds(minor, i, j);
+                for(auto k : _thirds) {
+                    _subcontraryTriads.push_back(PythagoreanMeans(i, k, j, PythagoreanMeans::Type::Subcontrary));
+                }
+            }
+        }
+    }
+}
+
+#pragma mark - private
+
+// _thirds = the indices k, root < k < fifth, whose frequency is within tolerance of mean, ascending
+void TriadAnalyzer::_findThirds(float mean, unsigned long root, unsigned long fifth) {
+    _thirds.clear();
+
+    // the search window is padded; the exact test below is the same one the cubic search used
+    auto const pad = 2.f * static_cast<float>(tolerance);
+    auto it = std::lower_bound(_sortedFrequencies.begin(), _sortedFrequencies.end(), mean - pad);
+    for(; it != _sortedFrequencies.end() && *it <= mean + pad; ++it) {
+        auto const kmf = *it;
+        if(fabsf(mean - kmf) < tolerance) {
+            auto const k = _sortedIndices[static_cast<size_t>(it - _sortedFrequencies.begin())];
+            if(k > root && k < fifth) {
+                _thirds.push_back(k);
+            }
+        }
+    }
+    std::sort(_thirds.begin(), _thirds.end());
+}
@@ -0,0 +1,50 @@
+/**
+ * @file TriadAnalyzer.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the TriadAnalyzer class.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PythagoreanMeans.h"
+#include "Tuning_Include.h"
+
+/**
+ * @class TriadAnalyzer
+ * @brief Finds the proportional ("major") and subcontrary ("minor") triads of a scale.
+ *
+ * For each (root, fifth) pair the arithmetic and harmonic means are computed, and the third is
+ * found by binary search in a frequency-sorted copy of the scale, so the cost is O(n^2 log n)
+ * instead of O(n^3).  The scale does not have to be sorted: the third only has to be between
+ * the root and the fifth by index.
+ *
+ * Triads are (root, third, fifth) with root < third < fifth < count, in (root, fifth, third) order,
+ * which is what TuningImp has always reported.
+ */
+class TriadAnalyzer final
+{
+public:
+    static constexpr double tolerance = 0.0005; // how close the third has to be to the mean
+
+    // lifecycle
+    TriadAnalyzer() = default;
+    ~TriadAnalyzer() = default;
+
+    // analysis
+    void analyze(const vector<float>& frequencies); ///< replaces the previous results
+    const vector<PythagoreanMeans>& getProportionalTriads() const { return _proportionalTriads; }
+    const vector<PythagoreanMeans>& getSubcontraryTriads() const { return _subcontraryTriads; }
+
+private:
+    void _findThirds(float mean, unsigned long root, unsigned long fifth); // -> _thirds
+
+    // scratch, reused between calls
+    vector<float> _sortedFrequencies {};
+    vector<unsigned long> _sortedIndices {};
+    vector<unsigned long> _thirds {};
+
+    vector<PythagoreanMeans> _proportionalTriads {};
+    vector<PythagoreanMeans> _subcontraryTriads {};
+};
@@ -135,17 +135,17 @@ void TriadicDiamond::update()
     auto const a_freq = _A->getFrequencyValue();
     auto const b_freq = _B->getFrequencyValue();
     auto const c_freq = _C->getFrequencyValue();
-    _A_B->mt  = CPS::A_div_B(CPS::A(a_freq), CPS::B(b_freq));
-    _A_C->mt  = CPS::A_div_B(CPS::A(a_freq), CPS::C(c_freq));
-    _B_A->mt  = CPS::A_div_B(CPS::B(b_freq), CPS::A(a_freq));
-    _B_C->mt  = CPS::A_div_B(CPS::B(b_freq), CPS::C(c_freq));
-    _C_A->mt  = CPS::A_div_B(CPS::C(c_freq), CPS::A(a_freq));
-    _C_B->mt  = CPS::A_div_B(CPS::C(c_freq), CPS::B(b_freq));
+    _A_B->mt  = _recordProduct(CPS::A_div_B(CPS::A(a_freq), CPS::B(b_freq)), {_A}, {_B});
+    _A_C->mt  = _recordProduct(CPS::A_div_B(CPS::A(a_freq), CPS::C(c_freq)), {_A}, {_C});
+    _B_A->mt  = _recordProduct(CPS::A_div_B(CPS::B(b_freq), CPS::A(a_freq)), {_B}, {_A});
+    _B_C->mt  = _recordProduct(CPS::A_div_B(CPS::B(b_freq), CPS::C(c_freq)), {_B}, {_C});
+    _C_A->mt  = _recordProduct(CPS::A_div_B(CPS::C(c_freq), CPS::A(a_freq)), {_C}, {_A});
+    _C_B->mt  = _recordProduct(CPS::A_div_B(CPS::C(c_freq), CPS::B(b_freq)), {_C}, {_B});
     //_one->mt  = CPS::A_div_B(CPS::A(1), CPS::A(1));
 
 
     auto ma = MicrotoneArray();
-    ma.addMicrotone(_one->mt);
+    ma.addMicrotone(_recordProduct(_one->mt, {})); // 1/1 has no terms
     ma.addMicrotone(_A_B->mt);
     ma.addMicrotone(_A_C->mt);
     ma.addMicrotone(_B_A->mt);
@@ -41,10 +41,10 @@ private:
 public:
     // public methods
     shared_ptr<Tuning> getTuning() override;
-    unique_ptr<AudioProcessorParameterGroup> createParams() override;// called only once: on construction of processor
-    String getGroupID() override;
-    String getGroupName() override;
-    String getSubgroupSeparator() override;
+    static unique_ptr<AudioProcessorParameterGroup> createParams();// called only once: on construction of processor
+    static String getGroupID();
+    static String getGroupName();
+    static String getSubgroupSeparator();
     ParameterID getDesignParameterID() override; // key for this design's Favorites array
     StringArray getFavoritesParameterIDs() override; // used for Favorites
     // called only once: when assigning _avpts
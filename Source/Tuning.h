@@ -70,6 +70,7 @@ public:
     virtual void setMicrotoneArrayFromHarmonics(vector<float> harmonics) = 0;
     virtual void setMicrotoneAtNoteNumber(Microtone_p microtone, unsigned long nn) = 0;
     virtual Microtone_p microtoneAtNoteNumber(unsigned long nn) = 0;
+    virtual bool getFilterNoteAtNoteNumber(unsigned long nn) = 0; // same as microtoneAtNoteNumber(nn)->getFilterNote(), without building the Microtone
     virtual void setPostProcessPreTuningUpdate(function<void()> postProcessBlock) = 0;
     virtual void callPostProcessBlock() = 0;
     virtual void setOnTuningUpdate(function<void()> completionBlock) = 0;
@@ -169,6 +170,24 @@ public:
     virtual bool canPaintTuning() = 0;
     virtual void paint(WilsonicProcessor&, Graphics&, Rectangle<int>) = 0;
 
+    // batch updates: the setters called between beginUpdate() and the matching endUpdate()
+    // are coalesced into a single recompute, performed by the outermost endUpdate().  Nestable.
+    virtual void beginUpdate() = 0;
+    virtual void endUpdate() = 0;
+    virtual uint64_t getUpdateCount() = 0; // incremented by every recompute, so views can tell when to redraw
+
+    // RAII helper: beginUpdate() on construction, endUpdate() on destruction
+    class ScopedUpdate final
+    {
+    public:
+        explicit ScopedUpdate(Tuning& tuning) : _tuning(tuning) { _tuning.beginUpdate(); }
+        ~ScopedUpdate() { _tuning.endUpdate(); }
+        ScopedUpdate(const ScopedUpdate&) = delete;
+        ScopedUpdate& operator=(const ScopedUpdate&) = delete;
+    private:
+        Tuning& _tuning;
+    };
+
 protected:
     virtual void _update() = 0;
 };
@@ -69,8 +69,6 @@ TuningImp::TuningImp(const TuningImp& t)
 ,_canFavorite(t._canFavorite)
 ,_canScala(t._canScala)
 ,_microtoneArray(t._microtoneArray)
-,_processedArray(t._processedArray)
-,_microtoneNN(t._microtoneNN)
 ,_postProcessBlock(t._postProcessBlock)
 ,_completionBlock(t._completionBlock)
 ,_tuningTable(t._tuningTable)
@@ -97,9 +95,9 @@ int TuningImp::getMode() {
 
 void TuningImp::setMode(int newMode) {
     // -1 = nop
-    if (newMode >= -1 && newMode < static_cast<int>(_processedArray.count())) {
+    if (newMode >= -1 && newMode < static_cast<int>(_processedFlat.count())) {
         _mode = newMode;
-        _update();
+        _requestUpdate(UpdateStage::TuningTable);
     } else {
         DBG ("TuningImp::setMode: out of range" + String(newMode));
     }
@@ -113,7 +111,7 @@ void TuningImp::setNoteNumberMiddleC(unsigned long nn) {
     jassert(nn >= _noteNumberMiddleCMin && nn <= _noteNumberMiddleCMax);
     if (nn != _noteNumberMiddleC) {
         _noteNumberMiddleC = nn;
-        _update();
+        _requestUpdate(UpdateStage::TuningTable);
     }
 }
 
@@ -133,7 +131,7 @@ void TuningImp::setFrequencyMiddleC(float f) {
     jassert(f >= _frequencyMiddleCMin && f <= _frequencyMiddleCMax);
     if(WilsonicMath::floatsAreNotEqual(f, _frequencyMiddleC)) {
         _frequencyMiddleC = f;
-        _update();
+        _requestUpdate(UpdateStage::TuningTable);
     }
 }
 
@@ -153,7 +151,7 @@ void TuningImp::setOctaveMiddleC(int o) {
     jassert(o >= _octaveMiddleCMin && o <= _octaveMiddleCMax);
     if (o != _octaveMiddleC) {
         _octaveMiddleC = o;
-        _update();
+        _requestUpdate(UpdateStage::TuningTable);
     }
 }
 
@@ -172,7 +170,7 @@ bool TuningImp::getCanNPOOverride() {
 
 void TuningImp::setCanNPOOverride(bool shouldOverride) {
     _canNPOOverride = shouldOverride;
-    _update();
+    _requestUpdate(UpdateStage::NPOOverride);
 }
 
 // notes per octave "npo" override
@@ -185,7 +183,7 @@ void TuningImp::setNPOOverride(int npoOverride) {
     // because _processedArrayNPO is the end of the chain
     auto const newOverride = jlimit(Tuning::npoOverrideMin, Tuning::npoOverrideMax, npoOverride);
     _npoOverride = newOverride;
-    _update();
+    _requestUpdate(UpdateStage::NPOOverride);
 }
 
 int TuningImp::getNPOOverrideMin() {
@@ -207,7 +205,7 @@ void TuningImp::setNPOOverrideEnable(bool enable) {
         _npoOverrideEnable = enable;
     }
     
-    _update();
+    _requestUpdate(UpdateStage::NPOOverride);
 }
 
 float TuningImp::getOctave() {
@@ -220,7 +218,7 @@ void TuningImp::setOctave(float o) {
     jassert(!std::isinf(o));
     if(WilsonicMath::floatsAreNotEqual(_octave, o) && (o >= _octaveMin) && (o <= _octaveMax)) {
         _octave = o;
-        _update();
+        _requestUpdate(UpdateStage::Full);
     } else {
         //DBG("TuningImp::setOctave: NOP because o is out of range: " + String(o));
     }
@@ -241,7 +239,7 @@ bool TuningImp::getOctaveReduce() {
 void TuningImp::setOctaveReduce(bool o) {
     if (_octaveReduce != o) {
         _octaveReduce = o;
-        _update();
+        _requestUpdate(UpdateStage::Full);
     }
 }
 
@@ -252,7 +250,7 @@ bool TuningImp::getOctaveRepeat() {
 void TuningImp::setOctaveRepeat(bool o) {
     if ( _octaveRepeat != o) {
         _octaveRepeat = o;
-        _update();
+        _requestUpdate(UpdateStage::TuningTable);
     }
 }
 
@@ -263,7 +261,7 @@ bool TuningImp::getSort() {
 void TuningImp::setSort(bool s) {
     if (s != _sort) {
         _sort = s;
-        _update();
+        _requestUpdate(UpdateStage::Full);
     }
 }
 
@@ -274,7 +272,7 @@ bool TuningImp::getCanSort() {
 void TuningImp::setCanSort(bool s) {
     if (s != _canSort) {
         _canSort = s;
-        _update();
+        _requestUpdate(UpdateStage::Full);
     }
 }
 
@@ -285,7 +283,7 @@ bool TuningImp::getUniquify() {
 void TuningImp::setUniquify(bool u) {
     if ( _uniquify != u ) {
         _uniquify = u;
-        _update();
+        _requestUpdate(UpdateStage::Full);
     }
 }
 
@@ -296,7 +294,7 @@ bool TuningImp::getCanUniquify() {
 void TuningImp::setCanUniquify(bool u) {
     if ( _canUniquify != u ) {
         _canUniquify = u;
-        _update();
+        _requestUpdate(UpdateStage::Full);
     }
 }
 
@@ -320,7 +318,7 @@ const string TuningImp::getDebugDescription() {
     string retVal = "(\n";
     retVal += "n: " + getTuningName() + "\n";
     retVal += "m: " + _microtoneArray.getDebugDescription() + "\n";
-    retVal += "p: " + _processedArray.getDebugDescription() + "\n";
+    retVal += "p: " + _getProcessedArray().getDebugDescription() + "\n";
     retVal += ")\n";
 
     return retVal;
@@ -372,7 +370,7 @@ ScalaFile TuningImp::tuningAsScala() {
 
     // update tuning
     _update();
-    auto deep_copy = MicrotoneArray(_processedArray);
+    auto deep_copy = MicrotoneArray(_getProcessedArray());
     auto const pac = deep_copy.count();
     auto scalaFile = ScalaFile();
 
@@ -429,10 +427,12 @@ String TuningImp::defaultScalaName() {
 }
 
 String TuningImp::scalaComments() {
+    const ScopedLock sl(_lock);
     String retVal = "!\n";
-    auto const count = _processedArray.count();
+    auto& processedArray = _getProcessedArray();
+    auto const count = processedArray.count();
     for (unsigned long i = 0; i < count; i++) {
-        auto mt = _processedArray.microtoneAtIndex(i);
+        auto mt = processedArray.microtoneAtIndex(i);
         auto mt_f = mt->getFrequencyValue();
         auto mt_desc = mt->getShortDescriptionText();
         retVal += "! " + String(i) + ": " + String(mt_f) + " # " + String(mt_desc);
@@ -491,37 +491,70 @@ int TuningImp::nnForDeviceSpace(Point<int> xy) {
 
 #pragma mark - Update
 
+// full update: the whole chain, deferred if inside a batch
+void TuningImp::_update() {
+    _requestUpdate(UpdateStage::Full);
+}
+
+/**
+ * @brief Updates now, or records the stage so the outermost endUpdate() can update once.
+ * @param stage The earliest stage of the chain that changed.  Pending stages are merged by taking the earliest.
+ */
+void TuningImp::_requestUpdate(UpdateStage stage) {
+    const ScopedLock sl(_lock);
+    if(_updateDepth > 0) {
+        _pendingUpdateStage = jmax(_pendingUpdateStage, stage);
+        return;
+    }
+    _updateFromStage(stage);
+}
+
+void TuningImp::beginUpdate() {
+    const ScopedLock sl(_lock);
+    _updateDepth++;
+}
+
+void TuningImp::endUpdate() {
+    const ScopedLock sl(_lock);
+    jassert(_updateDepth > 0);
+    _updateDepth = jmax(0, _updateDepth - 1);
+    if(_updateDepth == 0 && _pendingUpdateStage != UpdateStage::None) {
+        auto const stage = _pendingUpdateStage;
+        _pendingUpdateStage = UpdateStage::None;
+        _updateFromStage(stage);
+    }
+}
+
+uint64_t TuningImp::getUpdateCount() {
+    const ScopedLock sl(_lock);
+    return _updateCount;
+}
+
 /**
- * @brief This method updates the tuning implementation.
+ * @brief This method updates the tuning implementation, starting at the given stage.
  * 
  * This method is one of the most important methods for the application. It is responsible for updating the tuning implementation.
- * It starts by creating a deep copy of the microtone array before processing. Then, it performs octave reduction if the flag is set.
- * After that, it sorts the array if the flag is set. It also removes duplicate microtones if the flag is set.
+ * A Full update processes the microtone array into flat buffers: octave reduction, sort, and uniquify if the flags are set, then the npo override.
+ * An NPOOverride update only re-runs the npo override on the existing flat buffer, and a TuningTable update skips both.
  * 
- * The method then calculates the frequency for each MIDI note number and sets it in the tuning table. It also sets the microtone at each note number.
+ * The method then calculates the frequency for each MIDI note number and sets it in the tuning table. It also records the degree and
+ * register of each note number so the Microtone at each note number can be built when it is asked for.
+ * Triads are only re-analyzed for a Full update; an NPOOverride update only re-maps them to the new npo degrees.
  * 
- * If the count of the processed array is zero, it sets the frequency for each MIDI note number to the frequency of middle C and sets the microtone at each note number to middle C.
+ * If the count of the processed array is zero, it sets the frequency for each MIDI note number to the frequency of middle C.
  * 	
  * Finally, it calls the post-process block and the completion block.
  */
-void TuningImp::_update() {
+void TuningImp::_updateFromStage(UpdateStage stage) {
     const ScopedLock sl(_lock);
-    _processedArray = MicrotoneArray(_microtoneArray);
-    if (_octaveReduce) {
-        _processedArray = _processedArray.octaveReduce(_octave);
-    }
-    if (_canSort && _sort) {
-        _processedArray = _processedArray.sort();
+    jassert(stage != UpdateStage::None);
+    if(stage == UpdateStage::Full) {
+        _processMicrotoneArray(_octaveReduce, _canSort && _sort, _canUniquify && _uniquify, _canNPOOverride && _npoOverrideEnable);
+    } else if(stage == UpdateStage::NPOOverride) {
+        _processNPOOverride(_canNPOOverride && _npoOverrideEnable);
     }
-    if (_canUniquify && _uniquify) {
-        _processedArray = _processedArray.uniquify();
-    }
-    
-    auto const count = (_canNPOOverride && _npoOverrideEnable) ? static_cast<unsigned long>(_npoOverride) : _processedArray.count();
-    auto [processedArrayNPO, processedArrayNPOMap] = _processedArray.npoOverride(static_cast<int>(count));
-    _processedArrayNPO = processedArrayNPO;
-    _processedArrayNPOMap = processedArrayNPOMap;
-    
+    auto const count = _processedFlatNPO.count();
+    auto const octaveFactor = powf(_octave, _octaveMiddleC);
     if(count > 0) {
         for(int i = 0; i < static_cast<int>(WilsonicProcessorConstants::numMidiNotes); i++) { // keep as int
             // Calculate the frequency for each MIDI note number
@@ -536,32 +569,31 @@ void TuningImp::_update() {
                 finc += 1.f;
             }
             auto const index = static_cast<unsigned long>(roundf(frac * static_cast<float>(count)));
-            auto tone = _processedArrayNPO.microtoneAtIndex(index)->clone();
-            tone->setMidiNoteNumber(static_cast<unsigned long>(i));
-            tone->setMidiRegister(static_cast<int>(finc));
-            tone->setFilterNote(false);
+            jassert(index < count);
+            _noteNumberDegree[static_cast<size_t>(i)] = static_cast<int>(index);
+            _noteNumberRegister[static_cast<size_t>(i)] = static_cast<int>(finc);
             auto const lp2 = powf(_octave, finc);
-            auto const octaveFactor = powf(_octave, _octaveMiddleC);
-            auto const nf = tone->getFrequencyValue();
+            auto const nf = _processedFlatNPO.frequencyAtIndex(index);
             auto const f = nf * lp2 * _frequencyMiddleC * octaveFactor;
             _tuningTable.setTuningTable(f, static_cast<unsigned long>(i)); // this is asserting on nyquist
-            setMicrotoneAtNoteNumber(tone, static_cast<unsigned long>(i));
         }
-        _analyzeProportionalTriads();
+        if(stage == UpdateStage::Full) {
+            _analyzeProportionalTriads();
+        } else if(stage == UpdateStage::NPOOverride) {
+            _mapTriadsToNPOOverride(); // same processed array, same triads
+        }
     } else { // count == 0 ==> UNITY
         // If the count of the processed array is zero, set the frequency for each MIDI note number to the frequency of middle C
-        auto middleC = make_shared<Microtone>(1,1);
-        middleC->setMidiNoteNumber(_noteNumberMiddleC);
-        middleC->setMidiRegister(0);
-        middleC->setFilterNote(false);
         for (unsigned long i = 0; i < WilsonicProcessorConstants::numMidiNotes; i++) {
-            auto const octaveFactor = powf(_octave, _octaveMiddleC);
             auto const f = _frequencyMiddleC * octaveFactor;
             _tuningTable.setTuningTable(f, i);
-            setMicrotoneAtNoteNumber(middleC->clone(), i);
+            _noteNumberDegree[i] = -1;
+            _noteNumberRegister[i] = 0;
         }
         // No scale analysis for this case
     }
+    _microtoneNNIsStale = true;
+    _updateCount++;
 
     // Call the post-process block
     callPostProcessBlock();
@@ -570,6 +602,118 @@ void TuningImp::_update() {
     callOnTuningUpdate();
 }
 
+/**
+ * @brief Processes _microtoneArray into _processedFlat and _processedFlatNPO.
+ *
+ * Reads each source microtone once, then octave reduces, sorts, uniquifies and npo overrides in place.
+ * No Microtone objects are created; the MicrotoneArrays returned by getProcessedArray() etc. are built lazily.
+ */
+void TuningImp::_processMicrotoneArray(bool octaveReduce, bool sort, bool uniquify, bool npoOverride) {
+    const ScopedLock sl(_lock);
+    auto const n = _microtoneArray.count();
+    _processedFlat.clear();
+    _processedFlat.reserve(n);
+    for(unsigned long i = 0; i < n; i++) {
+        auto const mt = _microtoneArray.microtoneAtIndex(i);
+        if(mt->getSpace() == Microtone::Space::LogPeriod) {
+            _processedFlat.addLogPeriod(mt->getPitchValue01(), mt->getPeriod(), i);
+        } else if(mt->isRational()) {
+            _processedFlat.addRational(mt->getNumerator(), mt->getDenominator(), i);
+        } else {
+            _processedFlat.addFrequency(mt->getFrequencyValue(), i);
+        }
+    }
+    if(octaveReduce) {
+        _processedFlat.octaveReduce(_octave);
+    }
+    if(sort) {
+        _processedFlat.sort();
+    }
+    if(uniquify) {
+        _processedFlat.uniquify();
+    }
+    _processedFlatIsOctaveReduced = octaveReduce;
+    _processNPOOverride(npoOverride);
+}
+
+/**
+ * @brief Re-runs only the npo override of the chain, on the current _processedFlat.
+ */
+void TuningImp::_processNPOOverride(bool npoOverride) {
+    const ScopedLock sl(_lock);
+    auto const count = npoOverride ? _npoOverride : static_cast<int>(_processedFlat.count());
+    _processedFlat.npoOverride(count, _processedFlatNPO, _processedArrayNPOMap);
+    _processedArraysAreStale = true;
+}
+
+/**
+ * @brief Builds the Microtone objects for the processed arrays, if they are stale.
+ *
+ * Each entry is a clone of its source microtone, octave reduced the same way the flat array was,
+ * so descriptions, rationals and Gral points are preserved.
+ */
+MicrotoneArray& TuningImp::_getProcessedArray() {
+    const ScopedLock sl(_lock);
+    if(_processedArraysAreStale) {
+        _processedArraysAreStale = false;
+        auto build = [this](FlatMicrotoneArray& flat, MicrotoneArray& dest) {
+            dest.removeAllMicrotones();
+            for(size_t i = 0; i < flat.count(); i++) {
+                auto mt = _microtoneArray.microtoneAtIndex(flat.sourceIndexAtIndex(i))->clone();
+                if(_processedFlatIsOctaveReduced) {
+                    mt->octaveReduce(_octave);
+                }
+                dest.addMicrotone(mt);
+            }
+        };
+        build(_processedFlat, _processedArray);
+        build(_processedFlatNPO, _processedArrayNPO);
+    }
+
+    return _processedArray;
+}
+
+MicrotoneArray& TuningImp::_getProcessedArrayNPO() {
+    const ScopedLock sl(_lock);
+    _getProcessedArray(); // builds both
+
+    return _processedArrayNPO;
+}
+
+/**
+ * @brief Builds the Microtone at each note number, if they are stale.
+ *
+ * All 128 are built at once so that a post-process block (i.e., Gral) can annotate them and
+ * have those annotations persist until the next update.
+ */
+void TuningImp::_buildMicrotoneNN() {
+    const ScopedLock sl(_lock);
+    if(!_microtoneNNIsStale) {
+        return;
+    }
+    _microtoneNNIsStale = false;
+    if(_processedFlatNPO.count() > 0) {
+        auto& processedArrayNPO = _getProcessedArrayNPO();
+        for(unsigned long i = 0; i < WilsonicProcessorConstants::numMidiNotes; i++) {
+            auto const degree = _noteNumberDegree[i];
+            jassert(degree >= 0);
+            auto tone = processedArrayNPO.microtoneAtIndex(static_cast<unsigned long>(degree))->clone();
+            tone->setMidiNoteNumber(i);
+            tone->setMidiRegister(_noteNumberRegister[i]);
+            tone->setFilterNote(false);
+            _microtoneNN[i] = tone;
+        }
+    } else {
+        auto middleC = make_shared<Microtone>(1,1);
+        middleC->setMidiNoteNumber(_noteNumberMiddleC);
+        middleC->setMidiRegister(0);
+        middleC->setFilterNote(false);
+        for(unsigned long i = 0; i < WilsonicProcessorConstants::numMidiNotes; i++) {
+            _microtoneNN[i] = middleC->clone();
+        }
+    }
+}
+
 // block will be called after microtones are processed, but before onTuningUpdate
 void TuningImp::setPostProcessPreTuningUpdate(function<void()> postProcessBlock) {
     _postProcessBlock = postProcessBlock;
@@ -583,7 +727,7 @@ void TuningImp::callPostProcessBlock() {
 
 void TuningImp::setOnTuningUpdate(function<void()> completionBlock) {
     _completionBlock = completionBlock;
-    _update(); // which calls the completion block
+    _requestUpdate(UpdateStage::TuningTable); // which calls the completion block
 }
 
 void TuningImp::callOnTuningUpdate() {
@@ -601,13 +745,13 @@ void TuningImp::setMicrotoneArrayFromHarmonics(vector<float> harmonics) {
         }
     }
 
-    _update();
+    _requestUpdate(UpdateStage::Full);
 }
 
 void TuningImp::setMicrotoneArray(MicrotoneArray ma) {
     const ScopedLock sl(_lock);
     _microtoneArray = MicrotoneArray(ma);
-    _update();
+    _requestUpdate(UpdateStage::Full);
 }
 
 MicrotoneArray TuningImp::getMicrotoneArray() {
@@ -617,12 +761,12 @@ MicrotoneArray TuningImp::getMicrotoneArray() {
 
 MicrotoneArray TuningImp::getProcessedArray() {
     const ScopedLock sl(_lock);
-    return MicrotoneArray(_processedArray); // return copy
+    return MicrotoneArray(_getProcessedArray()); // return copy
 }
 
 MicrotoneArray TuningImp::getProcessedArrayNPO() {
     const ScopedLock sl(_lock);
-    return MicrotoneArray(_processedArrayNPO); // return copy
+    return MicrotoneArray(_getProcessedArrayNPO()); // return copy
 }
 
 unsigned long TuningImp::getMicrotoneArrayCount() {
@@ -632,12 +776,12 @@ unsigned long TuningImp::getMicrotoneArrayCount() {
 
 unsigned long TuningImp::getProcessedArrayCount() {
     const ScopedLock sl(_lock);
-    return _processedArray.count();
+    return _processedFlat.count();
 }
 
 unsigned long TuningImp::getProcessedArrayNPOCount() {
     const ScopedLock sl(_lock);
-    return _processedArrayNPO.count();
+    return _processedFlatNPO.count();
 }
 
 const vector<PythagoreanMeans> TuningImp::getProportionalTriads() { // "major", sum tones
@@ -663,15 +807,21 @@ const vector<PythagoreanMeans> TuningImp::getAllTriads() {
 void TuningImp::setMicrotoneAtNoteNumber(Microtone_p microtone, unsigned long nn) {
     jassert(nn >= 0 && nn < WilsonicProcessorConstants::numMidiNotes);
     const ScopedLock sl(_lock);
+    _buildMicrotoneNN();
     _microtoneNN[nn] = microtone;
 }
 
 Microtone_p TuningImp::microtoneAtNoteNumber(unsigned long nn) {
     jassert(nn >= 0 && nn < WilsonicProcessorConstants::numMidiNotes);
     const ScopedLock sl(_lock);
+    _buildMicrotoneNN();
     return _microtoneNN[nn];
 }
 
+bool TuningImp::getFilterNoteAtNoteNumber(unsigned long nn) {
+    return microtoneAtNoteNumber(nn)->getFilterNote();
+}
+
 const float TuningImp::getSampleRate() {
     return _tuningTable.getSampleRate();
 }
@@ -681,7 +831,7 @@ void TuningImp::setSampleRate(float sampleRate) {
     // only doing this here because we want to update tuningTable if samplerate changes
     if(WilsonicMath::floatsAreNotEqual(sampleRate, _tuningTable.getSampleRate())) {
         _tuningTable.setSampleRate(sampleRate);
-        _update();
+        _requestUpdate(UpdateStage::TuningTable);
     }
 }
 
@@ -773,89 +923,29 @@ void TuningImp::_analyzeIntervals() {
  * @brief Analyzes the proportional triads of the tuning.
  * 
  * This function analyzes the proportional triads of the tuning. It calculates the major and minor triads for each note in the tuning and stores them in the respective member variables.
- * The function also checks for duplicate triads and skips them. The function uses a tolerance value to determine if a note is part of a triad.
+ * The search itself is done by TriadAnalyzer; triads that wrap around the period are not reported, as before.
  *
  * Note that this method uses _processedArray, NOT _processedArrayNPO
  *
  * @note This helper function is called during the update process of the tuning.
  */
 void TuningImp::_analyzeProportionalTriads() {
-    // Enable logging
-    //constexpr bool logging_enabled = false;
-
-    // Definitions for de-duping triads
-    typedef set<unsigned long> SUL;
-    typedef map<SUL, unsigned long> TM;
-    TM pmt, gmt, smt;
-
     // Lock to prevent other threads from accessing the same data simultaneously
     const ScopedLock sl(_lock);
 
-    // Get the count of the processed array (NOT the _processedArrayNPO!)
-    auto const npo = _processedArray.count();
-    vector<PythagoreanMeans> proportionalTriads;
-    vector<PythagoreanMeans> subcontraryTriads;
-    vector<PythagoreanMeans> allTriads;
-
-    // Trivial NOP
-    if(npo < 3) {
-        //DBG ("Can NOT analyze proportional triads because # terms is less than 3");
-        return;
-    }
+    // Analyze the processed array (NOT the _processedArrayNPO!)
+    _triadAnalyzer.analyze(_processedFlat.getFrequencies());
+    _mapTriadsToNPOOverride();
+}
 
-    // TODO: make this a continuous fn so that we ease in/out of the ui
-    //    auto const tolerance = 0.0001;
-    //    auto const tolerance = 0.001;
-    auto const tolerance = 0.0005;
-
-    // i.e., Triad (i, k, j)
-    for(unsigned long i = 0; i < npo; i++) { // root
-        auto const im = _processedArray.microtoneAtIndex(i);
-        auto const imf = im->getFrequencyValue();
-        for(unsigned long j = i + 2; j < npo + 2; j++) { // fifth
-            auto const ji = j % npo;
-            auto const jfac = (ji < j) ? _octave : 1;
-            auto const jm = _processedArray.microtoneAtIndex(ji);
-            auto const jmf = jfac * jm->getFrequencyValue();
-            auto const major = (imf + jmf) / 2;
-            auto const minor = 2 * (imf * jmf) / (imf + jmf);
-            constexpr float major_2nd = 9.f/8.f;
-            constexpr float fourth = 4.f/3.f;
-            auto const majorInLimits = (major / imf > major_2nd && major / imf < fourth);
-            auto const minorInLimits = (minor / imf > major_2nd && minor / imf < fourth);
-            for(unsigned long k = i + 1; k < j; k++) { // third
-                auto const ki = k % npo;
-                auto const kfac = (ki < k) ? _octave : 1;
-                auto const km = _processedArray.microtoneAtIndex(ki);
-                auto const kmf = kfac * km->getFrequencyValue();
-
-                // major
-                if (majorInLimits && fabsf(major - kmf) < tolerance) {
-                    // dedup dedup
-                    SUL mt = {i, ki, ji};
-                    if (pmt.find(mt) == pmt.end()) {
-                        pmt[mt] = 1UL; // add to dedup list
-                        auto majorTriad = PythagoreanMeans(i, k, j, PythagoreanMeans::Type::Proportional);
-                        proportionalTriads.push_back(majorTriad);
-                        allTriads.push_back(majorTriad);
-                    }
-                }
+/**
+ * @brief Transforms the triads of the processed array into degrees of the npo override array.
+ *
+ * Only depends on the npo map, so an npo override change does not need a new analysis.
+ */
+void TuningImp::_mapTriadsToNPOOverride() {
+    const ScopedLock sl(_lock);
 
-                // minor
-                if (minorInLimits && fabsf(minor - kmf) < tolerance) {
-                    // dedup dedup
-                    SUL mt = {i, ki, ji};
-                    if (smt.find(mt) == smt.end()) {
-                        smt[mt] = 1UL; // add to dedup list
-                        auto minorTriad = PythagoreanMeans(i, k, j, PythagoreanMeans::Type::Subcontrary);
-                        subcontraryTriads.push_back(minorTriad);
-                        allTriads.push_back(minorTriad);
-                    }
-                }
-            }
-        }
-    }
-    
     // filter/transform by npo override
     _proportionalTriads.clear();
     _geometricTriads.clear();
@@ -864,8 +954,7 @@ void TuningImp::_analyzeProportionalTriads() {
 
     auto isTriadInNPOOverride = [&](auto& triad) -> bool {
         auto isDegreeInMap = [&](auto const degree) -> bool {
-            auto it = _processedArrayNPOMap.find(static_cast<int>(degree));
-            return it != _processedArrayNPOMap.end();
+            return degree < _processedArrayNPOMap.size() && _processedArrayNPOMap[degree] >= 0;
         };
         
         return isDegreeInMap(triad.getRoot()) &&
@@ -874,15 +963,15 @@ void TuningImp::_analyzeProportionalTriads() {
     };
     
     auto xfmTriad = [&](PythagoreanMeans& triad) -> PythagoreanMeans {
-        auto const root = _processedArrayNPOMap[static_cast<int>(triad.getRoot())];
-        auto const third = _processedArrayNPOMap[static_cast<int>(triad.getThird())];
-        auto const fifth = _processedArrayNPOMap[static_cast<int>(triad.getFifth())];
+        auto const root = _processedArrayNPOMap[triad.getRoot()];
+        auto const third = _processedArrayNPOMap[triad.getThird()];
+        auto const fifth = _processedArrayNPOMap[triad.getFifth()];
         auto retTriad = PythagoreanMeans(static_cast<unsigned long>(root), static_cast<unsigned long>(third), static_cast<unsigned long>(fifth), triad.getType());
         
         return retTriad;
     };
     
-    for(auto& triad : proportionalTriads) {
+    for(auto triad : _triadAnalyzer.getProportionalTriads()) {
         if(isTriadInNPOOverride(triad)) {
             auto convertedTriad = xfmTriad(triad);
             _proportionalTriads.push_back(convertedTriad);
@@ -890,7 +979,7 @@ void TuningImp::_analyzeProportionalTriads() {
         }
     }
     
-    for(auto& triad : subcontraryTriads) {
+    for(auto triad : _triadAnalyzer.getSubcontraryTriads()) {
         if(isTriadInNPOOverride(triad)) {
             auto convertedTriad = xfmTriad(triad);
             _subcontraryTriads.push_back(convertedTriad);
@@ -906,7 +995,7 @@ ostream& operator << (ostream& os, TuningImp& m) {
     os << "d: " << m.getTuningDescription() << "\n";
     os << "c: " << m.getUserDescription() << "\n";
     os << "m: " << m._microtoneArray << "\n";
-    os << "p: " << m._processedArray << "\n";
+    os << "p: " << m._getProcessedArray() << "\n";
 
     return os;
 }
@@ -9,8 +9,10 @@
 
 #include <JuceHeader.h>
 #include "AppExperiments.h"
+#include "FlatMicrotoneArray.h"
 #include "Microtone.h"
 #include "MicrotoneArray.h"
+#include "TriadAnalyzer.h"
 #include "Tuning.h"
 #include "TuningTableImp.h"
 #include "WilsonicProcessorConstants.h"
@@ -36,7 +38,8 @@ public:
 protected:
     void _update() override;
     void _analyzeIntervals();
-    void _analyzeProportionalTriads();
+    void _analyzeProportionalTriads(); // _processedFlat -> triads
+    void _mapTriadsToNPOOverride(); // triads -> npo override degrees
     void _paintHelper(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bounds);
     AffineTransform _cartesian2HexTransform(Point<float> hp); // Returns an AffineTransform representing the transformation from Cartesian to hexagonal coordinates.
     Point<float> _octaveReduceGralPoint(Point<float> inPoint, Point<float> octavePoint, bool degreeIsPositive); // Reduces a Gral point to within an octave.
@@ -66,6 +69,7 @@ public:
     
     void setMicrotoneAtNoteNumber(Microtone_p microtone, unsigned long nn) override;
     Microtone_p microtoneAtNoteNumber(unsigned long nn) override;
+    bool getFilterNoteAtNoteNumber(unsigned long nn) override;
 
     void setPostProcessPreTuningUpdate(function<void()> postProcessBlock) override;
     void callPostProcessBlock() override;
@@ -139,6 +143,11 @@ public:
     String defaultScalaName() override;
     String scalaComments() override;
 
+    // batch updates
+    void beginUpdate() override;
+    void endUpdate() override;
+    uint64_t getUpdateCount() override;
+
     bool canPaintTuning() override;
     void paint(WilsonicProcessor& processor, Graphics& g, Rectangle<int> bounds) override;
     virtual int nnForDeviceSpace(Point<int> xy); // Returns the note number for a given device space, usually updated by paint
@@ -212,12 +221,28 @@ protected:
     // pitch class
     MicrotoneArray _microtoneArray;
 
-    // pitch class after being reduced, sorted, and uniquified
-    MicrotoneArray _processedArray {};
-    MicrotoneArray _processedArrayNPO {};
-    map<int, int> _processedArrayNPOMap {}; // npo override indices -> original npo indices
+    // pitch class after being reduced, sorted, and uniquified.
+    // The flat arrays are the source of truth, the MicrotoneArrays are built lazily for the UI
+    FlatMicrotoneArray _processedFlat {};
+    FlatMicrotoneArray _processedFlatNPO {};
+    vector<int> _processedArrayNPOMap {}; // original npo indices -> first npo override index, or -1
+    void _processMicrotoneArray(bool octaveReduce, bool sort, bool uniquify, bool npoOverride); // _microtoneArray -> flat arrays
+    void _processNPOOverride(bool npoOverride); // _processedFlat -> _processedFlatNPO
+    MicrotoneArray& _getProcessedArray(); // lazily built from _processedFlat
+    MicrotoneArray& _getProcessedArrayNPO(); // lazily built from _processedFlatNPO
     void _gralPostProcessBlockImp(); // updates Gral after tuning update
 
+    // the earliest stage of the processing chain that has to be recomputed
+    enum class UpdateStage {
+        None = 0,
+        TuningTable = 1, // middle C, sample rate: the tuning table only
+        NPOOverride = 2, // npo override: _processedFlatNPO, triads, and the tuning table
+        Full = 3 // microtones, period, reduce/sort/uniquify: the whole chain
+    };
+    void _requestUpdate(UpdateStage stage); // updates now, or at the outermost endUpdate() when inside a batch
+    virtual void _updateFromStage(UpdateStage stage); // recomputes from stage to the end of the chain, and increments _updateCount
+    uint64_t _updateCount = 0;
+
     // lock
     CriticalSection _lock;
     
@@ -243,14 +268,31 @@ protected:
 
 
 private:
-    // arrays of triads from this processed master set
+    // triads of _processedFlat
+    TriadAnalyzer _triadAnalyzer {};
+
+    // arrays of triads from this processed master set, in npo override degrees
     vector<PythagoreanMeans> _proportionalTriads {};
     vector<PythagoreanMeans> _geometricTriads {};
     vector<PythagoreanMeans> _subcontraryTriads {};
     vector<PythagoreanMeans> _allTriads {};
 
-    // Maps midi note numbers to the source microtone
+    // lazily built Microtone objects
+    MicrotoneArray _processedArray {};
+    MicrotoneArray _processedArrayNPO {};
+    bool _processedArraysAreStale = true;
+    bool _processedFlatIsOctaveReduced = true;
+
+    // Maps midi note numbers to the source microtone, built lazily from the degree/register below
     array<Microtone_p, WilsonicProcessorConstants::numMidiNotes> _microtoneNN {};
+    array<int, WilsonicProcessorConstants::numMidiNotes> _noteNumberDegree {}; // index into _processedFlatNPO, -1 = unity
+    array<int, WilsonicProcessorConstants::numMidiNotes> _noteNumberRegister {};
+    bool _microtoneNNIsStale = true;
+    void _buildMicrotoneNN();
+
+    // batch updates
+    int _updateDepth = 0;
+    UpdateStage _pendingUpdateStage = UpdateStage::None;
 
     // completion handlers
     function<void()> _postProcessBlock;
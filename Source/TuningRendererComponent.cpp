@@ -19,6 +19,7 @@
 
 TuningRendererComponent::TuningRendererComponent(WilsonicProcessor& processor, bool updateBasedOnSynth)
 : WilsonicComponentBase(processor)
+, FrameTimer(this)
 , _updateBasedOnAppTuningSynthNotes(updateBasedOnSynth)
 {
     _timerHelper();
@@ -26,7 +27,7 @@ TuningRendererComponent::TuningRendererComponent(WilsonicProcessor& processor, b
 
 TuningRendererComponent::~TuningRendererComponent()
 {
-    stopTimer();
+    stopFrameTimer();
 }
 
 #pragma mark - drawing
@@ -201,7 +202,7 @@ void TuningRendererComponent::_paint04(Graphics& g) {
 
 #if JucePlugin_IsSynth
     // optimization
-    auto vs = _processor.getVoiceStates();
+    auto const& vs = _processor.getVoiceStates();
     if(vs.noVoicesPlaying()) {
         return;
     }
@@ -209,7 +210,7 @@ void TuningRendererComponent::_paint04(Graphics& g) {
     // render playing notes
     if(_updateBasedOnAppTuningSynthNotes) {
         // draw a dynamic line+dot for each microtone based on voice amplitude
-        for(unsigned long i = 0; i < WilsonicProcessorConstants::numVoices; i++) {
+        for(unsigned long i = 0; i < WilsonicProcessorConstants::maxVoices; i++) {
             // experiment plumbing _appTuning into pitch wheel
             auto tolerance = 0.001f; // technically the tolerance comparison should be in pitch space
             auto v = vs.voiceState[i];
@@ -276,7 +277,7 @@ void TuningRendererComponent::setUpdateBasedOnAppTuningSynthNotes(bool update) {
 }
 
 void TuningRendererComponent::_timerHelper() {
-    stopTimer();
+    stopFrameTimer();
     if(_tuning == nullptr || !_updateBasedOnAppTuningSynthNotes) {
         
         return;
@@ -287,10 +288,10 @@ void TuningRendererComponent::_timerHelper() {
         auto const hz = AppExperiments::getFrameRateForNPO(npo);
         if(hz > 0) {
             //DBG ("TuningRendererComponent timer STARTED for npo:" << npo << ", hz: " << hz);
-            startTimerHz(hz);
+            startFrameTimerHz(hz);
         } else {
             //DBG ("TuningRendererComponent timer STOPPED for npo:" << npo << ", hz: " << hz);
-            stopTimer();
+            stopFrameTimer();
         }
     }
 }
@@ -313,7 +314,7 @@ void TuningRendererComponent::setTuning(shared_ptr<Tuning> inputTuning) {
 
 #pragma mark - Timer
 
-void TuningRendererComponent::timerCallback() {
+void TuningRendererComponent::frameCallback() {
     if(isShowing()) {
         repaint();
     }
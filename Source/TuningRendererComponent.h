@@ -9,6 +9,7 @@
 
 #include <JuceHeader.h>
 #include "AppTuningModel.h"
+#include "FrameTimer.h"
 #include "TuningImp.h"
 #include "Tuning_Include.h"
 #include "WilsonicAppSkin.h"
@@ -18,11 +19,11 @@
 /**
  * @class TuningRendererComponent
  * @brief This class is responsible for rendering the tuning.
- * @details It extends the WilsonicComponentBase and implements a Timer.
+ * @details It extends the WilsonicComponentBase and implements a FrameTimer.
  */
 class TuningRendererComponent
 : public WilsonicComponentBase
-, private Timer
+, private FrameTimer
 {
     // lifecycle
 public:
@@ -74,6 +75,6 @@ private:
 
     // private methods
     void _paint04(Graphics&);
-    void timerCallback() override;
+    void frameCallback() override;
     void _timerHelper();
 };
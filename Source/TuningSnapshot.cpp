@@ -0,0 +1,91 @@
+/**
+ * @file TuningSnapshot.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the TuningSnapshotBuffer class.
+ */
+
+#include "TuningSnapshot.h"
+#include "TuningConstants.h"
+
+#pragma mark - lifecycle
+
+TuningSnapshotBuffer::TuningSnapshotBuffer() {
+    // default to 12ET, same as TuningTableImp
+    auto& slot = _slots[0];
+    for(unsigned long i = 0; i < WilsonicProcessorConstants::numMidiNotes; i++) {
+        slot.snapshot.frequencies[i] = static_cast<float>(TuningConstants::defaultFrequencyA69 * exp2f((static_cast<float>(i) - static_cast<float>(TuningConstants::defaultNoteNumberA69)) / 12.f));
+    }
+    _current.store(&slot, std::memory_order_release);
+    _writeIndex = 1;
+}
+
+#pragma mark - writer
+
+/**
+ * @brief Copies snapshot into the next free slot, then makes it current.
+ *
+ * The slot written is never the current one, so a reader that loaded the current pointer
+ * can only be disturbed if this is called __numSlots - 1 more times before it finishes reading.
+ */
+void TuningSnapshotBuffer::publish(const TuningSnapshot& snapshot) {
+    auto& slot = _slots[_writeIndex];
+    _writeIndex = (_writeIndex + 1) % __numSlots;
+    jassert(&slot != _current.load(std::memory_order_relaxed));
+    auto const sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed); // odd: writing
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.snapshot = snapshot;
+    slot.sequence.store(sequence + 2, std::memory_order_release); // even: done
+    _current.store(&slot, std::memory_order_release);
+}
+
+void TuningSnapshotBuffer::setMorphPositionSource(const atomic<float>* morph_position) {
+    _morphPosition = morph_position;
+}
+
+#pragma mark - readers
+
+// calls reader on the current snapshot until it gets a result that was not overwritten while reading
+template<typename Reader>
+auto TuningSnapshotBuffer::_readConsistent(Reader reader) const -> decltype(reader(declval<const TuningSnapshot&>())) {
+    for(;;) {
+        auto const slot = _current.load(std::memory_order_acquire);
+        auto const sequence = slot->sequence.load(std::memory_order_acquire);
+        if((sequence & 1) == 0) {
+            auto result = reader(slot->snapshot);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(slot->sequence.load(std::memory_order_relaxed) == sequence) {
+                return result;
+            }
+        }
+    }
+}
+
+void TuningSnapshotBuffer::read(TuningSnapshot& dest) const {
+    dest = _readConsistent([](const TuningSnapshot& s) { return s; });
+}
+
+float TuningSnapshotBuffer::getFrequency(unsigned long nn) const {
+    auto const i = jlimit<unsigned long>(0, WilsonicProcessorConstants::numMidiNotes - 1, nn);
+    if(_morphPosition == nullptr) {
+        return _readConsistent([i](const TuningSnapshot& s) { return s.frequencies[i]; });
+    }
+    auto const t = _morphPosition->load(std::memory_order_relaxed);
+    return _readConsistent([i, t](const TuningSnapshot& s) {
+        return s.morphIsEnabled ? s.morphPath.evaluate(i, t, s.morphInterpolation) : s.frequencies[i];
+    });
+}
+
+bool TuningSnapshotBuffer::getFilterNote(unsigned long nn) const {
+    auto const i = jlimit<unsigned long>(0, WilsonicProcessorConstants::numMidiNotes - 1, nn);
+    return _readConsistent([i](const TuningSnapshot& s) { return s.filterNotes[i]; });
+}
+
+unsigned long TuningSnapshotBuffer::getNPO() const {
+    return _readConsistent([](const TuningSnapshot& s) { return s.npo; });
+}
+
+float TuningSnapshotBuffer::getPeriod() const {
+    return _readConsistent([](const TuningSnapshot& s) { return s.period; });
+}
@@ -0,0 +1,79 @@
+/**
+ * @file TuningSnapshot.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the TuningSnapshot struct and the TuningSnapshotBuffer class.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "MorphPath.h"
+#include "Tuning_Include.h"
+#include "WilsonicProcessorConstants.h"
+
+/**
+ * @struct TuningSnapshot
+ * @brief An immutable copy of everything the audio thread needs from the global tuning.
+ */
+struct TuningSnapshot final
+{
+    array<float, WilsonicProcessorConstants::numMidiNotes> frequencies {};
+    bitset<WilsonicProcessorConstants::numMidiNotes> filterNotes {};
+    unsigned long npo = 12;
+    float period = 2.f;
+
+    // Morph: when enabled getFrequency() interpolates the endpoints at the current morph position,
+    // instead of reading frequencies, which are only updated at the ui rate.
+    bool morphIsEnabled = false;
+    MorphPath::Interpolation morphInterpolation = MorphPath::Interpolation::Linear;
+    MorphPath morphPath {};
+};
+
+/**
+ * @class TuningSnapshotBuffer
+ * @brief Publishes TuningSnapshots from AppTuningModel to the audio thread without locks.
+ *
+ * The writer fills a preallocated slot that is not the current one, then swaps it in with an atomic
+ * pointer store (RCU style).  Readers never lock, allocate, or touch a refcount.  Each slot also has
+ * a sequence number, so in the unlikely case that the writer laps a reader the reader retries
+ * instead of seeing a half-written table.
+ *
+ * One writer (AppTuningModel, under its lock), any number of readers.
+ */
+class TuningSnapshotBuffer final
+{
+public:
+    // lifecycle
+    TuningSnapshotBuffer(); // 12ET
+    ~TuningSnapshotBuffer() = default;
+    TuningSnapshotBuffer(const TuningSnapshotBuffer&) = delete;
+    TuningSnapshotBuffer& operator=(const TuningSnapshotBuffer&) = delete;
+
+    // writer
+    void publish(const TuningSnapshot& snapshot);
+
+    // the morph position, i.e. the raw value of the morph interpolation parameter.  Set once, before audio starts.
+    void setMorphPositionSource(const atomic<float>* morph_position);
+
+    // readers: wait-free unless a publish is in progress on the same slot
+    void read(TuningSnapshot& dest) const; ///< copies the whole current snapshot
+    float getFrequency(unsigned long nn) const; ///< nn is clamped to [0, 127].  Morphs at the current position.
+    bool getFilterNote(unsigned long nn) const; ///< nn is clamped to [0, 127]
+    unsigned long getNPO() const;
+    float getPeriod() const;
+
+private:
+    struct Slot {
+        atomic<uint32_t> sequence {0}; // odd while being written
+        TuningSnapshot snapshot {};
+    };
+    static constexpr size_t __numSlots = 3;
+    array<Slot, __numSlots> _slots {};
+    atomic<Slot*> _current {nullptr};
+    const atomic<float>* _morphPosition = nullptr;
+    size_t _writeIndex = 0; // writer only
+
+    template<typename Reader>
+    auto _readConsistent(Reader reader) const -> decltype(reader(declval<const TuningSnapshot&>()));
+};
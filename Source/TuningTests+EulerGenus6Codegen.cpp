@@ -22,7 +22,7 @@
 #include "CPS_6_5.h"
 #include "CPS_6_6.h"
 
-// code gen...creates code for 13 files
+// code gen...creates the EulerGenusTables data
 
 void TuningTests::testEulerGenus6CodeGen()
 {
@@ -136,7 +136,7 @@ struct TuningTests
 
     static void walkCPSTuningBase8 (shared_ptr<CPSTuningBase>, const string);//variant
 
-    // code gen...creates code for 13 files
+    // code gen...creates the EulerGenusTables data
 
     static void testEulerGenus6CodeGen();
 
@@ -12,17 +12,17 @@
 
 VoiceStates::VoiceStates()
 {
-    for (unsigned long i = 0; i < WilsonicProcessorConstants::numVoices; i++)
+    for (unsigned long i = 0; i < WilsonicProcessorConstants::maxVoices; i++)
     {
         voiceState[i] = VoiceState();
     }
 }
 
 // sum of rms is near zero
-bool VoiceStates::noVoicesPlaying()
+bool VoiceStates::noVoicesPlaying() const
 {
     auto rms = 0.0f;
-    for (unsigned long i = 0; i < WilsonicProcessorConstants::numVoices; i++)
+    for (unsigned long i = 0; i < WilsonicProcessorConstants::maxVoices; i++)
     {
         rms += voiceState[i].rms;
     }
@@ -20,7 +20,15 @@ public:
 
     VoiceStates();
 
-    VoiceState voiceState[WilsonicProcessorConstants::numVoices] {};
+    VoiceState voiceState[WilsonicProcessorConstants::maxVoices] {};
 
-    bool noVoicesPlaying(); // sum of rms is near zero
+    bool noVoicesPlaying() const; // sum of rms is near zero
+};
+
+// a frame of the synth's telemetry, published by the audio thread once per block
+struct SynthTelemetry
+{
+    VoiceStates voiceStates {};
+    float rms = 0.f; // output meter
+    float peak = 0.f;
 };
@@ -52,126 +52,91 @@ void WilsonicIntervalMatrixComponent::paint(Graphics& g)
     // Layout
     auto const area = getLocalBounds().reduced (2.f);
 
-    // make a copy of processed array
-    auto ma = MicrotoneArray(_tuning->getProcessedArrayNPO());
-    unsigned long npo = ma.count();
-    if (npo == 0) {
-        
+    // the model, once per tuning
+    _updateModel();
+    if (_model.getSize() == 0) {
+
         jassertfalse;
         return;
     }
-    auto const cellWidth = static_cast<int>(area.getWidth() / float(npo + 1));
-    auto const cellHeight = static_cast<int>(area.getHeight() / float(npo + 1));
+
+    // the grid, once per model and size, at the display's resolution
+    auto const scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (!_gridImage.isValid() || _gridImageArea != area || _gridImageScale != scale)
+    {
+        _gridImageArea = area;
+        _gridImageScale = scale;
+        _gridImage = Image();
+        auto const w = roundToInt(static_cast<float>(area.getWidth()) * scale);
+        auto const h = roundToInt(static_cast<float>(area.getHeight()) * scale);
+        if (w > 0 && h > 0)
+        {
+            _gridImage = Image(Image::ARGB, w, h, true);
+            Graphics ig(_gridImage);
+            ig.addTransform(AffineTransform::scale(scale));
+            _paintGrid(ig, area.withZeroOrigin());
+        }
+    }
+    if (_gridImage.isValid())
+    {
+        g.drawImage(_gridImage, area.toFloat());
+    }
+}
+
+// Draws every cell of the model into area
+void WilsonicIntervalMatrixComponent::_paintGrid(Graphics& g, Rectangle<int> area)
+{
+    auto const size = _model.getSize();
+    auto const cellWidth = static_cast<int>(area.getWidth() / float(size));
+    auto const cellHeight = static_cast<int>(area.getHeight() / float(size));
     constexpr float lineThin = 0.25f;
     const Colour lineThinColour = Colours::darkslategrey;
     constexpr float lineThick = 1.f;
     const Colour lineThickColour = Colours::lightgrey;
-    Colour lineColor = lineThinColour;
-    float lineThickness = lineThin;
-    Colour cellTextColor = Colours::white;
-
-    for (unsigned long i = 0; i < npo + 1; i++)
-    {
-        // cell-level text and color, overwritten depending on 0-row or 0-column
-        string shortDesc = "";
-        lineColor = lineThinColour;
 
-        // cell-level pitch, including header row/column
-        float iFrequency = 0;
-        float jFrequency = 0;
-
-        if (i == 0)
-        {
-            // (i,j) == (0,0) display a white 'x' (upper left cell)
-            iFrequency = 0;
-            shortDesc = "x";
-            cellTextColor = Colours::white;
-            lineColor = lineThinColour;
-            lineThickness = lineThin;
-        }
-        else
-        {
-            // for j==0 iPitch and shortDesc are the pitch of header row cell
-            // for j>0 iPitch and shortDesc are the interval of the cell
-            auto const mti = ma.microtoneAtIndex(i - 1);
-            iFrequency = mti->getFrequencyValue();
-            jassert(iFrequency > 0);
-            shortDesc = to_string(iFrequency);
-            cellTextColor =_processor.getAppTuningModel()->colorForFrequency(iFrequency);     // DEPRECATED
-
-            lineThickness = lineThin;
-            lineColor = lineThinColour;
-        }
+    // below this the text is not legible, i.e., large Scala files, so only the colours are drawn
+    constexpr int minTextHeight = 6;
+    auto const drawText = cellHeight >= minTextHeight;
 
-        for (unsigned long j = 0; j < npo + 1; j++)
+    for (unsigned long i = 0; i < size; i++)
+    {
+        for (unsigned long j = 0; j < size; j++)
         {
-            if (i == 0 && j == 0)
-            {
-                // leave colour and description set to column from outer loop
-                // (i,j) == (0,0) display a white 'x' (upper left cell)
-            }
-            else if (j == 0)
-            {
-                // for j==0 iPitch and shortDesc are the pitch of header row cell
-            }
-            else if (i == 0)
-            {
-                // j > 0, i.e., header column displaying 1/pitch
-                auto const mtj = ma.microtoneAtIndex(j - 1);
-                jFrequency = mtj->getFrequencyValue();
-                shortDesc = "1/" + to_string(jFrequency);
-                cellTextColor =_processor.getAppTuningModel()->colorForFrequency(1.f / jFrequency);     // DEPRECATED
-
-                lineThickness = lineThin;
-                lineColor = lineThinColour;
-            }
-            else
-            {
-                // (i,j) = (1...npo+1, 1...npo+1) => interval
-                auto const mtj = ma.microtoneAtIndex(j - 1);
-                jFrequency = mtj->getFrequencyValue();
-                jassert(jFrequency > 0);
-                auto pFinal = iFrequency / jFrequency;
-                jassert(pFinal > 0);
-
-                // octave reduce
-                while (pFinal < 1)
-                    pFinal *= 2.f;
-
-                shortDesc = to_string(pFinal);
-                cellTextColor = _processor.getAppTuningModel()->colorForFrequency(pFinal);     // DEPRECATED
-
-                lineThickness = lineThick;
-                lineColor = lineThickColour;
-            }
-
             // rect for this cell
-            auto cellRect = Rectangle<int>();
             auto const x = static_cast<int>(area.getX() + cellWidth * float(i));
             auto const y = static_cast<int>(area.getY() + cellHeight * float(j));
-            cellRect.setX(x);
-            cellRect.setY(y);
-            cellRect.setSize(cellWidth, cellHeight);
+            auto const cellRect = Rectangle<int>(x, y, cellWidth, cellHeight);
+            auto const cellColour = _cellColours[i * size + j];
 
             // draw text for cell
-            if (i == 0 || j == 0)
+            if (_model.isHeader(i, j))
             {
                 // row/column headers don't get filled in
-                g.setColour(cellTextColor);
-                g.drawFittedText(shortDesc, cellRect, Justification::centred, 1);
+                if (drawText)
+                {
+                    g.setColour(cellColour);
+                    g.drawFittedText(_model.getText(i, j), cellRect, Justification::centred, 1);
+                }
+
+                // stroke cell
+                g.setColour(lineThinColour);
+                g.drawRect(cellRect, static_cast<int>(lineThin));
             }
             else
             {
                 // cells get filled
-                g.setColour(cellTextColor);
+                g.setColour(cellColour);
                 g.fillRect(cellRect);
-                g.setColour(Colours::black);
-                g.drawFittedText(shortDesc, cellRect, Justification::centred, 1);
+                if (drawText)
+                {
+                    g.setColour(Colours::black);
+                    g.drawFittedText(_model.getText(i, j), cellRect, Justification::centred, 1);
+                }
+
+                // stroke cell
+                g.setColour(lineThickColour);
+                g.drawRect(cellRect, static_cast<int>(lineThick));
             }
-
-            // stroke cell
-            g.setColour(lineColor);
-            g.drawRect(cellRect, static_cast<int>(lineThickness));
         }
     }
 }
@@ -186,5 +151,40 @@ void WilsonicIntervalMatrixComponent::resized()
 void WilsonicIntervalMatrixComponent::setTuning(shared_ptr<Tuning> t)
 {
     _tuning = t;
+    _modelIsStale = true;
     repaint();
 }
+
+// Recomputes the model and cell colours if the tuning's frequencies changed
+void WilsonicIntervalMatrixComponent::_updateModel()
+{
+    if (!_modelIsStale) {
+        return;
+    }
+    _modelIsStale = false;
+
+    // make a copy of processed array
+    auto ma = MicrotoneArray(_tuning->getProcessedArrayNPO());
+    vector<float> frequencies;
+    frequencies.reserve(ma.count());
+    for (unsigned long i = 0; i < ma.count(); i++) {
+        frequencies.push_back(ma.microtoneAtIndex(i)->getFrequencyValue());
+    }
+    if (!_model.setFrequencies(frequencies)) {
+        return;
+    }
+
+    // cell colours
+    auto const size = _model.getSize();
+    _cellColours.assign(size * size, Colours::white);
+    auto appTuningModel = _processor.getAppTuningModel();
+    for (unsigned long i = 0; i < size; i++) {
+        for (unsigned long j = 0; j < size; j++) {
+            if (i == 0 && j == 0) {
+                continue; // (0,0) white 'x'
+            }
+            _cellColours[i * size + j] = appTuningModel->colorForFrequency(_model.getValue(i, j));     // DEPRECATED
+        }
+    }
+    _gridImage = Image();
+}
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "IntervalMatrixModel.h"
 #include "TuningImp.h"
 #include "WilsonicAppSkin.h"
 
@@ -40,4 +41,14 @@ private:
     shared_ptr<Tuning> _tuning; // frequently overwritten by app tuning model
     shared_ptr<TuningImp> _tuningInternalDefault; // 12 et as fallback
     CriticalSection _lock;
+    IntervalMatrixModel _model; // computed once per tuning
+    vector<Colour> _cellColours {}; // flat, as the model's cells
+    bool _modelIsStale = true; // setTuning() was called since the model was computed
+    Image _gridImage; // the grid, drawn once per model and size
+    Rectangle<int> _gridImageArea {};
+    float _gridImageScale = 0.f;
+
+    // private methods
+    void _updateModel();
+    void _paintGrid(Graphics&, Rectangle<int> area);
 };
@@ -5,6 +5,7 @@
  * @author Marcus W. Hobbs
  */
 
+#include <algorithm>
 #include "AppTuningModel.h"
 #include "AppExperiments.h"
 #include "WilsonicMidiKeyboardComponent.h"
@@ -46,6 +47,13 @@ void WilsonicMidiKeyboardComponent::paint(Graphics& g) {
         g.drawText(String(_debug_paint_counter++), getLocalBounds(), Justification::topRight);
     }
 
+    // Rebuild the key cache if the tuning, the skin or the layout changed, or the triads were toggled
+    if (_keyCacheIsStale) {
+        _updateKeyCache();
+    } else if (_triadOverlaysAreShown != _processor.restoreShowProportionalTriads()) {
+        _updateTriadOverlays();
+    }
+
     // Depending on the display mode
     switch (_displayMode) {
         // If it's microtonal mode
@@ -61,15 +69,153 @@ void WilsonicMidiKeyboardComponent::paint(Graphics& g) {
     }
 }
 
+#pragma mark - key cache
+
+/**
+ * @brief Rebuilds the per-key geometry, colours and labels, and the triad overlays.
+ *
+ * The labels and colours come from the app tuning model, and the microtonal geometry depends on its npo,
+ * so this runs once per tuning, skin or layout change instead of once per key per paint.
+ */
+void WilsonicMidiKeyboardComponent::_updateKeyCache() {
+    _keyCacheIsStale = false;
+    auto const atm = _processor.getAppTuningModel();
+    for (int noteNum = _rangeStart; noteNum <= _rangeEnd; noteNum++) {
+        auto& key = _keyCache[static_cast<size_t>(noteNum)];
+        key.area = getRectangleForKey(noteNum);
+        if (_displayMode == microtonal) {
+            key.colour = atm->getTuningTableColor(static_cast<unsigned long>(noteNum));
+            key.topText = getNoteDescription(noteNum);
+            key.middleText = getNoteDescription2(noteNum);
+            key.bottomText = _getNoteCentsDescription(noteNum);
+            key.nnText = String(noteNum);
+        }
+    }
+    _updateTriadOverlays();
+}
+
+/**
+ * @brief Lays out the dots and lines of all triads, in every octave around middle C.
+ */
+void WilsonicMidiKeyboardComponent::_updateTriadOverlays() {
+    _triadOverlays.clear();
+    _triadOverlaysAreShown = _processor.restoreShowProportionalTriads();
+    if (!_triadOverlaysAreShown || _displayMode != microtonal) {
+        return;
+    }
+
+    // Assume numProportional + numSubcontrary = numAllTriads.  i.e., no geometric triads
+    auto const atm = _processor.getAppTuningModel();
+    auto const allTriads = atm->getTuning()->getAllTriads();
+    auto const numTriads = allTriads.size();
+    jassert(numTriads == atm->getTuning()->getProportionalTriads().size() + atm->getTuning()->getSubcontraryTriads().size());
+    if (numTriads < 1)
+        return;
+
+    // Proportional and subcontrary triads (no geometric for now)
+    auto const nnMiddleC = atm->uiGetNoteNumberMiddleC();
+    auto const npo = atm->getTuningTableNPO();
+    auto const dotSmallRadius = 13.f;
+    auto const proportionalColour = _processor.getAppSkin().getProportionalTriadDotColour();
+    auto const subcontraryColour = _processor.getAppSkin().getSubcontraryTriadDotColour();
+
+    // The centre of the dot for a degree of a triad
+    auto triadDotCentre = [&](auto const nnRoot, auto triadNum) {
+        auto keyRect = _keyCache[static_cast<size_t>(nnRoot)].area;
+        keyRect = keyRect.withSizeKeepingCentre(keyRect.getWidth(), 0.5f * keyRect.getHeight());
+        auto y01 = 1.f * (triadNum + 1.f) / (numTriads + 1.f);
+
+        return Point<float>(keyRect.getCentreX(), keyRect.getY() + y01 * keyRect.getHeight());
+    };
+
+    // Layout based on each scale's note mod npo, around middle c
+    auto addTriads = [&](auto const nn60) {
+        auto triadNum = 0;
+        for (auto triad : allTriads) {
+            auto const nn = array<unsigned long, 3> {nn60 + triad.getRoot(), nn60 + triad.getThird(), nn60 + triad.getFifth()};
+            // Skip if the root, third, or fifth of the triad is out of the keyboard's range
+            if (!std::all_of(nn.begin(), nn.end(), [this](auto n) { return static_cast<int>(n) >= _rangeStart && static_cast<int>(n) <= _rangeEnd; })) {
+                continue;
+            }
+            // Set the color of the triad dot based on the type of the triad
+            TriadOverlay overlay;
+            if (triad.getType() == PythagoreanMeans::Type::Proportional) {
+                overlay.colour = proportionalColour;
+            } else if (triad.getType() == PythagoreanMeans::Type::Subcontrary) {
+                overlay.colour = subcontraryColour;
+            } else {
+                // This should never happen, as there are only two types of triads
+                jassertfalse;
+            }
+            for (size_t j = 0; j < 3; j++) {
+                overlay.centres[j] = triadDotCentre(nn[j], triadNum);
+            }
+            overlay.bounds = Rectangle<float>::findAreaContainingPoints(overlay.centres.data(), 3).expanded(dotSmallRadius);
+            _triadOverlays.push_back(overlay);
+
+            // Increment the triad number
+            triadNum++;
+        }
+    };
+
+    // Iterate over all MIDI notes
+    for (int i = 0; i < static_cast<int>(WilsonicProcessorConstants::numMidiNotes); i++) {
+        // Calculate the index for centering the note about middle C
+        auto ff = static_cast<float>(i - static_cast<int>(nnMiddleC)) / static_cast<float>(npo);
+        auto finc = truncf(ff);
+        if (ff < 0.f) {
+            finc -= 1.f;
+        }
+        auto frac = fabsf(finc - ff);
+        if (frac == 1.f) {
+            frac = 0.f;
+        }
+        auto const index = static_cast<unsigned long>(roundf(frac * static_cast<float>(npo)));
+        // Add the triads if the index is zero
+        if (index == 0) {
+            addTriads(static_cast<unsigned long>(i));
+        }
+    }
+}
+
+/**
+ * @brief Draws the triads that intersect the clip: lines, then dots with a white outline over them.
+ *
+ * @param g The Graphics object that should be used to do the drawing operations.
+ */
+void WilsonicMidiKeyboardComponent::_paintTriadOverlays(Graphics& g) {
+    auto const clip = g.getClipBounds().toFloat();
+    auto const dotSmallRadius = 13.f;
+    auto const lineThickness = 2.0f;
+    float const strokeThickness = 1.f;
+    for (auto const& overlay : _triadOverlays) {
+        if (!overlay.bounds.intersects(clip)) {
+            continue;
+        }
+        g.setColour(overlay.colour);
+        g.drawLine(Line<float>(overlay.centres[0], overlay.centres[1]), lineThickness);
+        g.drawLine(Line<float>(overlay.centres[1], overlay.centres[2]), lineThickness);
+        for (auto const& centre : overlay.centres) {
+            Rectangle<float> rect = {dotSmallRadius, dotSmallRadius};
+            rect.setCentre(centre);
+            g.setColour(overlay.colour);
+            g.fillEllipse(rect);
+            g.setColour(Colours::white);
+            g.drawEllipse(rect, strokeThickness);
+        }
+    }
+}
+
 #pragma mark - paint microtonal
 
 /**
  * @brief Paints the MIDI keyboard component in microtonal mode.
  * 
  * This function is responsible for painting the MIDI keyboard component in microtonal mode.
- * It first fills the background with the colour of white notes. Then it iterates over all the notes and draws the microtonal notes.
+ * It first fills the background with the colour of white notes. Then it draws the microtonal notes that intersect the clip,
+ * so repainting one key only draws that key.
  * Depending on the orientation of the keyboard, it adjusts the shadow and line colours.
- * If the proportional triads are to be shown, it draws the dots and lines of all triads on the keyboard.
+ * If the proportional triads are to be shown, it draws the dots and lines of the triads in the clip.
  * 
  * @param g The Graphics object that should be used to do the drawing operations.
  */
@@ -81,13 +227,14 @@ void WilsonicMidiKeyboardComponent::_paint_microtonal(Graphics& g) {
     auto lineColour = findColour(keySeparatorLineColourId); // Colour for the lines
     auto textColour = findColour(textLabelColourId); // Colour for the text
 
-    // Iterate over all the notes
-    for (int noteNum = 0; noteNum < static_cast<int>(WilsonicProcessorConstants::numMidiNotes); noteNum++) {
-        // If the note is within the range, draw the microtonal note
-        if (noteNum >= _rangeStart && noteNum <= _rangeEnd) {
+    // Iterate over the notes in the clip
+    auto const clip = g.getClipBounds().toFloat();
+    for (int noteNum = _rangeStart; noteNum <= _rangeEnd; noteNum++) {
+        auto const& area = _keyCache[static_cast<size_t>(noteNum)].area;
+        if (area.intersects(clip)) {
             drawMicrotonalNote(noteNum,
                                 g,
-                                getRectangleForKey(noteNum),
+                                area,
                                 _processor.getKeyboardState()->isNoteOnForChannels(_midiInChannelMask, noteNum),
                                 _mouseOverNotes.contains(noteNum),
                                 lineColour,
@@ -132,96 +279,8 @@ void WilsonicMidiKeyboardComponent::_paint_microtonal(Graphics& g) {
         }
     }
 
-    // If the proportional triads are to be shown, draw the dots and lines of all triads on the keyboard
-    if (_processor.restoreShowProportionalTriads()) {
-        auto const atm = _processor.getAppTuningModel();
-        
-        // Assume numProportional + numSubcontrary = numAllTriads.  i.e., no geometric triads
-        auto const numTriads = atm->getTuning()->getProportionalTriads().size() + atm->getTuning()->getSubcontraryTriads().size();
-        auto const numAllTriads = atm->getTuning()->getAllTriads().size();
-        jassert(numTriads == numAllTriads);
-        if (numTriads < 1)
-            return;
-
-        // Proportional and subcontrary triads (no geometric for now)
-        auto const nnMiddleC = atm->uiGetNoteNumberMiddleC();
-        auto const npo = atm->getTuningTableNPO();
-        auto const dotSmallRadius = 13.f;
-
-        // Drawing lambda based on each scale's note mod npo, around middle c
-        auto drawTriad = [&](auto const nn60) {
-            // Lambda for drawing a dot for a degree of a triad
-            auto drawTriadDot = [&](auto scaleDegree, auto triadNum) {
-                auto const nnRoot = nn60 + scaleDegree;
-                auto keyRect = getRectangleForKey(static_cast<int>(nnRoot));
-                keyRect = keyRect.withSizeKeepingCentre(keyRect.getWidth(), 0.5f * keyRect.getHeight());
-                auto y01 = 1.f * (triadNum + 1.f) / (numTriads + 1.f);
-                auto centre = Point<float>(keyRect.getCentreX(), keyRect.getY() + y01 * keyRect.getHeight());
-                Rectangle<float> rect = {dotSmallRadius, dotSmallRadius};
-                rect.setCentre(centre);
-                g.fillEllipse(rect);
-                g.saveState();
-                g.setColour(Colours::white);
-                float const strokeThickness = 1.f;
-                g.drawEllipse(rect, strokeThickness);
-                g.restoreState();
-
-                return centre;
-            };
-
-            // Initialize the triad number
-            auto triadNum = 0;
-            auto const lineThickness = 2.0f;
-            for (auto triad : atm->getTuning()->getAllTriads()) {
-                // Skip if the root, third, or fifth of the triad is out of the MIDI note range
-                if (nn60 + triad.getRoot()  >= WilsonicProcessorConstants::numMidiNotes) continue;
-                if (nn60 + triad.getThird() >= WilsonicProcessorConstants::numMidiNotes) continue;
-                if (nn60 + triad.getFifth() >= WilsonicProcessorConstants::numMidiNotes) continue;
-                // Set the color of the triad dot based on the type of the triad
-                if (triad.getType() == PythagoreanMeans::Type::Proportional) {
-                    g.setColour(_processor.getAppSkin().getProportionalTriadDotColour());
-                } else if (triad.getType() == PythagoreanMeans::Type::Subcontrary) {
-                    g.setColour(_processor.getAppSkin().getSubcontraryTriadDotColour());
-                } else {
-                    // This should never happen, as there are only two types of triads
-                    jassertfalse;
-                }
-                // Draw the dots for the root, third, and fifth of the triad
-                auto pt0 = drawTriadDot(triad.getRoot(), triadNum);
-                auto pt1 = drawTriadDot(triad.getThird(), triadNum);
-                auto pt2 = drawTriadDot(triad.getFifth(), triadNum);
-                // Draw the lines connecting the dots of the triad
-                g.drawLine(Line<float>(pt0, pt1), lineThickness);
-                g.drawLine(Line<float>(pt1, pt2), lineThickness);
-                // Redraw the dots over the lines for better visibility
-                drawTriadDot(triad.getRoot(), triadNum);
-                drawTriadDot(triad.getThird(), triadNum);
-                drawTriadDot(triad.getFifth(), triadNum);
-
-                // Increment the triad number
-                triadNum++;
-            }
-        };
-
-        // Iterate over all MIDI notes
-        for (int i = 0; i < static_cast<int>(WilsonicProcessorConstants::numMidiNotes); i++) {
-            // Calculate the index for centering the note about middle C
-            auto ff = static_cast<float>(i - static_cast<int>(nnMiddleC)) / static_cast<float>(npo);
-            auto finc = truncf(ff);
-            if (ff < 0.f) {
-                finc -= 1.f;
-            }
-            auto frac = fabsf(finc - ff);
-            if (frac == 1.f) {
-                frac = 0.f;
-            }
-            auto const index = static_cast<unsigned long>(roundf(frac * static_cast<float>(npo)));
-            // Draw the triad if the index is zero
-            if (index == 0) {
-                drawTriad(static_cast<unsigned long>(i));
-            }
-        }
-    }
+    // If the proportional triads are to be shown, draw the dots and lines of the triads in the clip
+    _paintTriadOverlays(g);
 }
 
 #pragma mark - paint linear
@@ -235,11 +294,15 @@ void WilsonicMidiKeyboardComponent::_paint_linear(Graphics& g) {
     // White keys
     auto lineColour = findColour(keySeparatorLineColourId);
     auto textColour = findColour(textLabelColourId);
+    auto const clip = g.getClipBounds().toFloat();
     for (int noteNum = _rangeStart; noteNum <= _rangeEnd; ++noteNum) {
+        if (!_keyCache[static_cast<size_t>(noteNum)].area.intersects(clip)) {
+            continue;
+        }
         if (noteNum % 12 == 0 || noteNum % 12 == 2 || noteNum % 12 == 4 || noteNum % 12 == 5 || noteNum % 12 == 7 || noteNum % 12 == 9 || noteNum % 12 == 11) {
             drawWhiteNote(noteNum,
                            g,
-                           getRectangleForKey(noteNum),
+                           _keyCache[static_cast<size_t>(noteNum)].area,
                            _processor.getKeyboardState()->isNoteOnForChannels(_midiInChannelMask, noteNum),
                            _mouseOverNotes.contains(noteNum),
                            lineColour,
@@ -286,10 +349,10 @@ void WilsonicMidiKeyboardComponent::_paint_linear(Graphics& g) {
     for (int octave = 0; octave < static_cast<int>(WilsonicProcessorConstants::numMidiNotes); octave += 12) {
         for (int black = 0; black < 5; ++black) {
             auto noteNum = octave + blackNotes[black];
-            if (noteNum >= _rangeStart && noteNum <= _rangeEnd)
+            if (noteNum >= _rangeStart && noteNum <= _rangeEnd && _keyCache[static_cast<size_t>(noteNum)].area.intersects(clip))
                 drawBlackNote(noteNum,
                                g,
-                               getRectangleForKey(noteNum),
+                               _keyCache[static_cast<size_t>(noteNum)].area,
                                _processor.getKeyboardState()->isNoteOnForChannels(_midiInChannelMask, noteNum),
                                _mouseOverNotes.contains(noteNum),
                                blackNoteColour);
@@ -454,7 +517,8 @@ void WilsonicMidiKeyboardComponent::drawMicrotonalNote
     auto const text_area_factor = 1.f - nn_area_factor; // inverse
 
     // Draw the background rectangle with the color corresponding to the pitch
-    auto c = _processor.getAppTuningModel()->getTuningTableColor(static_cast<unsigned long>(midiNoteNumber));
+    auto const& key = _keyCache[static_cast<size_t>(midiNoteNumber)];
+    auto c = key.colour;
     if(isDown) c = c.brighter(0.6f); // If the note is being pressed, make the color brighter
     if(isOver) c = c.brighter(0.4f); // If the mouse is hovering over the note, make the color brighter
     g.setColour(c);
@@ -474,10 +538,10 @@ void WilsonicMidiKeyboardComponent::drawMicrotonalNote
 }
 
     // Get the descriptions of the note
-    auto topText = getNoteDescription(midiNoteNumber); // The description of the note
-    auto middleText = getNoteDescription2(midiNoteNumber); // The secondary description of the note
-    auto bottomText = _getNoteCentsDescription(midiNoteNumber); // cents as string
-    auto nnText = String(midiNoteNumber); // The MIDI note number as a string
+    auto const& topText = key.topText; // The description of the note
+    auto const& middleText = key.middleText; // The secondary description of the note
+    auto const& bottomText = key.bottomText; // cents as string
+    auto const& nnText = key.nnText; // The MIDI note number as a string
 
     // Define the areas for the labels
     auto const h = area.getHeight();
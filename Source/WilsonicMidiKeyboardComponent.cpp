@@ -50,7 +50,8 @@ WilsonicMidiKeyboardComponent::WilsonicMidiKeyboardComponent
 WilsonicProcessor& processor,
 Orientation orientation
 )
-: _processor(processor)
+: FrameTimer(this)
+, _processor(processor)
 , _orientation(orientation)
 , _displayMode(microtonal) // linear
 {
@@ -83,7 +84,7 @@ Orientation orientation
 
     // timer
     if (AppExperiments::renderSynthKeyboard) {
-        startTimerHz(AppExperiments::defaultTimerFrameRate);
+        startFrameTimerHz(AppExperiments::defaultTimerFrameRate);
     }
 
     //
@@ -92,7 +93,7 @@ Orientation orientation
 
 WilsonicMidiKeyboardComponent::~WilsonicMidiKeyboardComponent() {
     if (AppExperiments::renderSynthKeyboard) {
-        stopTimer();
+        stopFrameTimer();
     }
     _processor.getKeyboardState()->removeListener(this);
     _processor.getAppTuningModel()->removeActionListener(this);
@@ -509,6 +510,7 @@ void WilsonicMidiKeyboardComponent::setBlackNoteWidthProportion(float ratio) noe
 #pragma mark - RESIZED
 
 void WilsonicMidiKeyboardComponent::resized() {
+    _keyCacheIsStale = true;
     auto w = getWidth();
     auto h = getHeight();
     auto const wf = _displayMode == microtonal ? _keyWidthFactor : 1.f;// key width
@@ -693,7 +695,7 @@ void WilsonicMidiKeyboardComponent::mouseWheelMove(const MouseEvent&, const Mous
 
 #pragma mark - Timer Callback
 
-void WilsonicMidiKeyboardComponent::timerCallback() {
+void WilsonicMidiKeyboardComponent::frameCallback() {
     if (! AppExperiments::renderSynthKeyboard) {
         return;
     }
@@ -773,8 +775,10 @@ void WilsonicMidiKeyboardComponent::focusLost(FocusChangeType) {
 
 void WilsonicMidiKeyboardComponent::actionListenerCallback(const String& message) {
     if (message == AppTuningModel::getAppTuningModelChangedMessage()) {
+        _keyCacheIsStale = true;
         repaint();
     } else if (message == WilsonicAppSkin::getAppSkinChangedMessage()) {
+        _keyCacheIsStale = true;
         repaint();
     }
 }
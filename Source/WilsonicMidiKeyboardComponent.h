@@ -7,6 +7,7 @@
 
 #include <JuceHeader.h>
 #include "AppTuningModel.h"
+#include "FrameTimer.h"
 #include "WilsonicAppSkin.h"
 #include "WilsonicProcessorConstants.h"
 
@@ -24,7 +25,7 @@ class WilsonicMidiKeyboardComponent
 , public MidiKeyboardState::Listener
 , public ChangeBroadcaster
 , public ActionListener
-, private Timer
+, private FrameTimer
 {
 public:
     /**
@@ -410,7 +411,7 @@ public:
     /**
      * @brief Handles timer callbacks for the keyboard.
      */
-    void timerCallback() override;
+    void frameCallback() override;
 
     /**
      * @brief Handles key state changes on the keyboard.
@@ -628,6 +629,32 @@ private:
     int _octaveNumForMiddleC = 3; ///< Octave number for Middle C
     unsigned long _debug_paint_counter = 0; ///< Counter for debug paint
 
+    /**
+     * @brief What paint draws for a key, rebuilt when the tuning, the skin or the layout changes.
+     * Paint only draws the keys in its clip, so a note on/off repaints one key.
+     */
+    struct KeyCache {
+        Rectangle<float> area {}; ///< getRectangleForKey()
+        Colour colour {}; ///< The tuning table colour
+        String topText {}; ///< getNoteDescription()
+        String middleText {}; ///< getNoteDescription2()
+        String bottomText {}; ///< Cents
+        String nnText {}; ///< The note number
+    };
+    array<KeyCache, WilsonicProcessorConstants::numMidiNotes> _keyCache {}; ///< For the keys in [_rangeStart, _rangeEnd]
+    bool _keyCacheIsStale = true; ///< Set by resized() and tuning/skin changes
+
+    /**
+     * @brief A triad drawn over the keys: three dots joined by lines.
+     */
+    struct TriadOverlay {
+        Colour colour {};
+        array<Point<float>, 3> centres {}; ///< Root, third, fifth
+        Rectangle<float> bounds {}; ///< For clipping
+    };
+    vector<TriadOverlay> _triadOverlays {}; ///< Built with the key cache
+    bool _triadOverlaysAreShown = false; ///< restoreShowProportionalTriads() when the overlays were built
+
     // Private member functions
     Rectangle<float> _getRectangleForKeyLinear(int note) const; ///< Get rectangle for key in linear mode
     Rectangle<float> _getRectangleForKeyMicrotonal(int note) const; ///< Get rectangle for key in microtonal mode
@@ -644,6 +671,9 @@ private:
     void _repaintNote(int midiNoteNumber); ///< Repaint a note
     void _paint_microtonal(Graphics& g); ///< Paint in microtonal mode
     void _paint_linear(Graphics& g); ///< Paint in linear mode
+    void _updateKeyCache(); ///< Rebuilds _keyCache and _triadOverlays
+    void _updateTriadOverlays(); ///< Rebuilds _triadOverlays from the app tuning's triads
+    void _paintTriadOverlays(Graphics& g); ///< The triads in the clip
     void _setLowestVisibleKeyFloat(float noteNumber); ///< Set lowest visible key
     String _getNoteTextLinear(int midiNoteNumber); ///< Get note text in linear mode
     String _getNoteTextMicrotonal(int midiNoteNumber); ///< Get note text in microtonal mode
@@ -19,12 +19,13 @@
 
 WilsonicPitchWheelComponent::WilsonicPitchWheelComponent(WilsonicProcessor& processor, bool updateBasedOnSynth)
 : WilsonicComponentBase(processor)
+, FrameTimer(this)
 , _updateBasedOnAppTuningSynthNotes(updateBasedOnSynth) {
     _timerHelper();
 }
 
 WilsonicPitchWheelComponent::~WilsonicPitchWheelComponent() {
-    stopTimer();
+    stopFrameTimer();
 }
 
 #pragma mark - drawing
@@ -50,19 +51,54 @@ void WilsonicPitchWheelComponent::_paint04(Graphics& g) {
 
         return;
     }
+    if(getWidth() <= 0 || getHeight() <= 0) {
+        return;
+    }
+
+    // the static layer, redrawn only when something it shows changed
+    auto const scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if(_staticLayerIsStale || !_staticLayerIsCurrent() || WilsonicMath::floatsAreNotEqual(scale, _staticLayerScale)) {
+        _updateStaticLayer(scale);
+    }
+    g.drawImage(_staticLayer, getLocalBounds().toFloat());
+
+    // the playing notes
+    _paintVoices(g);
+}
+
+bool WilsonicPitchWheelComponent::_staticLayerIsCurrent() {
+    return _tuning->getUpdateCount() == _staticLayerUpdateCount
+    && !WilsonicMath::floatsAreNotEqual(_processor.getAppTuningModel()->getPitchColorOffset(), _staticLayerPitchColorOffset);
+}
+
+/**
+ * @brief Draws the spokes, labels and triad dots into the static layer, and records the spokes for _paintVoices
+ * @param scale Physical pixels per logical pixel
+ */
+void WilsonicPitchWheelComponent::_updateStaticLayer(float scale) {
+    _staticLayerIsStale = false;
+    _staticLayerUpdateCount = _tuning->getUpdateCount();
+    _staticLayerPitchColorOffset = _processor.getAppTuningModel()->getPitchColorOffset();
+    _staticLayerScale = scale;
+    _spokes.clear();
+    _noteNumberSpokeIsStale = true;
+
+    auto const area = getLocalBounds();
+    _staticLayer = Image(Image::ARGB, jmax(1, roundToInt(scale * area.getWidth())), jmax(1, roundToInt(scale * area.getHeight())), true);
+    Graphics g(_staticLayer);
+    g.addTransform(AffineTransform::scale(scale));
 
     auto& skin = _processor.getAppSkin();
     auto ma = _tuning->getProcessedArrayNPO(); // returns deep copy
     if(ma.count() == 0) {// If tuning is empty, draw "0" and return
         g.setColour(Colours::grey);
-        g.drawText ("0", getLocalBounds(), Justification::centred);
+        g.drawText ("0", area, Justification::centred);
         return;
     }
 
     // layout parameters
     auto const globalFontHeightMin = skin.getFontHeightMin() * _customFontScale;
     auto const horizontalScale = skin.getFontHorizontalScale();
-    auto const area = getLocalBounds();
     auto const x0 = 0.5f * area.getWidth();
     auto const y0 = 0.5f * area.getHeight();
     auto const dimension = jmin(area.getWidth(), area.getHeight());
@@ -70,11 +106,10 @@ void WilsonicPitchWheelComponent::_paint04(Graphics& g) {
     auto const radius00 = (_drawText ? 0.52f : 1.f) * 0.5f * margin * dimension;
     auto const radius10 = (1.00f) * 0.5f * margin * dimension;
     auto const lineSmallThickness = 2.f;
-    auto const lineLargeThickness = lineSmallThickness;
     auto const dotSmallRadius = skin.getSmallDotRadius();
-    auto const dotLargeRadius = skin.getLargeDotRadius();
     constexpr float pi = 3.14159265358979323846f;
     auto const pitchOffset = -1 * pi;
+    _origin = Point<float>(x0, y0);
 
     // Define lambda functions for sin/cos
     // Function for calculating the x-coordinate of a point on a circle
@@ -88,8 +123,8 @@ void WilsonicPitchWheelComponent::_paint04(Graphics& g) {
     };
 
     // Define lambda function for drawing a line from origin to the dot
-    // This function takes a microtone and a velocity magnitude as parameters
-    auto draw = [&](auto& mt, auto vmag) -> void {
+    // This function takes a microtone as a parameter, and records its spoke
+    auto draw = [&](auto& mt) -> void {
         // Get colour based on microtone pitch
         auto const p = mt->getPitchValue01();
         auto const colour = _processor.getAppTuningModel()->colorForPitch01(p);
@@ -98,8 +133,7 @@ void WilsonicPitchWheelComponent::_paint04(Graphics& g) {
         // Draw line
         auto const x1 = sx(radius00, p);
         auto const y1 = cy(radius00, p);
-        auto const lineThickness = lineSmallThickness + vmag * (lineLargeThickness - lineSmallThickness);
-        g.drawLine(x0, y0, x1, y1, lineThickness);
+        g.drawLine(x0, y0, x1, y1, lineSmallThickness);
 
         // Draw dot at end of line
         auto r = Rectangle<float> ();
@@ -107,14 +141,11 @@ void WilsonicPitchWheelComponent::_paint04(Graphics& g) {
         r.setCentre(Point<float> (x1, y1));
         g.fillEllipse(r);
 
-        // Stroke playing dot
-        auto rp = Rectangle<float>();
-        auto dotRadius = dotSmallRadius + vmag * (dotLargeRadius - dotSmallRadius);
-        rp.setSize(dotRadius, dotRadius);
-        rp.setCentre(Point<float> (x1, y1));
+        // Stroke dot
         Path path;
-        path.addEllipse(rp);
+        path.addEllipse(r);
         g.strokePath(path, PathStrokeType(1.f));
+        _spokes.push_back({p, Point<float>(x1, y1), colour});
 
         // Define a lambda function for drawing text on the pitch wheel
         // This function takes a text string, a minimum length for the text, and a radius as parameters
@@ -216,62 +247,99 @@ void WilsonicPitchWheelComponent::_paint04(Graphics& g) {
     // Draw a constant line+dot for each microtone(min line width)
     for(int i = static_cast<int>(ma.count()) - 1; i >= 0; i--) {
         auto const mt = ma.microtoneAtIndex(static_cast<unsigned long>(i));
-        draw(mt, 0.f);// Draw microtone with rms 0
+        draw(mt);
+    }
+}
+
+/**
+ * @brief Maps each note number of the app tuning to the spoke of this pitch wheel's tuning with the same pitch
+ */
+void WilsonicPitchWheelComponent::_updateNoteNumberSpoke() {
+    auto const appTuning = _processor.getAppTuningModel()->getTuning();
+    auto const updateCount = appTuning->getUpdateCount();
+    if(!_noteNumberSpokeIsStale && appTuning.get() == _noteNumberSpokeAppTuning && updateCount == _noteNumberSpokeAppTuningUpdateCount) {
+        return;
     }
+    _noteNumberSpokeIsStale = false;
+    _noteNumberSpokeAppTuning = appTuning.get();
+    _noteNumberSpokeAppTuningUpdateCount = updateCount;
 
+    // For some pages the happy path is the global and this pitch wheel are the same tuning
     auto const tolerance = 0.001f; // technically the tolerance comparison should be in pitch space
+    _noteNumberSpoke.fill(-1);
+    for(unsigned long nn = 0; nn < WilsonicProcessorConstants::numMidiNotes; nn++) {
+        if(appTuning->getFilterNoteAtNoteNumber(nn)) {
+            continue;
+        }
+        auto const p = appTuning->microtoneAtNoteNumber(nn)->getPitchValue01();
+        for(size_t i = 0; i < _spokes.size(); i++) {
+            if(fabsf(p - _spokes[i].pitch01) < tolerance) {
+                _noteNumberSpoke[nn] = static_cast<int>(i);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Draws a line+dot over the spoke of each playing note, sized by its amplitude
+ * @param g Graphics context
+ */
+void WilsonicPitchWheelComponent::_paintVoices(Graphics& g) {
+    _voicesAreShowing = false;
+    if(!_updateBasedOnAppTuningSynthNotes || _spokes.empty()) {
+        return;
+    }
+
+    auto& skin = _processor.getAppSkin();
+    auto const lineThickness = 2.f;
+    auto const dotSmallRadius = skin.getSmallDotRadius();
+    auto const dotLargeRadius = skin.getLargeDotRadius();
+    auto draw = [&](unsigned long nn, float vmag) -> void {
+        auto const index = _noteNumberSpoke[nn];
+        if(index < 0) {
+            return;
+        }
+        auto const& spoke = _spokes[static_cast<size_t>(index)];
+        g.setColour(spoke.colour);
+        g.drawLine(Line<float>(_origin, spoke.dot), lineThickness);
+        auto r = Rectangle<float>();
+        r.setSize(dotSmallRadius, dotSmallRadius);
+        r.setCentre(spoke.dot);
+        g.fillEllipse(r);
+
+        // Stroke playing dot
+        auto const dotRadius = dotSmallRadius + vmag * (dotLargeRadius - dotSmallRadius);
+        auto rp = Rectangle<float>();
+        rp.setSize(dotRadius, dotRadius);
+        rp.setCentre(spoke.dot);
+        Path path;
+        path.addEllipse(rp);
+        g.strokePath(path, PathStrokeType(1.f));
+        _voicesAreShowing = true;
+    };
 
 #if JucePlugin_IsSynth
-    auto vs = _processor.getVoiceStates();
+    auto const& vs = _processor.getVoiceStates();
     if(vs.noVoicesPlaying()) { // If no voices are playing, return
         return;
     }
-
-    // If drawing playing notes
-    if(_updateBasedOnAppTuningSynthNotes) {
-        // Draw a dynamic line+dot for each microtone based on voice amplitude
-        for(unsigned long i = 0; i < WilsonicProcessorConstants::numVoices; i++) {
-            auto v = vs.voiceState[i];
-            auto nnv = v.nn;
-            auto vmag = v.rms;
-            // Only render if the velocity is above tolerance
-            if(vmag > 0) {
-                // Get the microtone of the app tuning(implies the global, i.e., keyboard's tuning)
-                auto mtv = _processor.getAppTuningModel()->getTuning()->microtoneAtNoteNumber(nnv);
-                if(mtv->getFilterNote())
-                    continue;
-                // Loop through *this instance of pitch wheel's tuning* for equivalent frequency value microtones
-                // For some pages the happy path is the global and this pitch wheel are the same tuning
-                for(unsigned long ii = 0; ii < ma.count(); ii++) {
-                    auto mt = ma.microtoneAtIndex(ii);
-                    if(fabsf(mtv->getPitchValue01() - mt->getPitchValue01()) < tolerance) {
-                        draw(mtv, vmag);
-                        //DBG("nn:"+String(nnv)+", rms:"+String(vmag));
-                    }
-                }
-            }
+    _updateNoteNumberSpoke();
+    for(unsigned long i = 0; i < WilsonicProcessorConstants::maxVoices; i++) {
+        auto const& v = vs.voiceState[i];
+        // Only render if the velocity is above tolerance
+        if(v.rms > 0 && v.nn < WilsonicProcessorConstants::numMidiNotes) {
+            draw(v.nn, v.rms);
         }
     }
 #elif JucePlugin_IsMidiEffect
+    _updateNoteNumberSpoke();
     // For each midi note
     for (unsigned long i = 0; i < WilsonicProcessorConstants::numMidiNotes; i++) {
         float const vmag = _processor.getKeyboardRMSForNN(i);
         // If velocity is above 0
         if (vmag > 0.f) {
-            // Get the microtone of the app tuning
-            auto mtv = _processor.getAppTuningModel()->getTuning()->microtoneAtNoteNumber(i);
-            if(mtv->getFilterNote())
-                continue;
-
-            // Loop through *this instance of pitch wheel's tuning* for equivalent frequency value microtones
-            // For some pages the happy path is the global and this pitch wheel are the same tuning
-            for(unsigned long ii = 0; ii < ma.count(); ii++) {
-                auto mt = ma.microtoneAtIndex(ii);
-                if(fabsf(mtv->getPitchValue01() - mt->getPitchValue01()) < tolerance) {
-                    draw(mtv, vmag);
-                    //DBG("nn:"+String(nnv)+", rms:"+String(vmag));
-                }
-            }
+            draw(i, vmag);
         }
     }
 #else
@@ -280,12 +348,31 @@ void WilsonicPitchWheelComponent::_paint04(Graphics& g) {
 #endif
 }
 
+/**
+ * @brief Whether any note is playing, without drawing
+ */
+bool WilsonicPitchWheelComponent::_voicesArePlaying() {
+#if JucePlugin_IsSynth
+    return !_processor.getVoiceStates().noVoicesPlaying();
+#elif JucePlugin_IsMidiEffect
+    for (unsigned long i = 0; i < WilsonicProcessorConstants::numMidiNotes; i++) {
+        if(_processor.getKeyboardRMSForNN(i) > 0.f) {
+            return true;
+        }
+    }
+
+    return false;
+#else
+    return false;
+#endif
+}
+
 /**
  * @brief Resizes the component
  */
 void WilsonicPitchWheelComponent::resized()
 {
-    // nop
+    _staticLayerIsStale = true;
 }
 
 /**
@@ -304,7 +391,7 @@ void WilsonicPitchWheelComponent::setUpdateBasedOnAppTuningSynthNotes(bool updat
 void WilsonicPitchWheelComponent::_timerHelper() {
     // If tuning is null or not updating based on app tuning synth notes, stop timer and return
     if(_tuning == nullptr || !_updateBasedOnAppTuningSynthNotes) {
-        stopTimer();
+        stopFrameTimer();
         return;
     }
     
@@ -315,10 +402,10 @@ void WilsonicPitchWheelComponent::_timerHelper() {
         // If hz is greater than 0, start timer
         if(hz > 0) {
 //            DBG ("WilsonicPitchWheelComponent timer STARTED for npo:" << npo << ", hz: " << hz);
-            startTimerHz(hz);
+            startFrameTimerHz(hz);
         } else {// Else, stop timer
             DBG ("WilsonicPitchWheelComponent timer STOPPED for npo:" << npo << ", hz: " << hz);
-            stopTimer();
+            stopFrameTimer();
         }
     }
 }
@@ -331,6 +418,7 @@ void WilsonicPitchWheelComponent::setCustomFontScale(float scale01) {
     // If custom font scale is not equal to the input scale, set it and repaint
     if(WilsonicMath::floatsAreNotEqual(_customFontScale, scale01)) {
         _customFontScale = scale01;
+        _staticLayerIsStale = true;
         repaint();
     }
 }
@@ -341,6 +429,7 @@ void WilsonicPitchWheelComponent::setCustomFontScale(float scale01) {
  */
 void WilsonicPitchWheelComponent::setDrawText(bool draw_text) {
     _drawText = draw_text;
+    _staticLayerIsStale = true;
     repaint();
 }
 
@@ -350,6 +439,7 @@ void WilsonicPitchWheelComponent::setDrawText(bool draw_text) {
  */
 void WilsonicPitchWheelComponent::setTuning(shared_ptr<Tuning> inputTuning) {
     _tuning = inputTuning;
+    _staticLayerIsStale = true;
     _timerHelper();
     repaint();
 }
@@ -357,9 +447,30 @@ void WilsonicPitchWheelComponent::setTuning(shared_ptr<Tuning> inputTuning) {
 /**
  * @brief Callback function for timer
  */
-void WilsonicPitchWheelComponent::timerCallback() {
+void WilsonicPitchWheelComponent::frameCallback() {
     // If component is showing, repaint
-    if(isShowing()) {
+    if(!isShowing() || _tuning == nullptr) {
+        return;
+    }
+
+    // the tuning changed
+    if(_staticLayerIsStale || !_staticLayerIsCurrent()) {
         repaint();
+        return;
+    }
+
+#if JucePlugin_IsSynth
+    // no new frame from the audio thread
+    auto const sequence = _processor.getTelemetrySequence();
+    if(sequence == _telemetrySequence) {
+        return;
     }
+    _telemetrySequence = sequence;
+#endif
+
+    // nothing playing, and nothing left to erase
+    if(!_voicesAreShowing && !_voicesArePlaying()) {
+        return;
+    }
+    repaint();
 }
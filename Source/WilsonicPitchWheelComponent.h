@@ -17,20 +17,25 @@
 
 #include <JuceHeader.h>
 #include "AppTuningModel.h"
+#include "FrameTimer.h"
 #include "TuningImp.h"
 #include "Tuning_Include.h"
 #include "WilsonicAppSkin.h"
 #include "WilsonicComponentBase.h"
 #include "WilsonicProcessor.h"
+#include "WilsonicProcessorConstants.h"
 
 /**
  * @class WilsonicPitchWheelComponent
  * @brief A component that represents the pitch wheel of the Wilsonic application.
- * @details This class inherits from WilsonicComponentBase and Timer. It is responsible for managing and displaying the pitch wheel.
+ * @details This class inherits from WilsonicComponentBase and FrameTimer. It is responsible for managing and displaying the pitch wheel.
+ * The spokes, labels and triad dots are drawn once into an Image, which is redrawn only when the tuning, the layout or the
+ * pitch colours change.  Each frame draws that Image, then the playing notes on top of it, found by note number in an index
+ * that is built when either tuning changes.
  */
 class WilsonicPitchWheelComponent
 : public WilsonicComponentBase
-, private Timer
+, private FrameTimer
 {
 public:
     /**
@@ -93,15 +98,54 @@ private:
     bool _drawText {true}; ///< Boolean value to set the draw text.
     float _customFontScale {2.2248f}; ///< Float value to set the custom font scale.
 
+    /**
+     * @brief The static layer: spokes, labels and triad dots.
+     */
+    Image _staticLayer {}; ///< In physical pixels
+    bool _staticLayerIsStale {true}; ///< Set by the layout setters
+    uint64_t _staticLayerUpdateCount {0}; ///< _tuning->getUpdateCount() when the static layer was drawn
+    float _staticLayerPitchColorOffset {0.f}; ///< The app tuning model's pitch colour offset when the static layer was drawn
+    float _staticLayerScale {1.f}; ///< Physical pixels per logical pixel
+
+    /**
+     * @brief A degree of the tuning, as drawn on the static layer.
+     */
+    struct Spoke {
+        float pitch01 {0.f};
+        Point<float> dot {};
+        Colour colour {};
+    };
+    vector<Spoke> _spokes {}; ///< One per degree of the processed NPO array
+    Point<float> _origin {}; ///< The centre of the wheel
+
+    /**
+     * @brief App tuning note number -> the index of the spoke with the same pitch, or -1.
+     */
+    array<int, WilsonicProcessorConstants::numMidiNotes> _noteNumberSpoke {};
+    bool _noteNumberSpokeIsStale {true}; ///< Set when the spokes change
+    const Tuning* _noteNumberSpokeAppTuning {nullptr}; ///< The app tuning the index was built for
+    uint64_t _noteNumberSpokeAppTuningUpdateCount {0};
+
+    /**
+     * @brief Frame skipping.
+     */
+    bool _voicesAreShowing {false}; ///< The last frame drew playing notes
+    uint64_t _telemetrySequence {0}; ///< The processor's telemetry sequence at the last timer callback
+
     /**
      * @brief Private methods.
      */
     void _paint04(Graphics&); ///< Paint method 04.
+    bool _staticLayerIsCurrent(); ///< False if the tuning or the pitch colours changed since the static layer was drawn
+    void _updateStaticLayer(float scale); ///< Draws the static layer and the spokes
+    void _updateNoteNumberSpoke(); ///< Rebuilds _noteNumberSpoke if the spokes or the app tuning changed
+    void _paintVoices(Graphics&); ///< The playing notes, over the static layer
+    bool _voicesArePlaying(); ///< Any note to draw
     
     /**
-     * @brief Timer callback method.
+     * @brief Frame callback method.
      */
-    void timerCallback() override;
+    void frameCallback() override;
     
     /**
      * @brief Timer helper method.
@@ -75,93 +75,83 @@ unique_ptr<AudioProcessorParameterGroup> WilsonicProcessor::_createSynthParams()
     return synthParamGroup;
 }
 
+// added after the synth params, so it is at the end of the layout
+// do NOT use the JucePlugin_IsSynth macro here
+unique_ptr<AudioProcessorParameterGroup> WilsonicProcessor::_createSynthVoiceParams()
+{
+    auto synthVoiceParamGroup = make_unique<AudioProcessorParameterGroup>
+    ("SynthVoices", "Synth Voices", " | ",
+
+     // Polyphony
+     make_unique<AudioParameterInt> (ParameterID ("SYNTHVOICES", AppVersion::getVersionHint()), "Synth|Voices", 1, static_cast<int>(WilsonicProcessorConstants::maxVoices), WilsonicProcessorConstants::defaultNumVoices)
+     );
+
+    return synthVoiceParamGroup;
+}
+
+// added after the synth voice params, so it is at the end of the layout
+// do NOT use the JucePlugin_IsSynth macro here
+unique_ptr<AudioProcessorParameterGroup> WilsonicProcessor::_createSynthTuningParams()
+{
+    auto synthTuningParamGroup = make_unique<AudioProcessorParameterGroup>
+    ("SynthTuning", "Synth Tuning", " | ",
+
+     // Held notes glide to tuning changes
+     make_unique<AudioParameterFloat> (ParameterID ("SYNTHTUNINGGLIDE", AppVersion::getVersionHint()), "Synth|Tuning Glide", NormalisableRange<float> { 0.0f, 2.0f, 0.01f, 0.5f }, 0.0f, "s")
+     );
+
+    return synthTuningParamGroup;
+}
+
 // called within process
-void WilsonicProcessor::_setSynthParams()
+void WilsonicProcessor::_setSynthParams(int numSamples)
 {
     // do NOT use the JucePlugin_IsSynth macro here
-    _setSynthVoiceParams();
-    _setSynthFilterParams();
-    _setSynthReverbParams();
+    auto const blockSeconds = static_cast<float>(numSamples / getSampleRate());
+    auto const changed = _synthParams.update(blockSeconds);
+    if (changed == 0) {
+        return;
+    }
+    _setSynthVoiceParams(changed);
+    _setSynthFilterParams(changed);
+    _setSynthReverbParams(changed);
 }
 
 // called within process
-void WilsonicProcessor::_setSynthVoiceParams() {
+void WilsonicProcessor::_setSynthVoiceParams(SynthParams::Mask changed) {
     // do NOT use the JucePlugin_IsSynth macro here
-    for (int i = 0; i < _synth.getNumVoices(); ++i) {
-        if (auto voice = dynamic_cast<SynthVoice*>(_synth.getVoice(i))) {
-            auto& attack = *_apvts->getRawParameterValue ("SYNTHATTACK");
-            auto& decay = *_apvts->getRawParameterValue ("SYNTHDECAY");
-            auto& sustain = *_apvts->getRawParameterValue ("SYNTHSUSTAIN");
-            auto& release = *_apvts->getRawParameterValue ("SYNTHRELEASE");
-
-            //
-            auto& osc1Choice = *_apvts->getRawParameterValue ("SYNTHOSC1");
-            auto& osc2Choice = *_apvts->getRawParameterValue ("SYNTHOSC2");
-            auto& osc1Gain = *_apvts->getRawParameterValue ("SYNTHOSC1GAIN");
-            auto& osc2Gain = *_apvts->getRawParameterValue ("SYNTHOSC2GAIN");
-            auto& osc1Pitch = *_apvts->getRawParameterValue ("SYNTHOSC1PITCH");
-            auto& osc2Pitch = *_apvts->getRawParameterValue ("SYNTHOSC2PITCH");
-            auto& osc1FmFreq = *_apvts->getRawParameterValue ("SYNTHOSC1FMFREQ");
-            auto& osc2FmFreq = *_apvts->getRawParameterValue ("SYNTHOSC2FMFREQ");
-            auto& osc1FmDepth = *_apvts->getRawParameterValue ("SYNTHOSC1FMDEPTH");
-            auto& osc2FmDepth = *_apvts->getRawParameterValue ("SYNTHOSC2FMDEPTH");
-
-            //
-            auto& filterAttack = *_apvts->getRawParameterValue ("SYNTHFILTERATTACK");
-            auto& filterDecay = *_apvts->getRawParameterValue ("SYNTHFILTERDECAY");
-            auto& filterSustain = *_apvts->getRawParameterValue ("SYNTHFILTERSUSTAIN");
-            auto& filterRelease = *_apvts->getRawParameterValue ("SYNTHFILTERRELEASE");
-
-            //
-            auto& osc1 = voice->getOscillator1();
-            auto& osc2 = voice->getOscillator2();
-
-            //
-            auto& adsr = voice->getAdsr();
-            auto& filterAdsr = voice->getFilterAdsr();
-
-            //
-            for (unsigned long ii = 0; ii < (unsigned long)getTotalNumOutputChannels(); ii++) {
-                osc1[ii].setParams(static_cast<int>(osc1Choice), osc1Gain, static_cast<int>(osc1Pitch), osc1FmFreq, osc1FmDepth);
-                osc2[ii].setParams(static_cast<int>(osc2Choice), osc2Gain, static_cast<int>(osc2Pitch), osc2FmFreq, osc2FmDepth);
-            }
-
-            //
-            adsr.update (attack.load(), decay.load(), sustain.load(), release.load());
-            filterAdsr.update (filterAttack, filterDecay, filterSustain, filterRelease);
-        }
+
+    // polyphony
+    if (changed & SynthParams::bit(SynthParams::Voices)) {
+        _synth.setNumVoices(_synthParams.getInt(SynthParams::Voices));
     }
+
+    // every voice shares the oscillators, envelopes and glide
+    _synthParams.applyOscillators(_synth.getBank(), changed);
+    _synthParams.applyGlide(_synth.getBank(), changed);
 }
 
 // called within process
-void WilsonicProcessor::_setSynthFilterParams() {
+void WilsonicProcessor::_setSynthFilterParams(SynthParams::Mask changed) {
     // do NOT use the JucePlugin_IsSynth macro here
 
-    auto sampleRate = getSampleRate();
-    auto& filterType = *_apvts->getRawParameterValue ("SYNTHFILTERTYPE");
-    auto& filterCutoff = *_apvts->getRawParameterValue ("SYNTHFILTERCUTOFF");
-    auto& filterResonance = *_apvts->getRawParameterValue ("SYNTHFILTERRESONANCE");
-    auto& adsrDepth = *_apvts->getRawParameterValue ("SYNTHFILTERADSRDEPTH");
-    auto& lfoFreq = *_apvts->getRawParameterValue ("SYNTHLFO1FREQ");
-    auto& lfoDepth = *_apvts->getRawParameterValue ("SYNTHLFO1DEPTH");
-
-    for (int i = 0; i < _synth.getNumVoices(); ++i) {
-        if (auto voice = dynamic_cast<SynthVoice*>(_synth.getVoice(i))) {
-            voice->updateModParams(static_cast<float>(sampleRate), static_cast<int>(filterType), filterCutoff, filterResonance, adsrDepth, lfoFreq, lfoDepth);
-        }
-    }
+    // the filter envelope modulates each voice's cutoff
+    _synthParams.applyFilter(_synth.getBank(), changed);
 }
 
 // called within process
-void WilsonicProcessor::_setSynthReverbParams() {
+void WilsonicProcessor::_setSynthReverbParams(SynthParams::Mask changed) {
     // do NOT use the JucePlugin_IsSynth macro here
 
-    _reverbParams.roomSize = *_apvts->getRawParameterValue ("SYNTHREVERBSIZE");
-    _reverbParams.width = *_apvts->getRawParameterValue ("SYNTHREVERBWIDTH");
-    _reverbParams.damping = *_apvts->getRawParameterValue ("SYNTHREVERBDAMPING");
-    _reverbParams.dryLevel = *_apvts->getRawParameterValue ("SYNTHREVERBDRY");
-    _reverbParams.wetLevel = *_apvts->getRawParameterValue ("SYNTHREVERBWET");
-    _reverbParams.freezeMode = *_apvts->getRawParameterValue ("SYNTHREVERBFREEZE");
+    if ((changed & SynthParams::reverbMask) == 0) {
+        return;
+    }
+    _reverbParams.roomSize = _synthParams.get(SynthParams::ReverbSize);
+    _reverbParams.width = _synthParams.get(SynthParams::ReverbWidth);
+    _reverbParams.damping = _synthParams.get(SynthParams::ReverbDamping);
+    _reverbParams.dryLevel = _synthParams.get(SynthParams::ReverbDry);
+    _reverbParams.wetLevel = _synthParams.get(SynthParams::ReverbWet);
+    _reverbParams.freezeMode = _synthParams.get(SynthParams::ReverbFreeze);
     _reverb.setParameters (_reverbParams);
 }
 
@@ -169,35 +159,10 @@ void WilsonicProcessor::_setSynthReverbParams() {
 StringArray WilsonicProcessor::getSynthParameterIDs() {
     // do NOT use the JucePlugin_IsSynth macro here
 
-    return StringArray ("SYNTHOSC1",
-                        "SYNTHOSC2",
-                        "SYNTHOSC1GAIN",
-                        "SYNTHOSC2GAIN",
-                        "SYNTHOSC1PITCH",
-                        "SYNTHOSC2PITCH",
-                        "SYNTHOSC1FMFREQ",
-                        "SYNTHOSC2FMFREQ",
-                        "SYNTHOSC1FMDEPTH",
-                        "SYNTHOSC2FMDEPTH",
-                        "SYNTHLFO1FREQ",
-                        "SYNTHLFO1DEPTH",
-                        "SYNTHFILTERTYPE",
-                        "SYNTHFILTERCUTOFF",
-                        "SYNTHFILTERRESONANCE",
-                        "SYNTHATTACK",
-                        "SYNTHDECAY",
-                        "SYNTHSUSTAIN",
-                        "SYNTHRELEASE",
-                        "SYNTHFILTERADSRDEPTH",
-                        "SYNTHFILTERATTACK",
-                        "SYNTHFILTERDECAY",
-                        "SYNTHFILTERSUSTAIN",
-                        "SYNTHFILTERRELEASE",
-                        "SYNTHREVERBSIZE",
-                        "SYNTHREVERBWIDTH",
-                        "SYNTHREVERBDAMPING",
-                        "SYNTHREVERBDRY",
-                        "SYNTHREVERBWET",
-                        "SYNTHREVERBFREEZE"
-                        );
+    StringArray retVal;
+    for (size_t i = 0; i < SynthParams::NumParams; i++) {
+        retVal.add (SynthParams::getParameterID (static_cast<SynthParams::ID>(i)));
+    }
+
+    return retVal;
 }
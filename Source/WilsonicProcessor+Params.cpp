@@ -44,27 +44,33 @@ AudioProcessorValueTreeState::ParameterLayout WilsonicProcessor::_createParamGro
     // Each page has a model that is responsible for its entire, automatable state.
     // To release a new version without breaking automation, new parameters must be added to the end.
     // Note: Parameter groups do not seem to be a thing in the avpts
+    // The design models' layouts are static: the models are created on first use
     // 0.20Beta
     auto designsParamGroup = _designsModel->createParams();
-    auto brun2ParamGroup = _designsModel->getBrun2Model()->createParams(); // 0.22B added period
-    auto coPrimeParamGroup = _designsModel->getCoPrimeModel()->createParams(); // added 0.25b
-    auto cpsParamGroup = _designsModel->getCPSModel()->createParams();
-    auto etParamGroup = _designsModel->getEqualTemperamentModel()->createParams();
-    auto eulerGenusParamGroup = _designsModel->getEulerGenusModel()->createParams();
-    auto persian17NorthIndianParamGroup = _designsModel->getPersian17NorthIndianModel()->createParams();
-    auto presetParamGroup = _designsModel->getPresetsModel()->createParams();
-    auto recurrenceRelationParamGroup = _designsModel->getRecurrenceRelationModel()->createParams();
-    auto tritriadicParamGroup = _designsModel->getTritriadicModel()->createParams();
+    auto brun2ParamGroup = Brun2Model::createParams(); // 0.22B added period
+    auto coPrimeParamGroup = CoPrimeModel::createParams(); // added 0.25b
+    auto cpsParamGroup = CPSModel::createParams();
+    auto etParamGroup = EqualTemperamentModel::createParams();
+    auto eulerGenusParamGroup = EulerGenusModel::createParams();
+    auto persian17NorthIndianParamGroup = Persian17NorthIndianModel::createParams();
+    auto presetParamGroup = PresetsModel::createParams();
+    auto recurrenceRelationParamGroup = RecurrenceRelationModel::createParams();
+    auto tritriadicParamGroup = TritriadicModel::createParams();
     auto appTuningParamGroup = _designsModel->getAppTuningModel()->createParams();
-    auto scalaTuningParamGroup = _designsModel->getScalaModel()->createParams();
-    auto diamondsParamGroup = _designsModel->getDiamondsModel()->createParams();
-    auto morphParamGroup = _designsModel->getMorphModel()->createParams();
-    auto partchParamGroup = _designsModel->getPartchModel()->createParams();
+    auto scalaTuningParamGroup = ScalaModel::createParams();
+    auto diamondsParamGroup = DiamondsModel::createParams();
+    auto morphParamGroup = MorphModel::createParams();
+    auto partchParamGroup = PartchModel::createParams();
     auto favoritesParamGroup = _designsModel->getFavoritesModelV2()->createParams();
 
 #if JucePlugin_IsSynth
     // If the plugin is a synthesizer, create a parameter group for the synth.
     auto synthParamGroup = _createSynthParams();
+    auto synthVoiceParamGroup = _createSynthVoiceParams(); // added with the voice bank
+    auto synthTuningParamGroup = _createSynthTuningParams(); // added with scheduled tuning changes
+#elif JucePlugin_IsMidiEffect
+    // If the plugin is a MIDI effect, create a parameter group for pitch bend retuning.
+    auto retuneParamGroup = _createRetuneParams();
 #endif
     // To release a new version without breaking automation, new parameters must be added to the end: HERE!
 
@@ -90,6 +96,12 @@ AudioProcessorValueTreeState::ParameterLayout WilsonicProcessor::_createParamGro
      std::move(morphParamGroup),
      std::move(partchParamGroup),
      std::move(favoritesParamGroup)
+#if JucePlugin_IsSynth
+     , std::move(synthVoiceParamGroup)
+     , std::move(synthTuningParamGroup)
+#elif JucePlugin_IsMidiEffect
+     , std::move(retuneParamGroup)
+#endif
      // To release a new version without breaking automation, new parameters must be added to the end
      );
 
@@ -227,17 +227,25 @@ void WilsonicProcessor::saveShowProportionalTriads(bool should_show)
     String show = String(should_show ? 1 : 0);
     _properties->setValue(SHOW_PROPORTIONAL_TRIADS, show);
     _properties->saveIfNeeded();
+    _showProportionalTriads = should_show;
+    _showProportionalTriadsIsCached = true;
 }
 
 /**
  * @brief Restores the show proportional triads setting from the properties.
+ * The keyboard reads it while painting, so it is only read from the properties once; saving updates it.
  * @return Whether proportional triads should be shown.
  */
 bool WilsonicProcessor::restoreShowProportionalTriads()
 {
+    if(_showProportionalTriadsIsCached) {
+        return _showProportionalTriads;
+    }
     String val = _properties->getValue(SHOW_PROPORTIONAL_TRIADS, "1");
     int const val_int = val.getIntValue();
     bool const retVal =(val_int == 0) ? false : true;
+    _showProportionalTriads = retVal;
+    _showProportionalTriadsIsCached = true;
 
     return retVal;
 }
@@ -0,0 +1,92 @@
+/*
+ ==============================================================================
+
+ WilsonicProcessor+Retune.cpp
+ Created: 17 Oct 2026
+ Author:  Marcus W. Hobbs
+
+ ==============================================================================
+ */
+
+#include "AppTuningModel.h"
+#include "ScheduledTuning.h"
+#include "WilsonicProcessor.h"
+
+// do NOT use the JucePlugin_IsMidiEffect macro in this file
+
+#pragma mark - retune params
+
+// do NOT use the JucePlugin_IsMidiEffect macro here
+unique_ptr<AudioProcessorParameterGroup> WilsonicProcessor::_createRetuneParams()
+{
+    auto retuneParamGroup = make_unique<AudioProcessorParameterGroup>
+    ("Retune", "Retune", " | ",
+
+     // In-process retuning: MPE channel per note + pitch bend, for when MTS-ESP is not available
+     make_unique<AudioParameterBool> (ParameterID (getRetuneEnableParameterID(), AppVersion::getVersionHint()), "Retune|Pitch Bend Output", false),
+     make_unique<AudioParameterInt> (ParameterID (getRetuneBendRangeParameterID(), AppVersion::getVersionHint()), "Retune|Pitch Bend Range", PitchBendRetuner::minBendRange, PitchBendRetuner::maxBendRange, PitchBendRetuner::defaultBendRange, "st"),
+     make_unique<AudioParameterInt> (ParameterID (getRetuneChannelsParameterID(), AppVersion::getVersionHint()), "Retune|Member Channels", 1, PitchBendRetuner::maxMemberChannels, PitchBendRetuner::defaultNumMemberChannels),
+     make_unique<AudioParameterChoice> (ParameterID (getRetuneStealParameterID(), AppVersion::getVersionHint()), "Retune|Voice Stealing", StringArray { "Oldest", "None" }, 0)
+     );
+
+    return retuneParamGroup;
+}
+
+#pragma mark - retune
+
+/**
+ * @brief Rewrites midiMessages in place to MPE channel per note + pitch bend, from the scheduled tuning.
+ *
+ * Called within process, after _beginTuningBlock.  Events keep their sample positions.  The output is
+ * built in _retuneBuffer, preallocated in prepareToPlay, then swapped with midiMessages.
+ */
+void WilsonicProcessor::_retuneMidi(MidiBuffer& midiMessages)
+{
+    // do NOT use the JucePlugin_IsMidiEffect macro here
+    if (_retuneEnable == nullptr || _scheduledTuning == nullptr) {
+        return;
+    }
+    _retuneBuffer.clear();
+    int samplePosition = 0;
+    auto sink = [this, &samplePosition](const uint8_t* data, int numBytes) {
+        _retuneBuffer.addEvent(data, numBytes, samplePosition);
+    };
+
+    // disabled: end the retuned notes, and pass everything else through
+    auto const isEnabled = _retuneEnable->load() > 0.5f;
+    if (!isEnabled) {
+        if (!_retuneWasEnabled) {
+            return;
+        }
+        _retuneWasEnabled = false;
+        _retuner.allNotesOff(sink);
+        for (auto const metadata : midiMessages) {
+            _retuneBuffer.addEvent(metadata.data, metadata.numBytes, metadata.samplePosition);
+        }
+        midiMessages.swapWith(_retuneBuffer);
+
+        return;
+    }
+
+    // (re)configure the downstream synth when enabled, or when the zone changes
+    auto const bendRange = static_cast<int>(_retuneBendRange->load());
+    auto const numChannels = static_cast<int>(_retuneChannels->load());
+    if (!_retuneWasEnabled || bendRange != _retuner.getBendRange() || numChannels != _retuner.getNumMemberChannels()) {
+        _retuneWasEnabled = true;
+        _retuner.allNotesOff(sink);
+        _retuner.setBendRange(bendRange);
+        _retuner.setNumMemberChannels(numChannels);
+        _retuner.writeConfiguration(sink);
+    }
+    _retuner.setStealPolicy(static_cast<PitchBendRetuner::StealPolicy>(static_cast<int>(_retuneSteal->load())));
+
+    // held notes follow tuning changes, then this block's events
+    auto const& tuning = *_scheduledTuning;
+    auto frequencyForNote = [&tuning](int nn) { return tuning.getFrequency(static_cast<unsigned long>(nn)); };
+    _retuner.updateBends(frequencyForNote, sink);
+    for (auto const metadata : midiMessages) {
+        samplePosition = metadata.samplePosition;
+        _retuner.process(metadata.data, metadata.numBytes, frequencyForNote, sink);
+    }
+    midiMessages.swapWith(_retuneBuffer);
+}
@@ -23,6 +23,7 @@
 #include "PresetsModel.h"
 #include "RecurrenceRelationModel.h"
 #include "ScalaModel.h"
+#include "ScheduledTuning.h"
 #include "TritriadicModel.h"
 #include "TuningTests.h"
 #include "WilsonicEditor.h"
@@ -63,14 +64,22 @@ WilsonicProcessor::WilsonicProcessor()
     options.folderName = String(ProjectInfo::projectName);
     _properties = make_unique<PropertiesFile>(options);
 
+    // the audio thread plays the tuning from here
+    _scheduledTuning = &getScheduledTuning();
+
 #if JucePlugin_IsSynth
     // this has to happen for synth to even function properly
     // SYNTH
-    _synth.addSound(new SynthSound());
-    for (unsigned long i = 0; i < WilsonicProcessorConstants::numVoices; i++)
-    {
-        _synth.addVoice(new SynthVoice(*this));
-    }
+    _synth.addVoices(*_scheduledTuning);
+    _synthParams.resolve([this](const char* paramID) { return _apvts->getRawParameterValue(paramID); });
+    jassert(_synthParams.isResolved());
+#elif JucePlugin_IsMidiEffect
+    // PITCH BEND RETUNING
+    _retuneEnable = _apvts->getRawParameterValue(getRetuneEnableParameterID());
+    _retuneBendRange = _apvts->getRawParameterValue(getRetuneBendRangeParameterID());
+    _retuneChannels = _apvts->getRawParameterValue(getRetuneChannelsParameterID());
+    _retuneSteal = _apvts->getRawParameterValue(getRetuneStealParameterID());
+    jassert(_retuneEnable != nullptr && _retuneBendRange != nullptr && _retuneChannels != nullptr && _retuneSteal != nullptr);
 #endif
     
     // always do MidiKeyboardState for every target
@@ -110,6 +119,7 @@ void WilsonicProcessor::_MTS_helper() {
         MTS_ClearNoteFilter();
         MTS_SetScaleName("MTS-ESP Init");
         _mtsEspStatus = MTS_ESP_Status::Registered;
+        getAppTuningModel()->resendTuningToMtsEsp(); // new session: send every note
         if(_mtsEspStatus != _mtsEspStatusPrevious) {
             WilsonicMenuComponentMessageBus::getInstance().broadcastMessage("Wilsonic registered as MTS-ESP Source");
             _mtsEspStatusPrevious = _mtsEspStatus;
@@ -207,21 +217,18 @@ void WilsonicProcessor::changeProgramName(int , const String& ) {
     //TODO: support current program
 }
 
-const atomic<float>& WilsonicProcessor::getRMS() {
-    return _meter.getRMS();
+const SynthTelemetry& WilsonicProcessor::getSynthTelemetry() {
+    _telemetry.update();
+    return _telemetry.get();
 }
 
-const atomic<float>& WilsonicProcessor::getPeak() {
-    return _meter.getPeak();
+const VoiceStates& WilsonicProcessor::getVoiceStates() {
+    return getSynthTelemetry().voiceStates;
 }
 
-VoiceStates WilsonicProcessor::getVoiceStates() {
-    return _voiceStates; // return by value
-}
-
-void WilsonicProcessor::setVoiceStateFrequency(unsigned long nn, float frequency) {
-    jassert(nn >= 0 && nn < WilsonicProcessorConstants::numMidiNotes);
-    _voiceStates.voiceState[nn].frequency = frequency;
+uint64_t WilsonicProcessor::getTelemetrySequence() {
+    _telemetry.update();
+    return _telemetry.getSequence();
 }
 
 shared_ptr<MidiKeyboardState> WilsonicProcessor::getKeyboardState() {
@@ -249,6 +256,10 @@ shared_ptr<AppTuningModel> WilsonicProcessor::getAppTuningModel() {
     return _designsModel->getAppTuningModel();
 }
 
+ScheduledTuning& WilsonicProcessor::getScheduledTuning() {
+    return _designsModel->getAppTuningModel()->getScheduledTuning();
+}
+
 shared_ptr<Brun2Model> WilsonicProcessor::getBrun2Model() {
     return _designsModel->getBrun2Model();
 }
@@ -324,12 +335,7 @@ AudioProcessorValueTreeState::Listener* WilsonicProcessor::getProcessorAsListene
 void WilsonicProcessor::prepareToPlay(double sampleRate, int samplesPerBlock) {
 #if JucePlugin_IsSynth
     _synth.setCurrentPlaybackSampleRate(sampleRate);
-    jassert(_synth.getNumVoices() == WilsonicProcessorConstants::numVoices);
-    for (int i = 0; i < _synth.getNumVoices(); i++) {
-        if (auto voice = dynamic_cast<SynthVoice*>(_synth.getVoice(i))) {
-            voice->prepareToPlay(sampleRate, samplesPerBlock, getTotalNumOutputChannels());
-        }
-    }
+    jassert(_synth.getNumVoices() == static_cast<int>(WilsonicProcessorConstants::maxVoices));
 
     dsp::ProcessSpec spec;
     spec.maximumBlockSize = (unsigned int)samplesPerBlock;
@@ -343,9 +349,16 @@ void WilsonicProcessor::prepareToPlay(double sampleRate, int samplesPerBlock) {
     _reverbParams.dryLevel = 1.0f;
     _reverbParams.wetLevel = 0.0f;
     _reverb.setParameters(_reverbParams);
+    _synthParams.invalidate(); // push every parameter on the first block
 #elif JucePlugin_IsMidiEffect
     ignoreUnused(samplesPerBlock);
     _sampleRateMIDIController = static_cast<float>(sampleRate);
+
+    // retuning never allocates in processBlock: configuration, plus a bend and a note per event
+    constexpr size_t retuneBufferBytes = 64 * 1024;
+    _retuneBuffer.ensureSize(retuneBufferBytes);
+    _retuner.reset();
+    _retuneWasEnabled = false; // resend the configuration
 #endif
     DBG("WilsonicProcessor::prepareToPlay: Input bus count: " << getBusCount(true));
     DBG("WilsonicProcessor::prepareToPlay: Output bus count: " << getBusCount(false));
@@ -405,32 +418,33 @@ void WilsonicProcessor::processBlock(AudioBuffer<float>& buffer, MidiBuffer& mid
 
     // Process the MIDI buffer.
     _keyboardState->processNextMidiBuffer(midiMessages, 0, buffer.getNumSamples(), true);
+
+    // Tuning changes are applied here, at the block boundary, never within a render.
+    _beginTuningBlock();
     if (! AppExperiments::enableSimpleSynth) {
         // If the simple synth is not enabled, render zeros.
         _synth.renderNextBlock(buffer, midiMessages, 0, buffer.getNumSamples());
     } else {
         // Update the synth parameters.
-        _setSynthParams();
+        _setSynthParams(buffer.getNumSamples());
 
         // Render the synth.
         _synth.renderNextBlock(buffer, midiMessages, 0, buffer.getNumSamples());
 
-        // Get the voice states. This may need a lock to avoid race conditions.
-        VoiceStates vs = VoiceStates();
-        auto const num_voices = _synth.getNumVoices();
-        for (int i = 0; i < num_voices; i++) {
-            if (auto voice = dynamic_cast<SynthVoice*>(_synth.getVoice(i))) {
-                vs.voiceState[i] = voice->getVoiceState();
-            }
-        }
-        _voiceStates = vs; // Copy the voice states by value.
-
         // Process the reverb.
         dsp::AudioBlock<float> block { buffer };
         _reverb.process(dsp::ProcessContextReplacing<float>(block));
 
         // Process the output meter at the processor level.
         _meter.process(buffer);
+
+        // Publish the voice states and meters to the ui: written in place, wait-free.
+        _synth.getBank().updateMeters();
+        auto& telemetry = _telemetry.beginWrite();
+        _synth.fillVoiceStates(telemetry.voiceStates);
+        telemetry.rms = _meter.getRMS();
+        telemetry.peak = _meter.getPeak();
+        _telemetry.publish();
     }
 #elif JucePlugin_IsMidiEffect
     // This code path is taken if the plugin is a MIDI effect.
@@ -443,12 +457,29 @@ void WilsonicProcessor::processBlock(AudioBuffer<float>& buffer, MidiBuffer& mid
 
     // Process the MIDI buffer.
     _keyboardState->processNextMidiBuffer(midiMessages, 0, numSamples, true);
+
+    // Optional in-process retuning, after the keyboard so its notes are retuned too.
+    _beginTuningBlock();
+    _retuneMidi(midiMessages);
 #else
     // This code path should never be taken. If it is, there's a problem with the plugin configuration.
     jassertfalse;
 #endif
 }
 
+#pragma mark - Scheduled tuning
+
+/**
+ * @brief Starts a block: applies the latest tuning change, so the whole block is rendered with one tuning.
+ *
+ * JUCE delivers host automation once per block, before processBlock, and automation of a design reaches
+ * AppTuningModel on that same thread, so the change is played from the start of the block it arrived with.
+ * Changes made on the message thread are played from the start of the next block.
+ */
+void WilsonicProcessor::_beginTuningBlock() {
+    _scheduledTuning->applyPending();
+}
+
 #pragma mark - Editor
 
 bool WilsonicProcessor::hasEditor() const {
@@ -673,6 +704,7 @@ bool WilsonicProcessor::resetMtsEsp() {
         MTS_RegisterMaster();
         MTS_ClearNoteFilter();
         _mtsEspStatus = MTS_ESP_Status::Registered;
+        getAppTuningModel()->resendTuningToMtsEsp(); // new session: send every note
         WilsonicMenuComponentMessageBus::getInstance().broadcastMessage("MTS-ESP: Wilsonic is registered as the source");
         sendActionMessage(getMtsEspStatusDidChangeMessage());
 
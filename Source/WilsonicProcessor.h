@@ -13,11 +13,13 @@
 #include "DesignsProtocol.h"
 #include "libMTSMaster.h"
 #include "MeterData.h"
-#include "SynthSound.h"
-#include "SynthVoice.h"
+#include "PitchBendRetuner.h"
+#include "SynthParams.h"
+#include "TelemetryChannel.h"
 #include "VoiceStates.h"
 #include "WilsonicAppSkin.h"
 #include "WilsonicProcessorConstants.h"
+#include "WilsonicSynth.h"
 
 // ADD NEW SCALE DESIGN HERE
 // forward declarations
@@ -36,6 +38,7 @@ class Persian17NorthIndianModel;
 class PresetsModel;
 class RecurrenceRelationModel;
 class ScalaModel;
+class ScheduledTuning;
 class TritriadicModel;
 
 // class
@@ -73,6 +76,10 @@ public:
 
     static const String getMtsEspStatusDidChangeMessage() { return "MTSESPSTATUSDIDCHANGE"; }
     static const String getMIDIPanicMessage() { return "MIDIPANICMESSAGE"; }
+    static const char* getRetuneEnableParameterID() { return "RETUNEENABLE"; }
+    static const char* getRetuneBendRangeParameterID() { return "RETUNEBENDRANGE"; }
+    static const char* getRetuneChannelsParameterID() { return "RETUNECHANNELS"; }
+    static const char* getRetuneStealParameterID() { return "RETUNESTEAL"; }
 
     // lifecycle
 
@@ -114,11 +121,11 @@ public:
     void getStateInformation(MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
-    // Synth audio levels
-    const atomic<float>& getRMS();
-    const atomic<float>& getPeak();
-    VoiceStates getVoiceStates(); // struct: copy by value for synth
-    void setVoiceStateFrequency(unsigned long nn, float frequency); // midi effect
+    // Synth audio levels: the latest frame from the audio thread.  Message thread only;
+    // a reference is valid until the next call.  Read everything of one paint from one call.
+    const SynthTelemetry& getSynthTelemetry();
+    const VoiceStates& getVoiceStates();
+    uint64_t getTelemetrySequence(); // changes when there is a new frame
 
     // keyboard
     shared_ptr<MidiKeyboardState> getKeyboardState(); // class, used by audio and message threads ==> can't copy
@@ -129,6 +136,7 @@ public:
     WilsonicAppSkin& getAppSkin();
     // ADD NEW SCALE DESIGN HERE
     shared_ptr<AppTuningModel> getAppTuningModel();
+    ScheduledTuning& getScheduledTuning(); // lock-free, the audio thread applies its changes at block boundaries
     shared_ptr<CoPrimeModel> getCoPrimeModel();
     shared_ptr<CPSModel> getCPSModel();
     shared_ptr<DesignsModel> getDesignsModel();
@@ -219,17 +227,22 @@ private:
 
     // OWNER: synth models
     // synth models
-    Synthesiser _synth; // OWNER
+    WilsonicSynth _synth; // OWNER
+    SynthParams _synthParams; // OWNER, resolved once
     dsp::Reverb _reverb; // OWNER
     Reverb::Parameters _reverbParams; // OWNER
-    VoiceStates _voiceStates {}; // OWNER
-    MeterData _meter; // OWNER
+    TelemetryChannel<SynthTelemetry> _telemetry; // OWNER, audio thread -> message thread
+    MeterData _meter; // OWNER, audio thread
+
+    ScheduledTuning* _scheduledTuning = nullptr; // owned by AppTuningModel
 
     // tunings models...order is important
     shared_ptr<DesignsModel> _designsModel; // OWNER, order is important
     shared_ptr<AudioProcessorValueTreeState> _apvts; // order is important
     shared_ptr<MidiKeyboardState> _keyboardState;
     unique_ptr<PropertiesFile> _properties;
+    bool _showProportionalTriads = true; // read while painting, so cached: restored once, updated on save
+    bool _showProportionalTriadsIsCached = false;
 
     // MTS-ESP
 #if JUCE_IOS || JUCE_ANDROID
@@ -242,16 +255,30 @@ private:
     // Sample Rate for midi controller target
     float _sampleRateMIDIController = 48000.f;
 
+    // midi controller target: optional pitch bend retuning, audio thread
+    PitchBendRetuner _retuner; // OWNER
+    MidiBuffer _retuneBuffer; // OWNER, preallocated
+    const atomic<float>* _retuneEnable = nullptr; // resolved once
+    const atomic<float>* _retuneBendRange = nullptr;
+    const atomic<float>* _retuneChannels = nullptr;
+    const atomic<float>* _retuneSteal = nullptr;
+    bool _retuneWasEnabled = false;
+
 #pragma mark - private methods
     // private methods
     void _MTS_helper();
     AudioProcessorValueTreeState::ParameterLayout _createParamGroup();
     unique_ptr<AudioProcessorParameterGroup> _createSynthParams();
-    void _setSynthParams(); // called within process
-    void _setSynthVoiceParams(); // called within process
-    void _setSynthFilterParams(); // called within process
-    void _setSynthReverbParams(); // called within process
+    unique_ptr<AudioProcessorParameterGroup> _createSynthVoiceParams();
+    unique_ptr<AudioProcessorParameterGroup> _createSynthTuningParams();
+    void _setSynthParams(int numSamples); // called within process
+    void _setSynthVoiceParams(SynthParams::Mask changed); // called within process
+    void _setSynthFilterParams(SynthParams::Mask changed); // called within process
+    void _setSynthReverbParams(SynthParams::Mask changed); // called within process
+    void _beginTuningBlock(); // called within process
     StringArray getSynthParameterIDs(); // used for Favorites
+    unique_ptr<AudioProcessorParameterGroup> _createRetuneParams();
+    void _retuneMidi(MidiBuffer& midiMessages); // called within process
 
     // ADD NEW SCALE DESIGN HERE
     // DesignsProtocol
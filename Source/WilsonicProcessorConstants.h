@@ -25,26 +25,30 @@ public:
     /**
      * @brief Depending on the plugin type, different constants are defined.
      * 
-     * If the plugin is a synth, numVoices is set to 5 and identifier is set to "Wilsonic".
-     * If the plugin is a MIDI effect, numVoices is set to 5 and identifier is set to "WilsonicController".
-     * If the plugin is neither, an assertion failure is triggered and numVoices is set to 5 and identifier is set to "Fubar".
+     * If the plugin is a synth, identifier is set to "Wilsonic".
+     * If the plugin is a MIDI effect, identifier is set to "WilsonicController".
+     * If the plugin is neither, an assertion failure is triggered and identifier is set to "Fubar".
      */
 #if JucePlugin_IsSynth
-    static constexpr unsigned long numVoices = 5;
     static constexpr const char* identifier = "Wilsonic";
 #elif JucePlugin_IsMidiEffect
-    static constexpr unsigned long numVoices = 5;
     static constexpr const char* identifier = "WilsonicController";
 #else
     jassertfalse;
-    static constexpr unsigned long numVoices = 5;
     static constexpr const char* identifier = "Fubar";
 #endif
+
+    /**
+     * @brief The synth's polyphony: the SYNTHVOICES parameter, in [1, maxVoices].
+     * Every voice exists from construction (OscillatorBank::maxVoices), so changing it never allocates.
+     */
+    static constexpr unsigned long maxVoices = 128;
+    static constexpr int defaultNumVoices = 16;
     static constexpr unsigned long numChannelsToProcess = 2;
     static constexpr int defaultMidiChannel = 1;
     static constexpr float defaultVelocity = 0.9f;
     static constexpr int defaultNumPrecisionDigits = 6;
-    static constexpr int defaultUIUpdateFrequencyHz = 24; // Hz
+    static constexpr int defaultUIUpdateFrequencyHz = 20; // Hz, a divisor of FrameScheduler::frameRateHz
     
     /**
      * @brief The number of MIDI notes. This value must never change.
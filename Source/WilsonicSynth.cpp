@@ -0,0 +1,125 @@
+/**
+ * @file WilsonicSynth.cpp
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the implementation of the WilsonicSynth class.
+ */
+
+#include "AppExperiments.h"
+#include "SynthSound.h"
+#include "WilsonicSynth.h"
+
+#pragma mark - lifecycle
+
+void WilsonicSynth::addVoices(const ScheduledTuning& tuning) {
+    jassert(getNumVoices() == 0);
+    _tuning = &tuning;
+    addSound(new SynthSound());
+    for(size_t i = 0; i < OscillatorBank::maxVoices; i++) {
+        addVoice(new SynthVoice(_bank, i));
+    }
+}
+
+void WilsonicSynth::setCurrentPlaybackSampleRate(double sampleRate) {
+    Synthesiser::setCurrentPlaybackSampleRate(sampleRate);
+    _bank.prepare(sampleRate);
+    allNotesOff(0, false); // the bank was reset
+}
+
+#pragma mark - polyphony
+
+void WilsonicSynth::setNumVoices(int numVoices) {
+    numVoices = jlimit(1, static_cast<int>(OscillatorBank::maxVoices), numVoices);
+    if(numVoices == _numVoices) {
+        return;
+    }
+    const ScopedLock sl(lock);
+    for(int i = numVoices; i < _numVoices; i++) {
+        auto voice = voices.getUnchecked(i);
+        if(voice->isVoiceActive()) {
+            stopVoice(voice, 0.f, true);
+        }
+    }
+    _numVoices = numVoices;
+}
+
+// only the first _numVoices voices
+SynthesiserVoice* WilsonicSynth::findFreeVoice(SynthesiserSound* sound, int midiChannel, int midiNoteNumber, bool stealIfNoneAvailable) const {
+    const ScopedLock sl(lock);
+    for(int i = 0; i < _numVoices; i++) {
+        auto voice = voices.getUnchecked(i);
+        if(!voice->isVoiceActive() && voice->canPlaySound(sound)) {
+            return voice;
+        }
+    }
+    if(stealIfNoneAvailable) {
+        return findVoiceToSteal(sound, midiChannel, midiNoteNumber);
+    }
+
+    return nullptr;
+}
+
+// the same note, else the oldest released voice, else the oldest voice
+SynthesiserVoice* WilsonicSynth::findVoiceToSteal(SynthesiserSound* sound, int /*midiChannel*/, int midiNoteNumber) const {
+    SynthesiserVoice* oldestReleased = nullptr;
+    SynthesiserVoice* oldest = nullptr;
+    for(int i = 0; i < _numVoices; i++) {
+        auto voice = voices.getUnchecked(i);
+        if(!voice->canPlaySound(sound)) {
+            continue;
+        }
+        if(voice->getCurrentlyPlayingNote() == midiNoteNumber) {
+            return voice;
+        }
+        if(voice->isPlayingButReleased() && (oldestReleased == nullptr || voice->wasStartedBefore(*oldestReleased))) {
+            oldestReleased = voice;
+        }
+        if(oldest == nullptr || voice->wasStartedBefore(*oldest)) {
+            oldest = voice;
+        }
+    }
+    jassert(oldest != nullptr);
+
+    return oldestReleased != nullptr ? oldestReleased : oldest;
+}
+
+#pragma mark - render
+
+void WilsonicSynth::renderVoices(AudioBuffer<float>& outputBuffer, int startSample, int numSamples) {
+    if(!AppExperiments::enableSimpleSynth) {
+        return;
+    }
+    jassert(_tuning != nullptr);
+
+    // held notes follow the tuning
+    _bank.updateFrequencies([this](unsigned long nn) { return _tuning->getFrequency(nn); });
+
+    // the voices are mono
+    for(int offset = 0; offset < numSamples; offset += static_cast<int>(__scratchSize)) {
+        auto const n = jmin(static_cast<int>(__scratchSize), numSamples - offset);
+        std::fill(_scratch.begin(), _scratch.begin() + n, 0.f);
+        _bank.render(_scratch.data(), static_cast<size_t>(n));
+        for(int ch = 0; ch < outputBuffer.getNumChannels(); ch++) {
+            outputBuffer.addFrom(ch, startSample + offset, _scratch.data(), n);
+        }
+    }
+
+    // voices release the notes the bank finished
+    Synthesiser::renderVoices(outputBuffer, startSample, numSamples);
+}
+
+void WilsonicSynth::fillVoiceStates(VoiceStates& voiceStates) const {
+    for(size_t i = 0; i < OscillatorBank::maxVoices; i++) {
+        auto& vs = voiceStates.voiceState[i];
+        if(!_bank.isVoiceActive(i)) {
+            vs = VoiceState();
+            vs.velocity = 0.f;
+            continue;
+        }
+        vs.nn = _bank.noteNumberAtVoice(i);
+        vs.frequency = _bank.frequencyAtVoice(i);
+        vs.velocity = _bank.velocityAtVoice(i);
+        vs.rms = _bank.rmsAtVoice(i);
+        vs.peak = _bank.peakAtVoice(i);
+    }
+}
@@ -0,0 +1,56 @@
+/**
+ * @file WilsonicSynth.h
+ * @author Marcus W. Hobbs
+ * @date 17 Oct 2026
+ * @brief This file contains the WilsonicSynth class.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "OscillatorBank.h"
+#include "SynthVoice.h"
+#include "ScheduledTuning.h"
+#include "VoiceStates.h"
+#include "WilsonicProcessorConstants.h"
+
+/**
+ * @class WilsonicSynth
+ * @brief The synth: juce::Synthesiser for MIDI and voice allocation, an OscillatorBank for rendering.
+ *
+ * Every SynthVoice is a lane of the bank, so the voices are rendered together instead of one at a time.
+ * All maxVoices voices are added once; setNumVoices() limits how many of them are allocated to notes,
+ * and stealing only considers those.
+ */
+class WilsonicSynth final
+: public Synthesiser
+{
+public:
+    // lifecycle
+    WilsonicSynth() = default;
+    ~WilsonicSynth() override = default;
+    void addVoices(const ScheduledTuning& tuning); ///< Once, before audio starts
+    void setCurrentPlaybackSampleRate(double sampleRate) override;
+
+    // polyphony, called on the audio thread
+    void setNumVoices(int numVoices); ///< In [1, maxVoices].  Voices above it are released.
+    int getNumVoicesInUse() const { return _numVoices; }
+
+    // the bank, i.e., for parameters
+    OscillatorBank& getBank() { return _bank; }
+    void fillVoiceStates(VoiceStates& voiceStates) const; ///< After a block
+
+protected:
+    SynthesiserVoice* findFreeVoice(SynthesiserSound* sound, int midiChannel, int midiNoteNumber, bool stealIfNoneAvailable) const override;
+    SynthesiserVoice* findVoiceToSteal(SynthesiserSound* sound, int midiChannel, int midiNoteNumber) const override;
+    void renderVoices(AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override;
+
+private:
+    static constexpr size_t __scratchSize = 256; // render chunk, samples
+    OscillatorBank _bank {};
+    const ScheduledTuning* _tuning = nullptr; // the audio thread applies its changes, see WilsonicProcessor::_beginTuningBlock
+    array<float, __scratchSize> _scratch {}; // mono mix
+    int _numVoices = WilsonicProcessorConstants::defaultNumVoices;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WilsonicSynth)
+};
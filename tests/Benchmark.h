@@ -0,0 +1,206 @@
+// A minimal benchmark harness for the headless benchmarks: timed samples, median/p99, allocation
+// counts, JSON output, and a regression check against a previous JSON output.
+//
+// Include it in exactly one translation unit per benchmark: it replaces the global operator new.
+//
+// Every benchmark accepts:
+//   --json <path>       write the results as JSON (default: stdout)
+//   --baseline <path>   compare against a previous --json output
+//   --threshold <x>     a case regresses if its median exceeds the baseline by more than x (default 0.10),
+//                       or if it allocates more per op than the baseline
+//   --passes <n>        times each case is run (default 5)
+//   --filter <text>     only run cases whose name contains text
+// The exit status is 1 if any case regressed.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+    inline std::atomic<unsigned long long> allocations {0};
+}
+
+void* operator new(std::size_t size) {
+    benchmark::allocations.fetch_add(1, std::memory_order_relaxed);
+    if(auto p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace benchmark
+{
+    struct Result {
+        std::string name {};
+        unsigned long long samples = 0;
+        double medianNs = 0; // per op
+        double p99Ns = 0; // per op
+        double meanNs = 0; // per op
+        double allocationsPerOp = 0;
+    };
+
+    // keeps the optimizer from removing work whose result is unused
+    template<typename T>
+    inline void doNotOptimize(const T& value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    class Runner final
+    {
+    public:
+        Runner(int argc, char* argv[]) {
+            for(int i = 1; i + 1 < argc; i += 2) {
+                std::string const key = argv[i];
+                std::string const value = argv[i + 1];
+                if(key == "--json") _jsonPath = value;
+                else if(key == "--baseline") _baselinePath = value;
+                else if(key == "--threshold") _threshold = std::stod(value);
+                else if(key == "--passes") _passes = std::max(1, std::stoi(value));
+                else if(key == "--filter") _filter = value;
+                else std::fprintf(stderr, "unknown option: %s\n", key.c_str());
+            }
+        }
+
+        // times op(i) for i in [0, ops), passes times.  Each sample is batch consecutive ops.
+        template<typename Op>
+        void run(const std::string& name, size_t ops, size_t batch, Op op) {
+            run(name, ops, batch, op, []() {});
+        }
+
+        // the same, calling reset() untimed before each pass, i.e. to restore the input of an in place op
+        template<typename Op, typename Reset>
+        void run(const std::string& name, size_t ops, size_t batch, Op op, Reset reset) {
+            if(ops == 0 || (!_filter.empty() && name.find(_filter) == std::string::npos)) {
+                return;
+            }
+            batch = std::max<size_t>(1, batch);
+            using Clock = std::chrono::steady_clock;
+            std::vector<double> samples;
+            samples.reserve(_passes * (ops / batch + 1));
+            auto const allocations0 = allocations.load();
+            double totalNs = 0;
+            unsigned long long resetAllocations = 0;
+            for(int pass = 0; pass < _passes; pass++) {
+                auto const allocations1 = allocations.load();
+                reset();
+                resetAllocations += allocations.load() - allocations1;
+                for(size_t i = 0; i < ops; i += batch) {
+                    auto const n = std::min(batch, ops - i);
+                    auto const t0 = Clock::now();
+                    for(size_t j = i; j < i + n; j++) {
+                        op(j);
+                    }
+                    auto const ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+                    totalNs += ns;
+                    samples.push_back(ns / static_cast<double>(n));
+                }
+            }
+            auto const totalOps = static_cast<double>(ops) * _passes;
+            Result r;
+            r.name = name;
+            r.samples = samples.size();
+            r.medianNs = _percentile(samples, 0.5);
+            r.p99Ns = _percentile(samples, 0.99);
+            r.meanNs = totalNs / totalOps;
+            r.allocationsPerOp = static_cast<double>(allocations.load() - allocations0 - resetAllocations) / totalOps;
+            std::fprintf(stderr, "%-32s median %12.1f ns  p99 %12.1f ns  allocs/op %8.2f\n", name.c_str(), r.medianNs, r.p99Ns, r.allocationsPerOp);
+            _results.push_back(r);
+        }
+
+        // writes the JSON, checks the baseline; returns the exit status
+        int finish() {
+            std::ostringstream json;
+            json << "{\n  \"results\": [\n";
+            for(size_t i = 0; i < _results.size(); i++) {
+                auto const& r = _results[i];
+                json << "    {\"name\": \"" << r.name << "\", \"samples\": " << r.samples
+                     << ", \"median_ns\": " << r.medianNs << ", \"p99_ns\": " << r.p99Ns << ", \"mean_ns\": " << r.meanNs
+                     << ", \"allocations_per_op\": " << r.allocationsPerOp << "}" << (i + 1 < _results.size() ? "," : "") << "\n";
+            }
+            json << "  ]\n}\n";
+            if(_jsonPath.empty()) {
+                std::fputs(json.str().c_str(), stdout);
+            } else {
+                std::ofstream(_jsonPath) << json.str();
+            }
+
+            return _checkBaseline() ? 0 : 1;
+        }
+
+    private:
+        std::string _jsonPath {};
+        std::string _baselinePath {};
+        double _threshold = 0.10;
+        int _passes = 5;
+        std::string _filter {};
+        std::vector<Result> _results {};
+
+        static double _percentile(std::vector<double>& samples, double p) {
+            auto const k = static_cast<size_t>(p * static_cast<double>(samples.size() - 1) + 0.5);
+            std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(k), samples.end());
+            return samples[k];
+        }
+
+        // reads "key": number from one line of our own JSON
+        static bool _number(const std::string& line, const std::string& key, double& value) {
+            auto const at = line.find("\"" + key + "\": ");
+            if(at == std::string::npos) {
+                return false;
+            }
+            value = std::strtod(line.c_str() + at + key.size() + 4, nullptr);
+            return true;
+        }
+
+        bool _checkBaseline() const {
+            if(_baselinePath.empty()) {
+                return true;
+            }
+            std::ifstream in(_baselinePath);
+            if(!in) {
+                std::fprintf(stderr, "can't read baseline %s\n", _baselinePath.c_str());
+                return false;
+            }
+            bool ok = true;
+            std::string line;
+            while(std::getline(in, line)) {
+                auto const at = line.find("\"name\": \"");
+                if(at == std::string::npos) {
+                    continue;
+                }
+                auto const name = line.substr(at + 9, line.find('"', at + 9) - at - 9);
+                double median = 0, allocations_per_op = 0;
+                if(!_number(line, "median_ns", median) || !_number(line, "allocations_per_op", allocations_per_op)) {
+                    continue;
+                }
+                for(auto const& r : _results) {
+                    if(r.name != name) {
+                        continue;
+                    }
+                    auto const ratio = median > 0 ? r.medianNs / median : 1.0;
+                    auto const slower = ratio > 1.0 + _threshold;
+                    auto const allocates = r.allocationsPerOp > allocations_per_op + 0.5;
+                    std::fprintf(stderr, "%-32s %+7.1f%% %s\n", name.c_str(), (ratio - 1.0) * 100.0,
+                                 slower ? "REGRESSED" : (allocates ? "ALLOCATES MORE" : "ok"));
+                    ok = ok && !slower && !allocates;
+                }
+            }
+
+            return ok;
+        }
+    };
+}
@@ -7,6 +7,10 @@
 #define jassert(x) assert(x)
 #endif
 
+#ifndef jassertfalse
+#define jassertfalse assert(false)
+#endif
+
 template <typename Type>
 static constexpr const Type& jlimit(const Type& lower, const Type& upper, const Type& value)
 {
@@ -0,0 +1,68 @@
+// Benchmarks plugin startup headless: the JUCE-free work that creating the design models costs.
+// DesignsModel creates a design's model on first use, so instantiation pays only for the selected design;
+// these cases time what the others still pay when they are first shown.  See Benchmark.h for the options.
+//
+//   scala_bundle_open      ScalaBundle over the bundled library (ScalaBundleModel, i.e. ScalaModel creation), per open
+//   scala_bundle_rows      the table text of every entry, per entry
+//   scala_default_degrees  the degrees of the first entry (the default Scala tuning), per decode
+//   eulergenus_find_key    EulerGenusTables::findDAWKey (EulerGenusModel creation and automation), per DAW key
+//
+// usage: ./tests/bench_startup [scala bundle, default Resources/scala_bundle_00_v1.bin] [options]
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Source/EulerGenusTables.h"
+#include "../Source/ScalaBundle.h"
+
+int main(int argc, char* argv[]) {
+    std::string path = "Resources/scala_bundle_00_v1.bin";
+    if(argc > 1 && argv[1][0] != '-') {
+        path = argv[1];
+        argv[1] = argv[0];
+        argc--;
+        argv++;
+    }
+    benchmark::Runner runner(argc, argv);
+
+    // the bundle, read once: the plugin reads it in place from BinaryData
+    std::ifstream in(path, std::ios::binary);
+    std::vector<char> const data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    ScalaBundle const bundle(data.data(), data.size());
+    if(!bundle.isValid()) {
+        std::fprintf(stderr, "not a scala bundle: %s\n", path.c_str());
+        return 1;
+    }
+    auto const numEntries = static_cast<size_t>(bundle.getNumEntries());
+    std::fprintf(stderr, "%zu scala bundle entries, %zu EulerGenus DAW keys\n", numEntries, EulerGenusTables::numDAWKeys);
+
+    // Scala
+    runner.run("scala_bundle_open", 100, 1, [&](size_t) {
+        ScalaBundle b(data.data(), data.size());
+        benchmark::doNotOptimize(b.isValid());
+    });
+    runner.run("scala_bundle_rows", numEntries, 64, [&](size_t i) {
+        size_t n = 0;
+        for(int c = 0; c < bundle.getNumColumns(); c++) {
+            n += bundle.getText(static_cast<int>(i), c).size();
+        }
+        benchmark::doNotOptimize(n);
+    });
+    runner.run("scala_default_degrees", 1000, 10, [&](size_t) {
+        double sum = 0;
+        for(int d = 0; d < bundle.getNumDegrees(0); d++) {
+            sum += bundle.getDegree(0, d).cents;
+        }
+        benchmark::doNotOptimize(sum);
+    });
+
+    // EulerGenus
+    runner.run("eulergenus_find_key", EulerGenusTables::numDAWKeys, 64, [&](size_t i) {
+        benchmark::doNotOptimize(EulerGenusTables::findDAWKey(EulerGenusTables::dawKeys[i].key));
+    });
+
+    return runner.finish();
+}
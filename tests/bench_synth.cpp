@@ -0,0 +1,116 @@
+// Benchmarks the synth's OscillatorBank headless: the whole render cost of a block, which is what the audio thread pays.
+// A 512 sample block at 48 kHz is 10.7 ms of audio; the per-op time is the share of that budget.  See Benchmark.h for the options.
+//
+//   render_idle_512        no voice playing, per block
+//   render_16_voices_512   16 sustained voices (the default polyphony), per block
+//   render_128_voices_512  every voice, per block
+//   render_128_fm_512      every voice, both oscillators with FM, per block
+//   note_on_off            a note on and off, per pair
+//   params_lookup_by_id    the synth parameters looked up by ID string, as processBlock did every block, per block
+//   params_update          the synth parameters read through SynthParams with no motion, per block
+//   process_block_32       processBlock's synth work, 16 voices and no parameter motion: parameters and render, per 32 sample block
+//   process_block_64       the same, per 64 sample block
+//   process_block_512      the same, per 512 sample block
+//
+// usage: ./tests/bench_synth [options]
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Source/OscillatorBank.h"
+#include "../Source/SynthParams.h"
+
+static float equalTemperament(unsigned long nn) {
+    return 440.f * std::exp2((static_cast<float>(nn) - 69.f) / 12.f);
+}
+
+int main(int argc, char* argv[]) {
+    benchmark::Runner runner(argc, argv);
+    constexpr size_t blockSize = 512;
+    std::vector<float> block(blockSize);
+
+    auto bank = std::make_unique<OscillatorBank>();
+    bank->prepare(48000.0);
+    bank->setOscillator(0, OscillatorBank::Waveform::Saw, 0.f, 0, 0.f, 0.f);
+    bank->setOscillator(1, OscillatorBank::Waveform::Square, -6.f, 12, 0.f, 0.f);
+    bank->setFilter(OscillatorBank::FilterType::LowPass, 2000.f, 1.f, 4000.f);
+    auto play = [&](size_t numVoices) {
+        bank->reset();
+        for(size_t v = 0; v < numVoices; v++) {
+            bank->noteOn(v, 36 + (v * 7) % 60, 0.8f);
+        }
+    };
+    auto render = [&](size_t) {
+        std::fill(block.begin(), block.end(), 0.f);
+        bank->updateFrequencies(equalTemperament);
+        bank->render(block.data(), blockSize);
+        bank->updateMeters();
+        benchmark::doNotOptimize(block[0]);
+    };
+
+    play(0);
+    runner.run("render_idle_512", 10000, 10, render);
+    play(16);
+    runner.run("render_16_voices_512", 1000, 1, render);
+    play(OscillatorBank::maxVoices);
+    runner.run("render_128_voices_512", 200, 1, render);
+    bank->setOscillator(0, OscillatorBank::Waveform::Saw, 0.f, 0, 5.f, 50.f);
+    bank->setOscillator(1, OscillatorBank::Waveform::Square, -6.f, 12, 3.f, 20.f);
+    play(OscillatorBank::maxVoices);
+    runner.run("render_128_fm_512", 200, 1, render);
+
+    bank->reset();
+    runner.run("note_on_off", 10000, 64, [&](size_t i) {
+        auto const v = i % OscillatorBank::maxVoices;
+        bank->noteOn(v, 60, 0.8f);
+        bank->noteOff(v, false);
+    });
+
+    // parameters, with no motion: the fixed cost of every block
+    std::unordered_map<std::string, std::atomic<float>> raw;
+    for(size_t i = 0; i < SynthParams::NumParams; i++) {
+        raw[SynthParams::getParameterID(static_cast<SynthParams::ID>(i))] = 0.f;
+    }
+    raw["SYNTHVOICES"] = 16.f;
+    raw["SYNTHFILTERCUTOFF"] = 20000.f;
+    raw["SYNTHFILTERRESONANCE"] = 0.1f;
+    raw["SYNTHSUSTAIN"] = 1.f;
+    runner.run("params_lookup_by_id", 10000, 10, [&](size_t) {
+        auto sum = 0.f;
+        for(size_t i = 0; i < SynthParams::NumParams; i++) {
+            sum += raw.at(SynthParams::getParameterID(static_cast<SynthParams::ID>(i))).load();
+        }
+        benchmark::doNotOptimize(sum);
+    });
+    SynthParams params;
+    params.resolve([&](const char* id) { return &raw.at(id); });
+    params.update(0.01f);
+    runner.run("params_update", 10000, 100, [&](size_t) {
+        benchmark::doNotOptimize(params.update(0.01f));
+    });
+
+    // what the processor does per block, without juce::Synthesiser and the reverb
+    bank->setOscillator(0, OscillatorBank::Waveform::Saw, 0.f, 0, 0.f, 0.f);
+    bank->setOscillator(1, OscillatorBank::Waveform::Square, -6.f, 12, 0.f, 0.f);
+    play(16);
+    for(auto const blockSize : {32, 64, 512}) {
+        auto const n = static_cast<size_t>(blockSize);
+        auto const blockSeconds = static_cast<float>(blockSize) / 48000.f;
+        runner.run("process_block_" + std::to_string(blockSize), 20000 / n * 64, 1, [&](size_t) {
+            auto const changed = params.update(blockSeconds);
+            params.applyOscillators(*bank, changed);
+            params.applyFilter(*bank, changed);
+            std::fill(block.begin(), block.begin() + blockSize, 0.f);
+            bank->updateFrequencies(equalTemperament);
+            bank->render(block.data(), n);
+            bank->updateMeters();
+            benchmark::doNotOptimize(block[0]);
+        });
+    }
+
+    return runner.finish();
+}
@@ -0,0 +1,178 @@
+// Benchmarks TriadAnalyzer against the original cubic TuningImp::_analyzeProportionalTriads
+// over every .scl file in the bundled scala library, and checks that they find the same triads.
+//
+// usage: ./tests/bench_triads [scl directory, default Source/scl]
+
+#include <chrono>
+#include <cstdio>
+#include <dirent.h>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../Source/TriadAnalyzer.h"
+
+using Triads = std::vector<std::tuple<unsigned long, unsigned long, unsigned long>>;
+
+// The original analyzer, unchanged apart from reading a vector instead of the processed array.
+// Triads that wrap around the period are dropped afterwards by the npo map, so they are dropped here.
+static void cubic(const std::vector<float>& frequencies, float octave, Triads& major, Triads& minor) {
+    typedef std::set<unsigned long> SUL;
+    typedef std::map<SUL, unsigned long> TM;
+    TM pmt, smt;
+    auto const npo = frequencies.size();
+    if(npo < 3) {
+        return;
+    }
+    auto const tolerance = 0.0005;
+    for(unsigned long i = 0; i < npo; i++) {
+        auto const imf = frequencies[i];
+        for(unsigned long j = i + 2; j < npo + 2; j++) {
+            auto const ji = j % npo;
+            auto const jfac = (ji < j) ? octave : 1;
+            auto const jmf = jfac * frequencies[ji];
+            auto const major_ = (imf + jmf) / 2;
+            auto const minor_ = 2 * (imf * jmf) / (imf + jmf);
+            constexpr float major_2nd = 9.f/8.f;
+            constexpr float fourth = 4.f/3.f;
+            auto const majorInLimits = (major_ / imf > major_2nd && major_ / imf < fourth);
+            auto const minorInLimits = (minor_ / imf > major_2nd && minor_ / imf < fourth);
+            for(unsigned long k = i + 1; k < j; k++) {
+                auto const ki = k % npo;
+                auto const kfac = (ki < k) ? octave : 1;
+                auto const kmf = kfac * frequencies[ki];
+                if(majorInLimits && fabsf(major_ - kmf) < tolerance) {
+                    SUL mt = {i, ki, ji};
+                    if(pmt.find(mt) == pmt.end()) {
+                        pmt[mt] = 1UL;
+                        if(j < npo) {
+                            major.emplace_back(i, k, j);
+                        }
+                    }
+                }
+                if(minorInLimits && fabsf(minor_ - kmf) < tolerance) {
+                    SUL mt = {i, ki, ji};
+                    if(smt.find(mt) == smt.end()) {
+                        smt[mt] = 1UL;
+                        if(j < npo) {
+                            minor.emplace_back(i, k, j);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// minimal .scl reader: cents (contain '.') or ratios/integers; returns false if unreadable
+static bool readScl(const std::string& path, std::vector<float>& degrees) {
+    std::ifstream in(path);
+    std::string line;
+    int state = 0; // 0 = description, 1 = count, 2 = degrees
+    size_t count = 0;
+    degrees.clear();
+    while(std::getline(in, line)) {
+        if(!line.empty() && line[0] == '!') {
+            continue;
+        }
+        if(state == 0) {
+            state = 1;
+            continue;
+        }
+        std::istringstream ss(line);
+        std::string token;
+        if(!(ss >> token)) {
+            continue;
+        }
+        if(state == 1) {
+            count = std::stoul(token);
+            state = 2;
+            continue;
+        }
+        double value = 0;
+        if(token.find('.') != std::string::npos) {
+            value = std::exp2(std::stod(token) / 1200.0);
+        } else {
+            auto const slash = token.find('/');
+            value = (slash == std::string::npos) ? std::stod(token) : std::stod(token.substr(0, slash)) / std::stod(token.substr(slash + 1));
+        }
+        if(!(value > 0)) {
+            return false;
+        }
+        degrees.push_back(static_cast<float>(value));
+        if(degrees.size() == count) {
+            break;
+        }
+    }
+    return count > 0 && degrees.size() == count;
+}
+
+static Triads toTuples(const std::vector<PythagoreanMeans>& triads) {
+    Triads retVal;
+    for(auto t : triads) {
+        retVal.emplace_back(t.getRoot(), t.getThird(), t.getFifth());
+    }
+    return retVal;
+}
+
+int main(int argc, char* argv[]) {
+    std::string const dir = argc > 1 ? argv[1] : "Source/scl";
+    auto d = opendir(dir.c_str());
+    if(d == nullptr) {
+        std::fprintf(stderr, "can't open %s\n", dir.c_str());
+        return 1;
+    }
+
+    // processed arrays: 1/1 plus the degrees below the period, period reduced and sorted, as TuningImp does by default
+    std::vector<std::pair<std::vector<float>, float>> scales;
+    std::vector<float> degrees;
+    while(auto e = readdir(d)) {
+        std::string const name = e->d_name;
+        if(name.size() < 4 || name.substr(name.size() - 4) != ".scl" || !readScl(dir + "/" + name, degrees)) {
+            continue;
+        }
+        auto const period = degrees.back();
+        if(!(period > 1.f)) {
+            continue;
+        }
+        std::vector<float> scale {1.f};
+        for(size_t i = 0; i + 1 < degrees.size(); i++) {
+            auto f = degrees[i];
+            while(f < 1.f) f *= period;
+            while(f >= period) f /= period;
+            scale.push_back(f);
+        }
+        std::sort(scale.begin(), scale.end());
+        scales.emplace_back(scale, period);
+    }
+    closedir(d);
+
+    using Clock = std::chrono::steady_clock;
+    double cubicSeconds = 0, analyzerSeconds = 0;
+    size_t mismatches = 0, triads = 0;
+    TriadAnalyzer analyzer;
+    for(auto& [scale, period] : scales) {
+        Triads major, minor;
+        auto const t0 = Clock::now();
+        cubic(scale, period, major, minor);
+        auto const t1 = Clock::now();
+        analyzer.analyze(scale);
+        auto const t2 = Clock::now();
+        cubicSeconds += std::chrono::duration<double>(t1 - t0).count();
+        analyzerSeconds += std::chrono::duration<double>(t2 - t1).count();
+        triads += major.size() + minor.size();
+        if(toTuples(analyzer.getProportionalTriads()) != major || toTuples(analyzer.getSubcontraryTriads()) != minor) {
+            mismatches++;
+        }
+    }
+
+    std::printf("scales: %zu, triads: %zu, mismatches: %zu\n", scales.size(), triads, mismatches);
+    std::printf("cubic:    %.3f ms\n", cubicSeconds * 1000.0);
+    std::printf("analyzer: %.3f ms (%.1fx)\n", analyzerSeconds * 1000.0, analyzerSeconds > 0 ? cubicSeconds / analyzerSeconds : 0.0);
+
+    return mismatches == 0 ? 0 : 1;
+}
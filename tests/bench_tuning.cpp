@@ -0,0 +1,259 @@
+// Benchmarks the tuning engine headless: the JUCE-free code that TuningImp, ScalaTuningImp, Morph, Brun and
+// EulerGenusModel run for every tuning update.  RecurrenceRelation and CoPrime regenerate with JUCE types, so
+// they are not covered.  See Benchmark.h for the options, the JSON, and the regression check.
+//
+//   scl_parse          ScalaFileTokenizer::parseScl, per .scl file
+//   scl_to_scale       ScalaTuningImp::createScalaTuningFromSclString: parse, microtones, processing chain, per .scl file
+//   process_chain      TuningImp::_processMicrotoneArray: fill, octave reduce, sort, uniquify, npo override, per scale
+//   octave_reduce      FlatMicrotoneArray::octaveReduce, per scale
+//   sort               FlatMicrotoneArray::sort, per scale
+//   uniquify           FlatMicrotoneArray::uniquify, per scale
+//   npo_override       FlatMicrotoneArray::npoOverride to 12 notes, per scale
+//   triads             TriadAnalyzer::analyze (TuningImp::_analyzeProportionalTriads), per scale
+//   morph_linear       MorphPath::evaluate (Morph::_updateFromStage), per step of a 1000 step sweep
+//   morph_log2         the same, Log2 interpolation
+//   morph_endpoints    MorphPath::setEndpoints (Morph::_update when an endpoint tuning changes), per change
+//   brun_levels        BrunLevels for every level (Brun regenerating when the generator changes), per generator
+//   eulergenus_cps     CPSProducts of each CPS in the EulerGenus tree (EulerGenusModel creating a tuning), per tuning
+//   cps_set_term       CPSProducts::setTerm on CPS_6_3 (EulerGenusModel automating A..F), per change
+//
+// usage: ./tests/bench_tuning [scl directory, default Source/scl] [options]
+
+#include <algorithm>
+#include <cmath>
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Source/BrunLevels.h"
+#include "../Source/CPSProducts.h"
+#include "../Source/EulerGenusTables.h"
+#include "../Source/FlatMicrotoneArray.h"
+#include "../Source/MorphPath.h"
+#include "../Source/ScalaFileTokenizer.h"
+#include "../Source/TriadAnalyzer.h"
+#include "../Source/TuningConstants.h"
+
+// the microtones of a .scl as ScalaTuningImp builds them: 1/1 and the degrees below the period
+static bool fill(const ScalaFileTokenizer::Scl& scl, FlatMicrotoneArray& flat, float& period) {
+    if(scl.degrees.empty()) {
+        return false;
+    }
+    auto value = [](const ScalaFileTokenizer::Degree& d) {
+        return d.isRatio ? static_cast<double>(d.numerator) / static_cast<double>(d.denominator) : std::exp2(d.cents / 1200.0);
+    };
+    period = static_cast<float>(value(scl.degrees.back()));
+    if(!(period >= TuningConstants::minPeriod && period <= TuningConstants::maxPeriod)) {
+        return false;
+    }
+    flat.clear();
+    flat.reserve(scl.degrees.size());
+    flat.addRational(1, 1, 0);
+    for(size_t i = 0; i + 1 < scl.degrees.size(); i++) {
+        auto const& d = scl.degrees[i];
+        auto const f = static_cast<float>(value(d));
+        if(!(f > 0.f)) {
+            return false;
+        }
+        if(d.isRatio && d.numerator <= 0xffffffffULL && d.denominator <= 0xffffffffULL) {
+            flat.addRational(static_cast<unsigned long>(d.numerator), static_cast<unsigned long>(d.denominator), i + 1);
+        } else {
+            flat.addFrequency(f, i + 1);
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    std::string dir = "Source/scl";
+    if(argc > 1 && argv[1][0] != '-') {
+        dir = argv[1];
+        argv[1] = argv[0];
+        argc--;
+        argv++;
+    }
+    benchmark::Runner runner(argc, argv);
+
+    // the library, read once
+    std::vector<std::string> files;
+    if(auto d = opendir(dir.c_str())) {
+        while(auto e = readdir(d)) {
+            std::string const name = e->d_name;
+            if(name.size() > 4 && name.substr(name.size() - 4) == ".scl") {
+                std::ifstream in(dir + "/" + name, std::ios::binary);
+                std::ostringstream ss;
+                ss << in.rdbuf();
+                files.push_back(ss.str());
+            }
+        }
+        closedir(d);
+    }
+    if(files.empty()) {
+        std::fprintf(stderr, "no .scl files in %s\n", dir.c_str());
+        return 1;
+    }
+
+    // parse
+    runner.run("scl_parse", files.size(), 1, [&](size_t i) {
+        ScalaFileTokenizer::Scl scl;
+        ScalaFileTokenizer::Error error;
+        benchmark::doNotOptimize(ScalaFileTokenizer::parseScl(files[i], scl, error));
+    });
+
+    // the scales that parse
+    struct Scale {
+        FlatMicrotoneArray source {};
+        float period = 2.f;
+    };
+    std::vector<Scale> scales;
+    for(auto const& file : files) {
+        ScalaFileTokenizer::Scl scl;
+        ScalaFileTokenizer::Error error;
+        Scale s;
+        if(ScalaFileTokenizer::parseScl(file, scl, error) && fill(scl, s.source, s.period)) {
+            scales.push_back(std::move(s));
+        }
+    }
+    std::fprintf(stderr, "%zu .scl files, %zu scales\n", files.size(), scales.size());
+
+    // a .scl to a processed scale, as ScalaTuningImp loads it
+    FlatMicrotoneArray npo;
+    std::vector<int> npoMap;
+    runner.run("scl_to_scale", files.size(), 1, [&](size_t i) {
+        ScalaFileTokenizer::Scl scl;
+        ScalaFileTokenizer::Error error;
+        FlatMicrotoneArray w;
+        float period = 2.f;
+        if(ScalaFileTokenizer::parseScl(files[i], scl, error) && fill(scl, w, period)) {
+            w.octaveReduce(period);
+            w.sort();
+            w.uniquify();
+            w.npoOverride(static_cast<int>(w.count()), npo, npoMap);
+        }
+        benchmark::doNotOptimize(w.count());
+    });
+
+    // the processing chain, whole and by stage.  Each stage is timed on the output of the previous one.
+    std::vector<FlatMicrotoneArray> reduced(scales.size()), sorted(scales.size()), unique(scales.size()), work(scales.size());
+    for(size_t i = 0; i < scales.size(); i++) {
+        reduced[i] = scales[i].source;
+        reduced[i].octaveReduce(scales[i].period);
+        sorted[i] = reduced[i];
+        sorted[i].sort();
+        unique[i] = sorted[i];
+        unique[i].uniquify();
+    }
+    auto from = [&](const std::vector<FlatMicrotoneArray>& input) {
+        return [&]() { std::copy(input.begin(), input.end(), work.begin()); };
+    };
+    runner.run("process_chain", scales.size(), 1, [&](size_t i) {
+        auto& w = work[i];
+        w = scales[i].source;
+        w.octaveReduce(scales[i].period);
+        w.sort();
+        w.uniquify();
+        w.npoOverride(static_cast<int>(w.count()), npo, npoMap);
+    });
+    runner.run("octave_reduce", scales.size(), 1, [&](size_t i) {
+        work[i].octaveReduce(scales[i].period);
+    }, [&]() { std::transform(scales.begin(), scales.end(), work.begin(), [](const Scale& s) { return s.source; }); });
+    runner.run("sort", scales.size(), 1, [&](size_t i) {
+        work[i].sort();
+    }, from(reduced));
+    runner.run("uniquify", scales.size(), 1, [&](size_t i) {
+        work[i].uniquify();
+    }, from(sorted));
+    runner.run("npo_override", scales.size(), 1, [&](size_t i) {
+        unique[i].npoOverride(12, npo, npoMap);
+    });
+
+    // triads of the processed scales
+    TriadAnalyzer analyzer;
+    runner.run("triads", unique.size(), 1, [&](size_t i) {
+        analyzer.analyze(unique[i].getFrequencies());
+        benchmark::doNotOptimize(analyzer.getProportionalTriads().size());
+    });
+
+    // morph: 12ET to 19ET
+    float A[MorphPath::numNotes];
+    float B[MorphPath::numNotes];
+    for(size_t i = 0; i < MorphPath::numNotes; i++) {
+        auto const d = static_cast<float>(i) - 60.f;
+        A[i] = 261.6256f * std::exp2(d / 12.f);
+        B[i] = 261.6256f * std::exp2(d / 19.f);
+    }
+    MorphPath path;
+    path.setEndpoints(A, B);
+    float table[MorphPath::numNotes];
+    constexpr size_t steps = 1000;
+    for(auto [name, interpolation] : {std::make_pair("morph_linear", MorphPath::Interpolation::Linear),
+                                      std::make_pair("morph_log2", MorphPath::Interpolation::Log2)}) {
+        runner.run(name, steps, 16, [&](size_t i) {
+            path.evaluate(static_cast<float>(i) / static_cast<float>(steps), interpolation, table);
+            benchmark::doNotOptimize(table[0]);
+        });
+    }
+
+    // an endpoint changes, i.e., B from 19ET to 12ET with a transposition
+    runner.run("morph_endpoints", steps, 16, [&](size_t i) {
+        for(size_t nn = 0; nn < MorphPath::numNotes; nn++) {
+            B[nn] = A[nn] * (1.f + static_cast<float>(i) / static_cast<float>(steps));
+        }
+        path.setEndpoints(A, B);
+        benchmark::doNotOptimize(path.getB(0));
+    });
+
+    // Brun: the generator sweeping across its range like an LFO
+    runner.run("brun_levels", steps, 16, [&](size_t i) {
+        BrunLevels const levels(0.01f + 0.98f * static_cast<float>(i) / static_cast<float>(steps), 9); // Brun::absoluteMaxLevel
+        benchmark::doNotOptimize(levels.getNotesPerPeriod(9));
+    });
+
+    // EulerGenus: every CPS_n_k in the tree, the k-products of its n master terms
+    std::vector<size_t> cpsTunings;
+    for(size_t t = 0; t < EulerGenusTables::numTunings; t++) {
+        if(EulerGenusTables::tunings[t].tuningClass < EulerGenusTables::TuningClass::EulerGenus_1) {
+            cpsTunings.push_back(t);
+        }
+    }
+    CPSProducts tree;
+    runner.run("eulergenus_cps", cpsTunings.size(), 1, [&](size_t i) {
+        auto const& row = EulerGenusTables::tunings[cpsTunings[i]];
+        auto const c = static_cast<int>(row.tuningClass); // CPS_1_1, CPS_2_1, CPS_2_2, CPS_3_1...
+        int n = 1;
+        while((n + 1) * n / 2 <= c) {
+            n++;
+        }
+        auto const k = c - n * (n - 1) / 2 + 1;
+        tree.clear();
+        for(unsigned terms = 1; terms < (1u << EulerGenusTables::numTerms); terms++) {
+            if((terms & ~static_cast<unsigned>(row.masterSet)) == 0 && __builtin_popcount(terms) == k) {
+                tree.addProduct(static_cast<CPSProducts::Terms>(terms));
+            }
+        }
+        for(size_t t = 0; t < EulerGenusTables::numTerms; t++) {
+            tree.setTerm(t, static_cast<float>(2 * t + 1));
+        }
+        benchmark::doNotOptimize(tree.frequencyAtIndex(0));
+    });
+
+    // CPS_6_3: the 20 products of 3 of A..F, one term sweeping like an LFO
+    CPSProducts products;
+    for(unsigned a = 0; a < 6; a++)
+        for(unsigned b = a + 1; b < 6; b++)
+            for(unsigned c = b + 1; c < 6; c++)
+                products.addProduct(static_cast<CPSProducts::Terms>((1 << a) | (1 << b) | (1 << c)));
+    for(size_t t = 0; t < 6; t++) {
+        products.setTerm(t, static_cast<float>(2 * t + 1));
+    }
+    runner.run("cps_set_term", steps, 16, [&](size_t i) {
+        products.setTerm(i % 6, 1.f + static_cast<float>(i) / static_cast<float>(steps));
+        benchmark::doNotOptimize(products.frequencyAtIndex(0));
+    });
+
+    return runner.finish();
+}
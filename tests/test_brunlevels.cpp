@@ -0,0 +1,85 @@
+#include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "../Source/BrunLevels.h"
+
+// Brun::brunArray() and Brun::_microtoneArrayBrun() as they were, with Fraction's reduction
+static std::vector<std::pair<unsigned long, unsigned long>> referenceRatios(unsigned long level, float g) {
+    float mosA = 1.f, mosB = g, tmpf = 0.f;
+    unsigned long mosX1 = 1, mosX2 = 0, mosY1 = 0, mosY2 = 1, num = 1, den = 1, tmpui = 0;
+    std::vector<std::pair<unsigned long, unsigned long>> retVal;
+    for(unsigned long i = 0; i < level + 1; i++) {
+        retVal.push_back({num, den});
+        num = 2 * mosY1 + mosY2;
+        den = 2 * mosX1 + mosX2;
+        mosA = mosA - mosB;
+        mosX2 = mosX1 + mosX2;
+        mosY2 = mosY1 + mosY2;
+        if(mosB > mosA) {
+            tmpf = mosA; mosA = mosB; mosB = tmpf;
+            tmpui = mosX1; mosX1 = mosX2; mosX2 = tmpui;
+            tmpui = mosY1; mosY1 = mosY2; mosY2 = tmpui;
+        }
+    }
+    return retVal;
+}
+
+static unsigned long reduced(std::pair<unsigned long, unsigned long> r) {
+    return r.second / (r.first > 0 ? std::gcd(r.first, r.second) : 1);
+}
+
+static std::vector<unsigned long> referenceDegreeLevels(unsigned long l, float g) {
+    auto const ratios = referenceRatios(l, g);
+    auto const numScaleDegrees = reduced(ratios.back());
+    unsigned long level = 0, brunIndex = 0;
+    std::vector<unsigned long> retVal;
+    for(unsigned long i = 0; i < numScaleDegrees; i++) {
+        retVal.push_back(level);
+        if(i == numScaleDegrees - 1) break;
+        if(i + 1 == reduced(ratios[brunIndex])) {
+            level++;
+            brunIndex++;
+            brunIndex = std::min(brunIndex, static_cast<unsigned long>(ratios.size() - 1));
+        }
+    }
+    return retVal;
+}
+
+int main() {
+    // 7/12 at the default generator
+    {
+        BrunLevels levels(0.58333333f, 9);
+        assert(levels.getMaxLevel() == 9);
+        assert(levels.getRatio(0).num == 1 && levels.getRatio(0).den == 1);
+        assert(levels.getNotesPerPeriod(0) == 1);
+        assert(levels.getDegreeLevel(0, 0) == 0);
+        bool found12 = false;
+        for(unsigned long l = 0; l <= 9; l++) {
+            auto const& r = levels.getRatio(l);
+            found12 = found12 || (r.num == 7 && r.den == 12);
+        }
+        assert(found12);
+    }
+
+    // the same as the reference, across generators and levels
+    for(int k = 0; k <= 1000; k++) {
+        auto const g = static_cast<float>(k) / 1000.f * 0.999f;
+        BrunLevels levels(g, 9);
+        auto const ratios = referenceRatios(9, g);
+        for(unsigned long l = 0; l <= 9; l++) {
+            assert(levels.getRatio(l).num == ratios[l].first);
+            assert(levels.getRatio(l).den == ratios[l].second);
+            assert(levels.getNotesPerPeriod(l) == reduced(ratios[l]));
+            auto const degreeLevels = referenceDegreeLevels(l, g);
+            assert(degreeLevels.size() == levels.getNotesPerPeriod(l));
+            for(unsigned long i = 0; i < degreeLevels.size(); i++) {
+                assert(levels.getDegreeLevel(l, i) == degreeLevels[i]);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include "../Source/CPSProducts.h"
+
+static bool close(float a, float b) {
+    return std::fabs(a - b) <= 1e-6f * std::fabs(b);
+}
+
+int main() {
+    using Terms = CPSProducts::Terms;
+
+    // CPS_6_3: 20 products of 3 of the 6 terms A..F, in the order CPS_6_3::update() adds them
+    std::vector<std::vector<size_t>> triads;
+    for(size_t a = 0; a < 6; a++)
+        for(size_t b = a + 1; b < 6; b++)
+            for(size_t c = b + 1; c < 6; c++)
+                triads.push_back({a, b, c});
+    assert(triads.size() == 20);
+
+    float f[6] = {1.f, 3.f, 5.f, 7.f, 9.f, 11.f};
+    CPSProducts products;
+    for(auto const& t : triads) {
+        products.addProduct(static_cast<Terms>((1 << t[0]) | (1 << t[1]) | (1 << t[2])));
+    }
+    for(size_t t = 0; t < 6; t++) {
+        products.setTerm(t, f[t]);
+    }
+    assert(products.count() == 20);
+    auto check = [&]() {
+        for(size_t p = 0; p < triads.size(); p++) {
+            auto const& t = triads[p];
+            assert(close(products.frequencyAtIndex(p), f[t[0]] * f[t[1]] * f[t[2]]));
+        }
+    };
+    check();
+    assert(products.frequencyAtIndex(0) == 15.f); // 1*3*5: integer products are exact
+
+    // each term is in C(5,2) = 10 products, ascending
+    for(size_t t = 0; t < 6; t++) {
+        auto const& with = products.productsWithTerm(t);
+        assert(with.size() == 10);
+        for(size_t i = 1; i < with.size(); i++) assert(with[i - 1] < with[i]);
+        for(auto p : with) assert(products.numeratorAtIndex(p) & (1 << t));
+    }
+    assert(products.productsWithTerm(6).empty());
+
+    // changing a term recomputes only the products that contain it
+    f[2] = 5.5f;
+    products.setTerm(2, f[2]);
+    check();
+
+    // no drift: a long automation sweep ends where a fresh index would
+    for(int i = 0; i < 10000; i++) {
+        f[0] = 1.f + 0.5f * std::sin(0.01f * static_cast<float>(i));
+        products.setTerm(0, f[0]);
+    }
+    check();
+
+    // diamonds: A/B, B/A, and the constant 1/1
+    CPSProducts diamond;
+    auto const ab = diamond.addProduct(1 << 0, 1 << 1);
+    auto const ba = diamond.addProduct(1 << 1, 1 << 0);
+    auto const one = diamond.addProduct(0);
+    diamond.setTerm(0, 5.f);
+    diamond.setTerm(1, 4.f);
+    assert(close(diamond.frequencyAtIndex(ab), 1.25f));
+    assert(close(diamond.frequencyAtIndex(ba), 0.8f));
+    assert(diamond.frequencyAtIndex(one) == 1.f);
+    assert(diamond.denominatorAtIndex(ab) == (1 << 1));
+    assert(diamond.productsWithTerm(0).size() == 2);
+
+    // clear
+    diamond.clear();
+    assert(diamond.count() == 0);
+    assert(diamond.productsWithTerm(0).empty());
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Source/EulerGenusTables.h"
+
+int main() {
+    using T = EulerGenusTables;
+    constexpr std::string_view leaf = "W_EG_CPS_LEAF"; // EulerGenusModel::__daw_key_null
+
+    // every DAW key is found at its index
+    for(size_t i = 0; i < T::numDAWKeys; i++) {
+        assert(T::findDAWKey(T::dawKeys[i].key) == static_cast<int>(i));
+    }
+
+    // everything else is not
+    assert(T::findDAWKey("") == -1);
+    assert(T::findDAWKey(leaf) == -1);
+    assert(T::findDAWKey("||EulerGenus_6_A_B_C_D_E_F__EulerGenus_6_A_B_C_D_E_F") == -1); // the root's back key
+    for(size_t i = 0; i < T::numDAWKeys; i += 97) {
+        std::string key {T::dawKeys[i].key};
+        assert(T::findDAWKey(std::string_view(key).substr(0, key.size() - 1)) == -1);
+        key.back() = 'X';
+        assert(T::findDAWKey(key) == -1);
+    }
+
+    // the hash is the codegen's: building it again gives the generated tables
+    {
+        std::vector<std::string_view> keys;
+        for(auto const& row : T::dawKeys) {
+            keys.push_back(row.key);
+        }
+        std::vector<uint16_t> displacements, slots;
+        assert(T::buildPerfectHash(keys, T::numHashBuckets, displacements, slots));
+        assert(std::equal(displacements.begin(), displacements.end(), T::hashDisplacements.begin(), T::hashDisplacements.end()));
+        assert(std::equal(slots.begin(), slots.end(), T::hashSlots.begin(), T::hashSlots.end()));
+        assert(!T::buildPerfectHash({}, 1, displacements, slots));
+    }
+
+    // tunings are sorted and unique
+    for(size_t i = 1; i < T::numTunings; i++) {
+        assert(T::tunings[i - 1].key < T::tunings[i].key);
+    }
+
+    // the tree is consistent
+    size_t numSubsets = 0;
+    for(size_t t = 0; t < T::numTunings; t++) {
+        auto const& tuning = T::tunings[t];
+        assert(tuning.tuningClass < T::TuningClass::NumTuningClasses);
+        assert(tuning.masterSet != 0 && tuning.masterSet < (1 << T::numTerms));
+        assert((tuning.masterSet & tuning.commonTones) == 0);
+        assert(tuning.numSubsets0 <= 8 && tuning.numSubsets1 <= 8);
+        numSubsets += tuning.numSubsets0 + tuning.numSubsets1;
+
+        // the subsets' DAW keys select subset i of this tuning
+        for(size_t i = 0; i < tuning.numSubsets0 + tuning.numSubsets1; i++) {
+            auto const s0 = i < tuning.numSubsets0;
+            auto const k = s0 ? tuning.subsets0 + i : tuning.subsets1 + i - tuning.numSubsets0;
+            assert(k < T::numSubsetKeys);
+            auto const& row = T::dawKeys[T::subsetKeys[k]];
+            assert(row.tuning == t);
+            auto const first = s0 ? T::Selection::S0_0 : T::Selection::S1_0;
+            auto const index = s0 ? i : i - tuning.numSubsets0;
+            assert(static_cast<size_t>(row.selection) == static_cast<size_t>(first) + index);
+        }
+
+        // the parent key selects the parent, except for the Euler Genus, which has none
+        auto const parent = T::findDAWKey(tuning.parentKey);
+        if(tuning.tuningClass == T::TuningClass::EulerGenus_6) {
+            assert(parent == -1);
+        } else {
+            assert(parent >= 0);
+            assert(T::dawKeys[static_cast<size_t>(parent)].tuning == t);
+            assert(T::dawKeys[static_cast<size_t>(parent)].selection == T::Selection::Parent);
+        }
+    }
+    assert(numSubsets == T::numSubsetKeys);
+
+    // drilling goes to a parent selection, or nowhere
+    for(auto const& row : T::dawKeys) {
+        assert(row.tuning < T::numTunings);
+        assert(row.selection < T::Selection::NumSelections);
+        if(row.drillKey != leaf) {
+            auto const drill = T::findDAWKey(row.drillKey);
+            assert(drill >= 0);
+            assert(T::dawKeys[static_cast<size_t>(drill)].selection == T::Selection::Parent);
+        }
+    }
+
+    // the initial state: EG6 CPS_6_3
+    assert(T::dawKeys[2].key == "||EulerGenus_6_A_B_C_D_E_F__CPS_6_3_A_B_C_D_E_F");
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <cassert>
+#include <vector>
+
+#include "../Source/FavoritesIndex.h"
+
+int main() {
+    // add, lookup
+    {
+        FavoritesIndex x;
+        assert(x.add(5, 500, true));
+        assert(x.add(2, 200, false)); // a morph favorite: not in A, B
+        assert(x.add(9, 900, true));
+        assert(!x.add(5, 501, true));
+        assert(x.size() == 3);
+        assert(x.getNumRows(0) == 3 && x.getNumRows(1) == 2 && x.getNumRows(2) == 2);
+        assert(x.getID(0, 0) == 5 && x.getID(0, 1) == 2 && x.getID(0, 2) == 9);
+        assert(x.getID(1, 1) == 9);
+        assert(x.getID(0, 3) == FavoritesIndex::notFound && x.getID(0, -1) == FavoritesIndex::notFound);
+        assert(x.getRow(0, 9) == 2 && x.getRow(1, 9) == 1);
+        assert(x.getRow(1, 2) == FavoritesIndex::notFound);
+        assert(x.containsHash(200) && !x.containsHash(501));
+        assert(x.getNewID(0, 10) == 0);
+        assert(x.getNewID(2, 10) == 3);
+        assert(x.getNewID(2, 2) == FavoritesIndex::notFound);
+    }
+
+    // remove keeps the rows in sync
+    {
+        FavoritesIndex x;
+        for(int ID = 0; ID < 6; ID++) {
+            x.add(ID, ID * 10, ID != 3);
+        }
+        x.setSelectedID(0, 4);
+        x.setSelectedID(1, 1);
+        assert(x.remove(1));
+        assert(!x.remove(1));
+        assert(!x.contains(1) && !x.containsHash(10));
+        assert(x.getIDs(0) == std::vector<int>({0, 2, 3, 4, 5}));
+        assert(x.getIDs(1) == std::vector<int>({0, 2, 4, 5}));
+        for(int view = 0; view < FavoritesIndex::numViews; view++) {
+            for(int row = 0; row < x.getNumRows(view); row++) {
+                assert(x.getRow(view, x.getID(view, row)) == row);
+            }
+        }
+        assert(x.getSelectedID(0) == 4 && x.isSelectedRow(0, 3));
+        assert(x.getSelectedID(1) == FavoritesIndex::notFound); // removed
+        assert(x.getNewID(0, 10) == 1);
+    }
+
+    // duplicate hashes (legacy libraries)
+    {
+        FavoritesIndex x;
+        x.add(1, 7, true);
+        x.add(2, 7, true);
+        x.remove(1);
+        assert(x.containsHash(7));
+        x.remove(2);
+        assert(!x.containsHash(7));
+    }
+
+    // sort and setOrder are per view
+    {
+        FavoritesIndex x;
+        for(int ID : {3, 1, 4, 5, 9, 2, 6}) {
+            x.add(ID, ID, true);
+        }
+        x.setSelectedID(1, 4);
+        x.sort(1, [](int a, int b) { return a < b; });
+        assert(x.getIDs(1) == std::vector<int>({1, 2, 3, 4, 5, 6, 9}));
+        assert(x.getIDs(0) == std::vector<int>({3, 1, 4, 5, 9, 2, 6}));
+        assert(x.getRow(1, 9) == 6 && x.getRow(0, 9) == 4);
+        assert(x.isSelectedRow(1, 3)); // selection follows the ID
+
+        // stable: even before odd, ties keep their order
+        x.sort(2, [](int a, int b) { return (a % 2) < (b % 2); });
+        assert(x.getIDs(2) == std::vector<int>({4, 2, 6, 3, 1, 5, 9}));
+
+        x.setOrder(0, {9, 42, 1, 9});
+        assert(x.getIDs(0) == std::vector<int>({9, 1, 3, 4, 5, 2, 6}));
+        assert(x.getRow(0, 6) == 6 && x.getRow(0, 9) == 0);
+    }
+
+    // clear
+    {
+        FavoritesIndex x;
+        x.add(1, 1, true);
+        x.setSelectedID(0, 1);
+        x.clear();
+        assert(x.size() == 0 && x.getNumRows(0) == 0 && x.getNumRows(2) == 0);
+        assert(x.getSelectedID(0) == FavoritesIndex::notFound);
+        assert(x.getRow(0, 1) == FavoritesIndex::notFound);
+    }
+
+    return 0;
+}
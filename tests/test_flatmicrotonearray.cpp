@@ -0,0 +1,67 @@
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include "../Source/FlatMicrotoneArray.h"
+
+int main() {
+    // octave reduce: floats, rationals and log-period pitches
+    {
+        FlatMicrotoneArray fa;
+        fa.addFrequency(3.f, 0);
+        fa.addRational(5, 1, 1);
+        fa.addLogPeriod(1.25f, 2.f, 2);
+        fa.addFrequency(0.75f, 3);
+        fa.octaveReduce(2.f);
+        assert(fa.count() == 4);
+        assert(fa.frequencyAtIndex(0) == 1.5f);
+        assert(fa.isRationalAtIndex(1));
+        assert(fa.numeratorAtIndex(1) == 5 && fa.denominatorAtIndex(1) == 4);
+        assert(fa.frequencyAtIndex(1) == 1.25f);
+        assert(std::fabs(fa.frequencyAtIndex(2) - std::pow(2.f, 0.25f)) < 1e-6f);
+        assert(fa.frequencyAtIndex(3) == 1.5f);
+        assert(fa.pitchAtIndex(0) == log2f(1.5f));
+
+        // a rational in a non-integer period becomes a float
+        FlatMicrotoneArray fb;
+        fb.addRational(3, 2, 0);
+        fb.octaveReduce(1.4f);
+        assert(!fb.isRationalAtIndex(0));
+        assert(fb.frequencyAtIndex(0) >= 1.f && fb.frequencyAtIndex(0) < 1.4f);
+    }
+
+    // sort and uniquify track the source index; the last duplicate wins
+    {
+        FlatMicrotoneArray fa;
+        fa.addFrequency(1.5f, 0);
+        fa.addFrequency(1.25f, 1);
+        fa.addFrequency(1.5f, 2);
+        fa.addFrequency(1.f, 3);
+        fa.sort();
+        assert(fa.frequencyAtIndex(0) == 1.f && fa.sourceIndexAtIndex(0) == 3);
+        assert(fa.sourceIndexAtIndex(2) == 0 && fa.sourceIndexAtIndex(3) == 2);
+        fa.uniquify();
+        assert(fa.count() == 3);
+        assert(fa.frequencyAtIndex(2) == 1.5f && fa.sourceIndexAtIndex(2) == 2);
+    }
+
+    // npo override: same index mapping as MicrotoneArray::npoOverride
+    {
+        FlatMicrotoneArray fa;
+        for(unsigned long i = 0; i < 5; i++) {
+            fa.addFrequency(1.f + 0.1f * static_cast<float>(i), i);
+        }
+        FlatMicrotoneArray dest;
+        std::vector<int> npoMap;
+        fa.npoOverride(10, dest, npoMap);
+        assert(dest.count() == 10);
+        assert(dest.sourceIndexAtIndex(1) == 0 && dest.sourceIndexAtIndex(2) == 1);
+        assert(npoMap.size() == 5 && npoMap[0] == 0 && npoMap[1] == 2 && npoMap[4] == 8);
+
+        fa.npoOverride(2, dest, npoMap);
+        assert(dest.count() == 2);
+        assert(npoMap[0] == 0 && npoMap[1] == -1 && npoMap[2] == 1 && npoMap[3] == -1);
+    }
+
+    return 0;
+}
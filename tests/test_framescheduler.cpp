@@ -0,0 +1,125 @@
+#include <cassert>
+#include <functional>
+
+#include "../Source/FrameScheduler.h"
+
+struct Client : public FrameScheduler::Client {
+    int calls = 0;
+    bool visible = true;
+    std::function<void()> onFrame {};
+    void frameCallback() override {
+        calls++;
+        if(onFrame) onFrame();
+    }
+    bool isFrameVisible() override { return visible; }
+};
+
+int main() {
+    // periods
+    assert(FrameScheduler::periodForRate(60) == 1);
+    assert(FrameScheduler::periodForRate(30) == 2);
+    assert(FrameScheduler::periodForRate(20) == 3);
+    assert(FrameScheduler::periodForRate(1) == 60);
+    assert(FrameScheduler::periodForRate(120) == 1);
+    assert(FrameScheduler::periodForRate(0) == 1);
+
+    // rates, and clients at rate 0 are not called
+    {
+        FrameScheduler s;
+        Client a, b, c;
+        s.addClient(a);
+        s.addClient(b);
+        s.addClient(c);
+        assert(s.getNumClients() == 3);
+        assert(s.getNumRunningClients() == 0);
+        s.setClientRate(a, 60);
+        s.setClientRate(b, 20);
+        assert(s.getClientRate(a) == 60);
+        assert(s.getClientRate(c) == 0);
+        assert(s.getNumRunningClients() == 2);
+        for(int i = 0; i < 60; i++) s.tick();
+        assert(a.calls == 60);
+        assert(b.calls == 20);
+        assert(c.calls == 0);
+
+        // stopping
+        s.setClientRate(a, 0);
+        for(int i = 0; i < 6; i++) s.tick();
+        assert(a.calls == 60);
+        assert(b.calls == 22);
+        assert(s.getNumRunningClients() == 1);
+    }
+
+    // clients that share a rate are called in the same frame
+    {
+        FrameScheduler s;
+        Client a, b;
+        s.addClient(a);
+        s.addClient(b);
+        s.setClientRate(a, 30);
+        s.setClientRate(b, 30);
+        assert(s.tick() == 0);
+        assert(s.tick() == 2);
+        assert(s.tick() == 0);
+        assert(s.tick() == 2);
+    }
+
+    // invisible clients are skipped, but keep their period
+    {
+        FrameScheduler s;
+        Client a;
+        s.addClient(a);
+        s.setClientRate(a, 30);
+        a.visible = false;
+        for(int i = 0; i < 4; i++) s.tick();
+        assert(a.calls == 0);
+        a.visible = true;
+        assert(s.tick() == 0);
+        assert(s.tick() == 1);
+    }
+
+    // removing
+    {
+        FrameScheduler s;
+        Client a;
+        s.addClient(a);
+        s.setClientRate(a, 60);
+        s.removeClient(a);
+        s.removeClient(a); // not added
+        assert(s.getNumClients() == 0);
+        assert(s.getClientRate(a) == 0);
+        assert(s.tick() == 0);
+    }
+
+    // adding, removing and re-rating from a callback
+    {
+        FrameScheduler s;
+        Client a, b, c;
+        s.addClient(a);
+        s.addClient(b);
+        s.setClientRate(a, 60);
+        s.setClientRate(b, 60);
+        a.onFrame = [&] {
+            s.removeClient(b); // not called in this frame
+            s.addClient(c);
+            s.setClientRate(c, 60); // waits for the next frame
+            s.setClientRate(a, 0);
+            a.onFrame = nullptr;
+        };
+        assert(s.tick() == 1);
+        assert(b.calls == 0);
+        assert(c.calls == 0);
+        assert(s.getNumClients() == 2);
+        assert(s.tick() == 1);
+        assert(a.calls == 1);
+        assert(c.calls == 1);
+
+        // removing itself
+        c.onFrame = [&] { s.removeClient(c); };
+        assert(s.tick() == 1);
+        assert(s.getNumClients() == 1);
+        assert(s.tick() == 0);
+    }
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "../Source/IntervalMatrixModel.h"
+
+int main() {
+    // empty
+    {
+        IntervalMatrixModel m;
+        assert(m.getSize() == 0);
+        assert(!m.setFrequencies({}));
+        assert(m.getSize() == 0);
+    }
+
+    // 1, 5/4, 3/2
+    {
+        IntervalMatrixModel m;
+        std::vector<float> f {1.f, 1.25f, 1.5f};
+        assert(m.setFrequencies(f));
+        assert(m.getSize() == 4);
+        assert(m.getText(0, 0) == "x");
+        assert(m.getValue(0, 0) == 0.f);
+
+        // header column is the frequency, header row is its inverse
+        assert(m.isHeader(2, 0) && m.isHeader(0, 2) && !m.isHeader(1, 1));
+        assert(m.getValue(2, 0) == 1.25f);
+        assert(m.getText(2, 0) == std::to_string(1.25f));
+        assert(m.getValue(0, 3) == 1.f / 1.5f);
+        assert(m.getText(0, 3) == "1/" + std::to_string(1.5f));
+
+        // intervals are octave reduced
+        assert(m.getValue(1, 1) == 1.f);
+        assert(m.getValue(3, 1) == 1.5f);
+        assert(m.getValue(1, 3) == 2.f / 1.5f);
+        assert(m.getText(1, 3) == std::to_string(2.f / 1.5f));
+        for(size_t i = 1; i < m.getSize(); i++) {
+            for(size_t j = 1; j < m.getSize(); j++) {
+                assert(m.getValue(i, j) >= 1.f && m.getValue(i, j) < 2.f);
+            }
+        }
+
+        // unchanged frequencies keep the cells
+        assert(!m.setFrequencies(f));
+        assert(m.getSize() == 4);
+
+        // changed frequencies recompute them
+        f.push_back(1.75f);
+        assert(m.setFrequencies(f));
+        assert(m.getSize() == 5);
+        assert(m.getValue(4, 0) == 1.75f);
+        assert(!m.setFrequencies(f));
+
+        // and back to empty
+        assert(m.setFrequencies({}));
+        assert(m.getSize() == 0);
+    }
+
+    // 128 notes
+    {
+        IntervalMatrixModel m;
+        std::vector<float> f;
+        for(int i = 0; i < 128; i++) f.push_back(1.f + static_cast<float>(i) / 128.f);
+        assert(m.setFrequencies(f));
+        assert(m.getSize() == 129);
+        assert(m.getValue(128, 0) == f.back());
+        assert(!m.getText(128, 128).empty());
+    }
+
+    return 0;
+}
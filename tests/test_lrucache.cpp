@@ -0,0 +1,60 @@
+#include <cassert>
+#include <memory>
+#include <string>
+
+#include "../Source/LruCache.h"
+
+int main() {
+    // eviction order
+    {
+        LruCache<std::string, int> c(3);
+        assert(c.capacity() == 3 && c.size() == 0);
+        assert(c.find("a") == nullptr);
+        c.put("a", 1);
+        c.put("b", 2);
+        c.put("c", 3);
+        assert(c.size() == 3);
+
+        // touching "a" makes "b" the least recently used
+        assert(c.find("a") != nullptr && *c.find("a") == 1);
+        c.put("d", 4);
+        assert(c.size() == 3);
+        assert(!c.contains("b"));
+        assert(c.contains("a") && c.contains("c") && c.contains("d"));
+
+        // replacing a value also touches it
+        c.put("c", 30);
+        c.put("e", 5);
+        assert(!c.contains("a"));
+        assert(*c.find("c") == 30);
+
+        // contains does not touch
+        assert(c.contains("d"));
+        c.put("f", 6);
+        assert(!c.contains("d"));
+    }
+
+    // erase, clear
+    {
+        LruCache<int, std::shared_ptr<int>> c(2);
+        c.put(1, std::make_shared<int>(1));
+        c.put(2, std::make_shared<int>(2));
+        assert(c.erase(1));
+        assert(!c.erase(1));
+        assert(c.size() == 1);
+        c.put(3, std::make_shared<int>(3));
+        assert(c.contains(2) && c.contains(3));
+        c.clear();
+        assert(c.size() == 0 && c.find(2) == nullptr);
+    }
+
+    // capacity is at least 1
+    {
+        LruCache<int, int> c(0);
+        c.put(1, 1);
+        c.put(2, 2);
+        assert(c.size() == 1 && c.contains(2));
+    }
+
+    return 0;
+}
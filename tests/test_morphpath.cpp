@@ -0,0 +1,83 @@
+#include <cassert>
+#include <cmath>
+
+#include "../Source/MorphPath.h"
+
+int main() {
+    using Interpolation = MorphPath::Interpolation;
+    constexpr auto n = MorphPath::numNotes;
+
+    // exp2 matches std::exp2 to float precision
+    for(float x = -126.f; x <= 127.f; x += 0.0137f) {
+        auto const expected = std::exp2(static_cast<double>(x));
+        auto const actual = static_cast<double>(MorphPath::exp2(x));
+        assert(std::fabs(actual - expected) <= 1e-6 * expected);
+    }
+    assert(MorphPath::exp2(0.f) == 1.f);
+    assert(MorphPath::exp2(1.f) == 2.f);
+    assert(MorphPath::exp2(-3.f) == 0.125f);
+
+    // 12ET A -> 19ET B
+    float A[n];
+    float B[n];
+    for(size_t i = 0; i < n; i++) {
+        auto const d = static_cast<float>(i) - 60.f;
+        A[i] = 261.6256f * std::exp2(d / 12.f);
+        B[i] = 261.6256f * std::exp2(d / 19.f);
+    }
+    MorphPath path;
+    path.setEndpoints(A, B);
+
+    // endpoints are exact, and t is clamped
+    {
+        float dest[n];
+        for(auto interpolation : {Interpolation::Linear, Interpolation::Log2}) {
+            path.evaluate(0.f, interpolation, dest);
+            for(size_t i = 0; i < n; i++) assert(dest[i] == A[i]);
+            path.evaluate(-1.f, interpolation, dest);
+            for(size_t i = 0; i < n; i++) assert(dest[i] == A[i]);
+            path.evaluate(1.f, interpolation, dest);
+            for(size_t i = 0; i < n; i++) assert(dest[i] == B[i]);
+            path.evaluate(2.f, interpolation, dest);
+            for(size_t i = 0; i < n; i++) assert(dest[i] == B[i]);
+            assert(path.evaluate(5, 0.f, interpolation) == A[5]);
+            assert(path.evaluate(5, 1.f, interpolation) == B[5]);
+        }
+        assert(path.getA(7) == A[7] && path.getB(7) == B[7]);
+    }
+
+    // between: same as the scalar formulas Morph used, and one note matches all notes
+    {
+        float dest[n];
+        for(float t = 0.01f; t < 1.f; t += 0.07f) {
+            path.evaluate(t, Interpolation::Linear, dest);
+            for(size_t i = 0; i < n; i++) {
+                auto const expected = A[i] + (B[i] - A[i]) * t;
+                assert(std::fabs(dest[i] - expected) <= 1e-5f * expected);
+                assert(path.evaluate(i, t, Interpolation::Linear) == dest[i]);
+            }
+            path.evaluate(t, Interpolation::Log2, dest);
+            for(size_t i = 0; i < n; i++) {
+                auto const expected = std::exp2(std::log2(A[i]) + (std::log2(B[i]) - std::log2(A[i])) * t);
+                assert(std::fabs(dest[i] - expected) <= 1e-5f * expected);
+                assert(path.evaluate(i, t, Interpolation::Log2) == dest[i]);
+            }
+        }
+    }
+
+    // log2 interpolation of an octave is the geometric mean at 0.5
+    {
+        float a[n];
+        float b[n];
+        for(size_t i = 0; i < n; i++) {
+            a[i] = 100.f;
+            b[i] = 400.f;
+        }
+        MorphPath octaves;
+        octaves.setEndpoints(a, b);
+        assert(std::fabs(octaves.evaluate(0, 0.5f, Interpolation::Log2) - 200.f) < 1e-3f);
+        assert(std::fabs(octaves.evaluate(0, 0.5f, Interpolation::Linear) - 250.f) < 1e-3f);
+    }
+
+    return 0;
+}
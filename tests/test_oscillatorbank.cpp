@@ -0,0 +1,171 @@
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "../Source/OscillatorBank.h"
+
+using Waveform = OscillatorBank::Waveform;
+
+static constexpr double sampleRate = 48000.0;
+
+// 12-TET, A4 = 440
+static float equalTemperament(unsigned long nn) {
+    return 440.f * std::exp2((static_cast<float>(nn) - 69.f) / 12.f);
+}
+
+static std::vector<float> render(OscillatorBank& bank, size_t numSamples) {
+    std::vector<float> retVal(numSamples, 0.f);
+    for(size_t s = 0; s < numSamples; s += 512) {
+        bank.updateFrequencies(equalTemperament);
+        bank.render(retVal.data() + s, std::min<size_t>(512, numSamples - s));
+    }
+    return retVal;
+}
+
+// frequency from the upward zero crossings
+static double measureFrequency(const std::vector<float>& x, size_t from) {
+    std::vector<double> crossings;
+    for(size_t i = from + 1; i < x.size(); i++) {
+        if(x[i - 1] < 0.f && x[i] >= 0.f) {
+            crossings.push_back(static_cast<double>(i - 1) + x[i - 1] / (x[i - 1] - x[i]));
+        }
+    }
+    assert(crossings.size() > 2);
+    return sampleRate * static_cast<double>(crossings.size() - 1) / (crossings.back() - crossings.front());
+}
+
+int main() {
+    // table levels: the most harmonics below Nyquist
+    assert(OscillatorBank::tableLevelForIncrement(0.f) == OscillatorBank::numTableLevels - 1);
+    assert(OscillatorBank::tableLevelForIncrement(0.4f) == 0); // 1.25 harmonics
+    assert(OscillatorBank::tableLevelForIncrement(0.5f / 4.f) == 2);
+    assert(OscillatorBank::tableLevelForIncrement(0.5f / 5.f) == 2);
+    assert(OscillatorBank::tableLevelForIncrement(1e-6f) == OscillatorBank::numTableLevels - 1);
+    for(size_t level = 0; level < OscillatorBank::numTableLevels; level++) {
+        auto const harmonics = static_cast<float>(size_t(1) << level);
+        auto const increment = 0.5f / (harmonics + 0.5f);
+        assert((size_t(1) << OscillatorBank::tableLevelForIncrement(increment)) <= harmonics);
+    }
+
+    // tables: one period, with guard points, band-limited
+    auto const N = OscillatorBank::tableSize;
+    for(auto w : {Waveform::Sine, Waveform::Saw, Waveform::Square}) {
+        for(size_t level = 0; level < OscillatorBank::numTableLevels; level++) {
+            auto const* t = OscillatorBank::getTable(w, level);
+            assert(t[N] == t[0] && t[N + 1] == t[1]);
+            assert(std::fabs(t[0]) < 1e-5f); // sums of sines
+        }
+    }
+    auto const* sine = OscillatorBank::getTable(Waveform::Sine, 0);
+    assert(std::fabs(sine[N / 4] - 1.f) < 1e-6f);
+    assert(OscillatorBank::getTable(Waveform::Sine, 10)[N / 4] == sine[N / 4]);
+    auto const* saw1 = OscillatorBank::getTable(Waveform::Saw, 0);
+    assert(std::fabs(saw1[N / 4] - 2.f / 3.14159265f) < 1e-5f); // the fundamental only
+    auto const* square = OscillatorBank::getTable(Waveform::Square, 10);
+    assert(std::fabs(square[N / 4] - 1.f) < 0.01f); // converges to sign(x)
+    assert(std::fabs(square[3 * N / 4] + 1.f) < 0.01f);
+
+    auto bank = std::make_unique<OscillatorBank>();
+    bank->prepare(sampleRate);
+    bank->setFilter(OscillatorBank::FilterType::LowPass, 20000.f, 0.7071f, 0.f);
+    bank->setOscillator(1, Waveform::Sine, -100.f, 0, 0.f, 0.f);
+    assert(bank->getNumActiveVoices() == 0);
+
+    // silence: no voice, no output
+    auto x = render(*bank, 1024);
+    for(auto s : x) assert(s == 0.f);
+
+    // a voice renders its note's frequency
+    bank->noteOn(3, 69, 1.f);
+    assert(bank->isVoiceActive(3));
+    assert(bank->getNumActiveVoices() == 1);
+    x = render(*bank, 24000);
+    assert(bank->frequencyAtVoice(3) == 440.f);
+    assert(std::fabs(measureFrequency(x, 12000) - 440.0) < 0.1);
+    bank->updateMeters();
+    assert(bank->rmsAtVoice(3) > 0.f);
+    assert(bank->peakAtVoice(3) <= OscillatorBank::voiceGain * 1.01f);
+    assert(bank->rmsAtVoice(0) == 0.f);
+
+    // pitch offset: an octave up in 12-TET
+    bank->setOscillator(0, Waveform::Saw, 0.f, 12, 0.f, 0.f);
+    x = render(*bank, 24000);
+    assert(std::fabs(measureFrequency(x, 12000) - 880.0) < 0.2);
+    bank->setOscillator(0, Waveform::Sine, 0.f, 0, 0.f, 0.f);
+
+    // envelope: released voices fade out, then free their lane
+    OscillatorBank::Envelope envelope;
+    envelope.attack = 0.01f;
+    envelope.decay = 0.01f;
+    envelope.sustain = 0.5f;
+    envelope.release = 0.05f;
+    bank->setAmpEnvelope(envelope);
+    bank->noteOff(3, true);
+    assert(bank->isVoiceActive(3));
+    x = render(*bank, static_cast<size_t>(0.06 * sampleRate));
+    assert(!bank->isVoiceActive(3));
+    assert(bank->getNumActiveVoices() == 0);
+    x = render(*bank, 512);
+    for(auto s : x) assert(s == 0.f);
+
+    // sustain level
+    bank->updateMeters();
+    bank->noteOn(100, 57, 1.f);
+    x = render(*bank, 24000);
+    bank->updateMeters();
+    auto const sustainRms = bank->rmsAtVoice(100);
+    bank->setAmpEnvelope({0.01f, 0.01f, 1.f, 0.05f});
+    x = render(*bank, 24000);
+    bank->updateMeters();
+    assert(std::fabs(bank->rmsAtVoice(100) / sustainRms - 2.f) < 0.05f);
+
+    // hard stop: a fade over one control interval, not a cut
+    bank->noteOff(100, false);
+    assert(bank->isVoiceActive(100));
+    x = render(*bank, OscillatorBank::controlInterval);
+    assert(!bank->isVoiceActive(100));
+    auto const maxStep = 2.f * 3.14159265f * static_cast<float>(equalTemperament(57) / sampleRate) * OscillatorBank::voiceGain;
+    for(size_t i = 1; i < x.size(); i++) assert(std::fabs(x[i] - x[i - 1]) < 1.5f * maxStep);
+    assert(std::fabs(x.back()) < 0.2f * OscillatorBank::voiceGain);
+
+    // a hard stop before the voice rendered a sample, i.e., All Sound Off in the same block, frees it
+    bank->noteOn(101, 60, 1.f);
+    bank->noteOff(101, false);
+    assert(!bank->isVoiceActive(101));
+    x = render(*bank, OscillatorBank::controlInterval);
+    assert(!bank->isVoiceActive(101));
+
+    // a stolen voice, i.e., hard stop then noteOn, carries on from where it was: no click
+    bank->noteOn(100, 57, 1.f);
+    x = render(*bank, 24000);
+    bank->noteOff(100, false);
+    bank->noteOn(100, 57, 1.f);
+    x = render(*bank, 4800);
+    for(size_t i = 1; i < x.size(); i++) assert(std::fabs(x[i] - x[i - 1]) < 1.5f * maxStep);
+    bank->noteOff(100, false);
+    x = render(*bank, OscillatorBank::controlInterval);
+    assert(!bank->isVoiceActive(100));
+
+    // every voice at once; the mix is the sum of the voices
+    for(size_t v = 0; v < OscillatorBank::maxVoices; v++) {
+        bank->noteOn(v, 60, 0.5f);
+    }
+    assert(bank->getNumActiveVoices() == OscillatorBank::maxVoices);
+    x = render(*bank, 4800);
+    auto peak = 0.f;
+    for(size_t i = 2400; i < x.size(); i++) peak = std::max(peak, std::fabs(x[i]));
+    assert(std::fabs(peak - OscillatorBank::maxVoices * 0.5f * OscillatorBank::voiceGain) < 0.05f * peak);
+    assert(std::fabs(measureFrequency(x, 2400) - equalTemperament(60)) < 1.0);
+
+    // FM stays finite and reset silences everything
+    bank->setOscillator(0, Waveform::Square, 0.f, 0, 5.f, 200.f);
+    x = render(*bank, 4800);
+    for(auto s : x) assert(std::isfinite(s));
+    bank->reset();
+    assert(bank->getNumActiveVoices() == 0);
+    x = render(*bank, 512);
+    for(auto s : x) assert(s == 0.f);
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "../Source/PitchBendRetuner.h"
+
+struct Message {
+    int status = 0;
+    int channel = 0;
+    int data1 = 0;
+    int data2 = 0;
+    int size = 0;
+};
+
+struct Sink {
+    std::vector<Message> messages;
+    void operator()(const uint8_t* data, int size) {
+        messages.push_back({data[0] & 0xf0, (data[0] & 0x0f) + 1, size > 1 ? data[1] : 0, size > 2 ? data[2] : 0, size});
+    }
+};
+
+static void send(PitchBendRetuner& r, int status, int channel, int d1, int d2, float (*f)(int), Sink& sink) {
+    uint8_t const data[3] {static_cast<uint8_t>(status | (channel - 1)), static_cast<uint8_t>(d1), static_cast<uint8_t>(d2)};
+    r.process(data, 3, f, sink);
+}
+
+static float et12(int nn) { return 440.f * std::pow(2.f, static_cast<float>(nn - 69) / 12.f); }
+static float quarterTones(int nn) { return 440.f * std::pow(2.f, static_cast<float>(nn - 69) / 24.f); }
+
+int main() {
+    // pitch bend
+    assert(PitchBendRetuner::noteForFrequency(440.f) == 69);
+    assert(PitchBendRetuner::noteForFrequency(et12(60)) == 60);
+    assert(PitchBendRetuner::noteForFrequency(1.f) == 0);
+    assert(PitchBendRetuner::noteForFrequency(30000.f) == 127);
+    assert(PitchBendRetuner::bendForFrequency(440.f, 69, 48) == 8192);
+    assert(PitchBendRetuner::bendForFrequency(et12(71), 69, 2) == 16383);
+    assert(PitchBendRetuner::bendForFrequency(et12(67), 69, 2) == 0);
+    assert(std::abs(PitchBendRetuner::bendForFrequency(440.f * std::pow(2.f, 0.5f / 12.f), 69, 48) - (8192 + 8192 / 96)) <= 1);
+    assert(PitchBendRetuner::bendForFrequency(0.f, 69, 48) == 8192);
+
+    // configuration: the MPE configuration message, then pitch bend sensitivity on each member channel
+    {
+        PitchBendRetuner r;
+        r.setNumMemberChannels(4);
+        r.setBendRange(24);
+        Sink sink;
+        r.writeConfiguration(sink);
+        assert(sink.messages.size() == 5 * 6);
+        assert(sink.messages[0].channel == 1 && sink.messages[1].data1 == 100 && sink.messages[1].data2 == 6);
+        assert(sink.messages[2].data1 == 6 && sink.messages[2].data2 == 4);
+        assert(sink.messages[6].channel == 2 && sink.messages[7].data2 == 0 && sink.messages[8].data2 == 24);
+        assert(sink.messages.back().channel == 5);
+    }
+
+    // each note gets its own member channel, with the bend before the note on
+    {
+        PitchBendRetuner r;
+        Sink sink;
+        send(r, 0x90, 1, 60, 100, quarterTones, sink);
+        send(r, 0x90, 1, 61, 100, quarterTones, sink);
+        assert(r.getNumActiveNotes() == 2);
+        assert(sink.messages.size() == 4);
+        assert(sink.messages[0].status == 0xe0 && sink.messages[1].status == 0x90);
+        assert(sink.messages[0].channel == sink.messages[1].channel);
+        assert(sink.messages[1].data2 == 100);
+        auto const ch60 = r.getMemberChannelForNote(1, 60);
+        auto const ch61 = r.getMemberChannelForNote(1, 61);
+        assert(ch60 >= 2 && ch61 >= 2 && ch60 != ch61);
+
+        // the note and bend sound the tuning table's frequency
+        auto const& on = sink.messages[3];
+        auto const& bend = sink.messages[2];
+        auto const bend14 = bend.data1 | (bend.data2 << 7);
+        auto const nn = static_cast<float>(on.data1) + static_cast<float>(bend14 - 8192) / 8192.f * 48.f;
+        assert(std::abs(440.f * std::pow(2.f, (nn - 69.f) / 12.f) - quarterTones(61)) < 0.05f);
+
+        // note off on the same member channel, with the rewritten note
+        sink.messages.clear();
+        send(r, 0x90, 1, 61, 0, quarterTones, sink);
+        assert(sink.messages.size() == 1);
+        assert(sink.messages[0].status == 0x80 && sink.messages[0].channel == ch61 && sink.messages[0].data1 == on.data1);
+        assert(r.getMemberChannelForNote(1, 61) == 0);
+
+        // unknown note offs are dropped
+        sink.messages.clear();
+        send(r, 0x80, 1, 99, 0, quarterTones, sink);
+        assert(sink.messages.empty());
+
+        // the next note gets the channel that was released longest ago, not the one just released
+        send(r, 0x90, 1, 62, 100, quarterTones, sink);
+        assert(r.getMemberChannelForNote(1, 62) != ch61);
+    }
+
+    // stealing
+    {
+        PitchBendRetuner r;
+        r.setNumMemberChannels(2);
+        Sink sink;
+        send(r, 0x90, 1, 60, 100, et12, sink);
+        send(r, 0x90, 1, 62, 100, et12, sink);
+        auto const ch60 = r.getMemberChannelForNote(1, 60);
+        sink.messages.clear();
+        send(r, 0x90, 1, 64, 100, et12, sink);
+        assert(r.getNumActiveNotes() == 2);
+        assert(r.getMemberChannelForNote(1, 60) == 0);
+        assert(r.getMemberChannelForNote(1, 64) == ch60);
+        assert(sink.messages[0].status == 0x80 && sink.messages[0].data1 == 60);
+
+        r.setStealPolicy(PitchBendRetuner::StealPolicy::None);
+        sink.messages.clear();
+        send(r, 0x90, 1, 65, 100, et12, sink);
+        assert(sink.messages.empty());
+        assert(r.getMemberChannelForNote(1, 65) == 0);
+        assert(r.getMemberChannelForNote(1, 64) == ch60);
+    }
+
+    // retrigger, and the same note on different input channels
+    {
+        PitchBendRetuner r;
+        Sink sink;
+        send(r, 0x90, 1, 60, 100, et12, sink);
+        send(r, 0x90, 2, 60, 100, et12, sink);
+        assert(r.getNumActiveNotes() == 2);
+        sink.messages.clear();
+        send(r, 0x90, 1, 60, 90, et12, sink);
+        assert(r.getNumActiveNotes() == 2);
+        assert(sink.messages[0].status == 0x80);
+    }
+
+    // other messages
+    {
+        PitchBendRetuner r;
+        Sink sink;
+        send(r, 0x90, 3, 60, 100, et12, sink);
+        auto const ch = r.getMemberChannelForNote(3, 60);
+        sink.messages.clear();
+
+        // poly pressure -> channel pressure on the member channel
+        send(r, 0xa0, 3, 60, 77, et12, sink);
+        assert(sink.messages.size() == 1 && sink.messages[0].status == 0xd0 && sink.messages[0].channel == ch);
+        assert(sink.messages[0].data1 == 77 && sink.messages[0].size == 2);
+
+        // control changes go to the master channel
+        sink.messages.clear();
+        send(r, 0xb0, 3, 64, 127, et12, sink);
+        assert(sink.messages.size() == 1 && sink.messages[0].channel == 1 && sink.messages[0].data1 == 64);
+
+        // program change keeps its size
+        sink.messages.clear();
+        uint8_t const pc[2] {0xc4, 5};
+        r.process(pc, 2, et12, sink);
+        assert(sink.messages.size() == 1 && sink.messages[0].size == 2 && sink.messages[0].channel == 1);
+
+        // system messages pass through
+        sink.messages.clear();
+        uint8_t const clock[1] {0xf8};
+        r.process(clock, 1, et12, sink);
+        assert(sink.messages.size() == 1 && sink.messages[0].size == 1);
+
+        // all notes off ends the held notes
+        sink.messages.clear();
+        send(r, 0xb0, 1, 123, 0, et12, sink);
+        assert(r.getNumActiveNotes() == 0);
+        assert(sink.messages.size() == 2 && sink.messages[0].status == 0x80 && sink.messages[0].channel == ch);
+    }
+
+    // a tuning change bends the held notes
+    {
+        PitchBendRetuner r;
+        Sink sink;
+        send(r, 0x90, 1, 69, 100, et12, sink);
+        sink.messages.clear();
+        r.updateBends(et12, sink);
+        assert(sink.messages.empty());
+        r.updateBends([](int) { return 440.f * std::pow(2.f, 0.25f / 12.f); }, sink);
+        assert(sink.messages.size() == 1 && sink.messages[0].status == 0xe0);
+        sink.messages.clear();
+        r.allNotesOff(sink);
+        assert(sink.messages.size() == 1 && r.getNumActiveNotes() == 0);
+    }
+
+    return 0;
+}
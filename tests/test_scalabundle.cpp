@@ -0,0 +1,82 @@
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../Source/ScalaBundle.h"
+
+// run from the repository root
+static std::vector<char> readBundle() {
+    std::ifstream in("Resources/scala_bundle_00_v1.bin", std::ios::binary);
+    assert(in);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static int columnIndex(const ScalaBundle& b, std::string_view name) {
+    for(int i = 0; i < b.getNumColumns(); i++) {
+        if(b.getColumn(i).name == name) {
+            return i;
+        }
+    }
+    assert(false);
+    return -1;
+}
+
+int main() {
+    auto const data = readBundle();
+    ScalaBundle b(data.data(), data.size());
+    assert(b.isValid());
+    assert(b.getNumColumns() == 9);
+    assert(b.getNumEntries() == 5158);
+
+    // columns, same as the xml
+    auto const scala = b.getColumn(7);
+    assert(scala.name == "Scala" && scala.columnId == 8 && scala.width == 250);
+    assert(scala.visible == 1 && scala.editable == 0 && scala.sortable == 1);
+    assert(b.getColumn(1).name == "Icon" && b.getColumn(1).sortable == 0);
+    auto const scl = columnIndex(b, "scl");
+    auto const npo = columnIndex(b, "NPO");
+    auto const period = columnIndex(b, "Period");
+
+    // first entry: ennea45.scl, all cents, ending in 2/1
+    assert(b.getID(0) == 1);
+    assert(b.getText(0, scl) == "ennea45.scl");
+    assert(b.getText(0, npo) == "45");
+    assert(b.getText(0, period) == "2.0");
+    assert(b.getFileName(0) == "! ennea45.scl");
+    assert(b.getSclDescription(0) == "! ennea45.scl\n!\nEnnealimmal-45, in a 7-limit least-squares tuning, g=48.999, G.W. Smith\n!\n");
+    assert(b.getNumDegrees(0) == 45);
+    auto const d0 = b.getDegree(0, 0);
+    assert(!d0.isRatio && d0.cents == 35.335);
+    auto const d44 = b.getDegree(0, 44);
+    assert(d44.isRatio && d44.numerator == 2 && d44.denominator == 1);
+
+    // third entry: fokker_12.scl, all ratios
+    assert(b.getID(2) == 3);
+    assert(b.getText(2, scl) == "fokker_12.scl");
+    auto const d2 = b.getDegree(2, 0);
+    assert(d2.isRatio && d2.numerator == 15 && d2.denominator == 14);
+
+    // every entry: the last degree is the period
+    for(int e = 0; e < b.getNumEntries(); e++) {
+        auto const n = b.getNumDegrees(e);
+        assert(n > 0);
+        auto const last = b.getDegree(e, n - 1);
+        auto const ratio = last.isRatio ? double(last.numerator) / double(last.denominator) : std::pow(2.0, last.cents / 1200.0);
+        assert(std::fabs(ratio - std::stod(std::string(b.getText(e, period)))) < 1e-3 * ratio);
+    }
+
+    // not a bundle
+    {
+        std::vector<char> bad(data);
+        bad[0] = 'X';
+        assert(!ScalaBundle(bad.data(), bad.size()).isValid());
+        assert(!ScalaBundle(data.data(), 40).isValid());
+        assert(!ScalaBundle(data.data(), data.size() - 1).isValid());
+        assert(!ScalaBundle(nullptr, 0).isValid());
+    }
+
+    return 0;
+}
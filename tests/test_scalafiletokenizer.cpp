@@ -0,0 +1,105 @@
+#include <cassert>
+#include <string>
+
+#include "../Source/ScalaFileTokenizer.h"
+
+using T = ScalaFileTokenizer;
+
+static T::Error sclError(std::string_view text) {
+    T::Scl scl;
+    T::Error error;
+    assert(!T::parseScl(text, scl, error));
+    return error;
+}
+
+static T::Error kbmError(std::string_view text) {
+    T::Kbm kbm;
+    T::Error error;
+    assert(!T::parseKbm(text, kbm, error));
+    return error;
+}
+
+int main() {
+    // tokens
+    {
+        T::Degree d;
+        assert(T::parseDegree("701.955", d) && !d.isRatio && d.cents == 701.955);
+        assert(T::parseDegree("3/2", d) && d.isRatio && d.numerator == 3 && d.denominator == 2);
+        assert(T::parseDegree("5", d) && d.isRatio && d.numerator == 5 && d.denominator == 1);
+        assert(T::parseDegree("-5.", d) && d.cents == -5);
+        assert(!T::parseDegree("3/0", d));
+        assert(!T::parseDegree("0", d));
+        assert(!T::parseDegree("3/", d));
+        assert(!T::parseDegree("abc", d));
+        assert(!T::parseDegree("1.2.3", d));
+        assert(!T::parseDegree("99999999999999999999999/1", d)); // overflow
+        unsigned long long u = 0;
+        assert(T::parseUnsigned("18446744073709551615", u) && u == 18446744073709551615ull);
+        assert(!T::parseUnsigned("18446744073709551616", u));
+        int i = 0;
+        assert(T::parseInt("-12", i) && i == -12);
+        assert(!T::parseInt("1x", i));
+        double x = 0;
+        assert(T::parseDouble("440.0", x) && x == 440.0);
+        assert(!T::parseDouble("nan", x));
+    }
+
+    // scl: comments, description, cents, ratios, integers, trailing text, CRLF
+    {
+        T::Scl scl;
+        T::Error error;
+        auto const text = "! test.scl\r\n!\r\nA test scale\r\n 3\r\n!\r\n100.0 cents\r\n5/4\r\n2 octave\r\n";
+        assert(T::parseScl(text, scl, error));
+        assert(scl.fileName == "! test.scl");
+        assert(scl.description == "! test.scl\n!\nA test scale\n!\n");
+        assert(scl.content == "! test.scl!A test scale 3!100.0 cents5/42 octave");
+        assert(scl.count == 3 && scl.degrees.size() == 3);
+        assert(!scl.degrees[0].isRatio && scl.degrees[0].cents == 100.0);
+        assert(scl.degrees[1].numerator == 5 && scl.degrees[1].denominator == 4);
+        assert(scl.degrees[2].numerator == 2 && scl.degrees[2].denominator == 1);
+    }
+
+    // scl: blank description, no trailing line feed, default file name
+    {
+        T::Scl scl;
+        T::Error error;
+        assert(T::parseScl("\n1\n\n2/1", scl, error));
+        assert(scl.fileName == "placeholder.scl" && scl.description.empty());
+        assert(scl.degrees.size() == 1);
+    }
+
+    // scl errors, with line numbers
+    {
+        assert(sclError("").line == 0);
+        assert(sclError("desc\n2\n3/2\nfoo\n").line == 4);
+        assert(sclError("desc\n3\n3/2\n2/1\n").toString() == "line 4: expected 3 notes, found 2");
+        assert(sclError("desc\nmany\n").line == 2);
+        assert(sclError("! only comments\n").toString() == "line 1: missing the number of notes");
+        assert(sclError("desc\n1\n184467440737095516160/1\n").line == 3);
+    }
+
+    // kbm: x entries, padding
+    {
+        T::Kbm kbm;
+        T::Error error;
+        auto const text = "! test.kbm\r\n4\r\n0\r\n127\r\n60\r\n69\r\n440.0\r\n3\r\n0\r\nx\r\n2\r\n";
+        assert(T::parseKbm(text, kbm, error));
+        assert(kbm.mapSize == 4 && kbm.firstNote == 0 && kbm.lastNote == 127);
+        assert(kbm.middleNote == 60 && kbm.referenceNote == 69 && kbm.referenceFrequency == 440.0);
+        assert(kbm.octaveDegree == 3);
+        assert(kbm.mapping.size() == 4);
+        assert(kbm.mapping[0] == 0 && kbm.mapping[1] == T::kbmNonEntry && kbm.mapping[2] == 2);
+        assert(kbm.mapping[3] == T::kbmNonEntry);
+    }
+
+    // kbm errors
+    {
+        assert(kbmError("1\n0\n127\n60\n69\n440.0\n1\n0\n1\n").toString() == "line 9: more than 1 mapping entries");
+        assert(kbmError("0\n0\n127\n60\n69\n-440.0\n1\n").line == 6);
+        assert(kbmError("129\n").line == 1);
+        assert(kbmError("1\n0\n127\n").toString() == "line 3: missing header fields");
+        assert(kbmError("1\n0\n127\n60\n69\n440.0\n1\ny\n").toString() == "line 8: invalid mapping entry 'y'");
+    }
+
+    return 0;
+}
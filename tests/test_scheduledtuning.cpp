@@ -0,0 +1,84 @@
+#include <atomic>
+#include <cassert>
+#include <thread>
+
+#include "../Source/ScheduledTuning.h"
+
+static TuningSnapshot filled(float f) {
+    TuningSnapshot s;
+    s.frequencies.fill(f);
+    return s;
+}
+
+int main() {
+    // default is 12ET, A69 = 440, with nothing pending
+    {
+        ScheduledTuning tuning;
+        assert(std::fabs(tuning.getFrequency(69) - 440.f) < 1e-3f);
+        assert(!tuning.applyPending());
+        assert(tuning.getFrequency(200) == tuning.getFrequency(127));
+    }
+
+    // a change is played from the next block, not before
+    {
+        ScheduledTuning tuning;
+        tuning.schedule(filled(100.f));
+        assert(std::fabs(tuning.getFrequency(69) - 440.f) < 1e-3f);
+        assert(tuning.applyPending());
+        assert(tuning.getFrequency(69) == 100.f);
+        assert(!tuning.applyPending());
+        assert(tuning.getFrequency(69) == 100.f);
+    }
+
+    // several changes between two blocks: the last one wins
+    {
+        ScheduledTuning tuning;
+        for(int i = 1; i <= 20; i++) {
+            tuning.schedule(filled(static_cast<float>(i)));
+        }
+        assert(tuning.applyPending());
+        assert(tuning.getFrequency(0) == 20.f);
+        assert(!tuning.applyPending());
+    }
+
+    // filter notes follow the applied snapshot
+    {
+        ScheduledTuning tuning;
+        auto s = filled(100.f);
+        s.filterNotes.set(61);
+        tuning.schedule(s);
+        assert(!tuning.getFilterNote(61));
+        tuning.applyPending();
+        assert(tuning.getFilterNote(61) && !tuning.getFilterNote(60));
+    }
+
+    // the audio thread never plays a half-written table, and ends on the last change, while the writer schedules continuously
+    {
+        ScheduledTuning tuning;
+        tuning.schedule(filled(0.5f));
+        tuning.applyPending();
+        std::atomic<bool> done {false};
+        constexpr int numChanges = 20000;
+        std::thread writer([&]() {
+            for(int i = 1; i <= numChanges; i++) {
+                tuning.schedule(filled(static_cast<float>(i)));
+            }
+            done = true;
+        });
+        float last = 0.f;
+        while(!done) {
+            tuning.applyPending();
+            auto const f = tuning.getFrequency(0);
+            for(unsigned long nn = 1; nn < 128; nn++) {
+                assert(tuning.getFrequency(nn) == f);
+            }
+            assert(f >= last);
+            last = f;
+        }
+        writer.join();
+        tuning.applyPending();
+        assert(tuning.getFrequency(0) == static_cast<float>(numChanges));
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <string>
+
+#include "../Source/SynthParams.h"
+
+int main() {
+    using P = SynthParams;
+
+    // every parameter has a unique ID
+    std::map<std::string, std::atomic<float>> raw;
+    for(size_t i = 0; i < P::NumParams; i++) {
+        auto const* id = P::getParameterID(static_cast<P::ID>(i));
+        assert(std::strncmp(id, "SYNTH", 5) == 0);
+        raw[id] = 0.f;
+    }
+    assert(raw.size() == P::NumParams);
+    assert(std::string(P::getParameterID(P::Voices)) == "SYNTHVOICES");
+    assert(std::string(P::getParameterID(P::ReverbFreeze)) == "SYNTHREVERBFREEZE");
+    assert(P::isSmoothed(P::FilterCutoff));
+    assert(!P::isSmoothed(P::Osc1));
+
+    P params;
+    assert(!params.isResolved());
+    raw["SYNTHVOICES"] = 16.f;
+    raw["SYNTHFILTERCUTOFF"] = 20000.f;
+    raw["SYNTHOSC1PITCH"] = -12.f;
+    raw["SYNTHFILTERRESONANCE"] = 0.1f;
+    params.resolve([&](const char* id) { return &raw.at(id); });
+    assert(params.isResolved());
+
+    // the first update jumps to every value
+    auto const all = params.update(0.01f);
+    for(size_t i = 0; i < P::NumParams; i++) assert(all & P::bit(static_cast<P::ID>(i)));
+    assert((all >> P::NumParams) == 0);
+    assert(params.getInt(P::Voices) == 16);
+    assert(params.get(P::FilterCutoff) == 20000.f);
+    assert(params.getInt(P::Osc1Pitch) == -12);
+
+    // no motion, no work
+    assert(params.update(0.01f) == 0);
+    assert(params.update(0.001f) == 0);
+
+    // a step: discrete parameters jump, continuous ones are smoothed
+    raw["SYNTHOSC2"] = 2.f;
+    raw["SYNTHFILTERCUTOFF"] = 1000.f;
+    auto changed = params.update(0.01f);
+    assert(changed == (P::bit(P::Osc2) | P::bit(P::FilterCutoff)));
+    assert(changed & P::oscillator2Mask);
+    assert((changed & P::oscillator1Mask) == 0);
+    assert(params.getInt(P::Osc2) == 2);
+    auto const expected = 20000.f + (1.f - std::exp(-0.01f / P::smoothingSeconds)) * (1000.f - 20000.f);
+    assert(std::fabs(params.get(P::FilterCutoff) - expected) < 0.01f);
+
+    // smoothing settles, with the same time constant for any block size
+    size_t blocks = 1;
+    while(params.update(0.01f) != 0) blocks++;
+    assert(params.get(P::FilterCutoff) == 1000.f);
+    raw["SYNTHFILTERCUTOFF"] = 20000.f;
+    params.update(0.01f);
+    while(params.update(0.01f) != 0) {}
+    raw["SYNTHFILTERCUTOFF"] = 1000.f;
+    size_t smallBlocks = 0;
+    while(params.update(0.001f) != 0) smallBlocks++;
+    assert(params.get(P::FilterCutoff) == 1000.f);
+    assert(blocks > 10 && blocks < 40); // about 0.25 s
+    assert(smallBlocks >= 10 * blocks - 10 && smallBlocks <= 10 * blocks + 10);
+
+    // invalidate pushes everything again
+    params.invalidate();
+    assert(params.update(0.01f) == all);
+
+    // apply: only the masked parts are pushed; the bank accepts every value
+    OscillatorBank bank;
+    params.applyOscillators(bank, all);
+    params.applyFilter(bank, all);
+    params.applyOscillators(bank, 0);
+
+    return 0;
+}
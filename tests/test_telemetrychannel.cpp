@@ -0,0 +1,78 @@
+#include <cassert>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "../Source/TelemetryChannel.h"
+
+// every field of a frame is its sequence number, so a torn frame is detectable
+struct Frame {
+    std::array<uint64_t, 64> values {};
+    bool isConsistent(uint64_t sequence) const {
+        for(auto v : values) {
+            if(v != sequence) return false;
+        }
+        return true;
+    }
+};
+
+int main() {
+    // single thread
+    {
+        TelemetryChannel<Frame> channel;
+        assert(!channel.update());
+        assert(channel.getSequence() == 0);
+        assert(channel.get().isConsistent(0));
+
+        auto& f = channel.beginWrite();
+        f.values.fill(1);
+        channel.publish();
+        assert(channel.update());
+        assert(channel.getSequence() == 1);
+        assert(channel.get().isConsistent(1));
+        assert(!channel.update()); // nothing new
+        assert(channel.getSequence() == 1);
+
+        // the reader sees the latest frame; the ones in between are dropped
+        for(uint64_t s = 2; s <= 5; s++) {
+            Frame g;
+            g.values.fill(s);
+            channel.publish(g);
+        }
+        assert(channel.update());
+        assert(channel.getSequence() == 5);
+        assert(channel.get().isConsistent(5));
+        assert(!channel.update());
+    }
+
+    // one writer, one reader: frames are never torn and never go backwards
+    {
+        TelemetryChannel<Frame> channel;
+        constexpr uint64_t numFrames = 200000;
+        std::atomic<bool> done {false};
+        std::thread writer([&]() {
+            for(uint64_t s = 1; s <= numFrames; s++) {
+                channel.beginWrite().values.fill(s);
+                channel.publish();
+            }
+            done = true;
+        });
+        uint64_t last = 0;
+        size_t reads = 0;
+        while(!done || last < numFrames) {
+            if(channel.update()) {
+                auto const sequence = channel.getSequence();
+                assert(sequence > last);
+                assert(channel.get().isConsistent(sequence));
+                last = sequence;
+                reads++;
+            }
+        }
+        writer.join();
+        assert(last == numFrames);
+        assert(reads > 0);
+    }
+
+    return 0;
+}
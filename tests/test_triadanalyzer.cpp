@@ -0,0 +1,86 @@
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "../Source/TriadAnalyzer.h"
+
+using Triads = std::vector<std::tuple<unsigned long, unsigned long, unsigned long>>;
+
+static Triads toTuples(const std::vector<PythagoreanMeans>& triads) {
+    Triads retVal;
+    for(auto t : triads) {
+        retVal.emplace_back(t.getRoot(), t.getThird(), t.getFifth());
+    }
+    return retVal;
+}
+
+// the cubic search, without the period wrap
+static void reference(const std::vector<float>& f, Triads& major, Triads& minor) {
+    auto const npo = f.size();
+    for(unsigned long i = 0; i < npo; i++) {
+        for(unsigned long j = i + 2; j < npo; j++) {
+            auto const m = (f[i] + f[j]) / 2;
+            auto const h = 2 * (f[i] * f[j]) / (f[i] + f[j]);
+            auto const mOK = m / f[i] > 9.f/8.f && m / f[i] < 4.f/3.f;
+            auto const hOK = h / f[i] > 9.f/8.f && h / f[i] < 4.f/3.f;
+            for(unsigned long k = i + 1; k < j; k++) {
+                if(mOK && fabsf(m - f[k]) < TriadAnalyzer::tolerance) {
+                    major.emplace_back(i, k, j);
+                }
+                if(hOK && fabsf(h - f[k]) < TriadAnalyzer::tolerance) {
+                    minor.emplace_back(i, k, j);
+                }
+            }
+        }
+    }
+}
+
+int main() {
+    // 4:5:6 is proportional, 10:12:15 is subcontrary
+    {
+        TriadAnalyzer ta;
+        ta.analyze({1.f, 5.f/4.f, 4.f/3.f, 3.f/2.f});
+        auto const major = toTuples(ta.getProportionalTriads());
+        assert(major.size() == 1 && major[0] == std::make_tuple(0UL, 1UL, 3UL));
+
+        TriadAnalyzer tb;
+        tb.analyze({1.f, 6.f/5.f, 3.f/2.f});
+        auto const minor = toTuples(tb.getSubcontraryTriads());
+        assert(minor.size() == 1 && minor[0] == std::make_tuple(0UL, 1UL, 2UL));
+        assert(tb.getProportionalTriads().empty());
+
+        // fewer than 3 notes
+        tb.analyze({1.f, 1.5f});
+        assert(tb.getSubcontraryTriads().empty() && tb.getProportionalTriads().empty());
+    }
+
+    // same triads, in the same order, as the cubic search: sorted and unsorted scales
+    {
+        std::mt19937 rng(1);
+        std::uniform_int_distribution<int> harmonic(8, 64);
+        TriadAnalyzer ta;
+        for(int trial = 0; trial < 200; trial++) {
+            std::vector<float> f;
+            auto const n = 3 + trial % 40;
+            for(int i = 0; i < n; i++) {
+                auto h = static_cast<float>(harmonic(rng));
+                while(h >= 16.f) {
+                    h *= 0.5f;
+                }
+                f.push_back(h / 8.f);
+            }
+            if(trial % 2 == 0) {
+                std::sort(f.begin(), f.end());
+            }
+            Triads major, minor;
+            reference(f, major, minor);
+            ta.analyze(f);
+            assert(toTuples(ta.getProportionalTriads()) == major);
+            assert(toTuples(ta.getSubcontraryTriads()) == minor);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <atomic>
+#include <cassert>
+#include <thread>
+
+#include "../Source/TuningSnapshot.h"
+
+int main() {
+    // default is 12ET, A69 = 440
+    {
+        TuningSnapshotBuffer buffer;
+        assert(std::fabs(buffer.getFrequency(69) - 440.f) < 1e-3f);
+        assert(std::fabs(buffer.getFrequency(81) - 880.f) < 1e-2f);
+        assert(buffer.getNPO() == 12);
+        assert(!buffer.getFilterNote(60));
+
+        // out of range note numbers are clamped
+        assert(buffer.getFrequency(200) == buffer.getFrequency(127));
+    }
+
+    // publish replaces the whole snapshot
+    {
+        TuningSnapshotBuffer buffer;
+        TuningSnapshot s;
+        s.frequencies.fill(100.f);
+        s.filterNotes.set(61);
+        s.npo = 7;
+        s.period = 3.f;
+        buffer.publish(s);
+        assert(buffer.getFrequency(0) == 100.f && buffer.getFrequency(127) == 100.f);
+        assert(buffer.getFilterNote(61) && !buffer.getFilterNote(60));
+        assert(buffer.getNPO() == 7 && buffer.getPeriod() == 3.f);
+        TuningSnapshot d;
+        buffer.read(d);
+        assert(d.frequencies == s.frequencies && d.filterNotes == s.filterNotes);
+    }
+
+    // a reader never sees a half-written table while a writer publishes continuously
+    {
+        TuningSnapshotBuffer buffer;
+        std::atomic<bool> done {false};
+        std::thread writer([&]() {
+            TuningSnapshot s;
+            for(int i = 1; i <= 20000; i++) {
+                s.frequencies.fill(static_cast<float>(i));
+                s.npo = static_cast<unsigned long>(1000 + i);
+                buffer.publish(s);
+            }
+            done = true;
+        });
+        TuningSnapshot d;
+        while(!done) {
+            buffer.read(d);
+            if(d.npo < 1000) {
+                continue; // the default 12ET snapshot
+            }
+            for(auto f : d.frequencies) {
+                assert(f == d.frequencies[0]);
+            }
+            assert(static_cast<float>(d.npo - 1000) == d.frequencies[0]);
+        }
+        writer.join();
+        assert(buffer.getFrequency(0) == 20000.f);
+    }
+
+    // a morph snapshot is interpolated at the morph position when it is read
+    {
+        TuningSnapshotBuffer buffer;
+        float A[MorphPath::numNotes];
+        float B[MorphPath::numNotes];
+        for(size_t i = 0; i < MorphPath::numNotes; i++) {
+            A[i] = 100.f;
+            B[i] = 400.f;
+        }
+        TuningSnapshot s;
+        s.frequencies.fill(100.f);
+        s.morphIsEnabled = true;
+        s.morphInterpolation = MorphPath::Interpolation::Log2;
+        s.morphPath.setEndpoints(A, B);
+        buffer.publish(s);
+
+        // no position source: the published frequencies
+        assert(buffer.getFrequency(60) == 100.f);
+
+        std::atomic<float> position {0.5f};
+        buffer.setMorphPositionSource(&position);
+        assert(std::fabs(buffer.getFrequency(60) - 200.f) < 1e-3f);
+        position = 1.f;
+        assert(buffer.getFrequency(60) == 400.f);
+
+        // not a morph
+        s.morphIsEnabled = false;
+        buffer.publish(s);
+        assert(buffer.getFrequency(60) == 100.f);
+    }
+
+    return 0;
+}
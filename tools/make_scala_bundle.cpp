@@ -0,0 +1,258 @@
+// Generates the binary scala bundle (Resources/scala_bundle_00_v1.bin) from the xml bundle
+// (Resources/scala_bundle_00_v0.xml).  See Source/ScalaBundleFormat.h for the layout.
+//
+// The .scl text of every entry is parsed here, with ScalaFileTokenizer, so the plugin never has to.
+// An entry that does not parse is an error.
+//
+// usage: ./tools/make_scala_bundle [in.xml, default Resources/scala_bundle_00_v0.xml] [out.bin, default Resources/scala_bundle_00_v1.bin]
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../Source/ScalaBundleFormat.h"
+#include "../Source/ScalaFileTokenizer.h"
+
+using F = ScalaBundleFormat;
+using Attributes = std::vector<std::pair<std::string, std::string>>;
+
+[[noreturn]] static void fail(const std::string& message) {
+    std::fprintf(stderr, "make_scala_bundle: %s\n", message.c_str());
+    std::exit(1);
+}
+
+// xml
+
+static void appendUTF8(std::string& s, unsigned long c) {
+    if(c < 0x80) {
+        s += char(c);
+    } else if(c < 0x800) {
+        s += char(0xC0 | (c >> 6));
+        s += char(0x80 | (c & 0x3F));
+    } else if(c < 0x10000) {
+        s += char(0xE0 | (c >> 12));
+        s += char(0x80 | ((c >> 6) & 0x3F));
+        s += char(0x80 | (c & 0x3F));
+    } else {
+        s += char(0xF0 | (c >> 18));
+        s += char(0x80 | ((c >> 12) & 0x3F));
+        s += char(0x80 | ((c >> 6) & 0x3F));
+        s += char(0x80 | (c & 0x3F));
+    }
+}
+
+// the entities XmlDocument decodes
+static std::string decodeEntities(const std::string& in) {
+    std::string out;
+    for(size_t i = 0; i < in.size(); i++) {
+        if(in[i] != '&') {
+            out += in[i];
+            continue;
+        }
+        auto const semi = in.find(';', i);
+        if(semi == std::string::npos) {
+            fail("unterminated entity: " + in.substr(i, 16));
+        }
+        auto const name = in.substr(i + 1, semi - i - 1);
+        if(name == "amp") out += '&';
+        else if(name == "lt") out += '<';
+        else if(name == "gt") out += '>';
+        else if(name == "quot") out += '"';
+        else if(name == "apos") out += '\'';
+        else if(name.size() > 2 && name[0] == '#' && (name[1] == 'x' || name[1] == 'X')) appendUTF8(out, std::stoul(name.substr(2), nullptr, 16));
+        else if(name.size() > 1 && name[0] == '#') appendUTF8(out, std::stoul(name.substr(1)));
+        else fail("unknown entity: &" + name + ";");
+        i = semi;
+    }
+
+    return out;
+}
+
+// attributes of every <tag .../> element, in document order
+static std::vector<Attributes> elements(const std::string& xml, const std::string& tag) {
+    std::vector<Attributes> retVal;
+    auto const open = "<" + tag + " ";
+    for(auto pos = xml.find(open); pos != std::string::npos; pos = xml.find(open, pos)) {
+        pos += open.size();
+        Attributes attributes;
+        while(true) {
+            while(pos < xml.size() && std::isspace(static_cast<unsigned char>(xml[pos]))) pos++;
+            if(xml.compare(pos, 2, "/>") == 0 || xml.compare(pos, 1, ">") == 0) break;
+            auto const eq = xml.find('=', pos);
+            if(eq == std::string::npos || (xml[eq + 1] != '"' && xml[eq + 1] != '\'')) {
+                fail("malformed <" + tag + "> near offset " + std::to_string(pos));
+            }
+            auto const end = xml.find(xml[eq + 1], eq + 2);
+            if(end == std::string::npos) {
+                fail("unterminated attribute in <" + tag + "> near offset " + std::to_string(pos));
+            }
+            attributes.emplace_back(xml.substr(pos, eq - pos), decodeEntities(xml.substr(eq + 2, end - eq - 2)));
+            pos = end + 1;
+        }
+        retVal.push_back(std::move(attributes));
+    }
+
+    return retVal;
+}
+
+static std::string attribute(const Attributes& attributes, const std::string& name) {
+    for(auto& [n, v] : attributes) {
+        if(n == name) {
+            return v;
+        }
+    }
+
+    return "";
+}
+
+// writer
+
+class Writer {
+public:
+    // interned: each distinct string is stored once
+    uint32_t intern(const std::string& s) {
+        auto const it = _offsets.find(s);
+        if(it != _offsets.end()) {
+            return it->second;
+        }
+        auto const offset = static_cast<uint32_t>(strings.size());
+        strings += s;
+        _offsets.emplace(s, offset);
+
+        return offset;
+    }
+
+    void putText(std::vector<uint8_t>& out, const std::string& s) {
+        auto const offset = intern(s);
+        putU32(out, offset);
+        putU32(out, static_cast<uint32_t>(s.size()));
+    }
+
+    static void putU32(std::vector<uint8_t>& out, uint32_t v) {
+        uint8_t b[4];
+        F::writeU32(b, v);
+        out.insert(out.end(), b, b + 4);
+    }
+
+    static void putU64(std::vector<uint8_t>& out, uint64_t v) {
+        uint8_t b[8];
+        F::writeU64(b, v);
+        out.insert(out.end(), b, b + 8);
+    }
+
+    std::string strings;
+
+private:
+    std::map<std::string, uint32_t> _offsets;
+};
+
+int main(int argc, char* argv[]) {
+    std::string const in_path = argc > 1 ? argv[1] : "Resources/scala_bundle_00_v0.xml";
+    std::string const out_path = argc > 2 ? argv[2] : "Resources/scala_bundle_00_v1.bin";
+    std::ifstream in(in_path, std::ios::binary);
+    if(!in) {
+        fail("can't open " + in_path);
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    auto const xml = ss.str();
+
+    auto const column_elements = elements(xml, "COLUMN");
+    auto const scala_elements = elements(xml, "SCALA");
+    if(column_elements.empty() || scala_elements.empty()) {
+        fail(in_path + " has no COLUMN or SCALA elements");
+    }
+
+    Writer w;
+    auto const num_columns = static_cast<uint32_t>(column_elements.size());
+    std::vector<uint8_t> columns, entries, degrees, kinds, ratios;
+    std::vector<std::string> column_names;
+    for(auto& c : column_elements) {
+        column_names.push_back(attribute(c, "name"));
+        w.putText(columns, column_names.back());
+        Writer::putU32(columns, static_cast<uint32_t>(std::stoi(attribute(c, "columnId"))));
+        Writer::putU32(columns, static_cast<uint32_t>(std::stoi(attribute(c, "width"))));
+        columns.push_back(static_cast<uint8_t>(std::stoi(attribute(c, "visible"))));
+        columns.push_back(static_cast<uint8_t>(std::stoi(attribute(c, "editable"))));
+        columns.push_back(static_cast<uint8_t>(std::stoi(attribute(c, "sortable"))));
+        columns.push_back(0);
+    }
+
+    uint32_t num_degrees = 0;
+    for(auto& e : scala_elements) {
+        auto const id = attribute(e, "ID");
+        ScalaFileTokenizer::Scl scl;
+        ScalaFileTokenizer::Error error;
+        if(!ScalaFileTokenizer::parseScl(attribute(e, "Scala"), scl, error)) {
+            fail("ID " + id + ": " + error.toString());
+        }
+        Writer::putU32(entries, static_cast<uint32_t>(std::stoi(id)));
+        Writer::putU32(entries, num_degrees);
+        Writer::putU32(entries, static_cast<uint32_t>(scl.degrees.size()));
+        for(auto& name : column_names) {
+            w.putText(entries, attribute(e, name));
+        }
+        w.putText(entries, scl.fileName);
+        w.putText(entries, scl.description);
+        for(auto& d : scl.degrees) {
+            if(!d.isRatio) {
+                kinds.push_back(F::Cents);
+                Writer::putU64(degrees, F::doubleToBits(d.cents));
+            } else if(d.numerator <= UINT32_MAX && d.denominator <= UINT32_MAX) {
+                kinds.push_back(F::Ratio32);
+                Writer::putU32(degrees, static_cast<uint32_t>(d.numerator));
+                Writer::putU32(degrees, static_cast<uint32_t>(d.denominator));
+            } else {
+                kinds.push_back(F::Ratio64);
+                Writer::putU64(degrees, ratios.size() / F::ratioSize);
+                Writer::putU64(ratios, d.numerator);
+                Writer::putU64(ratios, d.denominator);
+            }
+        }
+        num_degrees += static_cast<uint32_t>(scl.degrees.size());
+    }
+
+    // header
+    auto const columns_offset = F::headerSize;
+    auto const entries_offset = columns_offset + static_cast<uint32_t>(columns.size());
+    auto const degrees_offset = entries_offset + static_cast<uint32_t>(entries.size());
+    kinds.resize((kinds.size() + 3) & ~size_t(3));
+    auto const kinds_offset = degrees_offset + static_cast<uint32_t>(degrees.size());
+    auto const ratios_offset = kinds_offset + static_cast<uint32_t>(kinds.size());
+    auto const strings_offset = ratios_offset + static_cast<uint32_t>(ratios.size());
+    std::vector<uint8_t> out(F::headerSize);
+    std::memcpy(out.data() + F::Magic, F::magic, sizeof(F::magic));
+    F::writeU32(out.data() + F::Version, F::version);
+    F::writeU32(out.data() + F::NumColumns, num_columns);
+    F::writeU32(out.data() + F::NumEntries, static_cast<uint32_t>(scala_elements.size()));
+    F::writeU32(out.data() + F::EntryStride, F::entryStrideForColumns(num_columns));
+    F::writeU32(out.data() + F::ColumnsOffset, columns_offset);
+    F::writeU32(out.data() + F::EntriesOffset, entries_offset);
+    F::writeU32(out.data() + F::DegreesOffset, degrees_offset);
+    F::writeU32(out.data() + F::NumDegrees, num_degrees);
+    F::writeU32(out.data() + F::DegreeKindsOffset, kinds_offset);
+    F::writeU32(out.data() + F::RatiosOffset, ratios_offset);
+    F::writeU32(out.data() + F::NumRatios, static_cast<uint32_t>(ratios.size() / F::ratioSize));
+    F::writeU32(out.data() + F::StringsOffset, strings_offset);
+    F::writeU32(out.data() + F::StringsSize, static_cast<uint32_t>(w.strings.size()));
+    out.insert(out.end(), columns.begin(), columns.end());
+    out.insert(out.end(), entries.begin(), entries.end());
+    out.insert(out.end(), degrees.begin(), degrees.end());
+    out.insert(out.end(), kinds.begin(), kinds.end());
+    out.insert(out.end(), ratios.begin(), ratios.end());
+    out.insert(out.end(), w.strings.begin(), w.strings.end());
+
+    std::ofstream os(out_path, std::ios::binary);
+    os.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+    if(!os) {
+        fail("can't write " + out_path);
+    }
+    std::printf("%s: %zu entries, %u degrees, %zu bytes of strings, %zu bytes\n", out_path.c_str(), scala_elements.size(), num_degrees, w.strings.size(), out.size());
+
+    return 0;
+}